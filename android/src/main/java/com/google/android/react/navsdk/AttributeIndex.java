@@ -0,0 +1,270 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import androidx.annotation.Nullable;
+import java.util.Collection;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Map;
+import java.util.Set;
+import java.util.TreeMap;
+import org.json.JSONArray;
+
+/**
+ * Secondary indexes over the attribute records of overlays. Every attribute key has a hash index
+ * from value to overlay ids, and sorted indexes over its numeric and string values for range
+ * lookups. All of them are updated incrementally as records change.
+ */
+public class AttributeIndex {
+  private static class KeyIndex {
+    final Map<Object, Set<String>> buckets = new HashMap<>();
+    // Share their sets with the buckets.
+    final TreeMap<Double, Set<String>> numbers = new TreeMap<>();
+    final TreeMap<String, Set<String>> strings = new TreeMap<>();
+  }
+
+  private final Map<String, KeyIndex> keyIndexes = new HashMap<>();
+
+  /** Replaces the indexed record of {@code overlayId}. Pass null to remove the overlay. */
+  public void update(
+      String overlayId,
+      @Nullable Map<String, Object> previous,
+      @Nullable Map<String, Object> attributes) {
+    if (previous != null) {
+      for (Map.Entry<String, Object> entry : previous.entrySet()) {
+        Object value = attributes != null ? attributes.get(entry.getKey()) : null;
+        update(overlayId, entry.getKey(), entry.getValue(), value);
+      }
+    }
+    if (attributes != null) {
+      for (Map.Entry<String, Object> entry : attributes.entrySet()) {
+        if (previous == null || !previous.containsKey(entry.getKey())) {
+          update(overlayId, entry.getKey(), null, entry.getValue());
+        }
+      }
+    }
+  }
+
+  /** Replaces the indexed value of attribute {@code key} of {@code overlayId}. */
+  public void update(
+      String overlayId, String key, @Nullable Object previous, @Nullable Object value) {
+    if (previous == null ? value == null : previous.equals(value)) {
+      return;
+    }
+    if (previous != null) {
+      remove(overlayId, key, previous);
+    }
+    if (value != null) {
+      add(overlayId, key, value);
+    }
+  }
+
+  public void clear() {
+    keyIndexes.clear();
+  }
+
+  /**
+   * Returns the ids that may satisfy {@code predicate}, resolved through the indexes, or null if
+   * the predicate cannot narrow the overlays down and every overlay has to be evaluated. Equality,
+   * comparisons against literals, "has", "all" and "any" of such terms are resolved; the candidates
+   * still need to be checked against the predicate.
+   */
+  @Nullable
+  public Set<String> candidatesFor(StyleExpression predicate) {
+    return candidatesForJson(predicate.getSource());
+  }
+
+  private void add(String overlayId, String key, Object value) {
+    KeyIndex index = keyIndexes.get(key);
+    if (index == null) {
+      index = new KeyIndex();
+      keyIndexes.put(key, index);
+    }
+    Set<String> ids = index.buckets.get(value);
+    if (ids == null) {
+      ids = new HashSet<>();
+      index.buckets.put(value, ids);
+      if (value instanceof Double) {
+        index.numbers.put((Double) value, ids);
+      } else if (value instanceof String) {
+        index.strings.put((String) value, ids);
+      }
+    }
+    ids.add(overlayId);
+  }
+
+  private void remove(String overlayId, String key, Object value) {
+    KeyIndex index = keyIndexes.get(key);
+    Set<String> ids = index != null ? index.buckets.get(value) : null;
+    if (ids == null) {
+      return;
+    }
+    ids.remove(overlayId);
+    if (ids.isEmpty()) {
+      index.buckets.remove(value);
+      if (value instanceof Double) {
+        index.numbers.remove(value);
+      } else if (value instanceof String) {
+        index.strings.remove(value);
+      }
+      if (index.buckets.isEmpty()) {
+        keyIndexes.remove(key);
+      }
+    }
+  }
+
+  @Nullable
+  private Set<String> candidatesForJson(@Nullable Object json) {
+    if (!(json instanceof JSONArray) || ((JSONArray) json).length() == 0) {
+      return null;
+    }
+    JSONArray expression = (JSONArray) json;
+    String op = expression.optString(0);
+
+    switch (op) {
+      case "all":
+        {
+          // Terms that cannot be resolved only widen the candidates, which are checked anyway.
+          Set<String> result = null;
+          for (int i = 1; i < expression.length(); i++) {
+            Set<String> candidates = candidatesForJson(expression.opt(i));
+            if (candidates == null) {
+              continue;
+            }
+            if (result == null) {
+              result = new HashSet<>(candidates);
+            } else {
+              result.retainAll(candidates);
+            }
+          }
+          return result;
+        }
+      case "any":
+        {
+          Set<String> result = new HashSet<>();
+          for (int i = 1; i < expression.length(); i++) {
+            Set<String> candidates = candidatesForJson(expression.opt(i));
+            if (candidates == null) {
+              return null;
+            }
+            result.addAll(candidates);
+          }
+          return result;
+        }
+      case "has":
+        {
+          if (expression.length() != 2 || !(expression.opt(1) instanceof String)) {
+            return null;
+          }
+          KeyIndex index = keyIndexes.get((String) expression.opt(1));
+          return index != null ? union(index.buckets.values()) : new HashSet<>();
+        }
+      default:
+        return candidatesForComparison(expression, op);
+    }
+  }
+
+  @Nullable
+  private Set<String> candidatesForComparison(JSONArray expression, String op) {
+    if (expression.length() != 3 || flipped(op) == null) {
+      return null;
+    }
+    String key = getKey(expression.opt(1));
+    Object literal = StyleExpression.normalize(expression.opt(2));
+    if (key == null) {
+      key = getKey(expression.opt(2));
+      literal = StyleExpression.normalize(expression.opt(1));
+      op = flipped(op);
+    }
+    if (key == null || literal == null || literal instanceof JSONArray) {
+      return null;
+    }
+
+    KeyIndex index = keyIndexes.get(key);
+    if (index == null) {
+      return new HashSet<>();
+    }
+    if (op.equals("==")) {
+      Set<String> ids = index.buckets.get(literal);
+      return ids != null ? new HashSet<>(ids) : new HashSet<>();
+    }
+    if (literal instanceof Double) {
+      return union(range(index.numbers, (Double) literal, op).values());
+    }
+    if (literal instanceof String) {
+      return union(range(index.strings, (String) literal, op).values());
+    }
+    // Booleans are not ordered.
+    return new HashSet<>();
+  }
+
+  // The part of `sorted` whose keys satisfy `key op literal`.
+  private static <K> Map<K, Set<String>> range(
+      TreeMap<K, Set<String>> sorted, K literal, String op) {
+    switch (op) {
+      case "<":
+        return sorted.headMap(literal, false);
+      case "<=":
+        return sorted.headMap(literal, true);
+      case ">":
+        return sorted.tailMap(literal, false);
+      default:
+        return sorted.tailMap(literal, true);
+    }
+  }
+
+  private static Set<String> union(Collection<Set<String>> sets) {
+    Set<String> result = new HashSet<>();
+    for (Set<String> ids : sets) {
+      result.addAll(ids);
+    }
+    return result;
+  }
+
+  // Returns the attribute key of a ["get", key] expression, or null.
+  @Nullable
+  private static String getKey(@Nullable Object json) {
+    if (!(json instanceof JSONArray)) {
+      return null;
+    }
+    JSONArray array = (JSONArray) json;
+    if (array.length() != 2 || !"get".equals(array.opt(0)) || !(array.opt(1) instanceof String)) {
+      return null;
+    }
+    return (String) array.opt(1);
+  }
+
+  // The comparison that holds with its operands swapped, e.g. 3 < x is x > 3.
+  @Nullable
+  private static String flipped(String op) {
+    switch (op) {
+      case "==":
+        return "==";
+      case "<":
+        return ">";
+      case "<=":
+        return ">=";
+      case ">":
+        return "<";
+      case ">=":
+        return "<=";
+      default:
+        return null;
+    }
+  }
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import androidx.annotation.Nullable;
+
+/**
+ * Cancellation token for {@link NavWorkerPool} tasks. A token is cancelled explicitly or when its
+ * parent is cancelled, which allows binding work to both a view's lifetime and its camera
+ * generation.
+ */
+public class CancellationToken {
+  @Nullable private final CancellationToken parent;
+  private volatile boolean cancelled;
+
+  public CancellationToken() {
+    this(null);
+  }
+
+  public CancellationToken(@Nullable CancellationToken parent) {
+    this.parent = parent;
+  }
+
+  public boolean isCancelled() {
+    return cancelled || (parent != null && parent.isCancelled());
+  }
+
+  public void cancel() {
+    cancelled = true;
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.view.Choreographer;
+
+/**
+ * Samples frame pacing with Choreographer frame callbacks. Main-thread load is estimated from how
+ * late each frame callback runs relative to its vsync, which grows when the UI thread is busy.
+ *
+ * <p>A sampler is shared by the clients of one view: calls to {@link #start()} and {@link #stop()}
+ * are balanced, and sampling runs while at least one client has started it, so idle views pay
+ * nothing.
+ */
+public class FrameSampler implements Choreographer.FrameCallback {
+  private static final double HITCH_THRESHOLD = 1.5;
+
+  /** Receives every presented frame, with its duration and vsync time. */
+  public interface FrameListener {
+    void onFrame(double frameMs, long frameTimeNanos);
+  }
+
+  /** Frame pacing summary for the frames presented since the previous window was taken. */
+  public static class Window {
+    public int frameCount;
+    public double durationMs;
+    public double averageFrameMs;
+    public double maxFrameMs;
+    /** Frames that took longer than 1.5 target frame intervals. */
+    public int hitchCount;
+    /** Estimated fraction of time the UI thread was busy, between 0 and 1. */
+    public double mainThreadLoad;
+  }
+
+  private final double targetFrameMs;
+  private boolean running = false;
+  private int startCount = 0;
+  private long lastFrameTimeNanos = 0;
+  private FrameListener frameListener;
+
+  private long windowStartNanos;
+  private int frameCount;
+  private double frameSumMs;
+  private double maxFrameMs;
+  private int hitchCount;
+  private double callbackDelaySumMs;
+
+  public FrameSampler(double refreshRate) {
+    this.targetFrameMs = 1000.0 / (refreshRate > 0 ? refreshRate : 60.0);
+  }
+
+  public double getTargetFrameMs() {
+    return targetFrameMs;
+  }
+
+  public boolean isRunning() {
+    return running;
+  }
+
+  /** Sets the optional per-frame listener, used for cumulative statistics. */
+  public void setFrameListener(FrameListener listener) {
+    frameListener = listener;
+  }
+
+  public void start() {
+    if (startCount++ > 0) {
+      return;
+    }
+    running = true;
+    lastFrameTimeNanos = 0;
+    resetWindow();
+    Choreographer.getInstance().postFrameCallback(this);
+  }
+
+  public void stop() {
+    if (startCount == 0 || --startCount > 0) {
+      return;
+    }
+    running = false;
+    Choreographer.getInstance().removeFrameCallback(this);
+  }
+
+  @Override
+  public void doFrame(long frameTimeNanos) {
+    if (!running) {
+      return;
+    }
+    if (lastFrameTimeNanos > 0) {
+      double frameMs = (frameTimeNanos - lastFrameTimeNanos) / 1e6;
+      recordFrame(frameMs);
+      if (frameListener != null) {
+        frameListener.onFrame(frameMs, frameTimeNanos);
+      }
+    }
+    callbackDelaySumMs += Math.max(0, System.nanoTime() - frameTimeNanos) / 1e6;
+    lastFrameTimeNanos = frameTimeNanos;
+    Choreographer.getInstance().postFrameCallback(this);
+  }
+
+  private void recordFrame(double frameMs) {
+    frameCount++;
+    frameSumMs += frameMs;
+    maxFrameMs = Math.max(maxFrameMs, frameMs);
+    if (frameMs > targetFrameMs * HITCH_THRESHOLD) {
+      hitchCount++;
+    }
+  }
+
+  /** Returns the summary of the current window and starts a new one. */
+  public Window takeWindow() {
+    Window window = new Window();
+    window.frameCount = frameCount;
+    window.durationMs = (System.nanoTime() - windowStartNanos) / 1e6;
+    window.averageFrameMs = frameCount > 0 ? frameSumMs / frameCount : 0;
+    window.maxFrameMs = maxFrameMs;
+    window.hitchCount = hitchCount;
+    window.mainThreadLoad =
+        window.durationMs > 0 ? Math.min(1.0, callbackDelaySumMs / window.durationMs) : 0;
+    resetWindow();
+    return window;
+  }
+
+  private void resetWindow() {
+    windowStartNanos = System.nanoTime();
+    frameCount = 0;
+    frameSumMs = 0;
+    maxFrameMs = 0;
+    hitchCount = 0;
+    callbackDelaySumMs = 0;
+  }
+}
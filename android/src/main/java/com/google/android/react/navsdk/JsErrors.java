@@ -40,4 +40,28 @@ public class JsErrors {
   public static final String INVALID_IMAGE_ERROR_CODE = "INVALID_IMAGE";
   public static final String INVALID_IMAGE_ERROR_MESSAGE =
       "Failed to load image from the provided path";
+
+  public static final String INVALID_WAYPOINTS_ERROR_CODE = "INVALID_WAYPOINTS";
+
+  public static final String INVALID_TIME_WINDOWS_ERROR_CODE = "INVALID_TIME_WINDOWS";
+
+  public static final String INVALID_EXPRESSION_ERROR_CODE = "INVALID_EXPRESSION";
+
+  public static final String INVALID_ATTRIBUTES_ERROR_CODE = "INVALID_ATTRIBUTES";
+
+  public static final String INVALID_TRACE_ERROR_CODE = "INVALID_TRACE";
+
+  public static final String NO_TRIP_PLAYBACK_ERROR_CODE = "NO_TRIP_PLAYBACK";
+  public static final String NO_TRIP_PLAYBACK_ERROR_MESSAGE =
+      "No trip playback is loaded for this view";
+
+  public static final String INVALID_DATA_SOURCE_ERROR_CODE = "INVALID_DATA_SOURCE";
+  public static final String INVALID_DATA_SOURCE_ERROR_MESSAGE =
+      "The feature store must be an existing directory";
+
+  public static final String THUMBNAIL_FAILED_ERROR_CODE = "THUMBNAIL_FAILED";
+
+  public static final String RENDER_STATS_DISABLED_ERROR_CODE = "RENDER_STATS_DISABLED";
+  public static final String RENDER_STATS_DISABLED_ERROR_MESSAGE =
+      "Render stats are not enabled for this view";
 }
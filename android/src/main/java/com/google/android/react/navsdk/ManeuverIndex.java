@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import com.facebook.react.bridge.Arguments;
+import com.facebook.react.bridge.WritableArray;
+import com.google.android.gms.maps.model.LatLng;
+import com.google.android.libraries.navigation.NavInfo;
+import com.google.android.libraries.navigation.RouteSegment;
+import com.google.android.libraries.navigation.StepInfo;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Places the steps of the current route on its geometry, so that maneuver markers can be drawn
+ * without processing the route in JS. A step's maneuver is located by its distance along the route,
+ * taken from the first nav info that reports it after a route change and kept until the next one.
+ */
+public class ManeuverIndex {
+  private static final double EARTH_RADIUS_METERS = 6371009.0;
+
+  // Nav info distances are rounded to whole meters, so a maneuver this close to a vertex of the
+  // route is placed on the vertex rather than interpolated next to it.
+  private static final double VERTEX_SNAP_METERS = 10;
+
+  private static final double[] NO_POINTS = new double[0];
+
+  // Vertices of all legs, with their distance along the whole route and their leg and index in it.
+  private double[] lats = NO_POINTS;
+  private double[] lngs = NO_POINTS;
+  private double[] meters = NO_POINTS;
+  private int[] legs = new int[0];
+  private int[] indices = new int[0];
+  private int vertexCount;
+
+  private final Map<Integer, Double> stepMeters = new HashMap<>();
+  private double[] maneuverPoints = NO_POINTS;
+
+  /** Indexes the geometry of {@code segments} and forgets the step positions of the old route. */
+  public synchronized void reset(List<RouteSegment> segments) {
+    stepMeters.clear();
+    maneuverPoints = NO_POINTS;
+
+    List<List<LatLng>> paths = new ArrayList<>();
+    int count = 0;
+    if (segments != null) {
+      for (RouteSegment segment : segments) {
+        List<LatLng> path = segment.getLatLngs();
+        paths.add(path);
+        count += path.size();
+      }
+    }
+
+    lats = new double[count];
+    lngs = new double[count];
+    meters = new double[count];
+    legs = new int[count];
+    indices = new int[count];
+    vertexCount = 0;
+    double total = 0;
+    for (int leg = 0; leg < paths.size(); leg++) {
+      List<LatLng> path = paths.get(leg);
+      for (int i = 0; i < path.size(); i++) {
+        LatLng vertex = path.get(i);
+        if (vertexCount > 0) {
+          total +=
+              distance(
+                  lats[vertexCount - 1], lngs[vertexCount - 1], vertex.latitude, vertex.longitude);
+        }
+        lats[vertexCount] = vertex.latitude;
+        lngs[vertexCount] = vertex.longitude;
+        meters[vertexCount] = total;
+        legs[vertexCount] = leg;
+        indices[vertexCount] = i;
+        vertexCount++;
+      }
+    }
+  }
+
+  /**
+   * Locates the current and remaining steps of {@code navInfo} and remembers them as the maneuver
+   * points returned by {@link #getManeuverPoints()}.
+   */
+  public synchronized void update(NavInfo navInfo) {
+    StepInfo currentStep = navInfo.getCurrentStep();
+    if (vertexCount == 0 || currentStep == null) {
+      maneuverPoints = NO_POINTS;
+      return;
+    }
+
+    // Distance travelled along the route; the route geometry is assumed to be as long as the
+    // driving distance the navigator reports for it.
+    Integer toFinalDestination = navInfo.getDistanceToFinalDestinationMeters();
+    Integer toCurrentStep = navInfo.getDistanceToCurrentStepMeters();
+    double progress =
+        Math.max(
+            0, meters[vertexCount - 1] - (toFinalDestination != null ? toFinalDestination : 0));
+
+    StepInfo[] remainingSteps = navInfo.getRemainingSteps();
+    int stepCount = 1 + (remainingSteps != null ? remainingSteps.length : 0);
+    double[] points = new double[stepCount * 6];
+    double position =
+        metersOfStep(currentStep, progress + (toCurrentStep != null ? toCurrentStep : 0));
+    appendStep(currentStep, position, points, 0);
+    for (int i = 1; i < stepCount; i++) {
+      StepInfo step = remainingSteps[i - 1];
+      position = metersOfStep(step, position + step.getDistanceFromPrevStepMeters());
+      appendStep(step, position, points, i * 6);
+    }
+    maneuverPoints = points;
+  }
+
+  /**
+   * Returns the points of the last update, packed as [stepNumber, lat, lng, legIndex, firstVertex,
+   * lastVertex, ...], where the vertex range of each step is within the leg of its maneuver.
+   */
+  public synchronized WritableArray getManeuverPoints() {
+    WritableArray array = Arguments.createArray();
+    for (double value : maneuverPoints) {
+      array.pushDouble(value);
+    }
+    return array;
+  }
+
+  public synchronized boolean hasManeuverPoints() {
+    return maneuverPoints.length > 0;
+  }
+
+  // Returns the remembered position of `step`, or remembers `position` for it. Keeping the first
+  // position stops maneuver points from moving as the rounded distances of later nav infos change.
+  private double metersOfStep(StepInfo step, double position) {
+    Double known = stepMeters.get(step.getStepNumber());
+    if (known != null) {
+      return known;
+    }
+    position = Math.min(position, meters[vertexCount - 1]);
+    stepMeters.put(step.getStepNumber(), position);
+    return position;
+  }
+
+  private void appendStep(StepInfo step, double position, double[] points, int offset) {
+    // The maneuver ends its step at the first vertex at or after it.
+    int last = Math.min(lowerBound(position), vertexCount - 1);
+    double lat = lats[last];
+    double lng = lngs[last];
+    if (last > 0 && meters[last] - position > VERTEX_SNAP_METERS) {
+      int from = last - 1;
+      if (position - meters[from] <= VERTEX_SNAP_METERS) {
+        last = from;
+        lat = lats[from];
+        lng = lngs[from];
+      } else {
+        double t = (position - meters[from]) / (meters[last] - meters[from]);
+        lat = lats[from] + (lats[last] - lats[from]) * t;
+        lng = lngs[from] + (lngs[last] - lngs[from]) * t;
+      }
+    }
+
+    // The step starts at the last vertex at or before the previous maneuver, within the same leg.
+    double startMeters = position - step.getDistanceFromPrevStepMeters();
+    int first = Math.min(Math.max(upperBound(startMeters) - 1, 0), last);
+    int firstIndex = legs[first] == legs[last] ? indices[first] : 0;
+
+    points[offset] = step.getStepNumber();
+    points[offset + 1] = lat;
+    points[offset + 2] = lng;
+    points[offset + 3] = legs[last];
+    points[offset + 4] = firstIndex;
+    points[offset + 5] = indices[last];
+  }
+
+  // Index of the first vertex whose distance is not less than `value`.
+  private int lowerBound(double value) {
+    int low = 0;
+    int high = vertexCount;
+    while (low < high) {
+      int mid = (low + high) >>> 1;
+      if (meters[mid] < value) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+
+  // Index of the first vertex whose distance is greater than `value`.
+  private int upperBound(double value) {
+    int low = 0;
+    int high = vertexCount;
+    while (low < high) {
+      int mid = (low + high) >>> 1;
+      if (meters[mid] <= value) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+
+  private static double distance(double lat1, double lng1, double lat2, double lng2) {
+    double phi1 = Math.toRadians(lat1);
+    double phi2 = Math.toRadians(lat2);
+    double dPhi = phi2 - phi1;
+    double dLambda = Math.toRadians(lng2 - lng1);
+    double h =
+        Math.sin(dPhi / 2) * Math.sin(dPhi / 2)
+            + Math.cos(phi1) * Math.cos(phi2) * Math.sin(dLambda / 2) * Math.sin(dLambda / 2);
+    return 2 * EARTH_RADIUS_METERS * Math.asin(Math.min(1, Math.sqrt(h)));
+  }
+}
@@ -15,10 +15,17 @@ package com.google.android.react.navsdk;
 
 import android.annotation.SuppressLint;
 import android.app.Activity;
+import android.graphics.Point;
+import android.graphics.RectF;
+import android.os.Handler;
+import android.os.Looper;
+import android.os.SystemClock;
+import androidx.annotation.Nullable;
 import androidx.core.util.Supplier;
 import com.facebook.react.bridge.UiThreadUtil;
 import com.google.android.gms.maps.CameraUpdateFactory;
 import com.google.android.gms.maps.GoogleMap;
+import com.google.android.gms.maps.Projection;
 import com.google.android.gms.maps.model.BitmapDescriptor;
 import com.google.android.gms.maps.model.BitmapDescriptorFactory;
 import com.google.android.gms.maps.model.CameraPosition;
@@ -36,6 +43,7 @@ import com.google.android.gms.maps.model.Polygon;
 import com.google.android.gms.maps.model.PolygonOptions;
 import com.google.android.gms.maps.model.Polyline;
 import com.google.android.gms.maps.model.PolylineOptions;
+import com.google.android.libraries.navigation.RouteSegment;
 import java.io.BufferedReader;
 import java.io.IOException;
 import java.io.InputStream;
@@ -43,12 +51,21 @@ import java.io.InputStreamReader;
 import java.net.HttpURLConnection;
 import java.net.URL;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.HashMap;
+import java.util.HashSet;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
-import java.util.concurrent.Executors;
+import java.util.Set;
+import org.json.JSONObject;
 
 public class MapViewController implements INavigationViewControllerProperties {
+  /** Called on every camera change, and once more with {@code idle} set when it settles. */
+  public interface CameraObserver {
+    void onCameraChange(boolean idle);
+  }
+
   private GoogleMap mGoogleMap;
   private Supplier<Activity> activitySupplier;
   private INavigationViewCallback mNavigationViewCallback;
@@ -60,6 +77,79 @@ public class MapViewController implements INavigationViewControllerProperties {
   private final Map<String, GroundOverlay> groundOverlayMap = new HashMap<>();
   private final Map<String, Circle> circleMap = new HashMap<>();
 
+  // Cancellation tokens for background work tied to this view and its current camera.
+  private CancellationToken viewLifetimeToken = new CancellationToken();
+  private CancellationToken cameraGenerationToken;
+
+  private QualityGovernor qualityGovernor;
+  private FrameSampler frameSampler;
+  private volatile RenderMetrics renderMetrics;
+  private final Map<String, CameraObserver> cameraObservers = new LinkedHashMap<>();
+
+  private static final String ANCHORED_VIEWS_OBSERVER_KEY = "anchoredViews";
+  @Nullable private NavAnchorLayer anchorLayer;
+
+  private static final String MARKER_STYLE_OBSERVER_KEY = "markerStyle";
+  private static final String MARKER_DECLUTTER_OBSERVER_KEY = "markerDeclutter";
+  private static final String VIEWPORT_WATCH_OBSERVER_KEY = "viewportWatch";
+  private final Map<String, Map<String, Object>> markerAttributes = new HashMap<>();
+  // Built on the first attribute query, then updated with every attribute change.
+  @Nullable private AttributeIndex markerAttributeIndex;
+  // A marker is shown only when neither its options, the style filter nor decluttering hide it.
+  private final Set<String> markersHiddenByOptions = new HashSet<>();
+  private final Set<String> markersHiddenByStyle = new HashSet<>();
+  private Set<String> markersHiddenByDeclutter = new HashSet<>();
+  private final Set<String> markersWithCustomIcon = new HashSet<>();
+  // Option values of styled markers, restored when the style is removed.
+  private final Map<String, MarkerBaseStyle> markerBaseStyles = new HashMap<>();
+  private final Map<Float, BitmapDescriptor> markerHueIcons = new HashMap<>();
+  @Nullable private MarkerStyle markerStyle;
+  private float markerStyleZoom;
+  @Nullable private MarkerDeclutter markerDeclutter;
+  private long lastDeclutterTimeMs;
+  private boolean declutterScheduled;
+  private final Handler declutterHandler = new Handler(Looper.getMainLooper());
+
+  // Full-resolution points of each polyline, drawn simplified by the quality governor's tolerance.
+  private final Map<String, List<LatLng>> polylineSourcePoints = new HashMap<>();
+  private double appliedPolylineTolerance = 0;
+
+  // Extent {minLat, minLng, maxLat, maxLng} of each polyline and polygon, computed on demand.
+  private final Map<String, double[]> polylineExtents = new HashMap<>();
+  private final Map<String, double[]> polygonExtents = new HashMap<>();
+
+  @Nullable private TripPlayback tripPlayback;
+
+  /** Receives the overlays that entered and left the visible region. */
+  public interface ViewportWatchListener {
+    void onViewportMembershipChanged(List<String> entered, List<String> left);
+  }
+
+  @Nullable private ViewportWatch viewportWatch;
+  @Nullable private ViewportWatchListener viewportWatchListener;
+  private boolean viewportWatchScheduled;
+
+  /** Receives the ids of the markers staged and evicted by the route prefetcher. */
+  public interface RoutePrefetchListener {
+    void onRoutePrefetchChanged(List<String> staged, List<String> evicted);
+  }
+
+  @Nullable private RoutePrefetcher routePrefetcher;
+
+  /** Option values of a marker captured before a style is applied to it. */
+  private static class MarkerBaseStyle {
+    float alpha;
+    float zIndex;
+    float rotation;
+    boolean tinted;
+
+    MarkerBaseStyle(Marker marker) {
+      alpha = marker.getAlpha();
+      zIndex = marker.getZIndex();
+      rotation = marker.getRotation();
+    }
+  }
+
   // Reverse mapping: native ID -> effective ID (for click event handling)
   private final Map<String, String> markerNativeIdToEffectiveId = new HashMap<>();
   private final Map<String, String> polylineNativeIdToEffectiveId = new HashMap<>();
@@ -98,6 +188,312 @@ public class MapViewController implements INavigationViewControllerProperties {
     mGoogleMap.setOnInfoWindowClickListener(
         marker -> mNavigationViewCallback.onMarkerInfoWindowTapped(marker));
     mGoogleMap.setOnMapClickListener(latLng -> mNavigationViewCallback.onMapClick(latLng));
+    mGoogleMap.setOnCameraMoveListener(
+        () -> {
+          advanceCameraGeneration();
+          notifyCameraObservers(false);
+        });
+    mGoogleMap.setOnCameraIdleListener(() -> notifyCameraObservers(true));
+  }
+
+  /** Registers a camera observer under {@code key}, replacing the previous one. */
+  public void setCameraObserver(String key, @Nullable CameraObserver observer) {
+    if (observer == null) {
+      cameraObservers.remove(key);
+    } else {
+      cameraObservers.put(key, observer);
+    }
+  }
+
+  private void notifyCameraObservers(boolean idle) {
+    if (cameraObservers.isEmpty()) {
+      return;
+    }
+    // Observers may unregister themselves while being notified.
+    for (CameraObserver observer : new ArrayList<>(cameraObservers.values())) {
+      observer.onCameraChange(idle);
+    }
+  }
+
+  /**
+   * Attaches the layer hosting the anchored React children of this view. Its anchored views are
+   * repositioned from the map projection on every camera frame, and hidden while their coordinate
+   * is off-screen.
+   */
+  public void setAnchorLayer(@Nullable NavAnchorLayer layer) {
+    if (anchorLayer != null) {
+      anchorLayer.setAnchorLayoutListener(null);
+    }
+    anchorLayer = layer;
+    if (layer == null) {
+      setCameraObserver(ANCHORED_VIEWS_OBSERVER_KEY, null);
+      return;
+    }
+
+    layer.setAnchorLayoutListener(this::layoutAnchoredViews);
+    setCameraObserver(
+        ANCHORED_VIEWS_OBSERVER_KEY,
+        idle -> {
+          List<NavAnchorView> views = layer.getAnchoredViews();
+          if (!views.isEmpty()) {
+            layoutAnchoredViews(views);
+          }
+        });
+    layoutAnchoredViews(layer.getAnchoredViews());
+  }
+
+  private void layoutAnchoredViews(List<NavAnchorView> views) {
+    if (mGoogleMap == null || anchorLayer == null || views.isEmpty()) {
+      return;
+    }
+    Projection projection = mGoogleMap.getProjection();
+    int width = anchorLayer.getWidth();
+    int height = anchorLayer.getHeight();
+    // Views within the virtualization margin around the layer stay materialized.
+    double margin = getQualityVirtualizationMargin();
+    double marginX = margin * width;
+    double marginY = margin * height;
+    for (NavAnchorView view : views) {
+      Point point =
+          projection.toScreenLocation(new LatLng(view.getLatitude(), view.getLongitude()));
+      // Cull once the view can no longer overlap the layer, whatever its anchor point is.
+      double slackX = Math.max(view.getWidth(), marginX);
+      double slackY = Math.max(view.getHeight(), marginY);
+      boolean visible =
+          point.x >= -slackX
+              && point.x <= width + slackX
+              && point.y >= -slackY
+              && point.y <= height + slackY;
+      view.placeAt(point.x, point.y, visible);
+    }
+  }
+
+  /**
+   * Projects packed {@code [lat, lng, ...]} coordinates to packed {@code [x, y, ...]} screen points
+   * in one pass. Points are divided by {@code density} to return density-independent pixels.
+   */
+  public double[] projectToScreen(double[] latLngs, float density) {
+    int count = latLngs.length / 2;
+    double[] result = new double[count * 2];
+    if (mGoogleMap == null) {
+      return result;
+    }
+    Projection projection = mGoogleMap.getProjection();
+    for (int i = 0; i < count; i++) {
+      Point point = projection.toScreenLocation(new LatLng(latLngs[2 * i], latLngs[2 * i + 1]));
+      result[2 * i] = point.x / density;
+      result[2 * i + 1] = point.y / density;
+    }
+    return result;
+  }
+
+  /**
+   * Converts packed {@code [x, y, ...]} density-independent screen points to packed {@code [lat,
+   * lng, ...]} coordinates in one pass.
+   */
+  public double[] screenToCoordinates(double[] points, float density) {
+    int count = points.length / 2;
+    double[] result = new double[count * 2];
+    if (mGoogleMap == null) {
+      return result;
+    }
+    Projection projection = mGoogleMap.getProjection();
+    for (int i = 0; i < count; i++) {
+      LatLng latLng =
+          projection.fromScreenLocation(
+              new Point(
+                  Math.round((float) points[2 * i] * density),
+                  Math.round((float) points[2 * i + 1] * density)));
+      result[2 * i] = latLng.latitude;
+      result[2 * i + 1] = latLng.longitude;
+    }
+    return result;
+  }
+
+  /**
+   * Token cancelled when this controller is released. Use it for {@link NavWorkerPool} tasks whose
+   * result is only meaningful while the view exists.
+   */
+  public CancellationToken getViewLifetimeToken() {
+    return viewLifetimeToken;
+  }
+
+  /**
+   * Starts a new view lifetime once the hosting fragment's view is recreated, so that work
+   * submitted with {@link #getViewLifetimeToken()} is no longer dropped.
+   */
+  public void renewViewLifetime() {
+    if (viewLifetimeToken.isCancelled()) {
+      viewLifetimeToken = new CancellationToken();
+    }
+  }
+
+  /**
+   * Returns a token for the current camera generation. It is cancelled as soon as the camera moves
+   * or the controller is released, so work computed for a stale viewport is dropped.
+   */
+  public CancellationToken getCameraGenerationToken() {
+    if (cameraGenerationToken == null) {
+      cameraGenerationToken = new CancellationToken(viewLifetimeToken);
+    }
+    return cameraGenerationToken;
+  }
+
+  private void advanceCameraGeneration() {
+    if (cameraGenerationToken != null) {
+      cameraGenerationToken.cancel();
+      cameraGenerationToken = null;
+    }
+  }
+
+  /**
+   * Adaptive quality governor of this view, or null when disabled. Features with quality knobs read
+   * their current values from it.
+   */
+  public QualityGovernor getQualityGovernor() {
+    return qualityGovernor;
+  }
+
+  /** Replaces the quality governor of this view, stopping the previous one. */
+  public void setQualityGovernor(QualityGovernor governor) {
+    if (qualityGovernor != null && qualityGovernor != governor) {
+      qualityGovernor.stop();
+    }
+    qualityGovernor = governor;
+    applyQualitySettings();
+  }
+
+  /**
+   * Applies the current knob values of the quality governor to the features they control. Called
+   * when the governor is replaced and after each of its adjustments.
+   */
+  public void applyQualitySettings() {
+    double tolerance = qualityGovernor != null ? qualityGovernor.getPolylineTolerance() : 0;
+    if (tolerance != appliedPolylineTolerance) {
+      appliedPolylineTolerance = tolerance;
+      for (Map.Entry<String, List<LatLng>> entry : polylineSourcePoints.entrySet()) {
+        Polyline polyline = polylineMap.get(entry.getKey());
+        if (polyline != null) {
+          polyline.setPoints(PolylineSimplifier.simplify(entry.getValue(), tolerance));
+          polylineExtents.remove(entry.getKey());
+        }
+      }
+    }
+    if (tripPlayback != null) {
+      tripPlayback.setQualityIntervals(
+          getQualityAnimationIntervalMs(), getQualityEventIntervalMs());
+    }
+    // Cluster radius and virtualization margin take effect on the next pass.
+    setNeedsDeclutter();
+    if (anchorLayer != null) {
+      layoutAnchoredViews(anchorLayer.getAnchoredViews());
+    }
+  }
+
+  /** Minimum interval between high-frequency view events set by the quality governor, or 0. */
+  public long getQualityEventIntervalMs() {
+    double rate = qualityGovernor != null ? qualityGovernor.getEventRate() : 0;
+    return rate > 0 ? Math.round(1000 / rate) : 0;
+  }
+
+  /** Minimum interval between frames of native animations set by the quality governor, or 0. */
+  public long getQualityAnimationIntervalMs() {
+    double rate = qualityGovernor != null ? qualityGovernor.getAnimationFrameRate() : 0;
+    return rate > 0 ? Math.round(1000 / rate) : 0;
+  }
+
+  private double getQualityClusterRadius() {
+    return qualityGovernor != null ? Math.max(0, qualityGovernor.getClusterRadius()) : 0;
+  }
+
+  private double getQualityVirtualizationMargin() {
+    return qualityGovernor != null ? Math.max(0, qualityGovernor.getVirtualizationMargin()) : 0;
+  }
+
+  /** Recorded-trip playback shown on this map, or null. */
+  @Nullable
+  public TripPlayback getTripPlayback() {
+    return tripPlayback;
+  }
+
+  /** Replaces the trip playback of this view, removing the previous one from the map. */
+  public void setTripPlayback(@Nullable TripPlayback playback) {
+    if (tripPlayback == playback) {
+      return;
+    }
+    if (tripPlayback != null) {
+      tripPlayback.remove();
+    }
+    tripPlayback = playback;
+    if (playback != null) {
+      playback.setQualityIntervals(getQualityAnimationIntervalMs(), getQualityEventIntervalMs());
+    }
+    if (playback != null && mGoogleMap != null) {
+      playback.show(mGoogleMap);
+    }
+  }
+
+  /** Frame sampler shared by the quality governor and render metrics of this view. */
+  public FrameSampler getFrameSampler() {
+    if (frameSampler == null) {
+      Activity activity = activitySupplier.get();
+      double refreshRate =
+          activity != null ? activity.getWindowManager().getDefaultDisplay().getRefreshRate() : 60;
+      frameSampler = new FrameSampler(refreshRate);
+    }
+    return frameSampler;
+  }
+
+  /** Render metrics of this view, or null when disabled. */
+  public RenderMetrics getRenderMetrics() {
+    return renderMetrics;
+  }
+
+  /** Replaces the render metrics of this view, stopping the previous ones. */
+  public void setRenderMetrics(RenderMetrics metrics) {
+    if (renderMetrics != null && renderMetrics != metrics) {
+      renderMetrics.stop();
+    }
+    renderMetrics = metrics;
+  }
+
+  /** Records a module command in the render metrics, if enabled. Safe to call from any thread. */
+  public void recordCommand(String name) {
+    RenderMetrics metrics = renderMetrics;
+    if (metrics != null) {
+      metrics.recordCommand(name);
+    }
+  }
+
+  /** Current number of overlays per type. */
+  public Map<String, Integer> getOverlayCounts() {
+    Map<String, Integer> counts = new HashMap<>();
+    counts.put("markers", markerMap.size());
+    counts.put("polylines", polylineMap.size());
+    counts.put("polygons", polygonMap.size());
+    counts.put("circles", circleMap.size());
+    counts.put("groundOverlays", groundOverlayMap.size());
+    return counts;
+  }
+
+  /** Cancels background work queued for this view. Called when the hosting fragment goes away. */
+  public void release() {
+    viewLifetimeToken.cancel();
+    cameraGenerationToken = null;
+    cameraObservers.clear();
+    setAnchorLayer(null);
+    markerStyle = null;
+    markerDeclutter = null;
+    declutterHandler.removeCallbacksAndMessages(null);
+    viewportWatch = null;
+    viewportWatchListener = null;
+    if (routePrefetcher != null) {
+      routePrefetcher.cancel();
+      routePrefetcher = null;
+    }
+    setQualityGovernor(null);
+    setRenderMetrics(null);
+    setTripPlayback(null);
   }
 
   public GoogleMap getGoogleMap() {
@@ -161,6 +557,7 @@ public class MapViewController implements INavigationViewControllerProperties {
     if (customId != null && !customId.isEmpty() && circleMap.containsKey(customId)) {
       Circle existingCircle = circleMap.get(customId);
       updateCircle(existingCircle, optionsMap);
+      watchedOverlayDidChange(customId);
       return existingCircle;
     }
 
@@ -203,6 +600,7 @@ public class MapViewController implements INavigationViewControllerProperties {
 
     circleMap.put(effectiveId, circle);
     circleNativeIdToEffectiveId.put(circle.getId(), effectiveId);
+    watchedOverlayDidChange(effectiveId);
 
     return circle;
   }
@@ -236,22 +634,535 @@ public class MapViewController implements INavigationViewControllerProperties {
   }
 
   public Marker addMarker(Map<String, Object> optionsMap) {
+    return addMarker(optionsMap, null);
+  }
+
+  /** Adds or replaces a marker carrying an attribute record for data-driven styling. */
+  public Marker addMarker(
+      Map<String, Object> optionsMap, @Nullable Map<String, Object> attributes) {
     if (mGoogleMap == null) {
       return null;
     }
 
     // Determine effective ID: use custom ID if provided
     String customId = CollectionUtil.getString("id", optionsMap);
+    String imagePath = CollectionUtil.getString("imgPath", optionsMap);
+    boolean hasCustomIcon = imagePath != null && !imagePath.isEmpty();
+    boolean visible = CollectionUtil.getBool("visible", optionsMap, true);
 
     // If custom ID provided and object exists, update it instead of recreating
     if (customId != null && !customId.isEmpty() && markerMap.containsKey(customId)) {
       Marker existingMarker = markerMap.get(customId);
+      MarkerBaseStyle base = markerBaseStyles.get(customId);
+      if (base != null) {
+        restoreMarker(existingMarker, base);
+      }
       updateMarker(existingMarker, optionsMap);
+      if (hasCustomIcon) {
+        markersWithCustomIcon.add(customId);
+      } else if (markersWithCustomIcon.remove(customId)) {
+        // The replacement has no image, so the marker goes back to the default icon and can be
+        // tinted by styles again.
+        existingMarker.setIcon(BitmapDescriptorFactory.defaultMarker());
+      }
+      setStyleStateForMarker(existingMarker, customId, visible, attributes);
       return existingMarker;
     }
 
     // Create new marker
-    return createMarker(optionsMap, customId);
+    Marker marker = createMarker(optionsMap, customId);
+    String effectiveId = getMarkerEffectiveId(marker.getId());
+    if (hasCustomIcon) {
+      markersWithCustomIcon.add(effectiveId);
+    }
+    setStyleStateForMarker(marker, effectiveId, visible, attributes);
+    return marker;
+  }
+
+  // Records the option visibility and attributes of a freshly added or replaced marker, then
+  // applies the current style on top of its option values.
+  private void setStyleStateForMarker(
+      Marker marker, String markerId, boolean visible, @Nullable Map<String, Object> attributes) {
+    if (visible) {
+      markersHiddenByOptions.remove(markerId);
+    } else {
+      markersHiddenByOptions.add(markerId);
+    }
+    Map<String, Object> stored =
+        attributes != null && !attributes.isEmpty() ? new HashMap<>(attributes) : null;
+    if (markerAttributeIndex != null) {
+      markerAttributeIndex.update(markerId, markerAttributes.get(markerId), stored);
+    }
+    if (stored != null) {
+      markerAttributes.put(markerId, stored);
+    } else {
+      markerAttributes.remove(markerId);
+    }
+    markerBaseStyles.remove(markerId);
+
+    if (markerStyle != null) {
+      applyMarkerStyle(marker, markerId);
+    } else {
+      updateMarkerVisibility(marker, markerId);
+    }
+    setNeedsDeclutter();
+    watchedOverlayDidChange(markerId);
+  }
+
+  private void updateMarkerVisibility(Marker marker, String markerId) {
+    boolean visible =
+        !markersHiddenByOptions.contains(markerId)
+            && !markersHiddenByStyle.contains(markerId)
+            && !markersHiddenByDeclutter.contains(markerId);
+    if (marker.isVisible() != visible) {
+      marker.setVisible(visible);
+    }
+  }
+
+  /**
+   * Sets the data-driven style evaluated against the attribute record of every marker, or null to
+   * restore the option values of styled markers. Zoom-dependent styles are re-evaluated when the
+   * camera settles.
+   */
+  public void setMarkerStyle(@Nullable MarkerStyle style) {
+    markerStyle = style;
+    markerStyleZoom = mGoogleMap != null ? mGoogleMap.getCameraPosition().zoom : 0;
+
+    if (style == null) {
+      // Restore the option values of every styled marker.
+      for (Map.Entry<String, MarkerBaseStyle> entry : markerBaseStyles.entrySet()) {
+        Marker marker = markerMap.get(entry.getKey());
+        if (marker != null) {
+          restoreMarker(marker, entry.getValue());
+        }
+      }
+      markerBaseStyles.clear();
+      List<String> hidden = new ArrayList<>(markersHiddenByStyle);
+      markersHiddenByStyle.clear();
+      for (String markerId : hidden) {
+        Marker marker = markerMap.get(markerId);
+        if (marker != null) {
+          updateMarkerVisibility(marker, markerId);
+        }
+      }
+    } else {
+      for (Map.Entry<String, Marker> entry : markerMap.entrySet()) {
+        applyMarkerStyle(entry.getValue(), entry.getKey());
+      }
+    }
+
+    if (style != null && style.usesZoom()) {
+      setCameraObserver(
+          MARKER_STYLE_OBSERVER_KEY,
+          idle -> {
+            if (idle && mGoogleMap != null) {
+              restyleMarkersForZoom(mGoogleMap.getCameraPosition().zoom);
+            }
+          });
+    } else {
+      setCameraObserver(MARKER_STYLE_OBSERVER_KEY, null);
+    }
+    setNeedsDeclutter();
+  }
+
+  private void restyleMarkersForZoom(float zoom) {
+    if (markerStyle == null || zoom == markerStyleZoom) {
+      return;
+    }
+    markerStyleZoom = zoom;
+    for (Map.Entry<String, Marker> entry : markerMap.entrySet()) {
+      applyMarkerStyle(entry.getValue(), entry.getKey());
+    }
+  }
+
+  /**
+   * Sets attribute {@code key} of the given markers to the aligned {@code values}; null removes
+   * it. Only markers whose style reads {@code key} are restyled. Returns the number of markers
+   * found.
+   */
+  public int setMarkerAttribute(String key, List<Object> values, List<String> markerIds) {
+    boolean restyle = markerStyle != null && markerStyle.dependsOnAttribute(key);
+    boolean redeclutter =
+        restyle
+            || (markerDeclutter != null
+                && markerDeclutter.priority != null
+                && markerDeclutter.priority.getAttributeKeys().contains(key));
+    int found = 0;
+    int count = Math.min(values.size(), markerIds.size());
+    for (int i = 0; i < count; i++) {
+      String markerId = markerIds.get(i);
+      Marker marker = markerMap.get(markerId);
+      if (marker == null) {
+        continue;
+      }
+      found++;
+
+      Map<String, Object> attributes = markerAttributes.get(markerId);
+      Object value = values.get(i);
+      if (markerAttributeIndex != null) {
+        markerAttributeIndex.update(
+            markerId, key, attributes != null ? attributes.get(key) : null, value);
+      }
+      if (value == null) {
+        if (attributes != null) {
+          attributes.remove(key);
+          if (attributes.isEmpty()) {
+            markerAttributes.remove(markerId);
+          }
+        }
+      } else {
+        if (attributes == null) {
+          attributes = new HashMap<>();
+          markerAttributes.put(markerId, attributes);
+        }
+        attributes.put(key, value);
+      }
+
+      if (restyle) {
+        applyMarkerStyle(marker, markerId);
+      }
+    }
+    if (redeclutter && found > 0) {
+      setNeedsDeclutter();
+    }
+    return found;
+  }
+
+  /**
+   * Returns the ids of the markers whose attributes satisfy {@code predicate}. Equality, range and
+   * "has" terms are resolved through attribute indexes, built on first use and then kept up to
+   * date.
+   */
+  public List<String> getMarkerIdsWhere(StyleExpression predicate) {
+    if (markerAttributeIndex == null) {
+      markerAttributeIndex = new AttributeIndex();
+      for (Map.Entry<String, Map<String, Object>> entry : markerAttributes.entrySet()) {
+        markerAttributeIndex.update(entry.getKey(), null, entry.getValue());
+      }
+    }
+
+    // Candidates from the index are a superset of the matches; confirm each one.
+    Set<String> candidates = markerAttributeIndex.candidatesFor(predicate);
+    double zoom = mGoogleMap != null ? mGoogleMap.getCameraPosition().zoom : 0;
+    List<String> markerIds = new ArrayList<>();
+    for (String markerId : candidates != null ? candidates : markerMap.keySet()) {
+      if (markerMap.containsKey(markerId)
+          && predicate.evaluateBoolean(markerAttributes.get(markerId), zoom)) {
+        markerIds.add(markerId);
+      }
+    }
+    return markerIds;
+  }
+
+  /**
+   * Applies {@code patch} to every marker matching {@code predicate} in one pass and returns their
+   * number. The patch may set the visible, alpha, zIndex and rotation option values and merge
+   * {@code attributes}, in which null removes a key. Styled properties keep following the style.
+   */
+  @SuppressWarnings("unchecked")
+  public int updateMarkersWhere(StyleExpression predicate, Map<String, Object> patch) {
+    List<String> markerIds = getMarkerIdsWhere(predicate);
+    Map<String, Object> attributePatch = (Map<String, Object>) patch.get("attributes");
+    Boolean visible = (Boolean) patch.get("visible");
+    Double alpha = (Double) patch.get("alpha");
+    Double zIndex = (Double) patch.get("zIndex");
+    Double rotation = (Double) patch.get("rotation");
+    boolean patchesOptions = alpha != null || zIndex != null || rotation != null;
+
+    boolean restyle = markerStyle != null && patchesOptions;
+    boolean redeclutter = visible != null || zIndex != null;
+    if (attributePatch != null) {
+      for (String key : attributePatch.keySet()) {
+        restyle = restyle || (markerStyle != null && markerStyle.dependsOnAttribute(key));
+        redeclutter =
+            redeclutter
+                || (markerDeclutter != null
+                    && markerDeclutter.priority != null
+                    && markerDeclutter.priority.getAttributeKeys().contains(key));
+      }
+    }
+    redeclutter = redeclutter || restyle;
+
+    for (String markerId : markerIds) {
+      Marker marker = markerMap.get(markerId);
+      if (attributePatch != null && !attributePatch.isEmpty()) {
+        Map<String, Object> previous = markerAttributes.get(markerId);
+        Map<String, Object> attributes =
+            previous != null ? new HashMap<>(previous) : new HashMap<>();
+        for (Map.Entry<String, Object> entry : attributePatch.entrySet()) {
+          if (entry.getValue() == null) {
+            attributes.remove(entry.getKey());
+          } else {
+            attributes.put(entry.getKey(), entry.getValue());
+          }
+        }
+        markerAttributeIndex.update(markerId, previous, attributes);
+        if (attributes.isEmpty()) {
+          markerAttributes.remove(markerId);
+        } else {
+          markerAttributes.put(markerId, attributes);
+        }
+      }
+
+      if (patchesOptions) {
+        // Styled markers restore their option values from the base style.
+        MarkerBaseStyle base = markerBaseStyles.get(markerId);
+        if (alpha != null) {
+          marker.setAlpha(alpha.floatValue());
+          if (base != null) {
+            base.alpha = alpha.floatValue();
+          }
+        }
+        if (zIndex != null) {
+          marker.setZIndex(zIndex.floatValue());
+          if (base != null) {
+            base.zIndex = zIndex.floatValue();
+          }
+        }
+        if (rotation != null) {
+          marker.setRotation(rotation.floatValue());
+          if (base != null) {
+            base.rotation = rotation.floatValue();
+          }
+        }
+      }
+
+      if (visible != null) {
+        if (visible) {
+          markersHiddenByOptions.remove(markerId);
+        } else {
+          markersHiddenByOptions.add(markerId);
+        }
+      }
+
+      if (restyle) {
+        applyMarkerStyle(marker, markerId);
+      } else if (visible != null) {
+        updateMarkerVisibility(marker, markerId);
+      }
+    }
+
+    if (redeclutter && !markerIds.isEmpty()) {
+      setNeedsDeclutter();
+    }
+    return markerIds.size();
+  }
+
+  /**
+   * Hides markers whose screen boxes overlap a higher-priority marker, or pass null to show them
+   * all again. Runs when the camera settles, at a reduced rate while it moves, and after marker
+   * changes.
+   */
+  public void setMarkerDeclutter(@Nullable MarkerDeclutter declutter) {
+    markerDeclutter = declutter;
+    if (declutter == null) {
+      setCameraObserver(MARKER_DECLUTTER_OBSERVER_KEY, null);
+      Set<String> hidden = markersHiddenByDeclutter;
+      markersHiddenByDeclutter = new HashSet<>();
+      for (String markerId : hidden) {
+        Marker marker = markerMap.get(markerId);
+        if (marker != null) {
+          updateMarkerVisibility(marker, markerId);
+        }
+      }
+      return;
+    }
+
+    setCameraObserver(MARKER_DECLUTTER_OBSERVER_KEY, this::declutterMarkersForCameraChange);
+    declutterMarkers();
+  }
+
+  private void declutterMarkersForCameraChange(boolean idle) {
+    MarkerDeclutter declutter = markerDeclutter;
+    if (declutter == null) {
+      return;
+    }
+    // The governor's animation frame rate may further lower the rate of passes while moving.
+    long intervalMs = Math.max(declutter.animationIntervalMs, getQualityAnimationIntervalMs());
+    if (!idle
+        && (declutter.animationIntervalMs <= 0
+            || SystemClock.uptimeMillis() - lastDeclutterTimeMs < intervalMs)) {
+      return;
+    }
+    declutterMarkers();
+  }
+
+  // Coalesces the passes requested by marker changes within one main loop turn.
+  private void setNeedsDeclutter() {
+    if (markerDeclutter == null || declutterScheduled) {
+      return;
+    }
+    declutterScheduled = true;
+    declutterHandler.post(
+        () -> {
+          declutterScheduled = false;
+          declutterMarkers();
+        });
+  }
+
+  private void declutterMarkers() {
+    MarkerDeclutter declutter = markerDeclutter;
+    if (declutter == null || mGoogleMap == null) {
+      return;
+    }
+    lastDeclutterTimeMs = SystemClock.uptimeMillis();
+
+    // Only markers that would otherwise be shown on screen compete for space.
+    Projection projection = mGoogleMap.getProjection();
+    Point size = getViewSize(projection);
+    RectF bounds = new RectF(0, 0, size.x, size.y);
+    double zoom = mGoogleMap.getCameraPosition().zoom;
+    // Markers closer than the governor's cluster radius collide, so fewer are shown when degraded.
+    float clusterSpacing = (float) getQualityClusterRadius() / 2;
+    List<String> markerIds = new ArrayList<>();
+    List<RectF> boxes = new ArrayList<>();
+    List<Double> priorities = new ArrayList<>();
+    for (Map.Entry<String, Marker> entry : markerMap.entrySet()) {
+      String markerId = entry.getKey();
+      if (markersHiddenByOptions.contains(markerId) || markersHiddenByStyle.contains(markerId)) {
+        continue;
+      }
+      Marker marker = entry.getValue();
+      Point point = projection.toScreenLocation(marker.getPosition());
+      RectF box = declutter.boxAt(point.x, point.y);
+      box.inset(-clusterSpacing, -clusterSpacing);
+      if (!RectF.intersects(box, bounds)) {
+        continue;
+      }
+      Object priority =
+          declutter.priority != null
+              ? declutter.priority.evaluate(markerAttributes.get(markerId), zoom)
+              : null;
+      markerIds.add(markerId);
+      boxes.add(box);
+      priorities.add(priority instanceof Double ? (Double) priority : marker.getZIndex());
+    }
+
+    // Ties are broken by id so equal-priority markers do not flicker between passes.
+    int count = markerIds.size();
+    Integer[] sorted = new Integer[count];
+    for (int i = 0; i < count; i++) {
+      sorted[i] = i;
+    }
+    Arrays.sort(
+        sorted,
+        (a, b) -> {
+          int byPriority = Double.compare(priorities.get(b), priorities.get(a));
+          return byPriority != 0 ? byPriority : markerIds.get(a).compareTo(markerIds.get(b));
+        });
+    int[] order = new int[count];
+    for (int i = 0; i < count; i++) {
+      order[i] = sorted[i];
+    }
+    boolean[] placed = declutter.resolve(boxes, order);
+
+    Set<String> hidden = new HashSet<>();
+    for (int i = 0; i < count; i++) {
+      if (!placed[i]) {
+        hidden.add(markerIds.get(i));
+      }
+    }
+
+    // Toggle only the markers whose declutter state changed.
+    Set<String> changed = new HashSet<>(hidden);
+    changed.removeAll(markersHiddenByDeclutter);
+    for (String markerId : markersHiddenByDeclutter) {
+      if (!hidden.contains(markerId)) {
+        changed.add(markerId);
+      }
+    }
+    markersHiddenByDeclutter = hidden;
+    for (String markerId : changed) {
+      Marker marker = markerMap.get(markerId);
+      if (marker != null) {
+        updateMarkerVisibility(marker, markerId);
+      }
+    }
+  }
+
+  private void applyMarkerStyle(Marker marker, String markerId) {
+    MarkerStyle style = markerStyle;
+    if (style == null) {
+      return;
+    }
+    Map<String, Object> attributes = markerAttributes.get(markerId);
+    double zoom = markerStyleZoom;
+
+    MarkerBaseStyle base = markerBaseStyles.get(markerId);
+    if (base == null) {
+      base = new MarkerBaseStyle(marker);
+      markerBaseStyles.put(markerId, base);
+    }
+
+    if (style.alpha != null) {
+      Object value = style.alpha.evaluate(attributes, zoom);
+      float alpha = value instanceof Double ? ((Double) value).floatValue() : base.alpha;
+      if (marker.getAlpha() != alpha) {
+        marker.setAlpha(alpha);
+      }
+    }
+    if (style.zIndex != null) {
+      Object value = style.zIndex.evaluate(attributes, zoom);
+      float zIndex = value instanceof Double ? ((Double) value).floatValue() : base.zIndex;
+      if (marker.getZIndex() != zIndex) {
+        marker.setZIndex(zIndex);
+      }
+    }
+    if (style.rotation != null) {
+      Object value = style.rotation.evaluate(attributes, zoom);
+      float rotation = value instanceof Double ? ((Double) value).floatValue() : base.rotation;
+      if (marker.getRotation() != rotation) {
+        marker.setRotation(rotation);
+      }
+    }
+    // Custom images are never tinted.
+    if (style.color != null && !markersWithCustomIcon.contains(markerId)) {
+      Integer color = MarkerStyle.colorIntFromValue(style.color.evaluate(attributes, zoom));
+      if (color != null) {
+        marker.setIcon(markerIconForHue(MarkerStyle.hueOfColor(color)));
+        base.tinted = true;
+      } else if (base.tinted) {
+        marker.setIcon(BitmapDescriptorFactory.defaultMarker());
+        base.tinted = false;
+      }
+    }
+
+    if (style.filter != null && !style.filter.evaluateBoolean(attributes, zoom)) {
+      markersHiddenByStyle.add(markerId);
+    } else {
+      markersHiddenByStyle.remove(markerId);
+    }
+    updateMarkerVisibility(marker, markerId);
+  }
+
+  private BitmapDescriptor markerIconForHue(float hue) {
+    BitmapDescriptor icon = markerHueIcons.get(hue);
+    if (icon == null) {
+      icon = BitmapDescriptorFactory.defaultMarker(hue);
+      markerHueIcons.put(hue, icon);
+    }
+    return icon;
+  }
+
+  private void restoreMarker(Marker marker, MarkerBaseStyle base) {
+    marker.setAlpha(base.alpha);
+    marker.setZIndex(base.zIndex);
+    marker.setRotation(base.rotation);
+    if (base.tinted) {
+      marker.setIcon(BitmapDescriptorFactory.defaultMarker());
+    }
+  }
+
+  private void clearMarkerStyleState() {
+    markerAttributes.clear();
+    if (markerAttributeIndex != null) {
+      markerAttributeIndex.clear();
+    }
+    markersHiddenByOptions.clear();
+    markersHiddenByStyle.clear();
+    markersHiddenByDeclutter.clear();
+    markersWithCustomIcon.clear();
+    markerBaseStyles.clear();
   }
 
   private Marker createMarker(Map<String, Object> optionsMap, String customId) {
@@ -350,8 +1261,10 @@ public class MapViewController implements INavigationViewControllerProperties {
 
     // If custom ID provided and object exists, update it instead of recreating
     if (customId != null && !customId.isEmpty() && polylineMap.containsKey(customId)) {
+      polylineExtents.remove(customId);
       Polyline existingPolyline = polylineMap.get(customId);
-      updatePolyline(existingPolyline, optionsMap);
+      updatePolyline(customId, existingPolyline, optionsMap);
+      watchedOverlayDidChange(customId);
       return existingPolyline;
     }
 
@@ -370,12 +1283,13 @@ public class MapViewController implements INavigationViewControllerProperties {
       return null;
     }
 
-    PolylineOptions options = new PolylineOptions();
+    List<LatLng> points = new ArrayList<>(latLngArr.size());
     for (int i = 0; i < latLngArr.size(); i++) {
       Map<String, Object> latLngMap = (Map<String, Object>) latLngArr.get(i);
-      LatLng latLng = createLatLng(latLngMap);
-      options.add(latLng);
+      points.add(createLatLng(latLngMap));
     }
+    PolylineOptions options = new PolylineOptions();
+    options.addAll(PolylineSimplifier.simplify(points, appliedPolylineTolerance));
 
     if (optionsMap.containsKey("color")) {
       int color = CollectionUtil.getInt("color", optionsMap, 0);
@@ -391,12 +1305,14 @@ public class MapViewController implements INavigationViewControllerProperties {
     String effectiveId = (customId != null && !customId.isEmpty()) ? customId : polyline.getId();
 
     polylineMap.put(effectiveId, polyline);
+    polylineSourcePoints.put(effectiveId, points);
     polylineNativeIdToEffectiveId.put(polyline.getId(), effectiveId);
+    watchedOverlayDidChange(effectiveId);
 
     return polyline;
   }
 
-  private void updatePolyline(Polyline polyline, Map<String, Object> optionsMap) {
+  private void updatePolyline(String id, Polyline polyline, Map<String, Object> optionsMap) {
     float width = Double.valueOf(CollectionUtil.getDouble("width", optionsMap, 0)).floatValue();
     boolean clickable = CollectionUtil.getBool("clickable", optionsMap, false);
     boolean visible = CollectionUtil.getBool("visible", optionsMap, true);
@@ -410,7 +1326,8 @@ public class MapViewController implements INavigationViewControllerProperties {
         LatLng latLng = createLatLng(latLngMap);
         points.add(latLng);
       }
-      polyline.setPoints(points);
+      polylineSourcePoints.put(id, points);
+      polyline.setPoints(PolylineSimplifier.simplify(points, appliedPolylineTolerance));
     }
 
     if (optionsMap.containsKey("color")) {
@@ -433,8 +1350,10 @@ public class MapViewController implements INavigationViewControllerProperties {
 
     // If custom ID provided and object exists, update it instead of recreating
     if (customId != null && !customId.isEmpty() && polygonMap.containsKey(customId)) {
+      polygonExtents.remove(customId);
       Polygon existingPolygon = polygonMap.get(customId);
       updatePolygon(existingPolygon, optionsMap);
+      watchedOverlayDidChange(customId);
       return existingPolygon;
     }
 
@@ -496,6 +1415,7 @@ public class MapViewController implements INavigationViewControllerProperties {
 
     polygonMap.put(effectiveId, polygon);
     polygonNativeIdToEffectiveId.put(polygon.getId(), effectiveId);
+    watchedOverlayDidChange(effectiveId);
 
     return polygon;
   }
@@ -576,6 +1496,7 @@ public class MapViewController implements INavigationViewControllerProperties {
       } else {
         // Update properties that can be changed
         updateGroundOverlay(existingOverlay, map);
+        watchedOverlayDidChange(customId);
         return existingOverlay;
       }
     }
@@ -683,6 +1604,7 @@ public class MapViewController implements INavigationViewControllerProperties {
 
     groundOverlayMap.put(effectiveId, groundOverlay);
     groundOverlayNativeIdToEffectiveId.put(groundOverlay.getId(), effectiveId);
+    watchedOverlayDidChange(effectiveId);
 
     return groundOverlay;
   }
@@ -710,6 +1632,20 @@ public class MapViewController implements INavigationViewControllerProperties {
             markerNativeIdToEffectiveId.remove(marker.getId());
             marker.remove();
             markerMap.remove(id);
+            Map<String, Object> attributes = markerAttributes.remove(id);
+            if (markerAttributeIndex != null) {
+              markerAttributeIndex.update(id, attributes, null);
+            }
+            markersHiddenByOptions.remove(id);
+            markersHiddenByStyle.remove(id);
+            markersHiddenByDeclutter.remove(id);
+            markersWithCustomIcon.remove(id);
+            markerBaseStyles.remove(id);
+            setNeedsDeclutter();
+            watchedOverlayDidChange(id);
+            if (routePrefetcher != null) {
+              routePrefetcher.forgetFeature(id);
+            }
           }
         });
   }
@@ -720,6 +1656,9 @@ public class MapViewController implements INavigationViewControllerProperties {
       polylineNativeIdToEffectiveId.remove(polyline.getId());
       polyline.remove();
       polylineMap.remove(id);
+      polylineSourcePoints.remove(id);
+      polylineExtents.remove(id);
+      watchedOverlayDidChange(id);
     }
   }
 
@@ -729,6 +1668,8 @@ public class MapViewController implements INavigationViewControllerProperties {
       polygonNativeIdToEffectiveId.remove(polygon.getId());
       polygon.remove();
       polygonMap.remove(id);
+      polygonExtents.remove(id);
+      watchedOverlayDidChange(id);
     }
   }
 
@@ -738,6 +1679,7 @@ public class MapViewController implements INavigationViewControllerProperties {
       circleNativeIdToEffectiveId.remove(circle.getId());
       circle.remove();
       circleMap.remove(id);
+      watchedOverlayDidChange(id);
     }
   }
 
@@ -747,6 +1689,7 @@ public class MapViewController implements INavigationViewControllerProperties {
       groundOverlayNativeIdToEffectiveId.remove(groundOverlay.getId());
       groundOverlay.remove();
       groundOverlayMap.remove(id);
+      watchedOverlayDidChange(id);
     }
   }
 
@@ -771,8 +1714,10 @@ public class MapViewController implements INavigationViewControllerProperties {
   }
 
   public void setMapStyle(String url) {
-    Executors.newSingleThreadExecutor()
-        .execute(
+    // The fetch blocks on the network, so it runs on the IO threads rather than the CPU workers.
+    NavWorkerPool.getInstance()
+        .submitIo(
+            viewLifetimeToken,
             () -> {
               try {
                 style = fetchJsonFromUrl(url);
@@ -831,6 +1776,368 @@ public class MapViewController implements INavigationViewControllerProperties {
     }
   }
 
+  /**
+   * Animates the camera once to fit the overlays with the given {@code ids}, the markers whose
+   * "group" attribute equals {@code group}, or every overlay when both are missing. The camera is
+   * untilted and faces {@code bearing}, or north. Returns false, without moving the camera, if no
+   * overlay was selected.
+   */
+  public boolean fitCameraToOverlays(Map<String, Object> options, float density) {
+    List<String> ids = null;
+    if (options.get("ids") instanceof List) {
+      ids = new ArrayList<>();
+      for (Object id : (List<?>) options.get("ids")) {
+        ids.add(String.valueOf(id));
+      }
+    }
+    int[] padding = new int[4];
+    if (options.get("padding") instanceof Map) {
+      Map<?, ?> insets = (Map<?, ?>) options.get("padding");
+      padding[0] = CollectionUtil.getInt("top", insets, 0);
+      padding[1] = CollectionUtil.getInt("left", insets, 0);
+      padding[2] = CollectionUtil.getInt("bottom", insets, 0);
+      padding[3] = CollectionUtil.getInt("right", insets, 0);
+    }
+    Object maxZoom = options.get("maxZoom");
+    Object bearing = options.get("bearing");
+    return fitCameraToOverlays(
+        ids,
+        CollectionUtil.getString("group", options),
+        padding,
+        maxZoom instanceof Double ? (Double) maxZoom : null,
+        bearing instanceof Double ? (Double) bearing : null,
+        density);
+  }
+
+  // Padding is {top, left, bottom, right} in pixels.
+  private boolean fitCameraToOverlays(
+      @Nullable List<String> ids,
+      @Nullable String group,
+      int[] padding,
+      @Nullable Double maxZoom,
+      @Nullable Double bearing,
+      float density) {
+    if (mGoogleMap == null) {
+      return false;
+    }
+
+    double[] extent = {
+      Double.POSITIVE_INFINITY,
+      Double.POSITIVE_INFINITY,
+      Double.NEGATIVE_INFINITY,
+      Double.NEGATIVE_INFINITY
+    };
+    if (ids != null) {
+      for (String id : ids) {
+        includeOverlay(id, extent);
+      }
+    } else if (group != null) {
+      for (Map.Entry<String, Marker> entry : markerMap.entrySet()) {
+        Map<String, Object> attributes = markerAttributes.get(entry.getKey());
+        if (attributes != null && group.equals(attributes.get("group"))) {
+          includeLatLng(entry.getValue().getPosition(), extent);
+        }
+      }
+    } else {
+      List<String> allIds = new ArrayList<>();
+      allIds.addAll(markerMap.keySet());
+      allIds.addAll(polylineMap.keySet());
+      allIds.addAll(polygonMap.keySet());
+      allIds.addAll(circleMap.keySet());
+      allIds.addAll(groundOverlayMap.keySet());
+      for (String id : allIds) {
+        includeOverlay(id, extent);
+      }
+    }
+    if (extent[0] > extent[2]) {
+      return false;
+    }
+
+    // Fit the extent, rotated by the bearing, in the padded part of the view.
+    double x0 = mercatorX(extent[1]);
+    double x1 = mercatorX(extent[3]);
+    double y0 = mercatorY(extent[2]);
+    double y1 = mercatorY(extent[0]);
+    double angle = Math.toRadians(bearing != null ? bearing : 0);
+    double cos = Math.cos(angle);
+    double sin = Math.sin(angle);
+    double width = (x1 - x0) * Math.abs(cos) + (y1 - y0) * Math.abs(sin);
+    double height = (x1 - x0) * Math.abs(sin) + (y1 - y0) * Math.abs(cos);
+
+    Point size = getViewSize(mGoogleMap.getProjection());
+    double availableWidth = Math.max(1, size.x - padding[1] - padding[3]);
+    double availableHeight = Math.max(1, size.y - padding[0] - padding[2]);
+    double tileSize = 256 * density;
+    double zoom =
+        maxZoom != null
+            ? Math.min(maxZoom, mGoogleMap.getMaxZoomLevel())
+            : mGoogleMap.getMaxZoomLevel();
+    if (width > 0) {
+      zoom = Math.min(zoom, Math.log(availableWidth / (width * tileSize)) / Math.log(2));
+    }
+    if (height > 0) {
+      zoom = Math.min(zoom, Math.log(availableHeight / (height * tileSize)) / Math.log(2));
+    }
+    zoom = Math.max(zoom, mGoogleMap.getMinZoomLevel());
+
+    // The camera target is the view center, offset from the center of the padded area.
+    double scale = tileSize * Math.pow(2, zoom);
+    double offsetX = (padding[3] - padding[1]) / 2.0 / scale;
+    double offsetY = (padding[2] - padding[0]) / 2.0 / scale;
+    double targetX = (x0 + x1) / 2 + offsetX * cos - offsetY * sin;
+    double targetY = (y0 + y1) / 2 + offsetX * sin + offsetY * cos;
+
+    CameraPosition cameraPosition =
+        new CameraPosition.Builder()
+            .target(new LatLng(latitudeFromMercatorY(targetY), targetX * 360 - 180))
+            .zoom((float) zoom)
+            .tilt(0)
+            .bearing(bearing != null ? bearing.floatValue() : 0)
+            .build();
+    mGoogleMap.animateCamera(CameraUpdateFactory.newCameraPosition(cameraPosition));
+    return true;
+  }
+
+  /**
+   * Reports when the given overlays enter or leave the visible region. Membership is evaluated when
+   * the camera settles and after watched overlays change, and the listener only receives changes,
+   * starting with the overlays visible now. Pass an empty list to stop watching.
+   */
+  public void setViewportWatch(List<String> overlayIds, @Nullable ViewportWatchListener listener) {
+    if (overlayIds.isEmpty() || listener == null) {
+      viewportWatch = null;
+      viewportWatchListener = null;
+      setCameraObserver(VIEWPORT_WATCH_OBSERVER_KEY, null);
+      return;
+    }
+    viewportWatch = new ViewportWatch(overlayIds);
+    viewportWatchListener = listener;
+    setCameraObserver(
+        VIEWPORT_WATCH_OBSERVER_KEY,
+        idle -> {
+          if (idle) {
+            updateViewportWatch();
+          }
+        });
+    // Report the overlays that are visible right away; the camera may not move for a while.
+    updateViewportWatch();
+  }
+
+  private void watchedOverlayDidChange(String overlayId) {
+    if (viewportWatch != null && viewportWatch.overlayIds.contains(overlayId)) {
+      setNeedsViewportWatchUpdate();
+    }
+  }
+
+  // Re-indexes the watched overlays and re-evaluates membership once the current batch of overlay
+  // changes is done.
+  private void setNeedsViewportWatchUpdate() {
+    if (viewportWatch == null) {
+      return;
+    }
+    viewportWatch.needsIndex = true;
+    if (viewportWatchScheduled) {
+      return;
+    }
+    viewportWatchScheduled = true;
+    declutterHandler.post(
+        () -> {
+          viewportWatchScheduled = false;
+          updateViewportWatch();
+        });
+  }
+
+  private void updateViewportWatch() {
+    ViewportWatch watch = viewportWatch;
+    ViewportWatchListener listener = viewportWatchListener;
+    if (watch == null || listener == null || mGoogleMap == null) {
+      return;
+    }
+    if (watch.needsIndex) {
+      watch.beginIndex();
+      for (String overlayId : watch.overlayIds) {
+        double[] extent = {
+          Double.POSITIVE_INFINITY,
+          Double.POSITIVE_INFINITY,
+          Double.NEGATIVE_INFINITY,
+          Double.NEGATIVE_INFINITY
+        };
+        includeOverlay(overlayId, extent);
+        if (extent[0] <= extent[2]) {
+          watch.indexOverlay(overlayId, extent);
+        }
+      }
+      watch.endIndex();
+    }
+
+    List<String> entered = new ArrayList<>();
+    List<String> left = new ArrayList<>();
+    if (watch.update(mGoogleMap.getProjection().getVisibleRegion(), entered, left)) {
+      listener.onViewportMembershipChanged(entered, left);
+    }
+  }
+
+  /**
+   * Stages the features loaded by {@code prefetcher} as hidden markers, replacing the previous
+   * prefetcher and removing the markers it staged. The listener receives the ids of the markers
+   * added and removed. Pass null to stop prefetching.
+   */
+  public void setRoutePrefetcher(
+      @Nullable RoutePrefetcher prefetcher, @Nullable RoutePrefetchListener listener) {
+    RoutePrefetcher previous = routePrefetcher;
+    routePrefetcher = null;
+    if (previous != null) {
+      previous.cancel();
+      for (String featureId : previous.getStagedIds()) {
+        removeMarker(featureId);
+      }
+    }
+    if (prefetcher == null) {
+      return;
+    }
+
+    routePrefetcher = prefetcher;
+    prefetcher.setListener(
+        (staged, evicted) -> {
+          List<String> stagedIds = stagePrefetchedFeatures(staged, evicted);
+          if (listener != null) {
+            listener.onRoutePrefetchChanged(stagedIds, evicted);
+          }
+        });
+  }
+
+  // Adds the staged features as hidden markers and removes the evicted ones. Returns the ids of the
+  // markers added.
+  private List<String> stagePrefetchedFeatures(List<JSONObject> staged, List<String> evicted) {
+    for (String featureId : evicted) {
+      removeMarker(featureId);
+    }
+    List<String> stagedIds = new ArrayList<>(staged.size());
+    for (JSONObject feature : staged) {
+      Map<String, Object> position = new HashMap<>();
+      position.put(Constants.LAT_FIELD_KEY, feature.optDouble("lat"));
+      position.put(Constants.LNG_FIELD_KEY, feature.optDouble("lng"));
+      Map<String, Object> options = new HashMap<>();
+      options.put("id", feature.optString("id"));
+      options.put("position", position);
+      options.put("visible", false);
+      for (String key : new String[] {"title", "snippet", "imgPath"}) {
+        if (feature.opt(key) instanceof String) {
+          options.put(key, feature.optString(key));
+        }
+      }
+      if (feature.opt("zIndex") instanceof Number) {
+        options.put("zIndex", feature.optDouble("zIndex"));
+      }
+      Map<String, Object> attributes = null;
+      JSONObject attributesJson = feature.optJSONObject("attributes");
+      if (attributesJson != null) {
+        attributes = MarkerStyle.attributesFromJson(attributesJson);
+      }
+      try {
+        addMarker(options, attributes);
+        stagedIds.add(feature.optString("id"));
+      } catch (IllegalArgumentException e) {
+        // An icon that cannot be loaded leaves the feature out.
+        routePrefetcher.forgetFeature(feature.optString("id"));
+      }
+    }
+    return stagedIds;
+  }
+
+  public void onRouteChanged(@Nullable List<RouteSegment> routeSegments) {
+    if (routePrefetcher != null) {
+      routePrefetcher.setRouteSegments(routeSegments);
+    }
+  }
+
+  public void onRoadSnappedLocation(LatLng location) {
+    if (routePrefetcher != null) {
+      routePrefetcher.updateWithLocation(location);
+    }
+  }
+
+  private void includeOverlay(String id, double[] extent) {
+    Marker marker = markerMap.get(id);
+    if (marker != null) {
+      includeLatLng(marker.getPosition(), extent);
+    }
+    Polyline polyline = polylineMap.get(id);
+    if (polyline != null) {
+      includeExtent(extentOfPath(polylineExtents, id, polyline.getPoints()), extent);
+    }
+    Polygon polygon = polygonMap.get(id);
+    if (polygon != null) {
+      // Holes lie inside the outer path.
+      includeExtent(extentOfPath(polygonExtents, id, polygon.getPoints()), extent);
+    }
+    Circle circle = circleMap.get(id);
+    if (circle != null) {
+      LatLng center = circle.getCenter();
+      double latDelta = Math.toDegrees(circle.getRadius() / 6371009.0);
+      double lngDelta = latDelta / Math.max(0.01, Math.cos(Math.toRadians(center.latitude)));
+      includeLatLng(new LatLng(center.latitude - latDelta, center.longitude - lngDelta), extent);
+      includeLatLng(new LatLng(center.latitude + latDelta, center.longitude + lngDelta), extent);
+    }
+    GroundOverlay groundOverlay = groundOverlayMap.get(id);
+    if (groundOverlay != null && groundOverlay.getBounds() != null) {
+      includeLatLng(groundOverlay.getBounds().southwest, extent);
+      includeLatLng(groundOverlay.getBounds().northeast, extent);
+    }
+  }
+
+  private static double[] extentOfPath(
+      Map<String, double[]> cache, String id, List<LatLng> points) {
+    double[] cached = cache.get(id);
+    if (cached != null) {
+      return cached;
+    }
+    double[] extent = {
+      Double.POSITIVE_INFINITY,
+      Double.POSITIVE_INFINITY,
+      Double.NEGATIVE_INFINITY,
+      Double.NEGATIVE_INFINITY
+    };
+    for (LatLng point : points) {
+      includeLatLng(point, extent);
+    }
+    cache.put(id, extent);
+    return extent;
+  }
+
+  private static void includeLatLng(LatLng latLng, double[] extent) {
+    extent[0] = Math.min(extent[0], latLng.latitude);
+    extent[1] = Math.min(extent[1], latLng.longitude);
+    extent[2] = Math.max(extent[2], latLng.latitude);
+    extent[3] = Math.max(extent[3], latLng.longitude);
+  }
+
+  private static void includeExtent(double[] other, double[] extent) {
+    if (other[0] <= other[2]) {
+      includeLatLng(new LatLng(other[0], other[1]), extent);
+      includeLatLng(new LatLng(other[2], other[3]), extent);
+    }
+  }
+
+  // Normalized Web Mercator coordinates, in [0, 1] from the north-west corner.
+  private static double mercatorX(double lng) {
+    return (lng + 180) / 360;
+  }
+
+  private static double mercatorY(double lat) {
+    double sin = Math.sin(Math.toRadians(Math.max(-85.05112878, Math.min(85.05112878, lat))));
+    return 0.5 - Math.log((1 + sin) / (1 - sin)) / (4 * Math.PI);
+  }
+
+  private static double latitudeFromMercatorY(double y) {
+    return 90 - 360 * Math.atan(Math.exp((y - 0.5) * 2 * Math.PI)) / Math.PI;
+  }
+
+  // The near right corner of the visible region is the bottom right corner of the view.
+  private static Point getViewSize(Projection projection) {
+    return projection.toScreenLocation(projection.getVisibleRegion().nearRight);
+  }
+
   public void setZoomLevel(int level) {
     if (mGoogleMap != null) {
       mGoogleMap.animateCamera(CameraUpdateFactory.zoomTo(level));
@@ -999,19 +2306,28 @@ public class MapViewController implements INavigationViewControllerProperties {
       return;
     }
 
+    setTripPlayback(null);
     mGoogleMap.clear();
 
     // Clear all internal maps
     markerMap.clear();
+    clearMarkerStyleState();
     polylineMap.clear();
     polygonMap.clear();
     groundOverlayMap.clear();
     circleMap.clear();
+    polylineSourcePoints.clear();
+    polylineExtents.clear();
+    polygonExtents.clear();
     markerNativeIdToEffectiveId.clear();
     polylineNativeIdToEffectiveId.clear();
     polygonNativeIdToEffectiveId.clear();
     groundOverlayNativeIdToEffectiveId.clear();
     circleNativeIdToEffectiveId.clear();
+    setNeedsViewportWatchUpdate();
+    if (routePrefetcher != null) {
+      routePrefetcher.forgetAllFeatures();
+    }
   }
 
   public void resetMinMaxZoomLevel() {
@@ -66,6 +66,9 @@ public class MapViewFragment extends SupportMapFragment
   @Override
   public void onViewCreated(@NonNull View view, @Nullable Bundle savedInstanceState) {
     super.onViewCreated(view, savedInstanceState);
+    if (mMapViewController != null) {
+      mMapViewController.renewViewLifetime();
+    }
 
     getMapAsync(
         googleMap -> {
@@ -76,6 +79,7 @@ public class MapViewFragment extends SupportMapFragment
 
           // Setup map listeners with the provided callback
           mMapViewController.setupMapListeners(MapViewFragment.this);
+          mMapViewController.setAnchorLayer(NavAnchorLayer.find(view.getParent()));
           applyMapColorSchemeToMap();
 
           emitEvent("onMapReady", null);
@@ -88,6 +92,14 @@ public class MapViewFragment extends SupportMapFragment
         });
   }
 
+  @Override
+  public void onDestroyView() {
+    super.onDestroyView();
+    if (mMapViewController != null) {
+      mMapViewController.release();
+    }
+  }
+
   @Override
   public void onMapReady() {
     emitEvent("onMapReady", null);
@@ -0,0 +1,234 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import android.graphics.RectF;
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import org.json.JSONException;
+import org.json.JSONObject;
+
+/**
+ * Screen-space collision resolver for markers. Each marker occupies a box of {@code boxWidth} by
+ * {@code boxHeight} around its projected position; boxes are placed in priority order and a marker
+ * whose box overlaps an already placed one is hidden. Placed boxes are bucketed in a uniform grid
+ * so a pass stays linear in the number of on-screen markers.
+ */
+public final class MarkerDeclutter {
+  // Size of the default marker pin, in density-independent pixels.
+  private static final float DEFAULT_BOX_WIDTH = 26;
+  private static final float DEFAULT_BOX_HEIGHT = 40;
+  private static final long DEFAULT_ANIMATION_INTERVAL_MS = 250;
+
+  /** Evaluated against marker attributes; higher values win. Markers fall back to their zIndex. */
+  @Nullable public final StyleExpression priority;
+
+  /** Collision box of a marker, in pixels. */
+  public final float boxWidth;
+
+  public final float boxHeight;
+
+  /** Position of the marker coordinate within its box, as a fraction of the box size. */
+  public final float anchorX;
+
+  public final float anchorY;
+
+  /** Extra spacing kept between boxes, in pixels. */
+  public final float padding;
+
+  /** Minimum time between passes while the camera is moving. Zero disables those passes. */
+  public final long animationIntervalMs;
+
+  private MarkerDeclutter(
+      @Nullable StyleExpression priority,
+      float boxWidth,
+      float boxHeight,
+      float anchorX,
+      float anchorY,
+      float padding,
+      long animationIntervalMs) {
+    this.priority = priority;
+    this.boxWidth = boxWidth;
+    this.boxHeight = boxHeight;
+    this.anchorX = anchorX;
+    this.anchorY = anchorY;
+    this.padding = padding;
+    this.animationIntervalMs = animationIntervalMs;
+  }
+
+  /**
+   * Parses options of the form {@code {priority?, boxSize?, anchor?, padding?,
+   * animationIntervalMs?}} from their JSON representation. Sizes are given in density-independent
+   * pixels and converted with {@code density}.
+   */
+  @NonNull
+  public static MarkerDeclutter fromJson(@NonNull String json, float density)
+      throws StyleExpression.InvalidExpressionException {
+    JSONObject object;
+    try {
+      object = new JSONObject(json);
+    } catch (JSONException e) {
+      throw new StyleExpression.InvalidExpressionException(
+          "Declutter options must be a JSON object");
+    }
+
+    StyleExpression priority = null;
+    float boxWidth = DEFAULT_BOX_WIDTH;
+    float boxHeight = DEFAULT_BOX_HEIGHT;
+    float anchorX = 0.5f;
+    float anchorY = 1.0f;
+    float padding = 0;
+    long animationIntervalMs = DEFAULT_ANIMATION_INTERVAL_MS;
+
+    Iterator<String> options = object.keys();
+    while (options.hasNext()) {
+      String option = options.next();
+      Object value = object.opt(option);
+      switch (option) {
+        case "priority":
+          try {
+            priority = StyleExpression.compile(value);
+          } catch (StyleExpression.InvalidExpressionException e) {
+            throw new StyleExpression.InvalidExpressionException("priority: " + e.getMessage());
+          }
+          break;
+        case "boxSize":
+          {
+            JSONObject size = value instanceof JSONObject ? (JSONObject) value : null;
+            Object width = size != null ? size.opt("width") : null;
+            Object height = size != null ? size.opt("height") : null;
+            if (!(width instanceof Number)
+                || !(height instanceof Number)
+                || ((Number) width).doubleValue() <= 0
+                || ((Number) height).doubleValue() <= 0) {
+              throw new StyleExpression.InvalidExpressionException(
+                  "boxSize must have a positive width and height");
+            }
+            boxWidth = ((Number) width).floatValue();
+            boxHeight = ((Number) height).floatValue();
+            break;
+          }
+        case "anchor":
+          {
+            JSONObject anchor = value instanceof JSONObject ? (JSONObject) value : null;
+            Object x = anchor != null ? anchor.opt("x") : null;
+            Object y = anchor != null ? anchor.opt("y") : null;
+            if (!(x instanceof Number) || !(y instanceof Number)) {
+              throw new StyleExpression.InvalidExpressionException(
+                  "anchor must have numeric x and y");
+            }
+            anchorX = ((Number) x).floatValue();
+            anchorY = ((Number) y).floatValue();
+            break;
+          }
+        case "padding":
+          if (!(value instanceof Number) || ((Number) value).doubleValue() < 0) {
+            throw new StyleExpression.InvalidExpressionException(
+                "padding must be a non-negative number");
+          }
+          padding = ((Number) value).floatValue();
+          break;
+        case "animationIntervalMs":
+          if (!(value instanceof Number) || ((Number) value).doubleValue() < 0) {
+            throw new StyleExpression.InvalidExpressionException(
+                "animationIntervalMs must be a non-negative number");
+          }
+          animationIntervalMs = ((Number) value).longValue();
+          break;
+        default:
+          throw new StyleExpression.InvalidExpressionException(
+              "Unknown declutter option '" + option + "'");
+      }
+    }
+    return new MarkerDeclutter(
+        priority,
+        boxWidth * density,
+        boxHeight * density,
+        anchorX,
+        anchorY,
+        padding * density,
+        animationIntervalMs);
+  }
+
+  /** Returns the collision box of a marker projected at ({@code x}, {@code y}). */
+  public RectF boxAt(float x, float y) {
+    // Half the padding on every side keeps the padding between two neighbouring boxes.
+    float left = x - anchorX * boxWidth - padding / 2;
+    float top = y - anchorY * boxHeight - padding / 2;
+    return new RectF(left, top, left + boxWidth + padding, top + boxHeight + padding);
+  }
+
+  /**
+   * Resolves collisions between {@code boxes}. {@code order} lists box indices from the highest
+   * priority to the lowest; the returned array tells for each box whether it is shown.
+   */
+  public boolean[] resolve(List<RectF> boxes, int[] order) {
+    // Cells as large as a box, so each box touches at most four of them.
+    float cellSize = Math.max(boxWidth, boxHeight) + padding;
+    Map<Long, List<Integer>> grid = new HashMap<>();
+    boolean[] placed = new boolean[boxes.size()];
+
+    for (int index : order) {
+      RectF box = boxes.get(index);
+      int minColumn = (int) Math.floor(box.left / cellSize);
+      int maxColumn = (int) Math.floor(box.right / cellSize);
+      int minRow = (int) Math.floor(box.top / cellSize);
+      int maxRow = (int) Math.floor(box.bottom / cellSize);
+
+      boolean collides = false;
+      for (int column = minColumn; column <= maxColumn && !collides; column++) {
+        for (int row = minRow; row <= maxRow && !collides; row++) {
+          List<Integer> cell = grid.get(cellKey(column, row));
+          if (cell == null) {
+            continue;
+          }
+          for (int other : cell) {
+            if (RectF.intersects(box, boxes.get(other))) {
+              collides = true;
+              break;
+            }
+          }
+        }
+      }
+
+      placed[index] = !collides;
+      if (collides) {
+        continue;
+      }
+      for (int column = minColumn; column <= maxColumn; column++) {
+        for (int row = minRow; row <= maxRow; row++) {
+          long key = cellKey(column, row);
+          List<Integer> cell = grid.get(key);
+          if (cell == null) {
+            cell = new ArrayList<>(2);
+            grid.put(key, cell);
+          }
+          cell.add(index);
+        }
+      }
+    }
+    return placed;
+  }
+
+  private static long cellKey(int column, int row) {
+    return ((long) column << 32) ^ (row & 0xFFFFFFFFL);
+  }
+}
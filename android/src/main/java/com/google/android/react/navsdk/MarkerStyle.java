@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import android.graphics.Color;
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.Map;
+import java.util.Set;
+import org.json.JSONException;
+import org.json.JSONObject;
+
+/**
+ * Data-driven marker style: one compiled {@link StyleExpression} per styled property, evaluated
+ * against the attribute record of each marker. Properties without an expression keep their option
+ * values.
+ */
+public final class MarkerStyle {
+  /** Markers for which the filter evaluates to false are hidden. */
+  @Nullable public final StyleExpression filter;
+
+  @Nullable public final StyleExpression alpha;
+  @Nullable public final StyleExpression zIndex;
+  @Nullable public final StyleExpression rotation;
+
+  /** Tints the default marker icon. Evaluates to an AARRGGBB number or a "#RRGGBB[AA]" string. */
+  @Nullable public final StyleExpression color;
+
+  private final boolean usesZoom;
+  private final Set<String> attributeKeys;
+
+  private MarkerStyle(Map<String, StyleExpression> expressions) {
+    filter = expressions.get("filter");
+    alpha = expressions.get("alpha");
+    zIndex = expressions.get("zIndex");
+    rotation = expressions.get("rotation");
+    color = expressions.get("color");
+
+    boolean zoom = false;
+    Set<String> keys = new HashSet<>();
+    for (StyleExpression expression : expressions.values()) {
+      zoom = zoom || expression.usesZoom();
+      keys.addAll(expression.getAttributeKeys());
+    }
+    usesZoom = zoom;
+    attributeKeys = keys;
+  }
+
+  /**
+   * Compiles a style of the form {@code {filter?, alpha?, zIndex?, rotation?, color?}} from its
+   * JSON representation.
+   */
+  @NonNull
+  public static MarkerStyle fromJson(@NonNull String json)
+      throws StyleExpression.InvalidExpressionException {
+    JSONObject object;
+    try {
+      object = new JSONObject(json);
+    } catch (JSONException e) {
+      throw new StyleExpression.InvalidExpressionException("Marker style must be a JSON object");
+    }
+
+    Map<String, StyleExpression> expressions = new HashMap<>();
+    Iterator<String> properties = object.keys();
+    while (properties.hasNext()) {
+      String property = properties.next();
+      switch (property) {
+        case "filter":
+        case "alpha":
+        case "zIndex":
+        case "rotation":
+        case "color":
+          break;
+        default:
+          throw new StyleExpression.InvalidExpressionException(
+              "Unknown marker style property '" + property + "'");
+      }
+      try {
+        expressions.put(property, StyleExpression.compile(object.opt(property)));
+      } catch (StyleExpression.InvalidExpressionException e) {
+        throw new StyleExpression.InvalidExpressionException(property + ": " + e.getMessage());
+      }
+    }
+    return new MarkerStyle(expressions);
+  }
+
+  /** Whether any property depends on the camera zoom. */
+  public boolean usesZoom() {
+    return usesZoom;
+  }
+
+  /** Whether any property reads the attribute {@code key}. */
+  public boolean dependsOnAttribute(String key) {
+    return attributeKeys.contains(key);
+  }
+
+  /** Converts an evaluated color to an AARRGGBB int, or null if it is not a color. */
+  @Nullable
+  public static Integer colorIntFromValue(@Nullable Object value) {
+    if (value instanceof Double) {
+      return (int) ((Double) value).longValue();
+    }
+    if (!(value instanceof String)) {
+      return null;
+    }
+    String string = (String) value;
+    if (!string.startsWith("#") || (string.length() != 7 && string.length() != 9)) {
+      return null;
+    }
+    long rgba;
+    try {
+      rgba = Long.parseLong(string.substring(1), 16);
+    } catch (NumberFormatException e) {
+      return null;
+    }
+    // Reorder CSS #RRGGBBAA to AARRGGBB.
+    return string.length() == 7
+        ? (int) (0xFF000000L | rgba)
+        : (int) (((rgba & 0xFF) << 24) | (rgba >> 8));
+  }
+
+  /** Hue of an AARRGGBB color, as expected by default marker icons. */
+  public static float hueOfColor(int color) {
+    float[] hsv = new float[3];
+    Color.colorToHSV(color, hsv);
+    return hsv[0];
+  }
+
+  /** Parses a JSON object of attribute values into the value model used by expressions. */
+  @NonNull
+  public static Map<String, Object> attributesFromJson(@NonNull String json) throws JSONException {
+    return attributesFromJson(new JSONObject(json));
+  }
+
+  /** Converts a parsed JSON object of attribute values into the value model used by expressions. */
+  @NonNull
+  public static Map<String, Object> attributesFromJson(@NonNull JSONObject object) {
+    Map<String, Object> attributes = new HashMap<>();
+    Iterator<String> keys = object.keys();
+    while (keys.hasNext()) {
+      String key = keys.next();
+      Object value = StyleExpression.normalize(object.opt(key));
+      if (value != null) {
+        attributes.put(key, value);
+      }
+    }
+    return attributes;
+  }
+}
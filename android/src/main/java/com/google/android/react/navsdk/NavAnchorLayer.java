@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import android.content.Context;
+import android.view.View;
+import android.view.ViewGroup;
+import android.view.ViewParent;
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Transparent container stacked above the map that hosts the React children of a NavView. Children
+ * keep the positions React assigns them; {@link NavAnchorView} children are additionally moved by
+ * the {@link MapViewController} from the map projection. Touches that miss every child fall
+ * through to the map.
+ */
+public class NavAnchorLayer extends ViewGroup {
+  /** Positions anchored views from the current map projection. */
+  public interface AnchorLayoutListener {
+    void onLayoutAnchoredViews(@NonNull List<NavAnchorView> views);
+  }
+
+  @Nullable private AnchorLayoutListener anchorLayoutListener;
+
+  // Cached so camera frames do not filter the child list; rebuilt when children change.
+  @Nullable private List<NavAnchorView> anchoredViews;
+
+  public NavAnchorLayer(Context context) {
+    super(context);
+  }
+
+  /** Returns the anchor layer among the children of {@code parent}, if any. */
+  @Nullable
+  public static NavAnchorLayer find(@Nullable ViewParent parent) {
+    if (!(parent instanceof ViewGroup)) {
+      return null;
+    }
+    ViewGroup group = (ViewGroup) parent;
+    for (int i = 0; i < group.getChildCount(); i++) {
+      View child = group.getChildAt(i);
+      if (child instanceof NavAnchorLayer) {
+        return (NavAnchorLayer) child;
+      }
+    }
+    return null;
+  }
+
+  public void setAnchorLayoutListener(@Nullable AnchorLayoutListener listener) {
+    anchorLayoutListener = listener;
+  }
+
+  @NonNull
+  public List<NavAnchorView> getAnchoredViews() {
+    if (anchoredViews == null) {
+      List<NavAnchorView> views = new ArrayList<>();
+      for (int i = 0; i < getChildCount(); i++) {
+        View child = getChildAt(i);
+        if (child instanceof NavAnchorView) {
+          views.add((NavAnchorView) child);
+        }
+      }
+      anchoredViews = views;
+    }
+    return anchoredViews;
+  }
+
+  /** Repositions a single anchored view, e.g. after its coordinate changed. */
+  public void requestAnchorLayout(@NonNull NavAnchorView view) {
+    if (anchorLayoutListener != null) {
+      anchorLayoutListener.onLayoutAnchoredViews(Collections.singletonList(view));
+    }
+  }
+
+  @Override
+  public void onViewAdded(View child) {
+    super.onViewAdded(child);
+    if (child instanceof NavAnchorView) {
+      anchoredViews = null;
+      requestAnchorLayout((NavAnchorView) child);
+    }
+  }
+
+  @Override
+  public void onViewRemoved(View child) {
+    super.onViewRemoved(child);
+    if (child instanceof NavAnchorView) {
+      anchoredViews = null;
+    }
+  }
+
+  @Override
+  protected void onSizeChanged(int w, int h, int oldw, int oldh) {
+    super.onSizeChanged(w, h, oldw, oldh);
+    // The culling rect follows the layer bounds.
+    if (anchorLayoutListener != null && !getAnchoredViews().isEmpty()) {
+      anchorLayoutListener.onLayoutAnchoredViews(getAnchoredViews());
+    }
+  }
+
+  @Override
+  protected void onLayout(boolean changed, int left, int top, int right, int bottom) {
+    // React Native lays out the children.
+  }
+
+  @Override
+  public void requestLayout() {
+    // No-op, like ReactViewGroup: layout is driven by React Native and the hosting NavView.
+  }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import android.content.Context;
+import android.view.View;
+import com.facebook.react.views.view.ReactViewGroup;
+
+/**
+ * React Native view pinned to a map coordinate. It lives in the {@link NavAnchorLayer} of its
+ * NavView and is moved with translations, so React layout passes never fight the projection.
+ */
+public class NavAnchorView extends ReactViewGroup {
+  private double latitude;
+  private double longitude;
+  private float anchorX = 0.5f;
+  private float anchorY = 1.0f;
+
+  private float pointX;
+  private float pointY;
+  private boolean placed;
+  private boolean visible;
+
+  public NavAnchorView(Context context) {
+    super(context);
+    // Stay hidden until the first projection, so the view never flashes at the map origin.
+    setVisibility(View.INVISIBLE);
+  }
+
+  public double getLatitude() {
+    return latitude;
+  }
+
+  public double getLongitude() {
+    return longitude;
+  }
+
+  public float getAnchorX() {
+    return anchorX;
+  }
+
+  public float getAnchorY() {
+    return anchorY;
+  }
+
+  void setCoordinate(double latitude, double longitude) {
+    this.latitude = latitude;
+    this.longitude = longitude;
+  }
+
+  void setAnchor(float anchorX, float anchorY) {
+    this.anchorX = anchorX;
+    this.anchorY = anchorY;
+  }
+
+  /** Asks the hosting layer to reproject this view after a prop change. */
+  void onAnchorChanged() {
+    if (getParent() instanceof NavAnchorLayer) {
+      ((NavAnchorLayer) getParent()).requestAnchorLayout(this);
+    } else if (placed) {
+      placeAt(pointX, pointY, visible);
+    }
+  }
+
+  /**
+   * Places the anchor point of this view on ({@code x}, {@code y}) in layer pixels. Culled views
+   * are made invisible, which also excludes them from touch handling.
+   */
+  public void placeAt(float x, float y, boolean visible) {
+    this.pointX = x;
+    this.pointY = y;
+    this.visible = visible;
+    this.placed = true;
+
+    int visibility = visible ? View.VISIBLE : View.INVISIBLE;
+    if (getVisibility() != visibility) {
+      setVisibility(visibility);
+    }
+    if (!visible) {
+      return;
+    }
+    setTranslationX(x - anchorX * getWidth() - getLeft());
+    setTranslationY(y - anchorY * getHeight() - getTop());
+  }
+
+  @Override
+  protected void onLayout(boolean changed, int left, int top, int right, int bottom) {
+    super.onLayout(changed, left, top, right, bottom);
+    // React moved or resized the view; keep the anchor point on the projected coordinate.
+    if (placed && changed) {
+      placeAt(pointX, pointY, visible);
+    }
+  }
+}
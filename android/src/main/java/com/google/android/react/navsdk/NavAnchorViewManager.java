@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import com.facebook.react.module.annotations.ReactModule;
+import com.facebook.react.uimanager.ThemedReactContext;
+import com.facebook.react.uimanager.ViewGroupManager;
+import com.facebook.react.uimanager.ViewManagerDelegate;
+import com.facebook.react.viewmanagers.NavAnchorViewManagerDelegate;
+import com.facebook.react.viewmanagers.NavAnchorViewManagerInterface;
+
+/** Manages {@link NavAnchorView}, the React Native views pinned to map coordinates. */
+@ReactModule(name = NavAnchorViewManager.REACT_CLASS)
+public class NavAnchorViewManager extends ViewGroupManager<NavAnchorView>
+    implements NavAnchorViewManagerInterface<NavAnchorView> {
+
+  public static final String REACT_CLASS = "NavAnchorView";
+
+  private final ViewManagerDelegate<NavAnchorView> mDelegate;
+
+  public NavAnchorViewManager() {
+    mDelegate = new NavAnchorViewManagerDelegate<>(this);
+  }
+
+  @Override
+  @Nullable
+  public ViewManagerDelegate<NavAnchorView> getDelegate() {
+    return mDelegate;
+  }
+
+  @NonNull
+  @Override
+  public String getName() {
+    return REACT_CLASS;
+  }
+
+  @NonNull
+  @Override
+  protected NavAnchorView createViewInstance(@NonNull ThemedReactContext context) {
+    return new NavAnchorView(context);
+  }
+
+  @Override
+  public void setLatitude(NavAnchorView view, double latitude) {
+    view.setCoordinate(latitude, view.getLongitude());
+  }
+
+  @Override
+  public void setLongitude(NavAnchorView view, double longitude) {
+    view.setCoordinate(view.getLatitude(), longitude);
+  }
+
+  @Override
+  public void setAnchorX(NavAnchorView view, float anchorX) {
+    view.setAnchor(anchorX, view.getAnchorY());
+  }
+
+  @Override
+  public void setAnchorY(NavAnchorView view, float anchorY) {
+    view.setAnchor(view.getAnchorX(), anchorY);
+  }
+
+  // Coordinate and anchor props arrive one by one; reproject once per update.
+  @Override
+  protected void onAfterUpdateTransaction(@NonNull NavAnchorView view) {
+    super.onAfterUpdateTransaction(view);
+    view.onAnchorChanged();
+  }
+}
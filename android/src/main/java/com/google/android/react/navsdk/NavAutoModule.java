@@ -612,6 +612,20 @@ public class NavAutoModule extends NativeNavAutoModuleSpec
         });
   }
 
+  @Override
+  public void fitCameraToOverlays(ReadableMap options, final Promise promise) {
+    final Map<String, Object> optionsMap = options.toHashMap();
+    final float density = getReactApplicationContext().getResources().getDisplayMetrics().density;
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          if (mMapViewController == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          promise.resolve(mMapViewController.fitCameraToOverlays(optionsMap, density));
+        });
+  }
+
   @Override
   public void isAutoScreenAvailable(final Promise promise) {
     promise.resolve(mMapViewController != null);
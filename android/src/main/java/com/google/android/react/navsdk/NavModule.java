@@ -63,6 +63,8 @@ import java.util.concurrent.CopyOnWriteArrayList;
 public class NavModule extends NativeNavModuleSpec
     implements INavigationCallback, LifecycleEventListener {
   public static final String REACT_CLASS = NAME;
+  // Stops within this distance of the destination of a route leg are on that leg.
+  private static final double TIME_WINDOW_MATCH_RADIUS_METERS = 50;
   private static NavModule instance;
   private static ModuleReadyListener moduleReadyListener;
 
@@ -70,14 +72,28 @@ public class NavModule extends NativeNavModuleSpec
   private Navigator mNavigator;
   private final ArrayList<Waypoint> mWaypoints = new ArrayList<>();
   private ListenableResultFuture<Navigator.RouteStatus> pendingRoute;
+  private final Object mRouteRequestLock = new Object();
+  private int mRouteRequestGeneration = 0;
+  private Promise mPendingRoutePromise;
   private RoadSnappedLocationProvider mRoadSnappedLocationProvider;
   private NavViewManager mNavViewManager;
   private final CopyOnWriteArrayList<NavigationReadyListener> mNavigationReadyListeners =
       new CopyOnWriteArrayList<>();
   private boolean mIsListeningRoadSnappedLocation = false;
+  // Set from the module thread and read from the UI thread, or the other way round.
+  private volatile boolean mIsSuspended = false;
+  private volatile boolean mResumeGuidanceOnResume = false;
+  private boolean mResumeLocationUpdatesOnResume = false;
+  private boolean mIsSimulationPaused = false;
   private LocationListener mLocationListener;
   private Navigator.ArrivalListener mArrivalListener;
   private Navigator.RouteChangedListener mRouteChangedListener;
+  private final RouteDiffer mRouteDiffer = new RouteDiffer();
+  private final ManeuverIndex mManeuverIndex = new ManeuverIndex();
+  // Schedule of the last evaluated stop sequence, kept to re-evaluate single-stop edits. Only
+  // accessed on the UI thread.
+  private TimeWindowEvaluator mTimeWindowEvaluator;
+  private Location mLastRoadSnappedLocation;
   private Navigator.TrafficUpdatedListener mTrafficUpdatedListener;
   private Navigator.ReroutingListener mReroutingListener;
   private Navigator.RemainingTimeOrDistanceChangedListener mRemainingTimeOrDistanceChangedListener;
@@ -167,9 +183,13 @@ public class NavModule extends NativeNavModuleSpec
     }
 
     mIsListeningRoadSnappedLocation = false;
+    mIsSuspended = false;
+    cancelPendingRouteRequest();
     removeLocationListener();
     removeNavigationListeners();
     mWaypoints.clear();
+    mRouteDiffer.reset();
+    mManeuverIndex.reset(null);
 
     for (NavigationReadyListener listener : mNavigationReadyListeners) {
       listener.onReady(false);
@@ -181,10 +201,78 @@ public class NavModule extends NativeNavModuleSpec
           navigator.clearDestinations();
           navigator.stopGuidance();
           navigator.getSimulator().unsetUserLocation();
+          mTimeWindowEvaluator = null;
+          mLastRoadSnappedLocation = null;
           promise.resolve(true);
         });
   }
 
+  /**
+   * Silences navigation without tearing down the session. Listeners, guidance, simulation and
+   * road-snapped location updates are stopped, while the navigator, waypoints and attached views
+   * are kept so that {@link #resumeNavigation} can restore them without a full re-initialization.
+   */
+  @Override
+  public void suspendNavigation(final Promise promise) {
+    if (!ensureNavigatorAvailable(promise)) {
+      return;
+    }
+    if (mIsSuspended) {
+      promise.resolve(null);
+      return;
+    }
+
+    mIsSuspended = true;
+    mResumeLocationUpdatesOnResume = mIsListeningRoadSnappedLocation;
+    mIsListeningRoadSnappedLocation = false;
+    removeLocationListener();
+    removeNavigationListeners();
+
+    final Navigator navigator = mNavigator;
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          mResumeGuidanceOnResume = navigator.isGuidanceRunning();
+          if (mResumeGuidanceOnResume) {
+            navigator.stopGuidance();
+          }
+          navigator.getSimulator().pause();
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void resumeNavigation(final Promise promise) {
+    if (!ensureNavigatorAvailable(promise)) {
+      return;
+    }
+    if (!mIsSuspended) {
+      promise.resolve(null);
+      return;
+    }
+
+    mIsSuspended = false;
+    registerNavigationListeners();
+    if (mResumeLocationUpdatesOnResume) {
+      registerLocationListener();
+      mIsListeningRoadSnappedLocation = true;
+    }
+
+    final Navigator navigator = mNavigator;
+    final boolean hasWaypoints = !mWaypoints.isEmpty();
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          if (!mIsSimulationPaused) {
+            navigator.getSimulator().resume();
+          }
+          // Read on the UI thread, after the suspend runnable that recorded it.
+          if (mResumeGuidanceOnResume && hasWaypoints) {
+            navigator.startGuidance();
+            emitOnStartGuidance();
+          }
+          promise.resolve(null);
+        });
+  }
+
   @Override
   public void showTermsAndConditionsDialog(
       String title,
@@ -458,7 +546,25 @@ public class NavModule extends NativeNavModuleSpec
         new Navigator.RouteChangedListener() {
           @Override
           public void onRouteChanged() {
-            emitOnRouteChanged();
+            // Reported as a patch of the previous route.
+            WritableMap params = Arguments.createMap();
+            List<RouteSegment> routeSegments = mNavigator.getRouteSegments();
+            params.putMap("routeChange", mRouteDiffer.diff(routeSegments));
+            mManeuverIndex.reset(routeSegments);
+            if (mTimeWindowEvaluator != null) {
+              // The new leg times are measured from where the car is now, so the sequence
+              // restarts here.
+              Location location = mLastRoadSnappedLocation;
+              mTimeWindowEvaluator.setOrigin(
+                  location != null ? location.getLatitude() : mTimeWindowEvaluator.getOriginLat(),
+                  location != null ? location.getLongitude() : mTimeWindowEvaluator.getOriginLng(),
+                  System.currentTimeMillis() / 1000.0);
+              mTimeWindowEvaluator.setRouteLegs(getRouteLegTimes(mNavigator));
+            }
+            emitOnRouteChanged(params);
+            if (mNavViewManager != null) {
+              mNavViewManager.onRouteChanged(routeSegments);
+            }
           }
         };
     mNavigator.addRouteChangedListener(mRouteChangedListener);
@@ -525,68 +631,239 @@ public class NavModule extends NativeNavModuleSpec
     }
   }
 
-  private void createWaypoint(Map map) {
-    String placeId = CollectionUtil.getString("placeId", map);
-    String title = CollectionUtil.getString("title", map);
-
-    Double lat = null;
-    Double lng = null;
-
-    if (map.containsKey("position")) {
-      Map latlng = (Map) map.get("position");
-      if (latlng.get(Constants.LAT_FIELD_KEY) != null)
-        lat = Double.parseDouble(latlng.get(Constants.LAT_FIELD_KEY).toString());
-      if (latlng.get(Constants.LNG_FIELD_KEY) != null)
-        lng = Double.parseDouble(latlng.get(Constants.LNG_FIELD_KEY).toString());
+  /**
+   * Builds navigation waypoints from a typed batch in a single pass. Waypoints without a place ID
+   * or explicit position take their coordinate from the packed {@code [lat, lng, ...]} array at the
+   * same index; packed coordinates beyond the end of the waypoint list become plain waypoints.
+   * Every invalid entry is added to {@code errors} as {@code {index, code, message}}.
+   */
+  private static List<Waypoint> getWaypointsFromBatch(ReadableMap batch, WritableArray errors) {
+    ReadableArray specs = batch.hasKey("waypoints") ? batch.getArray("waypoints") : null;
+    ReadableArray packed =
+        batch.hasKey("packedPositions") ? batch.getArray("packedPositions") : null;
+    int specCount = specs != null ? specs.size() : 0;
+    int packedSize = packed != null ? packed.size() : 0;
+    int packedCount = packedSize / 2;
+    int count = Math.max(specCount, packedCount);
+
+    if (packedSize % 2 != 0) {
+      addWaypointError(
+          errors,
+          packedCount,
+          "INVALID_PACKED_POSITIONS",
+          "Packed positions must contain lat/lng pairs");
     }
 
-    boolean vehicleStopover = CollectionUtil.getBool("vehicleStopover", map, false);
-    boolean preferSameSideOfRoad = CollectionUtil.getBool("preferSameSideOfRoad", map, false);
-
-    try {
-      Waypoint.Builder waypointBuilder =
-          Waypoint.builder()
-              .setTitle(title)
-              .setVehicleStopover(vehicleStopover)
-              .setPreferSameSideOfRoad(preferSameSideOfRoad);
-
-      if (map.containsKey("preferredHeading")) {
-        int preferredHeading = (int) map.get("preferredHeading");
-        waypointBuilder.setPreferredHeading(preferredHeading);
+    List<Waypoint> result = new ArrayList<>(count);
+    String previousPlaceId = null;
+    boolean hasPreviousPosition = false;
+    double previousLat = 0;
+    double previousLng = 0;
+
+    for (int i = 0; i < count; i++) {
+      ReadableMap spec = i < specCount ? specs.getMap(i) : null;
+      String placeId = getOptionalString(spec, "placeId");
+      String title = getOptionalString(spec, "title");
+
+      boolean hasPosition = true;
+      double lat = 0;
+      double lng = 0;
+      if (spec != null && spec.hasKey("position") && !spec.isNull("position")) {
+        ReadableMap position = spec.getMap("position");
+        lat = position.getDouble(Constants.LAT_FIELD_KEY);
+        lng = position.getDouble(Constants.LNG_FIELD_KEY);
+      } else if (i < packedCount) {
+        lat = packed.getDouble(2 * i);
+        lng = packed.getDouble(2 * i + 1);
+      } else {
+        hasPosition = false;
       }
 
-      if (placeId == null || placeId.isEmpty() && lat != null && lng != null) {
-        mWaypoints.add(waypointBuilder.setLatLng(lat, lng).build());
-      } else {
-        mWaypoints.add(waypointBuilder.setPlaceIdString(placeId).build());
+      Waypoint.Builder builder = Waypoint.builder().setTitle(title);
+      try {
+        if (placeId != null && !placeId.isEmpty()) {
+          if (placeId.equals(previousPlaceId)) {
+            addWaypointError(
+                errors, i, "DUPLICATE_WAYPOINT", "Place ID repeats the previous waypoint");
+            continue;
+          }
+          builder.setPlaceIdString(placeId);
+          previousPlaceId = placeId;
+          hasPreviousPosition = false;
+        } else if (hasPosition) {
+          if (!(lat >= -90 && lat <= 90 && lng >= -180 && lng <= 180)) {
+            addWaypointError(errors, i, "INVALID_POSITION", "Position is out of range");
+            continue;
+          }
+          if (hasPreviousPosition
+              && Math.abs(lat - previousLat) < 1e-6
+              && Math.abs(lng - previousLng) < 1e-6) {
+            addWaypointError(
+                errors, i, "DUPLICATE_WAYPOINT", "Position repeats the previous waypoint");
+            continue;
+          }
+          builder.setLatLng(lat, lng);
+          hasPreviousPosition = true;
+          previousLat = lat;
+          previousLng = lng;
+          previousPlaceId = null;
+        } else {
+          addWaypointError(
+              errors, i, "MISSING_LOCATION", "Waypoint requires a placeId or a position");
+          continue;
+        }
+
+        if (spec != null) {
+          if (spec.hasKey("preferredHeading") && !spec.isNull("preferredHeading")) {
+            builder.setPreferredHeading((int) spec.getDouble("preferredHeading"));
+          }
+          builder
+              .setVehicleStopover(getOptionalBoolean(spec, "vehicleStopover"))
+              .setPreferSameSideOfRoad(getOptionalBoolean(spec, "preferSameSideOfRoad"));
+        }
+        result.add(builder.build());
+      } catch (Waypoint.UnsupportedPlaceIdException e) {
+        addWaypointError(errors, i, "INVALID_PLACE_ID", "Place ID is not supported: " + placeId);
+      } catch (Waypoint.InvalidSegmentHeadingException e) {
+        addWaypointError(
+            errors, i, "INVALID_HEADING", "Preferred heading has to be between 0 and 360");
       }
-    } catch (Waypoint.UnsupportedPlaceIdException e) {
-      logDebugInfo("Error starting navigation: Place ID is not supported: " + placeId);
-    } catch (Waypoint.InvalidSegmentHeadingException e) {
-      logDebugInfo("Error starting navigation: Preferred heading has to be between 0 and 360");
     }
+    return result;
+  }
+
+  @Nullable
+  private static String getOptionalString(@Nullable ReadableMap map, String key) {
+    return map != null && map.hasKey(key) && !map.isNull(key) ? map.getString(key) : null;
+  }
+
+  private static boolean getOptionalBoolean(ReadableMap map, String key) {
+    return map.hasKey(key) && !map.isNull(key) && map.getBoolean(key);
+  }
+
+  private static void addWaypointError(
+      WritableArray errors, int index, String code, String message) {
+    WritableMap error = Arguments.createMap();
+    error.putInt("index", index);
+    error.putString("code", code);
+    error.putString("message", message);
+    errors.pushMap(error);
   }
 
   @Override
   public void setDestinations(
-      ReadableArray waypoints,
+      ReadableMap waypoints,
       @Nullable ReadableMap routingOptions,
       @Nullable ReadableMap displayOptions,
       @Nullable ReadableMap routeTokenOptions,
+      double debounceMs,
       final Promise promise) {
     if (!ensureNavigatorAvailable(promise)) {
       return;
     }
 
-    pendingRoute = null; // reset pendingRoute.
-    mWaypoints.clear(); // reset waypoints
+    // Validate and build all waypoints up front, so that an invalid list is reported without
+    // superseding the request that is currently in flight.
+    WritableArray waypointErrors = Arguments.createArray();
+    final List<Waypoint> destinations = getWaypointsFromBatch(waypoints, waypointErrors);
+    if (waypointErrors.size() > 0) {
+      WritableMap userInfo = Arguments.createMap();
+      int errorCount = waypointErrors.size();
+      userInfo.putArray("errors", waypointErrors);
+      promise.reject(
+          JsErrors.INVALID_WAYPOINTS_ERROR_CODE, errorCount + " invalid waypoint(s)", userInfo);
+      return;
+    }
+
+    // Any request still in flight is superseded by this one.
+    final int generation = beginRouteRequest(promise);
+
+    if (debounceMs > 0) {
+      // Collapse bursts: only the last call within the window reaches the navigator.
+      UiThreadUtil.runOnUiThread(
+          () -> {
+            if (isCurrentRouteRequest(generation)) {
+              issueRouteRequest(
+                  generation, destinations, routingOptions, displayOptions, routeTokenOptions);
+            }
+          },
+          (long) debounceMs);
+    } else {
+      issueRouteRequest(
+          generation, destinations, routingOptions, displayOptions, routeTokenOptions);
+    }
+  }
+
+  /**
+   * Starts a new route request generation, resolving the previously pending request (if any) as
+   * {@code ROUTE_CANCELED}.
+   */
+  private int beginRouteRequest(@Nullable Promise promise) {
+    Promise supersededPromise;
+    int generation;
+    synchronized (mRouteRequestLock) {
+      generation = ++mRouteRequestGeneration;
+      supersededPromise = mPendingRoutePromise;
+      mPendingRoutePromise = promise;
+    }
+    if (supersededPromise != null) {
+      supersededPromise.resolve(
+          EnumTranslationUtil.getRouteStatusStringValue(Navigator.RouteStatus.ROUTE_CANCELED));
+    }
+    return generation;
+  }
+
+  private void cancelPendingRouteRequest() {
+    beginRouteRequest(null);
+  }
+
+  private boolean isCurrentRouteRequest(int generation) {
+    synchronized (mRouteRequestLock) {
+      return generation == mRouteRequestGeneration;
+    }
+  }
+
+  private void completeRouteRequest(int generation, Navigator.RouteStatus code) {
+    Promise pendingPromise;
+    synchronized (mRouteRequestLock) {
+      // Results of superseded requests were already resolved as ROUTE_CANCELED.
+      if (generation != mRouteRequestGeneration || mPendingRoutePromise == null) {
+        return;
+      }
+      pendingPromise = mPendingRoutePromise;
+      mPendingRoutePromise = null;
+    }
+    // Convert RouteStatus to string matching codegen RouteStatusSpec
+    pendingPromise.resolve(EnumTranslationUtil.getRouteStatusStringValue(code));
+  }
 
-    // Set up a waypoint for each place that we want to go to.
-    for (int i = 0; i < waypoints.size(); i++) {
-      Map map = waypoints.getMap(i).toHashMap();
-      createWaypoint(map);
+  private void rejectRouteRequest(int generation, String code, String message, Throwable e) {
+    Promise pendingPromise;
+    synchronized (mRouteRequestLock) {
+      if (generation != mRouteRequestGeneration || mPendingRoutePromise == null) {
+        return;
+      }
+      pendingPromise = mPendingRoutePromise;
+      mPendingRoutePromise = null;
+    }
+    pendingPromise.reject(code, message, e);
+  }
+
+  private void issueRouteRequest(
+      int generation,
+      List<Waypoint> destinations,
+      @Nullable ReadableMap routingOptions,
+      @Nullable ReadableMap displayOptions,
+      @Nullable ReadableMap routeTokenOptions) {
+    if (mNavigator == null) {
+      completeRouteRequest(generation, Navigator.RouteStatus.ROUTE_CANCELED);
+      return;
     }
 
+    pendingRoute = null; // reset pendingRoute.
+    mWaypoints.clear(); // reset waypoints
+    mWaypoints.addAll(destinations);
+
     // Check valid flag for codegen nullable objects pattern
     boolean hasValidDisplayOptions =
         displayOptions != null
@@ -614,7 +891,8 @@ public class NavModule extends NativeNavModuleSpec
         customRoutesOptions =
             ObjectTranslationUtil.getCustomRoutesOptionsFromMap(routeTokenOptions.toHashMap());
       } catch (IllegalStateException e) {
-        promise.reject("routeTokenMalformed", "The route token passed is malformed", e);
+        rejectRouteRequest(
+            generation, "routeTokenMalformed", "The route token passed is malformed", e);
         return;
       }
 
@@ -644,14 +922,10 @@ public class NavModule extends NativeNavModuleSpec
 
     if (pendingRoute != null) {
       // Set an action to perform when a route is determined to the destination
-      pendingRoute.setOnResultListener(
-          code -> {
-            // Convert RouteStatus to string matching codegen RouteStatusSpec
-            promise.resolve(EnumTranslationUtil.getRouteStatusStringValue(code));
-          });
+      pendingRoute.setOnResultListener(code -> completeRouteRequest(generation, code));
     } else {
       // If no pending route, resolve with OK status
-      promise.resolve(EnumTranslationUtil.getRouteStatusStringValue(Navigator.RouteStatus.OK));
+      completeRouteRequest(generation, Navigator.RouteStatus.OK);
     }
   }
 
@@ -660,6 +934,7 @@ public class NavModule extends NativeNavModuleSpec
     if (!ensureNavigatorAvailable(promise)) {
       return;
     }
+    cancelPendingRouteRequest();
     mWaypoints.clear(); // reset waypoints
     mNavigator.clearDestinations();
     promise.resolve(true);
@@ -713,6 +988,7 @@ public class NavModule extends NativeNavModuleSpec
         .getSimulator()
         .simulateLocationsAlongExistingRoute(
             new SimulationOptions().speedMultiplier(speedMultiplier));
+    mIsSimulationPaused = false;
     promise.resolve(null);
   }
 
@@ -723,6 +999,7 @@ public class NavModule extends NativeNavModuleSpec
       return;
     }
     mNavigator.getSimulator().unsetUserLocation();
+    mIsSimulationPaused = false;
     promise.resolve(null);
   }
 
@@ -733,6 +1010,7 @@ public class NavModule extends NativeNavModuleSpec
       return;
     }
     mNavigator.getSimulator().pause();
+    mIsSimulationPaused = true;
     promise.resolve(null);
   }
 
@@ -742,7 +1020,11 @@ public class NavModule extends NativeNavModuleSpec
       promise.reject(JsErrors.NO_NAVIGATOR_ERROR_CODE, JsErrors.NO_NAVIGATOR_ERROR_MESSAGE);
       return;
     }
-    mNavigator.getSimulator().resume();
+    // While suspended, the simulator is resumed by resumeNavigation.
+    if (!mIsSuspended) {
+      mNavigator.getSimulator().resume();
+    }
+    mIsSimulationPaused = false;
     promise.resolve(null);
   }
 
@@ -858,6 +1140,206 @@ public class NavModule extends NativeNavModuleSpec
     promise.resolve(arr);
   }
 
+  @Override
+  public void getManeuverPoints(final Promise promise) {
+    if (mNavigator == null) {
+      promise.reject(JsErrors.NO_NAVIGATOR_ERROR_CODE, JsErrors.NO_NAVIGATOR_ERROR_MESSAGE);
+      return;
+    }
+
+    promise.resolve(mManeuverIndex.getManeuverPoints());
+  }
+
+  @Override
+  public void evaluateTimeWindows(ReadableMap request, final Promise promise) {
+    if (mNavigator == null) {
+      promise.reject(JsErrors.NO_NAVIGATOR_ERROR_CODE, JsErrors.NO_NAVIGATOR_ERROR_MESSAGE);
+      return;
+    }
+
+    ReadableArray specs = request.getArray("stops");
+    int count = specs != null ? specs.size() : 0;
+    final List<TimeWindowEvaluator.Stop> stops = new ArrayList<>(count);
+    for (int i = 0; i < count; i++) {
+      TimeWindowEvaluator.Stop stop = getTimeWindowStop(specs.getMap(i));
+      if (stop == null) {
+        promise.reject(
+            JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE,
+            "Stop " + i + " has an invalid position or time window");
+        return;
+      }
+      stops.add(stop);
+    }
+
+    final double speed = getOptionalDouble(request, "speedMetersPerSecond", 11);
+    final double detourFactor = getOptionalDouble(request, "detourFactor", 1.3);
+    if (!(speed > 0) || !(detourFactor > 0)) {
+      promise.reject(
+          JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE, "Speed and detour factor must be positive");
+      return;
+    }
+    final ReadableMap origin = request.hasKey("origin") ? request.getMap("origin") : null;
+    final Navigator navigator = mNavigator;
+    final double departureTime =
+        getOptionalDouble(request, "departureTime", System.currentTimeMillis()) / 1000;
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          double originLat;
+          double originLng;
+          if (origin != null) {
+            originLat = origin.getDouble(Constants.LAT_FIELD_KEY);
+            originLng = origin.getDouble(Constants.LNG_FIELD_KEY);
+          } else if (mLastRoadSnappedLocation != null) {
+            originLat = mLastRoadSnappedLocation.getLatitude();
+            originLng = mLastRoadSnappedLocation.getLongitude();
+          } else {
+            promise.reject(
+                JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE,
+                "An origin is required while the current location is unknown");
+            return;
+          }
+
+          TimeWindowEvaluator evaluator =
+              new TimeWindowEvaluator(speed, detourFactor, TIME_WINDOW_MATCH_RADIUS_METERS);
+          evaluator.setOrigin(originLat, originLng, departureTime);
+          evaluator.setRouteLegs(getRouteLegTimes(navigator));
+          evaluator.setStops(stops);
+          evaluator.evaluate();
+          mTimeWindowEvaluator = evaluator;
+          promise.resolve(getTimeWindowSchedule(evaluator, 0));
+        });
+  }
+
+  @Override
+  public void updateTimeWindowStop(ReadableMap edit, final Promise promise) {
+    final int type = (int) edit.getDouble("type");
+    final double index = edit.getDouble("index");
+    final double toIndex = getOptionalDouble(edit, "toIndex", -1);
+    if (index != Math.floor(index) || (type == 3 && toIndex != Math.floor(toIndex))) {
+      promise.reject(
+          JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE, "Stop indices must be whole numbers");
+      return;
+    }
+    TimeWindowEvaluator.Stop parsedStop = null;
+    if (type == 0 || type == 1) {
+      parsedStop = edit.hasKey("stop") ? getTimeWindowStop(edit.getMap("stop")) : null;
+      if (parsedStop == null) {
+        promise.reject(JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE, "The stop is missing or invalid");
+        return;
+      }
+    }
+    final TimeWindowEvaluator.Stop stop = parsedStop;
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          TimeWindowEvaluator evaluator = mTimeWindowEvaluator;
+          if (evaluator == null) {
+            promise.reject(
+                JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE, "Time windows have not been evaluated");
+            return;
+          }
+
+          int count = evaluator.getStopCount();
+          // Inserts may append a stop; every other edit needs an existing stop.
+          int limit = type == 1 ? count + 1 : count;
+          if (!(index >= 0 && index < limit) || (type == 3 && !(toIndex >= 0 && toIndex < count))) {
+            promise.reject(JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE, "Stop index is out of range");
+            return;
+          }
+
+          int position = (int) index;
+          switch (type) {
+            case 0:
+              evaluator.replaceStop(position, stop);
+              break;
+            case 1:
+              evaluator.insertStop(position, stop);
+              break;
+            case 2:
+              evaluator.removeStop(position);
+              break;
+            case 3:
+              evaluator.moveStop(position, (int) toIndex);
+              break;
+            default:
+              promise.reject(JsErrors.INVALID_TIME_WINDOWS_ERROR_CODE, "Unknown edit type");
+              return;
+          }
+          promise.resolve(getTimeWindowSchedule(evaluator, evaluator.evaluate()));
+        });
+  }
+
+  private static double getOptionalDouble(ReadableMap map, String key, double defaultValue) {
+    return map.hasKey(key) && !map.isNull(key) ? map.getDouble(key) : defaultValue;
+  }
+
+  /**
+   * Converts a stop from JS, with times in milliseconds since the epoch. Returns null if the stop
+   * is invalid.
+   */
+  @Nullable
+  private static TimeWindowEvaluator.Stop getTimeWindowStop(@Nullable ReadableMap spec) {
+    if (spec == null) {
+      return null;
+    }
+    double lat = spec.getDouble(Constants.LAT_FIELD_KEY);
+    double lng = spec.getDouble(Constants.LNG_FIELD_KEY);
+    double windowStart = getOptionalDouble(spec, "windowStart", Double.NEGATIVE_INFINITY) / 1000;
+    double windowEnd = getOptionalDouble(spec, "windowEnd", Double.POSITIVE_INFINITY) / 1000;
+    double serviceSeconds = getOptionalDouble(spec, "serviceSeconds", 0);
+    if (!(Math.abs(lat) <= 90 && Math.abs(lng) <= 180)
+        || windowStart > windowEnd
+        || !(serviceSeconds >= 0)) {
+      return null;
+    }
+    return new TimeWindowEvaluator.Stop(lat, lng, windowStart, windowEnd, serviceSeconds);
+  }
+
+  /**
+   * Travel time of each leg of the current route from the end of the previous leg, derived from
+   * the cached time to each remaining waypoint. Times the navigator does not know are NaN.
+   */
+  private static List<TimeWindowEvaluator.RouteLeg> getRouteLegTimes(Navigator navigator) {
+    List<RouteSegment> segments = navigator.getRouteSegments();
+    List<TimeAndDistance> times = navigator.getTimeAndDistanceList();
+    List<TimeWindowEvaluator.RouteLeg> legs = new ArrayList<>(segments.size());
+    double previous = 0;
+    for (int i = 0; i < segments.size(); i++) {
+      LatLng destination = segments.get(i).getDestinationLatLng();
+      double time = i < times.size() ? times.get(i).getSeconds() : Double.NaN;
+      double seconds = Double.isNaN(time) ? Double.NaN : Math.max(0, time - previous);
+      legs.add(
+          new TimeWindowEvaluator.RouteLeg(destination.latitude, destination.longitude, seconds));
+      previous = time;
+    }
+    return legs;
+  }
+
+  /** Packs the schedules from {@code first} to the end for JS, with times in milliseconds. */
+  private static WritableMap getTimeWindowSchedule(TimeWindowEvaluator evaluator, int first) {
+    WritableArray arrivalTimes = Arguments.createArray();
+    WritableArray waitSeconds = Arguments.createArray();
+    WritableArray slackSeconds = Arguments.createArray();
+    WritableArray routed = Arguments.createArray();
+    for (int i = first; i < evaluator.getStopCount(); i++) {
+      TimeWindowEvaluator.Schedule schedule = evaluator.getSchedule(i);
+      arrivalTimes.pushDouble(schedule.arrival * 1000);
+      waitSeconds.pushDouble(schedule.waitSeconds);
+      slackSeconds.pushDouble(
+          Double.isInfinite(schedule.slackSeconds) ? Double.MAX_VALUE : schedule.slackSeconds);
+      routed.pushBoolean(schedule.routed);
+    }
+    WritableMap map = Arguments.createMap();
+    map.putInt("firstIndex", first);
+    map.putInt("stopCount", evaluator.getStopCount());
+    map.putArray("arrivalTimes", arrivalTimes);
+    map.putArray("waitSeconds", waitSeconds);
+    map.putArray("slackSeconds", slackSeconds);
+    map.putArray("routed", routed);
+    return map;
+  }
+
   @Override
   public void getTraveledPath(final Promise promise) {
     if (mNavigator == null) {
@@ -933,6 +1415,12 @@ public class NavModule extends NativeNavModuleSpec
 
   @Override
   public void startUpdatingLocation(final Promise promise) {
+    if (mIsSuspended) {
+      // Location updates will be delivered once navigation is resumed.
+      mResumeLocationUpdatesOnResume = true;
+      promise.resolve(null);
+      return;
+    }
     registerLocationListener();
     mIsListeningRoadSnappedLocation = true;
     promise.resolve(null);
@@ -941,6 +1429,7 @@ public class NavModule extends NativeNavModuleSpec
   @Override
   public void stopUpdatingLocation(final Promise promise) {
     mIsListeningRoadSnappedLocation = false;
+    mResumeLocationUpdatesOnResume = false;
     removeLocationListener();
     promise.resolve(null);
   }
@@ -954,6 +1443,11 @@ public class NavModule extends NativeNavModuleSpec
           new LocationListener() {
             @Override
             public void onLocationChanged(final Location location) {
+              mLastRoadSnappedLocation = location;
+              if (mNavViewManager != null) {
+                mNavViewManager.onRoadSnappedLocation(
+                    new LatLng(location.getLatitude(), location.getLongitude()));
+              }
               if (mIsListeningRoadSnappedLocation) {
                 WritableMap params = Arguments.createMap();
                 params.putMap("location", ObjectTranslationUtil.getMapFromLocation(location));
@@ -984,9 +1478,10 @@ public class NavModule extends NativeNavModuleSpec
   }
 
   private void showNavInfo(NavInfo navInfo) {
-    if (navInfo == null || reactContext == null) {
+    if (navInfo == null || reactContext == null || mIsSuspended) {
       return;
     }
+    mManeuverIndex.update(navInfo);
     WritableMap map = Arguments.createMap();
 
     map.putInt("navState", navInfo.getNavState());
@@ -1013,6 +1508,9 @@ public class NavModule extends NativeNavModuleSpec
       }
     }
     map.putArray("getRemainingSteps", remainingSteps);
+    if (mManeuverIndex.hasManeuverPoints()) {
+      map.putArray("maneuverPoints", mManeuverIndex.getManeuverPoints());
+    }
 
     WritableArray turnByTurnEvents = Arguments.createArray();
     turnByTurnEvents.pushMap(map);
@@ -1044,8 +1542,8 @@ public class NavModule extends NativeNavModuleSpec
       listener.onModuleReady();
     }
 
-    // Re-register listeners on resume.
-    if (mNavigator != null) {
+    // Re-register listeners on resume, unless navigation has been suspended from JS.
+    if (mNavigator != null && !mIsSuspended) {
       registerNavigationListeners();
       if (mIsListeningRoadSnappedLocation) {
         registerLocationListener();
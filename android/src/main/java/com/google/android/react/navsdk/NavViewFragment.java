@@ -71,6 +71,9 @@ public class NavViewFragment extends SupportNavigationFragment
   @Override
   public void onViewCreated(@NonNull View view, @Nullable Bundle savedInstanceState) {
     super.onViewCreated(view, savedInstanceState);
+    if (mMapViewController != null) {
+      mMapViewController.renewViewLifetime();
+    }
 
     setNavigationUiEnabled(NavModule.getInstance().getNavigator() != null);
 
@@ -83,6 +86,7 @@ public class NavViewFragment extends SupportNavigationFragment
 
           // Setup map listeners with the provided callback
           mMapViewController.setupMapListeners(NavViewFragment.this);
+          mMapViewController.setAnchorLayer(NavAnchorLayer.find(view.getParent()));
           applyMapColorSchemeToMap();
           applyNightModePreference();
 
@@ -269,6 +273,9 @@ public class NavViewFragment extends SupportNavigationFragment
   }
 
   private void cleanup() {
+    if (mMapViewController != null) {
+      mMapViewController.release();
+    }
     removeOnRecenterButtonClickedListener(onRecenterButtonClickedListener);
     removePromptVisibilityChangedListener(onPromptVisibilityChangedListener);
   }
@@ -25,8 +25,8 @@ import com.facebook.react.bridge.ReactApplicationContext;
 import com.facebook.react.bridge.ReadableMap;
 import com.facebook.react.common.MapBuilder;
 import com.facebook.react.module.annotations.ReactModule;
-import com.facebook.react.uimanager.SimpleViewManager;
 import com.facebook.react.uimanager.ThemedReactContext;
+import com.facebook.react.uimanager.ViewGroupManager;
 import com.facebook.react.uimanager.ViewManagerDelegate;
 import com.facebook.react.uimanager.annotations.ReactProp;
 import com.facebook.react.viewmanagers.NavViewManagerDelegate;
@@ -34,17 +34,20 @@ import com.facebook.react.viewmanagers.NavViewManagerInterface;
 import com.google.android.gms.maps.GoogleMap;
 import com.google.android.gms.maps.GoogleMapOptions;
 import com.google.android.gms.maps.model.CameraPosition;
+import com.google.android.gms.maps.model.LatLng;
+import com.google.android.libraries.navigation.RouteSegment;
 import com.google.android.libraries.navigation.StylingOptions;
 import java.lang.ref.WeakReference;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.List;
 import java.util.Map;
 
 // NavViewManager is responsible for managing both the regular map fragment as well as the
 // navigation map view fragment.
 //
 @ReactModule(name = NavViewManager.REACT_CLASS)
-public class NavViewManager extends SimpleViewManager<FrameLayout>
+public class NavViewManager extends ViewGroupManager<FrameLayout>
     implements NavViewManagerInterface<FrameLayout> {
 
   public static final String REACT_CLASS = "NavView";
@@ -53,7 +56,14 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
   private final ViewManagerDelegate<FrameLayout> mDelegate;
 
   private final HashMap<Integer, WeakReference<IMapViewFragment>> fragmentMap = new HashMap<>();
-  private final HashMap<Integer, Choreographer.FrameCallback> frameCallbackMap = new HashMap<>();
+  private final HashMap<Integer, LayoutFrameCallback> frameCallbackMap = new HashMap<>();
+
+  // Number of frame callbacks executed per view, kept for diagnostics until the view is dropped.
+  private final HashMap<Integer, Integer> frameCallbackCounts = new HashMap<>();
+
+  // Number of extra frames the fragment is re-laid out after a size change or attach, to catch
+  // child views that settle asynchronously (e.g. navigation header inflation).
+  private static final int LAYOUT_SETTLE_FRAMES = 2;
 
   // Cache the latest options per view so deferred fragment creation uses fresh
   // values.
@@ -202,10 +212,77 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
   @NonNull
   @Override
   protected FrameLayout createViewInstance(@NonNull ThemedReactContext context) {
-    FrameLayout frameLayout = new FrameLayout(reactContext);
+    FrameLayout frameLayout =
+        new FrameLayout(reactContext) {
+          @Override
+          public void requestLayout() {
+            super.requestLayout();
+            // React Native does not run layout passes for native children, so layout requests
+            // coming from the fragment's view hierarchy are serviced here instead.
+            scheduleFragmentLayout(this);
+          }
+
+          @Override
+          protected void onLayout(boolean changed, int left, int top, int right, int bottom) {
+            super.onLayout(changed, left, top, right, bottom);
+            layoutAnchorLayer(this);
+          }
+        };
+    // React children are hosted by the anchor layer, stacked above the fragment.
+    frameLayout.addView(new NavAnchorLayer(reactContext));
+    frameLayout.addOnLayoutChangeListener(
+        (v, left, top, right, bottom, oldLeft, oldTop, oldRight, oldBottom) -> {
+          if (right - left != oldRight - oldLeft || bottom - top != oldBottom - oldTop) {
+            scheduleFragmentLayout((FrameLayout) v);
+          }
+        });
     return frameLayout;
   }
 
+  /** Sizes the anchor layer to the NavView, without laying out the React children it hosts. */
+  private void layoutAnchorLayer(FrameLayout frameLayout) {
+    NavAnchorLayer layer = getAnchorLayer(frameLayout);
+    int width = frameLayout.getWidth();
+    int height = frameLayout.getHeight();
+    layer.measure(
+        View.MeasureSpec.makeMeasureSpec(width, View.MeasureSpec.EXACTLY),
+        View.MeasureSpec.makeMeasureSpec(height, View.MeasureSpec.EXACTLY));
+    layer.layout(0, 0, width, height);
+  }
+
+  @NonNull
+  private NavAnchorLayer getAnchorLayer(@NonNull FrameLayout parent) {
+    NavAnchorLayer layer = NavAnchorLayer.find(parent);
+    if (layer == null) {
+      throw new IllegalStateException("NavView has no anchor layer");
+    }
+    return layer;
+  }
+
+  // React children are mounted into the anchor layer rather than next to the fragment view, so
+  // their indices are unaffected by the fragment and they always draw above the map.
+
+  @Override
+  public void addView(@NonNull FrameLayout parent, @NonNull View child, int index) {
+    getAnchorLayer(parent).addView(child, index);
+  }
+
+  @Override
+  public int getChildCount(@NonNull FrameLayout parent) {
+    return getAnchorLayer(parent).getChildCount();
+  }
+
+  @Override
+  @Nullable
+  public View getChildAt(@NonNull FrameLayout parent, int index) {
+    return getAnchorLayer(parent).getChildAt(index);
+  }
+
+  @Override
+  public void removeViewAt(@NonNull FrameLayout parent, int index) {
+    getAnchorLayer(parent).removeViewAt(index);
+  }
+
   /**
    * Ensures the fragment view is properly measured and laid out within its parent FrameLayout. This
    * is necessary because React Native's layout system doesn't automatically propagate layout to
@@ -231,39 +308,80 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
         View.MeasureSpec.makeMeasureSpec(width, View.MeasureSpec.EXACTLY),
         View.MeasureSpec.makeMeasureSpec(height, View.MeasureSpec.EXACTLY));
     fragmentView.layout(0, 0, width, height);
+
+    // Nothing else lays out the container, so its own layout request stays pending and would stop
+    // later requests from the fragment's views at this parent. Laying it out in place clears it.
+    frameLayout.layout(
+        frameLayout.getLeft(),
+        frameLayout.getTop(),
+        frameLayout.getRight(),
+        frameLayout.getBottom());
   }
 
   /**
-   * Starts a per-frame layout loop similar to the older implementation to ensure the fragment view
-   * stays in sync with its container size.
+   * Schedules a fragment layout pass on the next frame, followed by a short settle window of
+   * {@link #LAYOUT_SETTLE_FRAMES} frames. Repeated requests while a pass is pending only extend the
+   * window, so at most one frame callback is registered per view and none run while the view size
+   * and contents are stable.
    */
-  private void startLayoutLoop(FrameLayout view) {
+  private void scheduleFragmentLayout(FrameLayout view) {
     int viewId = view.getId();
-
-    // Remove existing callback if present
-    Choreographer.FrameCallback existing = frameCallbackMap.get(viewId);
-    if (existing != null) {
-      Choreographer.getInstance().removeFrameCallback(existing);
+    if (viewId == View.NO_ID || getFragmentForViewId(viewId) == null) {
+      return;
     }
 
-    Choreographer.FrameCallback frameCallback =
-        new Choreographer.FrameCallback() {
-          @Override
-          public void doFrame(long frameTimeNanos) {
-            IMapViewFragment fragment = getFragmentForViewId(viewId);
-            if (fragment != null) {
-              layoutFragmentInView(view, fragment);
-              Choreographer.getInstance().postFrameCallback(this);
-            } else {
-              frameCallbackMap.remove(viewId);
-            }
-          }
-        };
+    LayoutFrameCallback pending = frameCallbackMap.get(viewId);
+    if (pending != null) {
+      pending.remainingFrames = LAYOUT_SETTLE_FRAMES + 1;
+      return;
+    }
 
+    LayoutFrameCallback frameCallback = new LayoutFrameCallback(view, LAYOUT_SETTLE_FRAMES + 1);
     frameCallbackMap.put(viewId, frameCallback);
     Choreographer.getInstance().postFrameCallback(frameCallback);
   }
 
+  /**
+   * Returns the number of layout frame callbacks executed for the given view since it was created.
+   * Intended for diagnostics, to verify that idle views do not schedule per-frame work.
+   */
+  public int getFrameCallbackCount(int viewId) {
+    Integer count = frameCallbackCounts.get(viewId);
+    return count != null ? count : 0;
+  }
+
+  /** Frame callback laying out the fragment for a bounded number of frames. */
+  private class LayoutFrameCallback implements Choreographer.FrameCallback {
+    private final FrameLayout view;
+    private final int viewId;
+    int remainingFrames;
+
+    LayoutFrameCallback(FrameLayout view, int frames) {
+      this.view = view;
+      this.viewId = view.getId();
+      this.remainingFrames = frames;
+    }
+
+    @Override
+    public void doFrame(long frameTimeNanos) {
+      Integer count = frameCallbackCounts.get(viewId);
+      frameCallbackCounts.put(viewId, count != null ? count + 1 : 1);
+
+      IMapViewFragment fragment = getFragmentForViewId(viewId);
+      if (fragment == null) {
+        frameCallbackMap.remove(viewId);
+        return;
+      }
+      layoutFragmentInView(view, fragment);
+
+      if (--remainingFrames > 0) {
+        Choreographer.getInstance().postFrameCallback(this);
+      } else {
+        frameCallbackMap.remove(viewId);
+      }
+    }
+  }
+
   /** Clean up fragment when React Native view is destroyed */
   @Override
   public void onDropViewInstance(@NonNull FrameLayout view) {
@@ -286,10 +404,11 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
               return ref == null || ref.get() == null || ref.get() == view;
             });
 
-    Choreographer.FrameCallback frameCallback = frameCallbackMap.remove(viewId);
+    LayoutFrameCallback frameCallback = frameCallbackMap.remove(viewId);
     if (frameCallback != null) {
       Choreographer.getInstance().removeFrameCallback(frameCallback);
     }
+    frameCallbackCounts.remove(viewId);
 
     // Clean up property sink
     ViewPropertiesSink sink = propertySinkMap.remove(viewId);
@@ -627,6 +746,24 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
     return fragment;
   }
 
+  public void onRouteChanged(@Nullable List<RouteSegment> routeSegments) {
+    for (WeakReference<IMapViewFragment> weakReference : fragmentMap.values()) {
+      IMapViewFragment fragment = weakReference.get();
+      if (fragment != null && fragment.getMapController() != null) {
+        fragment.getMapController().onRouteChanged(routeSegments);
+      }
+    }
+  }
+
+  public void onRoadSnappedLocation(LatLng location) {
+    for (WeakReference<IMapViewFragment> weakReference : fragmentMap.values()) {
+      IMapViewFragment fragment = weakReference.get();
+      if (fragment != null && fragment.getMapController() != null) {
+        fragment.getMapController().onRoadSnappedLocation(location);
+      }
+    }
+  }
+
   public void onNavigationReady() {
     for (WeakReference<IMapViewFragment> weakReference : fragmentMap.values()) {
       IMapViewFragment fragment = weakReference.get();
@@ -822,6 +959,9 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
       return;
     }
 
+    // The fragment view was appended to the NavView; keep the anchored children above it.
+    getAnchorLayer(view).bringToFront();
+
     // Fragment created successfully, update state.
     pendingFragments.remove(viewId);
     mapOptionsCache.remove(viewId);
@@ -830,11 +970,9 @@ public class NavViewManager extends SimpleViewManager<FrameLayout>
     // Apply any buffered properties that arrived before fragment was created
     applyBufferedPropertiesAndClearSinks(viewId, mapViewFragment);
 
-    // Start per-frame layout loop to keep fragment sized correctly.
-    startLayoutLoop(view);
-
-    // Trigger layout after fragment transaction is done.
-    view.post(() -> layoutFragmentInView(view, mapViewFragment));
+    // Lay out the freshly attached fragment; later passes are driven by size changes and layout
+    // requests from the fragment's view hierarchy.
+    scheduleFragmentLayout(view);
   }
 
   public GoogleMap getGoogleMap(int viewId) {
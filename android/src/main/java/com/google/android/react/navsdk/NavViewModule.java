@@ -14,23 +14,42 @@
 package com.google.android.react.navsdk;
 
 import android.location.Location;
+import android.os.SystemClock;
+import android.text.TextUtils;
+import android.widget.FrameLayout;
+import androidx.annotation.Nullable;
+import androidx.core.util.Consumer;
 import com.facebook.react.bridge.Arguments;
 import com.facebook.react.bridge.Promise;
 import com.facebook.react.bridge.ReactApplicationContext;
+import com.facebook.react.bridge.ReadableArray;
 import com.facebook.react.bridge.ReadableMap;
 import com.facebook.react.bridge.UiThreadUtil;
 import com.facebook.react.bridge.WritableArray;
 import com.facebook.react.bridge.WritableMap;
 import com.google.android.gms.maps.UiSettings;
 import com.google.android.gms.maps.model.CameraPosition;
+import com.google.android.gms.maps.model.BitmapDescriptorFactory;
 import com.google.android.gms.maps.model.Circle;
 import com.google.android.gms.maps.model.GroundOverlay;
 import com.google.android.gms.maps.model.LatLng;
 import com.google.android.gms.maps.model.Marker;
 import com.google.android.gms.maps.model.Polygon;
 import com.google.android.gms.maps.model.Polyline;
+import com.google.android.libraries.navigation.Navigator;
 import com.google.maps.android.rn.navsdk.NativeNavViewModuleSpec;
+import java.io.File;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.List;
 import java.util.Map;
+import org.json.JSONArray;
+import org.json.JSONException;
+import org.json.JSONObject;
+import org.json.JSONTokener;
 
 /**
  * TurboModule for map view operations. Uses nativeID-based view registry to access view instances.
@@ -41,18 +60,56 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public static final String REACT_CLASS = NAME;
   private static final String TAG = "NavViewModule";
 
+  // Points classified per pool task: large enough to amortize the task overhead, small enough to
+  // spread a batch of a few thousand stops over all workers.
+  private static final int CLASSIFY_CHUNK_SIZE = 1024;
+
+  private static NavViewModule instance;
+
   private NavViewManager mNavViewManager;
 
   public NavViewModule(ReactApplicationContext reactContext, NavViewManager navViewManager) {
     super(reactContext);
     mNavViewManager = navViewManager;
+    instance = this;
+  }
+
+  public static NavViewModule getInstance() {
+    return instance;
+  }
+
+  /**
+   * Looks up the fragment for a module command and records the command in its render metrics, if
+   * enabled, so that hitches can be attributed to recent commands.
+   */
+  private IMapViewFragment getFragmentForCommand(String nativeID, String command) {
+    IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+    if (fragment != null && fragment.getMapController() != null) {
+      fragment.getMapController().recordCommand(command);
+    }
+    return fragment;
+  }
+
+  @Override
+  public void fitCameraToOverlays(String nativeID, ReadableMap options, final Promise promise) {
+    final Map<String, Object> optionsMap = options.toHashMap();
+    final float density = getDisplayDensity();
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "fitCameraToOverlays");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          promise.resolve(fragment.getMapController().fitCameraToOverlays(optionsMap, density));
+        });
   }
 
   @Override
   public void getCameraPosition(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getCameraPosition");
           if (fragment == null || fragment.getGoogleMap() == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -80,7 +137,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getMyLocation(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getMyLocation");
           if (fragment == null || fragment.getGoogleMap() == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -105,7 +162,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getUiSettings(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getUiSettings");
           if (fragment == null || fragment.getGoogleMap() == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -139,7 +196,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void isMyLocationEnabled(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "isMyLocationEnabled");
           if (fragment == null || fragment.getGoogleMap() == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -153,15 +210,29 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void addMarker(String nativeID, ReadableMap options, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "addMarker");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
           }
 
+          Map<String, Object> attributes = null;
+          String attributesJson =
+              options.hasKey("attributes") ? options.getString("attributes") : null;
+          if (attributesJson != null && !attributesJson.isEmpty()) {
+            try {
+              attributes = MarkerStyle.attributesFromJson(attributesJson);
+            } catch (JSONException e) {
+              promise.reject(
+                  JsErrors.INVALID_ATTRIBUTES_ERROR_CODE,
+                  "Marker attributes must be a JSON object");
+              return;
+            }
+          }
+
           try {
             MapViewController mapController = fragment.getMapController();
-            Marker marker = mapController.addMarker(options.toHashMap());
+            Marker marker = mapController.addMarker(options.toHashMap(), attributes);
             String effectiveId = mapController.getMarkerEffectiveId(marker.getId());
             promise.resolve(ObjectTranslationUtil.getMapFromMarker(marker, effectiveId));
           } catch (IllegalArgumentException e) {
@@ -174,7 +245,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void addPolyline(String nativeID, ReadableMap options, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "addPolyline");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -191,7 +262,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void addPolygon(String nativeID, ReadableMap options, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "addPolygon");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -208,7 +279,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void addCircle(String nativeID, ReadableMap options, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "addCircle");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -225,7 +296,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void addGroundOverlay(String nativeID, ReadableMap options, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "addGroundOverlay");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -250,7 +321,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void moveCamera(String nativeID, ReadableMap cameraPosition, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "moveCamera");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -265,7 +336,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void showRouteOverview(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "showRouteOverview");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -284,7 +355,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void clearMapView(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "clearMapView");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -299,7 +370,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void removeMarker(String nativeID, String id, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "removeMarker");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -314,7 +385,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void removePolyline(String nativeID, String id, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "removePolyline");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -329,7 +400,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void removePolygon(String nativeID, String id, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "removePolygon");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -344,7 +415,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void removeCircle(String nativeID, String id, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "removeCircle");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -359,7 +430,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void removeGroundOverlay(String nativeID, String id, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "removeGroundOverlay");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -374,7 +445,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void setZoomLevel(String nativeID, double level, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setZoomLevel");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -389,7 +460,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void setNavigationUIEnabled(String nativeID, boolean enabled, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setNavigationUIEnabled");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -408,7 +479,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void setFollowingPerspective(String nativeID, double perspective, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setFollowingPerspective");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -427,7 +498,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getMarkers(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getMarkers");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -447,7 +518,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getCircles(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getCircles");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -467,7 +538,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getPolylines(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getPolylines");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -487,7 +558,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getPolygons(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getPolygons");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -507,7 +578,7 @@ public class NavViewModule extends NativeNavViewModuleSpec {
   public void getGroundOverlays(String nativeID, final Promise promise) {
     UiThreadUtil.runOnUiThread(
         () -> {
-          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "getGroundOverlays");
           if (fragment == null) {
             promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
             return;
@@ -523,4 +594,910 @@ public class NavViewModule extends NativeNavViewModuleSpec {
           promise.resolve(result);
         });
   }
+
+  @Override
+  public void setQualityGovernorConfig(String nativeID, ReadableMap config, final Promise promise) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setQualityGovernorConfig");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          MapViewController mapController = fragment.getMapController();
+
+          if (!config.getBoolean("enabled")) {
+            mapController.setQualityGovernor(null);
+            promise.resolve(null);
+            return;
+          }
+
+          // Bounds arrive as min/max; map them to best/cheapest per knob. Higher tolerance and
+          // cluster radius are cheaper, lower event rate, frame rate and margin are cheaper.
+          QualityGovernor.Config governorConfig = new QualityGovernor.Config();
+          governorConfig.targetFrameRate = config.getDouble("targetFrameRate");
+          governorConfig.evaluationIntervalMs = (long) config.getDouble("evaluationIntervalMs");
+          governorConfig.polylineTolerance = getQualityBounds(config, "polylineTolerance", false);
+          governorConfig.clusterRadius = getQualityBounds(config, "clusterRadius", false);
+          governorConfig.eventRate = getQualityBounds(config, "eventRate", true);
+          governorConfig.animationFrameRate = getQualityBounds(config, "animationFrameRate", true);
+          governorConfig.virtualizationMargin =
+              getQualityBounds(config, "virtualizationMargin", true);
+
+          QualityGovernor governor =
+              new QualityGovernor(
+                  governorConfig,
+                  mapController.getFrameSampler(),
+                  adjustment -> {
+                    mapController.applyQualitySettings();
+                    adjustment.putString("nativeID", nativeID);
+                    emitOnQualityAdjusted(adjustment);
+                  });
+          mapController.setQualityGovernor(governor);
+          governor.start();
+          promise.resolve(null);
+        });
+  }
+
+  private static QualityGovernor.Bounds getQualityBounds(
+      ReadableMap config, String key, boolean higherIsBetter) {
+    ReadableMap bounds = config.getMap(key);
+    double min = bounds.getDouble("min");
+    double max = bounds.getDouble("max");
+    return higherIsBetter
+        ? new QualityGovernor.Bounds(max, min)
+        : new QualityGovernor.Bounds(min, max);
+  }
+
+  @Override
+  public void setRenderStatsConfig(String nativeID, ReadableMap config, final Promise promise) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          MapViewController mapController = fragment.getMapController();
+
+          if (!config.getBoolean("enabled")) {
+            mapController.setRenderMetrics(null);
+            promise.resolve(null);
+            return;
+          }
+
+          RenderMetrics metrics =
+              new RenderMetrics(mapController.getFrameSampler(), mapController::getOverlayCounts);
+          long eventIntervalMs = (long) config.getDouble("eventIntervalMs");
+          if (eventIntervalMs > 0) {
+            metrics.setReportListener(
+                eventIntervalMs,
+                snapshot -> {
+                  snapshot.putString("nativeID", nativeID);
+                  emitOnRenderStats(snapshot);
+                });
+          }
+          mapController.setRenderMetrics(metrics);
+          metrics.start();
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void getRenderStats(String nativeID, boolean reset, final Promise promise) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = mNavViewManager.getFragmentByNativeId(nativeID);
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          RenderMetrics metrics = fragment.getMapController().getRenderMetrics();
+          if (metrics == null) {
+            promise.reject(
+                JsErrors.RENDER_STATS_DISABLED_ERROR_CODE,
+                JsErrors.RENDER_STATS_DISABLED_ERROR_MESSAGE);
+            return;
+          }
+          WritableMap stats = metrics.snapshot(reset);
+          stats.putString("nativeID", nativeID);
+          promise.resolve(stats);
+        });
+  }
+
+  @Override
+  public void getLayoutFrameCallbackCount(String nativeID, final Promise promise) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          FrameLayout view = mNavViewManager.getViewByNativeId(nativeID);
+          if (view == null) {
+            promise.reject(
+                JsErrors.NO_VIEW_CONTROLLER_ERROR_CODE, JsErrors.NO_VIEW_CONTROLLER_ERROR_MESSAGE);
+            return;
+          }
+          promise.resolve(mNavViewManager.getFrameCallbackCount(view.getId()));
+        });
+  }
+
+  @Override
+  public void projectToScreen(String nativeID, ReadableArray latLngs, final Promise promise) {
+    final double[] packed = toDoubleArray(latLngs);
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "projectToScreen");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          promise.resolve(
+              toWritableArray(
+                  fragment.getMapController().projectToScreen(packed, getDisplayDensity())));
+        });
+  }
+
+  @Override
+  public void screenToCoordinates(String nativeID, ReadableArray points, final Promise promise) {
+    final double[] packed = toDoubleArray(points);
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "screenToCoordinates");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          promise.resolve(
+              toWritableArray(
+                  fragment.getMapController().screenToCoordinates(packed, getDisplayDensity())));
+        });
+  }
+
+  @Override
+  public void setProjectionWatch(String nativeID, ReadableArray latLngs, final Promise promise) {
+    final double[] packed = toDoubleArray(latLngs);
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setProjectionWatch");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          MapViewController mapController = fragment.getMapController();
+          if (packed.length < 2) {
+            mapController.setCameraObserver("projectionWatch", null);
+            promise.resolve(null);
+            return;
+          }
+
+          final float density = getDisplayDensity();
+          // Time of the last event and whether a camera move was skipped since, as the governor's
+          // event rate may throttle events while the camera moves.
+          final long[] lastEmitTimeMs = {0};
+          final boolean[] skipped = {false};
+          Runnable emitProjection =
+              () -> {
+                lastEmitTimeMs[0] = SystemClock.uptimeMillis();
+                skipped[0] = false;
+                WritableMap event = Arguments.createMap();
+                event.putString("nativeID", nativeID);
+                event.putArray(
+                    "points", toWritableArray(mapController.projectToScreen(packed, density)));
+                emitOnProjectionUpdated(event);
+              };
+          mapController.setCameraObserver(
+              "projectionWatch",
+              idle -> {
+                if (idle) {
+                  // Deliver the final position if the last move was throttled.
+                  if (skipped[0]) {
+                    emitProjection.run();
+                  }
+                } else if (SystemClock.uptimeMillis() - lastEmitTimeMs[0]
+                    >= mapController.getQualityEventIntervalMs()) {
+                  emitProjection.run();
+                } else {
+                  skipped[0] = true;
+                }
+              });
+          // Deliver the current projection right away, the camera may not move for a while.
+          emitProjection.run();
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void setViewportWatch(String nativeID, ReadableArray ids, final Promise promise) {
+    List<String> overlayIds = new ArrayList<>(ids.size());
+    for (int i = 0; i < ids.size(); i++) {
+      overlayIds.add(ids.getString(i));
+    }
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setViewportWatch");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          fragment
+              .getMapController()
+              .setViewportWatch(
+                  overlayIds,
+                  (entered, left) -> {
+                    WritableMap event = Arguments.createMap();
+                    event.putString("nativeID", nativeID);
+                    event.putArray("entered", Arguments.fromList(entered));
+                    event.putArray("left", Arguments.fromList(left));
+                    emitOnViewportMembershipChanged(event);
+                  });
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void setMarkerStyle(String nativeID, String style, final Promise promise) {
+    // Compile off the main thread; only applying the style touches the map.
+    MarkerStyle markerStyle = null;
+    if (!style.isEmpty()) {
+      try {
+        markerStyle = MarkerStyle.fromJson(style);
+      } catch (StyleExpression.InvalidExpressionException e) {
+        promise.reject(JsErrors.INVALID_EXPRESSION_ERROR_CODE, e.getMessage());
+        return;
+      }
+    }
+
+    final MarkerStyle compiledStyle = markerStyle;
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setMarkerStyle");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          fragment.getMapController().setMarkerStyle(compiledStyle);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void setMarkerDeclutter(String nativeID, String options, final Promise promise) {
+    MarkerDeclutter markerDeclutter = null;
+    if (!options.isEmpty()) {
+      try {
+        markerDeclutter = MarkerDeclutter.fromJson(options, getDisplayDensity());
+      } catch (StyleExpression.InvalidExpressionException e) {
+        promise.reject(JsErrors.INVALID_EXPRESSION_ERROR_CODE, e.getMessage());
+        return;
+      }
+    }
+
+    final MarkerDeclutter declutter = markerDeclutter;
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setMarkerDeclutter");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          fragment.getMapController().setMarkerDeclutter(declutter);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void selectMarkersWhere(String nativeID, String predicate, final Promise promise) {
+    final StyleExpression expression;
+    try {
+      expression = compilePredicate(predicate);
+    } catch (StyleExpression.InvalidExpressionException e) {
+      promise.reject(JsErrors.INVALID_EXPRESSION_ERROR_CODE, e.getMessage());
+      return;
+    }
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "selectMarkersWhere");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          WritableArray markerIds = Arguments.createArray();
+          for (String markerId : fragment.getMapController().getMarkerIdsWhere(expression)) {
+            markerIds.pushString(markerId);
+          }
+          promise.resolve(markerIds);
+        });
+  }
+
+  @Override
+  public void updateMarkersWhere(
+      String nativeID, String predicate, String patch, final Promise promise) {
+    final StyleExpression expression;
+    try {
+      expression = compilePredicate(predicate);
+    } catch (StyleExpression.InvalidExpressionException e) {
+      promise.reject(JsErrors.INVALID_EXPRESSION_ERROR_CODE, e.getMessage());
+      return;
+    }
+
+    final Map<String, Object> markerPatch = new HashMap<>();
+    try {
+      JSONObject json = new JSONObject(patch);
+      if (json.has("visible")) {
+        markerPatch.put("visible", json.getBoolean("visible"));
+      }
+      for (String key : new String[] {"alpha", "zIndex", "rotation"}) {
+        if (json.has(key)) {
+          markerPatch.put(key, json.getDouble(key));
+        }
+      }
+      JSONObject attributes = json.optJSONObject("attributes");
+      if (attributes != null) {
+        // Unlike attributesFromJson, keep nulls: they remove the attribute.
+        Map<String, Object> attributePatch = new HashMap<>();
+        Iterator<String> keys = attributes.keys();
+        while (keys.hasNext()) {
+          String key = keys.next();
+          attributePatch.put(key, StyleExpression.normalize(attributes.opt(key)));
+        }
+        markerPatch.put("attributes", attributePatch);
+      }
+    } catch (JSONException e) {
+      promise.reject(JsErrors.INVALID_ATTRIBUTES_ERROR_CODE, "Marker patch must be a JSON object");
+      return;
+    }
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "updateMarkersWhere");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          promise.resolve(
+              (double) fragment.getMapController().updateMarkersWhere(expression, markerPatch));
+        });
+  }
+
+  private static StyleExpression compilePredicate(String predicate)
+      throws StyleExpression.InvalidExpressionException {
+    try {
+      return StyleExpression.compile(new JSONTokener(predicate).nextValue());
+    } catch (JSONException e) {
+      throw new StyleExpression.InvalidExpressionException("Predicate must be valid JSON");
+    }
+  }
+
+  @Override
+  public void loadTripPlayback(String nativeID, ReadableMap trip, final Promise promise) {
+    // Copy and validate the trace off the main thread; it may hold many samples.
+    final TripPlayback playback;
+    try {
+      playback =
+          TripPlayback.fromTrace(
+              toDoubleArray(trip.getArray("latLngs")), toDoubleArray(trip.getArray("timestamps")));
+    } catch (IllegalArgumentException e) {
+      promise.reject(JsErrors.INVALID_TRACE_ERROR_CODE, e.getMessage());
+      return;
+    }
+    if (hasValue(trip, "trailColor")) {
+      playback.setTrailColor((int) trip.getDouble("trailColor"));
+    }
+    if (hasValue(trip, "trailWidth")) {
+      playback.setTrailWidth((float) trip.getDouble("trailWidth"));
+    }
+    if (hasValue(trip, "progressIntervalMs")) {
+      playback.setProgressIntervalMs((long) trip.getDouble("progressIntervalMs"));
+    }
+    final String markerImgPath =
+        hasValue(trip, "markerImgPath") ? trip.getString("markerImgPath") : null;
+    playback.setProgressListener(
+        progress -> {
+          WritableMap event = Arguments.createMap();
+          event.putString("nativeID", nativeID);
+          event.putDouble("timeMs", progress.getTimeMs());
+          event.putDouble("index", progress.getIndex());
+          event.putDouble("lat", progress.getPosition().latitude);
+          event.putDouble("lng", progress.getPosition().longitude);
+          event.putDouble("heading", progress.getHeading());
+          event.putBoolean("playing", progress.isPlaying());
+          emitOnTripProgress(event);
+        });
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "loadTripPlayback");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          if (markerImgPath != null && !markerImgPath.isEmpty()) {
+            try {
+              playback.setMarkerIcon(BitmapDescriptorFactory.fromAsset(markerImgPath));
+            } catch (Exception e) {
+              promise.reject(
+                  JsErrors.INVALID_IMAGE_ERROR_CODE, JsErrors.INVALID_IMAGE_ERROR_MESSAGE);
+              return;
+            }
+          }
+          fragment.getMapController().setTripPlayback(playback);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void clearTripPlayback(String nativeID, final Promise promise) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "clearTripPlayback");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          fragment.getMapController().setTripPlayback(null);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void playTrip(String nativeID, final Promise promise) {
+    withTripPlayback(nativeID, "playTrip", promise, TripPlayback::play);
+  }
+
+  @Override
+  public void pauseTrip(String nativeID, final Promise promise) {
+    withTripPlayback(nativeID, "pauseTrip", promise, TripPlayback::pause);
+  }
+
+  @Override
+  public void seekTrip(String nativeID, double timeMs, final Promise promise) {
+    withTripPlayback(nativeID, "seekTrip", promise, playback -> playback.seek(timeMs));
+  }
+
+  @Override
+  public void setTripPlaybackRate(String nativeID, double rate, final Promise promise) {
+    withTripPlayback(nativeID, "setTripPlaybackRate", promise, playback -> playback.setRate(rate));
+  }
+
+  private static boolean hasValue(ReadableMap map, String key) {
+    return map.hasKey(key) && !map.isNull(key);
+  }
+
+  private static float getFloat(ReadableMap map, String key, float fallback) {
+    return hasValue(map, key) ? (float) map.getDouble(key) : fallback;
+  }
+
+  /** Runs {@code action} on the UI thread with the trip playback of the view, if one is loaded. */
+  private void withTripPlayback(
+      String nativeID, String command, Promise promise, Consumer<TripPlayback> action) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, command);
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          TripPlayback playback = fragment.getMapController().getTripPlayback();
+          if (playback == null) {
+            promise.reject(
+                JsErrors.NO_TRIP_PLAYBACK_ERROR_CODE, JsErrors.NO_TRIP_PLAYBACK_ERROR_MESSAGE);
+            return;
+          }
+          action.accept(playback);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void startRoutePrefetch(String nativeID, ReadableMap options, final Promise promise) {
+    String storePath = options.getString("storePath");
+    if (storePath == null || !new File(storePath).isDirectory()) {
+      promise.reject(
+          JsErrors.INVALID_DATA_SOURCE_ERROR_CODE, JsErrors.INVALID_DATA_SOURCE_ERROR_MESSAGE);
+      return;
+    }
+    final int tileZoom = hasValue(options, "tileZoom") ? (int) options.getDouble("tileZoom") : 12;
+    final double aheadMeters =
+        hasValue(options, "aheadMeters") ? options.getDouble("aheadMeters") : 20000;
+    final double corridorMeters =
+        hasValue(options, "corridorMeters") ? options.getDouble("corridorMeters") : 500;
+    final int maxFeatures =
+        hasValue(options, "maxFeatures") ? (int) options.getDouble("maxFeatures") : 2000;
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "startRoutePrefetch");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          MapViewController mapController = fragment.getMapController();
+          RoutePrefetcher prefetcher =
+              new RoutePrefetcher(
+                  storePath,
+                  tileZoom,
+                  aheadMeters,
+                  corridorMeters,
+                  maxFeatures,
+                  mapController.getViewLifetimeToken());
+          mapController.setRoutePrefetcher(
+              prefetcher,
+              (staged, evicted) -> {
+                WritableMap event = Arguments.createMap();
+                event.putString("nativeID", nativeID);
+                event.putArray("staged", Arguments.fromList(staged));
+                event.putArray("evicted", Arguments.fromList(evicted));
+                emitOnRoutePrefetchChanged(event);
+              });
+          // Progress starts with the next road-snapped location update.
+          Navigator navigator =
+              NavModule.isInstanceReady() ? NavModule.getInstance().getNavigator() : null;
+          prefetcher.setRouteSegments(navigator != null ? navigator.getRouteSegments() : null);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void renderRouteThumbnail(ReadableMap thumbnail, final Promise promise) {
+    float scale = (float) thumbnail.getDouble("scale");
+    RouteThumbnailRenderer.Style style = new RouteThumbnailRenderer.Style();
+    style.width = Math.round((float) thumbnail.getDouble("width") * scale);
+    style.height = Math.round((float) thumbnail.getDouble("height") * scale);
+    style.padding = scale * getFloat(thumbnail, "padding", 8);
+    style.strokeWidth = scale * getFloat(thumbnail, "strokeWidth", 3);
+    style.stopRadius = scale * getFloat(thumbnail, "stopRadius", 4);
+    style.stopOutlineWidth = scale * getFloat(thumbnail, "stopOutlineWidth", 1.5f);
+    if (hasValue(thumbnail, "strokeColor")) {
+      style.strokeColor = (int) (long) thumbnail.getDouble("strokeColor");
+    }
+    if (hasValue(thumbnail, "stopColor")) {
+      style.stopColor = (int) (long) thumbnail.getDouble("stopColor");
+    }
+    if (hasValue(thumbnail, "stopOutlineColor")) {
+      style.stopOutlineColor = (int) (long) thumbnail.getDouble("stopOutlineColor");
+    }
+    if (hasValue(thumbnail, "backgroundColor")) {
+      style.backgroundColor = (int) (long) thumbnail.getDouble("backgroundColor");
+    }
+
+    RouteThumbnailRenderer.getInstance(getReactApplicationContext())
+        .render(
+            toDoubleArray(thumbnail.getArray("path")),
+            hasValue(thumbnail, "encodedPath") ? thumbnail.getString("encodedPath") : null,
+            toDoubleArray(thumbnail.getArray("stops")),
+            style,
+            (uri, error) -> {
+              if (uri == null) {
+                promise.reject(JsErrors.THUMBNAIL_FAILED_ERROR_CODE, error);
+                return;
+              }
+              promise.resolve(uri);
+            });
+  }
+
+  @Override
+  public void clipPolygons(
+      double operation, ReadableMap subject, ReadableMap clip, final Promise promise) {
+    List<PolygonClipper.GeoPolygon> subjectPolygons = unpackPolygons(subject);
+    List<PolygonClipper.GeoPolygon> clipPolygons = unpackPolygons(clip);
+    if (operation < 0 || operation > 2 || subjectPolygons == null || clipPolygons == null) {
+      promise.reject(JsErrors.INVALID_OPTIONS_ERROR_CODE, "Invalid polygon operation or packing");
+      return;
+    }
+
+    NavWorkerPool.getInstance()
+        .submit(
+            NavWorkerPool.PRIORITY_INTERACTIVE,
+            null,
+            () ->
+                promise.resolve(
+                    packPolygons(
+                        PolygonClipper.clip(subjectPolygons, clipPolygons, (int) operation))));
+  }
+
+  @Override
+  public void addClippedPolygons(
+      String nativeID,
+      double operation,
+      ReadableMap subject,
+      ReadableMap clip,
+      ReadableMap options,
+      final Promise promise) {
+    List<PolygonClipper.GeoPolygon> subjectPolygons = unpackPolygons(subject);
+    List<PolygonClipper.GeoPolygon> clipPolygons = unpackPolygons(clip);
+    if (operation < 0 || operation > 2 || subjectPolygons == null || clipPolygons == null) {
+      promise.reject(JsErrors.INVALID_OPTIONS_ERROR_CODE, "Invalid polygon operation or packing");
+      return;
+    }
+    Map<String, Object> optionsMap = options.toHashMap();
+
+    NavWorkerPool.getInstance()
+        .submit(
+            NavWorkerPool.PRIORITY_INTERACTIVE,
+            null,
+            () -> {
+              List<PolygonClipper.GeoPolygon> polygons =
+                  PolygonClipper.clip(subjectPolygons, clipPolygons, (int) operation);
+              UiThreadUtil.runOnUiThread(
+                  () -> {
+                    IMapViewFragment fragment =
+                        getFragmentForCommand(nativeID, "addClippedPolygons");
+                    if (fragment == null || fragment.getMapController() == null) {
+                      promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+                      return;
+                    }
+                    addPolygons(fragment.getMapController(), polygons, optionsMap, promise);
+                  });
+            });
+  }
+
+  @Override
+  public void classifyPoints(ReadableArray latLngs, ReadableMap zones, final Promise promise) {
+    List<PolygonClipper.GeoPolygon> zonePolygons = unpackPolygons(zones);
+    if (zonePolygons == null) {
+      promise.reject(JsErrors.INVALID_OPTIONS_ERROR_CODE, "Invalid polygon packing");
+      return;
+    }
+    classifyPoints(toDoubleArray(latLngs), zonePolygons, promise);
+  }
+
+  @Override
+  public void classifyPointsInPolygons(
+      String nativeID, ReadableArray latLngs, ReadableArray polygonIds, final Promise promise) {
+    final double[] points = toDoubleArray(latLngs);
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "classifyPointsInPolygons");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+
+          // Overlays are only read on the UI thread; the geometry is copied out before classifying.
+          Map<String, Polygon> polygonMap = fragment.getMapController().getPolygonMap();
+          List<PolygonClipper.GeoPolygon> zones = new ArrayList<>(polygonIds.size());
+          List<String> missingIds = new ArrayList<>();
+          for (int i = 0; i < polygonIds.size(); i++) {
+            String polygonId = polygonIds.getString(i);
+            Polygon polygon = polygonMap.get(polygonId);
+            if (polygon == null) {
+              missingIds.add(polygonId);
+              continue;
+            }
+            List<double[]> holes = new ArrayList<>();
+            for (List<LatLng> hole : polygon.getHoles()) {
+              holes.add(toLatLngArray(hole));
+            }
+            zones.add(new PolygonClipper.GeoPolygon(toLatLngArray(polygon.getPoints()), holes));
+          }
+          if (!missingIds.isEmpty()) {
+            promise.reject(
+                JsErrors.INVALID_OPTIONS_ERROR_CODE,
+                "Unknown polygon ids: " + TextUtils.join(", ", missingIds));
+            return;
+          }
+          classifyPoints(points, zones, promise);
+        });
+  }
+
+  /**
+   * Classifies the points, packed as [lat0, lng0, ...], on the worker pool and resolves with the
+   * index of the first zone containing each point, or -1.
+   */
+  private static void classifyPoints(
+      double[] latLngs, List<PolygonClipper.GeoPolygon> zones, Promise promise) {
+    NavWorkerPool pool = NavWorkerPool.getInstance();
+    pool.submit(
+        NavWorkerPool.PRIORITY_INTERACTIVE,
+        null,
+        () -> {
+          ZoneIndex index = new ZoneIndex(zones);
+          int count = latLngs.length / 2;
+          int[] result = new int[count];
+          pool.apply(
+              NavWorkerPool.PRIORITY_INTERACTIVE,
+              (count + CLASSIFY_CHUNK_SIZE - 1) / CLASSIFY_CHUNK_SIZE,
+              chunk -> {
+                int begin = chunk * CLASSIFY_CHUNK_SIZE;
+                index.classifyRange(
+                    latLngs, begin, Math.min(count, begin + CLASSIFY_CHUNK_SIZE), result);
+              },
+              () -> {
+                WritableArray zoneIndices = Arguments.createArray();
+                for (int zone : result) {
+                  zoneIndices.pushInt(zone);
+                }
+                promise.resolve(zoneIndices);
+              });
+        });
+  }
+
+  /**
+   * Adds the result of a polygon operation as overlays. With an id, the polygons are identified as
+   * "<id>/0", "<id>/1", ... so that running the operation again replaces them.
+   */
+  private static void addPolygons(
+      MapViewController mapController,
+      List<PolygonClipper.GeoPolygon> polygons,
+      Map<String, Object> options,
+      Promise promise) {
+    String baseId = CollectionUtil.getString("id", options);
+    WritableArray added = Arguments.createArray();
+    for (int i = 0; i < polygons.size(); i++) {
+      PolygonClipper.GeoPolygon geoPolygon = polygons.get(i);
+      Map<String, Object> polygonOptions = new HashMap<>(options);
+      polygonOptions.put("id", baseId != null ? baseId + "/" + i : null);
+      polygonOptions.put("points", toLatLngMaps(geoPolygon.outer));
+      ArrayList<Object> holes = new ArrayList<>();
+      for (double[] hole : geoPolygon.holes) {
+        holes.add(toLatLngMaps(hole));
+      }
+      polygonOptions.put("holes", holes);
+
+      Polygon polygon = mapController.addPolygon(polygonOptions);
+      if (polygon != null) {
+        String effectiveId = mapController.getPolygonEffectiveId(polygon.getId());
+        added.pushMap(ObjectTranslationUtil.getMapFromPolygon(polygon, effectiveId));
+      }
+    }
+    promise.resolve(added);
+  }
+
+  @Override
+  public void stopRoutePrefetch(String nativeID, final Promise promise) {
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "stopRoutePrefetch");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          fragment.getMapController().setRoutePrefetcher(null, null);
+          promise.resolve(null);
+        });
+  }
+
+  @Override
+  public void setMarkerAttribute(
+      String nativeID, ReadableArray ids, String key, String values, final Promise promise) {
+    List<String> markerIds = new ArrayList<>(ids.size());
+    for (int i = 0; i < ids.size(); i++) {
+      markerIds.add(ids.getString(i));
+    }
+
+    List<Object> alignedValues;
+    try {
+      Object json = new JSONArray("[" + values + "]").opt(0);
+      if (json instanceof JSONArray) {
+        JSONArray array = (JSONArray) json;
+        if (array.length() != markerIds.size()) {
+          promise.reject(
+              JsErrors.INVALID_ATTRIBUTES_ERROR_CODE,
+              "Attribute values must align with the marker ids");
+          return;
+        }
+        alignedValues = new ArrayList<>(array.length());
+        for (int i = 0; i < array.length(); i++) {
+          alignedValues.add(StyleExpression.normalize(array.opt(i)));
+        }
+      } else {
+        // A single value applies to every marker.
+        alignedValues =
+            new ArrayList<>(Collections.nCopies(markerIds.size(), StyleExpression.normalize(json)));
+      }
+    } catch (JSONException e) {
+      promise.reject(JsErrors.INVALID_ATTRIBUTES_ERROR_CODE, "Attribute values must be valid JSON");
+      return;
+    }
+
+    UiThreadUtil.runOnUiThread(
+        () -> {
+          IMapViewFragment fragment = getFragmentForCommand(nativeID, "setMarkerAttribute");
+          if (fragment == null || fragment.getMapController() == null) {
+            promise.reject(JsErrors.NO_MAP_ERROR_CODE, JsErrors.NO_MAP_ERROR_MESSAGE);
+            return;
+          }
+          int found = fragment.getMapController().setMarkerAttribute(key, alignedValues, markerIds);
+          promise.resolve((double) found);
+        });
+  }
+
+  private float getDisplayDensity() {
+    return getReactApplicationContext().getResources().getDisplayMetrics().density;
+  }
+
+  private static double[] toDoubleArray(ReadableArray array) {
+    double[] result = new double[array.size()];
+    for (int i = 0; i < result.length; i++) {
+      result[i] = array.getDouble(i);
+    }
+    return result;
+  }
+
+  /**
+   * Unpacks polygons packed as [lat0, lng0, ...] with the vertex count of each ring and the ring
+   * count of each polygon, outer ring first. Returns null if the counts do not match the
+   * coordinates.
+   */
+  @Nullable
+  private static List<PolygonClipper.GeoPolygon> unpackPolygons(ReadableMap packed) {
+    double[] latLngs = toDoubleArray(packed.getArray("latLngs"));
+    double[] ringSizes = toDoubleArray(packed.getArray("ringSizes"));
+    double[] ringCounts = toDoubleArray(packed.getArray("ringCounts"));
+    List<PolygonClipper.GeoPolygon> polygons = new ArrayList<>(ringCounts.length);
+    int ring = 0;
+    int vertex = 0;
+    for (double ringCount : ringCounts) {
+      double[] outer = null;
+      List<double[]> holes = new ArrayList<>();
+      for (int i = 0; i < (int) ringCount; i++, ring++) {
+        if (ring >= ringSizes.length) {
+          return null;
+        }
+        int size = (int) ringSizes[ring];
+        if ((vertex + size) * 2 > latLngs.length) {
+          return null;
+        }
+        double[] points = Arrays.copyOfRange(latLngs, vertex * 2, (vertex + size) * 2);
+        vertex += size;
+        if (i == 0) {
+          outer = points;
+        } else {
+          holes.add(points);
+        }
+      }
+      polygons.add(new PolygonClipper.GeoPolygon(outer != null ? outer : new double[0], holes));
+    }
+    return polygons;
+  }
+
+  private static WritableMap packPolygons(List<PolygonClipper.GeoPolygon> polygons) {
+    WritableArray latLngs = Arguments.createArray();
+    WritableArray ringSizes = Arguments.createArray();
+    WritableArray ringCounts = Arguments.createArray();
+    for (PolygonClipper.GeoPolygon polygon : polygons) {
+      List<double[]> rings = new ArrayList<>();
+      rings.add(polygon.outer);
+      rings.addAll(polygon.holes);
+      for (double[] ring : rings) {
+        for (double value : ring) {
+          latLngs.pushDouble(value);
+        }
+        ringSizes.pushInt(ring.length / 2);
+      }
+      ringCounts.pushInt(rings.size());
+    }
+    WritableMap map = Arguments.createMap();
+    map.putArray("latLngs", latLngs);
+    map.putArray("ringSizes", ringSizes);
+    map.putArray("ringCounts", ringCounts);
+    return map;
+  }
+
+  private static double[] toLatLngArray(List<LatLng> points) {
+    double[] latLngs = new double[points.size() * 2];
+    for (int i = 0; i < points.size(); i++) {
+      latLngs[2 * i] = points.get(i).latitude;
+      latLngs[2 * i + 1] = points.get(i).longitude;
+    }
+    return latLngs;
+  }
+
+  private static ArrayList<Object> toLatLngMaps(double[] latLngs) {
+    ArrayList<Object> points = new ArrayList<>(latLngs.length / 2);
+    for (int i = 0; i + 1 < latLngs.length; i += 2) {
+      Map<String, Object> point = new HashMap<>();
+      point.put("lat", latLngs[i]);
+      point.put("lng", latLngs[i + 1]);
+      points.add(point);
+    }
+    return points;
+  }
+
+  private static WritableArray toWritableArray(double[] values) {
+    WritableArray array = Arguments.createArray();
+    for (double value : values) {
+      array.pushDouble(value);
+    }
+    return array;
+  }
 }
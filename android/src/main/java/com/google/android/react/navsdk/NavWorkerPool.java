@@ -0,0 +1,273 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.os.Process;
+import android.util.Log;
+import androidx.annotation.Nullable;
+import java.util.ArrayDeque;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.IntConsumer;
+
+/**
+ * Bounded, work-stealing pool for background native work such as geometry processing, image
+ * decoding and rasterization. Each worker owns a deque per priority class and always picks the
+ * highest priority task available anywhere in the pool; idle workers steal from the others. Tasks
+ * whose token has been cancelled are dropped without running.
+ *
+ * <p>Blocking IO such as network fetches goes to a separate executor through {@link #submitIo}, so
+ * that it never occupies the CPU workers.
+ */
+public class NavWorkerPool {
+  /** Work whose result is needed for what is currently on screen. */
+  public static final int PRIORITY_INTERACTIVE = 0;
+
+  /** Work that prepares content likely to be needed soon. */
+  public static final int PRIORITY_PREFETCH = 1;
+
+  /** Housekeeping and bulk work with no latency requirement. */
+  public static final int PRIORITY_BACKGROUND = 2;
+
+  private static final String TAG = "NavWorkerPool";
+  private static final int PRIORITY_CLASS_COUNT = 3;
+  private static final int MAX_WORKER_COUNT = 4;
+  private static final int IO_THREAD_COUNT = 2;
+
+  private static NavWorkerPool instance;
+
+  private final Worker[] workers;
+  private final ExecutorService ioExecutor;
+  private final Object sleepLock = new Object();
+  private int pendingCount = 0;
+  private int nextWorker = 0;
+
+  private static final ThreadLocal<Integer> currentWorkerIndex = new ThreadLocal<>();
+
+  private static class Task {
+    final Runnable runnable;
+    @Nullable final CancellationToken token;
+    final int priorityClass;
+
+    Task(Runnable runnable, @Nullable CancellationToken token, int priorityClass) {
+      this.runnable = runnable;
+      this.token = token;
+      this.priorityClass = priorityClass;
+    }
+  }
+
+  private static class Worker {
+    @SuppressWarnings("unchecked")
+    final ArrayDeque<Task>[] queues = new ArrayDeque[PRIORITY_CLASS_COUNT];
+
+    Worker() {
+      for (int i = 0; i < PRIORITY_CLASS_COUNT; i++) {
+        queues[i] = new ArrayDeque<>();
+      }
+    }
+  }
+
+  public static synchronized NavWorkerPool getInstance() {
+    if (instance == null) {
+      instance = new NavWorkerPool();
+    }
+    return instance;
+  }
+
+  private NavWorkerPool() {
+    // Leave one core to the UI and render threads.
+    int cores = Runtime.getRuntime().availableProcessors();
+    int workerCount = Math.max(1, Math.min(MAX_WORKER_COUNT, cores - 1));
+    workers = new Worker[workerCount];
+    for (int i = 0; i < workerCount; i++) {
+      workers[i] = new Worker();
+    }
+    for (int i = 0; i < workerCount; i++) {
+      final int index = i;
+      Thread thread = new Thread(() -> runWorker(index), "NavWorkerPool-" + i);
+      thread.setDaemon(true);
+      thread.start();
+    }
+    ioExecutor =
+        Executors.newFixedThreadPool(
+            IO_THREAD_COUNT,
+            runnable -> {
+              Thread thread =
+                  new Thread(
+                      () -> {
+                        Process.setThreadPriority(Process.THREAD_PRIORITY_BACKGROUND);
+                        runnable.run();
+                      },
+                      "NavWorkerPool-io");
+              thread.setDaemon(true);
+              return thread;
+            });
+  }
+
+  public int getWorkerCount() {
+    return workers.length;
+  }
+
+  /** Queues a task with the given priority class. The task is dropped if the token is cancelled. */
+  public void submit(int priority, @Nullable CancellationToken token, Runnable runnable) {
+    if (token != null && token.isCancelled()) {
+      return;
+    }
+    int priorityClass = Math.max(0, Math.min(PRIORITY_CLASS_COUNT - 1, priority));
+
+    // Tasks spawned from a worker stay on that worker for locality; others are spread round robin.
+    Integer ownIndex = currentWorkerIndex.get();
+    int index;
+    if (ownIndex != null) {
+      index = ownIndex;
+    } else {
+      synchronized (sleepLock) {
+        index = nextWorker;
+        nextWorker = (nextWorker + 1) % workers.length;
+      }
+    }
+
+    Worker worker = workers[index];
+    synchronized (worker) {
+      worker.queues[priorityClass].addLast(new Task(runnable, token, priorityClass));
+    }
+    synchronized (sleepLock) {
+      pendingCount++;
+      sleepLock.notify();
+    }
+  }
+
+  /**
+   * Queues a task that blocks on IO, such as a network fetch, on the IO threads. The task is
+   * dropped if the token is cancelled before it starts.
+   */
+  public void submitIo(@Nullable CancellationToken token, Runnable runnable) {
+    if (token != null && token.isCancelled()) {
+      return;
+    }
+    ioExecutor.execute(() -> runTask(new Task(runnable, token, PRIORITY_BACKGROUND)));
+  }
+
+  /**
+   * Runs {@code block} once for each index in [0, count) as separate tasks, so that the iterations
+   * are spread over the workers, then runs {@code completion} on the worker that finishes the last
+   * one.
+   */
+  public void apply(int priority, int count, IntConsumer block, Runnable completion) {
+    if (count == 0) {
+      submit(priority, null, completion);
+      return;
+    }
+    AtomicInteger remaining = new AtomicInteger(count);
+    for (int i = 0; i < count; i++) {
+      final int index = i;
+      submit(
+          priority,
+          null,
+          () -> {
+            block.accept(index);
+            if (remaining.decrementAndGet() == 0) {
+              completion.run();
+            }
+          });
+    }
+  }
+
+  private void runWorker(int index) {
+    currentWorkerIndex.set(index);
+    Process.setThreadPriority(Process.THREAD_PRIORITY_BACKGROUND);
+    boolean interactive = false;
+
+    while (true) {
+      // Claim one queued task before looking for it. Tasks are queued before being counted, so
+      // there are always at least as many queued tasks as claims.
+      synchronized (sleepLock) {
+        while (pendingCount <= 0) {
+          try {
+            sleepLock.wait();
+          } catch (InterruptedException e) {
+            return;
+          }
+        }
+        pendingCount--;
+      }
+
+      // The deques are scanned one lock at a time, so a scan can miss every task while other
+      // workers take the ones it passed and new ones land in deques it already scanned. The claim
+      // is then given back so that the tasks it stands for are not left unrun.
+      Task task = takeTask(index);
+      if (task == null) {
+        synchronized (sleepLock) {
+          pendingCount++;
+        }
+        continue;
+      }
+
+      // Interactive tasks run at the default priority so that they are not scheduled as
+      // background work; the worker drops back once it takes a lower priority task.
+      boolean taskInteractive = task.priorityClass == PRIORITY_INTERACTIVE;
+      if (taskInteractive != interactive) {
+        Process.setThreadPriority(
+            taskInteractive
+                ? Process.THREAD_PRIORITY_DEFAULT
+                : Process.THREAD_PRIORITY_BACKGROUND);
+        interactive = taskInteractive;
+      }
+      runTask(task);
+    }
+  }
+
+  private static void runTask(Task task) {
+    if (task.token != null && task.token.isCancelled()) {
+      return;
+    }
+    try {
+      task.runnable.run();
+    } catch (RuntimeException e) {
+      // A failing task must not take the worker down with it.
+      Log.e(TAG, "Task failed", e);
+    }
+  }
+
+  /**
+   * Takes the highest priority task available, preferring the newest task of this worker's own
+   * deque and otherwise stealing the oldest task from another worker.
+   */
+  @Nullable
+  private Task takeTask(int index) {
+    for (int priorityClass = 0; priorityClass < PRIORITY_CLASS_COUNT; priorityClass++) {
+      Worker own = workers[index];
+      synchronized (own) {
+        Task task = own.queues[priorityClass].pollLast();
+        if (task != null) {
+          return task;
+        }
+      }
+      for (int offset = 1; offset < workers.length; offset++) {
+        Worker victim = workers[(index + offset) % workers.length];
+        synchronized (victim) {
+          Task task = victim.queues[priorityClass].pollFirst();
+          if (task != null) {
+            return task;
+          }
+        }
+      }
+    }
+    return null;
+  }
+}
@@ -32,6 +32,7 @@ public class Package extends BaseReactPackage {
   public List<ViewManager> createViewManagers(ReactApplicationContext reactContext) {
     List<ViewManager> viewManagers = new ArrayList<>();
     viewManagers.add(NavViewManager.getInstance(reactContext));
+    viewManagers.add(new NavAnchorViewManager());
     return viewManagers;
   }
 
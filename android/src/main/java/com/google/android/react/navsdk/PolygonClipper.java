@@ -0,0 +1,704 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+/**
+ * Union, intersection and difference of lat/lng polygons with holes, the Java counterpart of
+ * NavPolygonClipper.cpp on iOS.
+ *
+ * <p>Each operand is the even-odd area of all its rings, so ring orientation does not matter. Rings
+ * may cross or overlap themselves and other rings of the same operand; where an even number of them
+ * overlap, the area is outside. Coordinates are snapped to an integer
+ * grid of 1e-7 degrees, coarsened for operands spanning more than about 100 degrees, so that every
+ * predicate is evaluated exactly in 64-bit integers. Result outer rings are counterclockwise and
+ * holes clockwise, with longitude as x.
+ */
+public final class PolygonClipper {
+  // Values match the operations of the JS API.
+  public static final int UNION = 0;
+  public static final int INTERSECTION = 1;
+  public static final int DIFFERENCE = 2;
+
+  private static final double FINEST_GRID_DEGREES = 1e-7;
+
+  // Largest extent of the operands in grid units. Keeping coordinates below 2^30 keeps every
+  // product of the predicates below 2^62, and lets a point be packed into one long.
+  private static final double MAX_GRID_EXTENT = 1 << 30;
+  private static final long COORDINATE_MASK = (1L << 31) - 1;
+
+  private static final int LOCATION_INSIDE = 0;
+  private static final int LOCATION_OUTSIDE = 1;
+  // Coincides with an edge of the other operand running the same way.
+  private static final int LOCATION_SHARED_SAME = 2;
+  // Coincides with an edge of the other operand running the opposite way.
+  private static final int LOCATION_SHARED_OPPOSITE = 3;
+
+  /** A polygon with its rings packed as [lat0, lng0, ...]. */
+  public static class GeoPolygon {
+    public final double[] outer;
+    public final List<double[]> holes;
+
+    public GeoPolygon(double[] outer, List<double[]> holes) {
+      this.outer = outer;
+      this.holes = holes;
+    }
+  }
+
+  private PolygonClipper() {}
+
+  /** Computes `subject` `operation` `clip`. */
+  public static List<GeoPolygon> clip(
+      List<GeoPolygon> subject, List<GeoPolygon> clip, int operation) {
+    Grid grid = new Grid(subject, clip);
+    // The difference is computed as the intersection with the complement of the clip operand.
+    List<Edge> a = orientedEdges(subject, grid, false);
+    List<Edge> b = orientedEdges(clip, grid, operation == DIFFERENCE);
+
+    List<List<Long>> splitsA = emptyLists(a.size());
+    List<List<Long>> splitsB = emptyLists(b.size());
+    findIntersections(a, b, splitsA, splitsB);
+    List<List<Edge>> pieces = Arrays.asList(splitEdges(a, splitsA), splitEdges(b, splitsB));
+    List<Set<Edge>> pieceSets =
+        Arrays.asList(new HashSet<>(pieces.get(0)), new HashSet<>(pieces.get(1)));
+    BandIndex[] indices = {new BandIndex(pieces.get(0)), new BandIndex(pieces.get(1))};
+
+    // A piece is kept when the result is on its left and not on its right. Pieces shared by both
+    // operands are kept once, from the subject.
+    boolean[] keepInside = {operation == INTERSECTION, operation != UNION};
+    List<Edge> kept = new ArrayList<>();
+    for (int operand = 0; operand < 2; operand++) {
+      int other = 1 - operand;
+      for (Edge piece : pieces.get(operand)) {
+        int location = locate(piece, pieceSets.get(other), indices[other], pieces.get(other));
+        boolean keep =
+            location == (keepInside[operand] ? LOCATION_INSIDE : LOCATION_OUTSIDE)
+                || (operand == 0 && location == LOCATION_SHARED_SAME);
+        if (keep) {
+          kept.add(piece);
+        }
+      }
+    }
+
+    // Pieces kept in both directions are inside on both sides and cancel out. Duplicates are kept
+    // once.
+    Map<Edge, Integer> counts = new HashMap<>();
+    for (Edge edge : kept) {
+      Integer count = counts.get(edge);
+      counts.put(edge, count == null ? 1 : count + 1);
+    }
+    List<Edge> edges = new ArrayList<>();
+    Set<Edge> emitted = new HashSet<>();
+    for (Edge edge : kept) {
+      Integer reversed = counts.get(new Edge(edge.to, edge.from));
+      if (counts.get(edge) > (reversed != null ? reversed : 0) && emitted.add(edge)) {
+        edges.add(edge);
+      }
+    }
+
+    return assemble(linkRings(edges), grid);
+  }
+
+  private static long point(long x, long y) {
+    return (x << 31) | y;
+  }
+
+  private static long x(long point) {
+    return point >>> 31;
+  }
+
+  private static long y(long point) {
+    return point & COORDINATE_MASK;
+  }
+
+  private static long cross(long origin, long a, long b) {
+    return (x(a) - x(origin)) * (y(b) - y(origin)) - (y(a) - y(origin)) * (x(b) - x(origin));
+  }
+
+  /** Twice the signed area, positive for counterclockwise rings. */
+  private static double signedArea(long[] ring) {
+    double area = 0;
+    for (int i = 1; i + 1 < ring.length; i++) {
+      area += cross(ring[0], ring[i], ring[i + 1]);
+    }
+    return area;
+  }
+
+  private static boolean onSegment(long point, long a, long b) {
+    return cross(a, b, point) == 0
+        && Math.min(x(a), x(b)) <= x(point)
+        && x(point) <= Math.max(x(a), x(b))
+        && Math.min(y(a), y(b)) <= y(point)
+        && y(point) <= Math.max(y(a), y(b));
+  }
+
+  /**
+   * Whether the ray from (doubledX, doubledY) / 2 towards +x crosses the edge from `a` to `b`. The
+   * point is given doubled so that edge midpoints are exact.
+   */
+  private static boolean rayCrosses(long a, long b, long doubledX, long doubledY) {
+    if ((2 * y(a) > doubledY) == (2 * y(b) > doubledY)) {
+      return false;
+    }
+    long dx = x(b) - x(a);
+    long dy = y(b) - y(a);
+    long side = (2 * x(a) - doubledX) * dy + (doubledY - 2 * y(a)) * dx;
+    return dy > 0 ? side > 0 : side < 0;
+  }
+
+  private static boolean ringContains(long[] ring, long doubledX, long doubledY) {
+    boolean inside = false;
+    for (int i = 0, j = ring.length - 1; i < ring.length; j = i++) {
+      if (rayCrosses(ring[j], ring[i], doubledX, doubledY)) {
+        inside = !inside;
+      }
+    }
+    return inside;
+  }
+
+  /** A directed edge. After orientation, the inside of its operand is on its left. */
+  private static final class Edge {
+    final long from;
+    final long to;
+
+    Edge(long from, long to) {
+      this.from = from;
+      this.to = to;
+    }
+
+    @Override
+    public boolean equals(Object other) {
+      if (!(other instanceof Edge)) {
+        return false;
+      }
+      Edge edge = (Edge) other;
+      return from == edge.from && to == edge.to;
+    }
+
+    @Override
+    public int hashCode() {
+      return Long.hashCode(from * 0x9E3779B97F4A7C15L ^ to);
+    }
+  }
+
+  private static final class Grid {
+    private final double minLat;
+    private final double minLng;
+    private final double unit;
+
+    Grid(List<GeoPolygon> subject, List<GeoPolygon> clip) {
+      double[] bounds = {
+        Double.POSITIVE_INFINITY,
+        Double.POSITIVE_INFINITY,
+        Double.NEGATIVE_INFINITY,
+        Double.NEGATIVE_INFINITY
+      };
+      for (List<GeoPolygon> operand : Arrays.asList(subject, clip)) {
+        for (GeoPolygon polygon : operand) {
+          extend(bounds, polygon.outer);
+          for (double[] hole : polygon.holes) {
+            extend(bounds, hole);
+          }
+        }
+      }
+      if (bounds[0] > bounds[2]) {
+        Arrays.fill(bounds, 0);
+      }
+      minLat = bounds[0];
+      minLng = bounds[1];
+      double extent = Math.max(bounds[2] - bounds[0], bounds[3] - bounds[1]);
+      unit = Math.max(FINEST_GRID_DEGREES, extent / MAX_GRID_EXTENT);
+    }
+
+    private static void extend(double[] bounds, double[] ring) {
+      for (int i = 0; i + 1 < ring.length; i += 2) {
+        bounds[0] = Math.min(bounds[0], ring[i]);
+        bounds[1] = Math.min(bounds[1], ring[i + 1]);
+        bounds[2] = Math.max(bounds[2], ring[i]);
+        bounds[3] = Math.max(bounds[3], ring[i + 1]);
+      }
+    }
+
+    long toGrid(double lat, double lng) {
+      return point(Math.round((lng - minLng) / unit), Math.round((lat - minLat) / unit));
+    }
+
+    double lat(long point) {
+      return minLat + y(point) * unit;
+    }
+
+    double lng(long point) {
+      return minLng + x(point) * unit;
+    }
+  }
+
+  /**
+   * Buckets edges into horizontal bands, so that crossing candidates and ray casts only look at
+   * the edges spanning the same rows.
+   */
+  private static final class BandIndex {
+    private final long minY;
+    private final long bandHeight;
+    private final int bandCount;
+    // Edge indices of band i are entries[offsets[i]] to entries[offsets[i + 1] - 1].
+    private final int[] offsets;
+    private final int[] entries;
+
+    BandIndex(List<Edge> edges) {
+      long min = Long.MAX_VALUE;
+      long max = Long.MIN_VALUE;
+      for (Edge edge : edges) {
+        min = Math.min(min, Math.min(y(edge.from), y(edge.to)));
+        max = Math.max(max, Math.max(y(edge.from), y(edge.to)));
+      }
+      if (edges.isEmpty()) {
+        min = max = 0;
+      }
+      minY = min;
+      bandCount = Math.max(1, Math.min(edges.size() / 2, 1 << 16));
+      bandHeight = (max - min) / bandCount + 1;
+
+      offsets = new int[bandCount + 1];
+      for (Edge edge : edges) {
+        int last = band(Math.max(y(edge.from), y(edge.to)));
+        for (int band = band(Math.min(y(edge.from), y(edge.to))); band <= last; band++) {
+          offsets[band + 1]++;
+        }
+      }
+      for (int i = 0; i < bandCount; i++) {
+        offsets[i + 1] += offsets[i];
+      }
+      entries = new int[offsets[bandCount]];
+      int[] fill = Arrays.copyOf(offsets, bandCount);
+      for (int i = 0; i < edges.size(); i++) {
+        Edge edge = edges.get(i);
+        int last = band(Math.max(y(edge.from), y(edge.to)));
+        for (int band = band(Math.min(y(edge.from), y(edge.to))); band <= last; band++) {
+          entries[fill[band]++] = i;
+        }
+      }
+    }
+
+    int band(long y) {
+      return (int) Math.max(0, Math.min((y - minY) / bandHeight, bandCount - 1));
+    }
+
+    int start(int band) {
+      return offsets[band];
+    }
+
+    int end(int band) {
+      return offsets[band + 1];
+    }
+
+    int edgeAt(int entry) {
+      return entries[entry];
+    }
+  }
+
+  private static List<List<Long>> emptyLists(int count) {
+    List<List<Long>> lists = new ArrayList<>(count);
+    for (int i = 0; i < count; i++) {
+      lists.add(new ArrayList<>());
+    }
+    return lists;
+  }
+
+  private static void addRing(double[] latLngs, Grid grid, List<long[]> rings) {
+    long[] ring = new long[latLngs.length / 2];
+    int size = 0;
+    for (int i = 0; i + 1 < latLngs.length; i += 2) {
+      long snapped = grid.toGrid(latLngs[i], latLngs[i + 1]);
+      if (size == 0 || snapped != ring[size - 1]) {
+        ring[size++] = snapped;
+      }
+    }
+    while (size > 1 && ring[0] == ring[size - 1]) {
+      size--;
+    }
+    ring = Arrays.copyOf(ring, size);
+    if (size >= 3) {
+      rings.add(ring);
+    }
+  }
+
+  /** Adds the points where the two edges cross or touch to the split points of each. */
+  private static void intersect(Edge a, Edge b, List<Long> splitsA, List<Long> splitsB) {
+    long d1 = cross(b.from, b.to, a.from);
+    long d2 = cross(b.from, b.to, a.to);
+    long d3 = cross(a.from, a.to, b.from);
+    long d4 = cross(a.from, a.to, b.to);
+    if (Long.signum(d1) * Long.signum(d2) < 0 && Long.signum(d3) * Long.signum(d4) < 0) {
+      // A proper crossing, rounded to the grid.
+      double t = (double) d1 / ((double) d1 - (double) d2);
+      long crossing =
+          point(
+              Math.round(x(a.from) + (x(a.to) - x(a.from)) * t),
+              Math.round(y(a.from) + (y(a.to) - y(a.from)) * t));
+      splitsA.add(crossing);
+      splitsB.add(crossing);
+      return;
+    }
+    // Touching or collinear: split each edge at the endpoints of the other that lie on it.
+    if (onSegment(b.from, a.from, a.to)) {
+      splitsA.add(b.from);
+    }
+    if (onSegment(b.to, a.from, a.to)) {
+      splitsA.add(b.to);
+    }
+    if (onSegment(a.from, b.from, b.to)) {
+      splitsB.add(a.from);
+    }
+    if (onSegment(a.to, b.from, b.to)) {
+      splitsB.add(a.to);
+    }
+  }
+
+  /**
+   * Finds where the edges of `a` meet those of `b`. When both are the same list, each pair is
+   * tested once.
+   */
+  private static void findIntersections(
+      List<Edge> a, List<Edge> b, List<List<Long>> splitsA, List<List<Long>> splitsB) {
+    if (a.isEmpty() || b.isEmpty()) {
+      return;
+    }
+    boolean self = a == b;
+    BandIndex index = new BandIndex(b);
+    for (int i = 0; i < a.size(); i++) {
+      Edge edge = a.get(i);
+      long minX = Math.min(x(edge.from), x(edge.to));
+      long maxX = Math.max(x(edge.from), x(edge.to));
+      long minY = Math.min(y(edge.from), y(edge.to));
+      long maxY = Math.max(y(edge.from), y(edge.to));
+      int last = index.band(maxY);
+      for (int band = index.band(minY); band <= last; band++) {
+        for (int entry = index.start(band); entry < index.end(band); entry++) {
+          int j = index.edgeAt(entry);
+          if (self && j <= i) {
+            continue;
+          }
+          Edge other = b.get(j);
+          long overlapMinY = Math.max(minY, Math.min(y(other.from), y(other.to)));
+          if (overlapMinY > Math.min(maxY, Math.max(y(other.from), y(other.to)))
+              || Math.max(minX, Math.min(x(other.from), x(other.to)))
+                  > Math.min(maxX, Math.max(x(other.from), x(other.to)))) {
+            continue;
+          }
+          // Pairs sharing several bands are only tested in the first band of their overlap.
+          if (index.band(overlapMinY) != band) {
+            continue;
+          }
+          intersect(edge, other, splitsA.get(i), splitsB.get(j));
+        }
+      }
+    }
+  }
+
+  private static List<Edge> splitEdges(List<Edge> edges, List<List<Long>> splits) {
+    List<Edge> result = new ArrayList<>(edges.size());
+    for (int i = 0; i < edges.size(); i++) {
+      Edge edge = edges.get(i);
+      List<Long> points = splits.get(i);
+      long dx = x(edge.to) - x(edge.from);
+      long dy = y(edge.to) - y(edge.from);
+      long length = dx * dx + dy * dy;
+      Long[] sorted = points.toArray(new Long[0]);
+      Arrays.sort(
+          sorted,
+          (p, q) ->
+              Long.compare(
+                  (x(p) - x(edge.from)) * dx + (y(p) - y(edge.from)) * dy,
+                  (x(q) - x(edge.from)) * dx + (y(q) - y(edge.from)) * dy));
+      long current = edge.from;
+      for (long point : sorted) {
+        long position = (x(point) - x(edge.from)) * dx + (y(point) - y(edge.from)) * dy;
+        if (position <= 0 || position >= length || point == current || point == edge.to) {
+          continue;
+        }
+        result.add(new Edge(current, point));
+        current = point;
+      }
+      result.add(new Edge(current, edge.to));
+    }
+    return result;
+  }
+
+  private static Edge reversed(Edge edge) {
+    return new Edge(edge.to, edge.from);
+  }
+
+  private static Edge transpose(Edge edge) {
+    return new Edge(point(y(edge.from), x(edge.from)), point(y(edge.to), x(edge.to)));
+  }
+
+  /**
+   * Whether the even-odd area of `edges` is on the left of `edges[i]`. The ray from the midpoint of
+   * the edge towards +x gives the parity right next to it on that side; horizontal edges are cast
+   * towards +y with the transposed edges instead.
+   */
+  private static boolean areaOnLeft(
+      int i, List<Edge> edges, BandIndex rows, List<Edge> transposed, BandIndex columns) {
+    Edge edge = edges.get(i);
+    boolean horizontal = y(edge.from) == y(edge.to);
+    List<Edge> cast = horizontal ? transposed : edges;
+    BandIndex index = horizontal ? columns : rows;
+    Edge probe = cast.get(i);
+    long doubledX = x(probe.from) + x(probe.to);
+    long doubledY = y(probe.from) + y(probe.to);
+    boolean beyond = false;
+    int band = index.band(doubledY / 2);
+    for (int entry = index.start(band); entry < index.end(band); entry++) {
+      Edge candidate = cast.get(index.edgeAt(entry));
+      if (rayCrosses(candidate.from, candidate.to, doubledX, doubledY)) {
+        beyond = !beyond;
+      }
+    }
+    // An upward edge has +x on its right, a rightward edge has +y on its left.
+    return horizontal
+        ? (x(edge.to) > x(edge.from)) == beyond
+        : (y(edge.to) > y(edge.from)) != beyond;
+  }
+
+  /**
+   * Returns the boundary of the even-odd area of the rings, oriented so that the area (or its
+   * complement when `complement` is set) is on the left of every edge. Rings may cross or overlap
+   * themselves and each other: edges are split where they meet, pieces covered an even number of
+   * times are not on the boundary, and the side of the area is found by a ray cast from each piece.
+   */
+  private static List<Edge> orientedEdges(
+      List<GeoPolygon> polygons, Grid grid, boolean complement) {
+    List<long[]> rings = new ArrayList<>();
+    for (GeoPolygon polygon : polygons) {
+      addRing(polygon.outer, grid, rings);
+      for (double[] hole : polygon.holes) {
+        addRing(hole, grid, rings);
+      }
+    }
+    List<Edge> edges = new ArrayList<>();
+    for (long[] ring : rings) {
+      for (int k = 0; k < ring.length; k++) {
+        edges.add(new Edge(ring[k], ring[(k + 1) % ring.length]));
+      }
+    }
+    List<List<Long>> splits = emptyLists(edges.size());
+    findIntersections(edges, edges, splits, splits);
+    List<Edge> pieces = splitEdges(edges, splits);
+
+    // Pieces are counted regardless of direction, under the direction of their lower endpoint.
+    Map<Edge, Integer> counts = new HashMap<>(pieces.size() * 2);
+    for (Edge piece : pieces) {
+      Edge canonical = piece.from < piece.to ? piece : reversed(piece);
+      Integer count = counts.get(canonical);
+      counts.put(canonical, count == null ? 1 : count + 1);
+    }
+    List<Edge> boundary = new ArrayList<>();
+    for (Edge piece : pieces) {
+      Edge canonical = piece.from < piece.to ? piece : reversed(piece);
+      if (counts.get(canonical) % 2 == 1) {
+        boundary.add(piece);
+        counts.put(canonical, 0);
+      }
+    }
+
+    List<Edge> transposed = new ArrayList<>(boundary.size());
+    for (Edge edge : boundary) {
+      transposed.add(transpose(edge));
+    }
+    BandIndex rows = new BandIndex(boundary);
+    BandIndex columns = new BandIndex(transposed);
+    List<Edge> oriented = new ArrayList<>(boundary.size());
+    for (int i = 0; i < boundary.size(); i++) {
+      boolean keep = areaOnLeft(i, boundary, rows, transposed, columns) != complement;
+      oriented.add(keep ? boundary.get(i) : reversed(boundary.get(i)));
+    }
+    return oriented;
+  }
+
+  private static int locate(
+      Edge edge, Set<Edge> otherEdges, BandIndex otherIndex, List<Edge> other) {
+    if (otherEdges.contains(edge)) {
+      return LOCATION_SHARED_SAME;
+    }
+    if (otherEdges.contains(new Edge(edge.to, edge.from))) {
+      return LOCATION_SHARED_OPPOSITE;
+    }
+    long doubledX = x(edge.from) + x(edge.to);
+    long doubledY = y(edge.from) + y(edge.to);
+    boolean inside = false;
+    int band = otherIndex.band(doubledY / 2);
+    for (int entry = otherIndex.start(band); entry < otherIndex.end(band); entry++) {
+      Edge candidate = other.get(otherIndex.edgeAt(entry));
+      if (rayCrosses(candidate.from, candidate.to, doubledX, doubledY)) {
+        inside = !inside;
+      }
+    }
+    return inside ? LOCATION_INSIDE : LOCATION_OUTSIDE;
+  }
+
+  /**
+   * Follows the edges into rings. At a vertex with several outgoing edges, the first one clockwise
+   * from the incoming edge is taken, which keeps the inside on the left and separates rings that
+   * touch at a vertex.
+   */
+  private static List<long[]> linkRings(List<Edge> edges) {
+    Map<Long, List<Integer>> outgoing = new HashMap<>();
+    for (int i = 0; i < edges.size(); i++) {
+      List<Integer> candidates = outgoing.get(edges.get(i).from);
+      if (candidates == null) {
+        candidates = new ArrayList<>(1);
+        outgoing.put(edges.get(i).from, candidates);
+      }
+      candidates.add(i);
+    }
+
+    List<long[]> rings = new ArrayList<>();
+    boolean[] used = new boolean[edges.size()];
+    for (int start = 0; start < edges.size(); start++) {
+      if (used[start]) {
+        continue;
+      }
+      List<Long> ring = new ArrayList<>();
+      int current = start;
+      boolean closed = false;
+      while (true) {
+        used[current] = true;
+        Edge incoming = edges.get(current);
+        ring.add(incoming.from);
+        double backX = x(incoming.from) - x(incoming.to);
+        double backY = y(incoming.from) - y(incoming.to);
+        int next = -1;
+        double bestAngle = Double.POSITIVE_INFINITY;
+        List<Integer> candidates = outgoing.get(incoming.to);
+        for (int candidate : candidates != null ? candidates : Collections.<Integer>emptyList()) {
+          Edge edge = edges.get(candidate);
+          double outX = x(edge.to) - x(edge.from);
+          double outY = y(edge.to) - y(edge.from);
+          double angle = -Math.atan2(backX * outY - backY * outX, backX * outX + backY * outY);
+          if (angle <= 0) {
+            angle += 2 * Math.PI;
+          }
+          if (angle < bestAngle) {
+            bestAngle = angle;
+            next = candidate;
+          }
+        }
+        if (next == start) {
+          closed = true;
+          break;
+        }
+        if (next < 0 || used[next]) {
+          break;
+        }
+        current = next;
+      }
+      if (closed) {
+        long[] points = new long[ring.size()];
+        for (int i = 0; i < points.length; i++) {
+          points[i] = ring.get(i);
+        }
+        rings.add(points);
+      }
+    }
+    return rings;
+  }
+
+  /** Removes collinear vertices and spikes. */
+  private static long[] simplify(long[] ring) {
+    long[] result = new long[ring.length];
+    int size = 0;
+    for (long point : ring) {
+      while (size >= 2 && cross(result[size - 2], result[size - 1], point) == 0) {
+        size--;
+      }
+      result[size++] = point;
+    }
+    int first = 0;
+    boolean changed = true;
+    while (changed && size - first >= 3) {
+      changed = false;
+      if (cross(result[size - 2], result[size - 1], result[first]) == 0) {
+        size--;
+        changed = true;
+      } else if (cross(result[size - 1], result[first], result[first + 1]) == 0) {
+        first++;
+        changed = true;
+      }
+    }
+    return Arrays.copyOfRange(result, first, size);
+  }
+
+  private static double[] toLatLngs(long[] ring, Grid grid) {
+    double[] latLngs = new double[ring.length * 2];
+    for (int i = 0; i < ring.length; i++) {
+      latLngs[2 * i] = grid.lat(ring[i]);
+      latLngs[2 * i + 1] = grid.lng(ring[i]);
+    }
+    return latLngs;
+  }
+
+  /** Groups the rings into polygons, each hole going to the smallest outer ring containing it. */
+  private static List<GeoPolygon> assemble(List<long[]> rings, Grid grid) {
+    List<long[]> outers = new ArrayList<>();
+    List<Double> outerAreas = new ArrayList<>();
+    List<long[]> holes = new ArrayList<>();
+    for (long[] linked : rings) {
+      long[] ring = simplify(linked);
+      if (ring.length < 3) {
+        continue;
+      }
+      double area = signedArea(ring);
+      if (area > 0) {
+        outers.add(ring);
+        outerAreas.add(area);
+      } else if (area < 0) {
+        holes.add(ring);
+      }
+    }
+
+    List<GeoPolygon> polygons = new ArrayList<>(outers.size());
+    for (long[] outer : outers) {
+      polygons.add(new GeoPolygon(toLatLngs(outer, grid), new ArrayList<>()));
+    }
+    for (long[] hole : holes) {
+      long doubledX = x(hole[0]) + x(hole[1]);
+      long doubledY = y(hole[0]) + y(hole[1]);
+      double holeArea = -signedArea(hole);
+      int owner = -1;
+      for (int i = 0; i < outers.size(); i++) {
+        boolean smaller = owner < 0 || outerAreas.get(i) < outerAreas.get(owner);
+        if (outerAreas.get(i) > holeArea
+            && smaller
+            && ringContains(outers.get(i), doubledX, doubledY)) {
+          owner = i;
+        }
+      }
+      if (owner >= 0) {
+        polygons.get(owner).holes.add(toLatLngs(hole, grid));
+      }
+    }
+    return polygons;
+  }
+}
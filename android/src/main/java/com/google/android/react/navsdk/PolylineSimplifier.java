@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import com.google.android.gms.maps.model.LatLng;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Douglas-Peucker polyline simplification, the Java counterpart of NavPolylineSimplifier.cpp on
+ * iOS. Keeps the end points and every vertex needed so that no removed vertex is farther than the
+ * tolerance from the simplified line. Distances are measured in a local equirectangular
+ * projection, which is accurate for the short tolerances used on screen.
+ */
+public final class PolylineSimplifier {
+  private static final double METERS_PER_DEGREE = 6371009.0 * Math.PI / 180;
+
+  private PolylineSimplifier() {}
+
+  /** Returns the points unchanged when the tolerance is not positive. */
+  public static List<LatLng> simplify(List<LatLng> points, double toleranceMeters) {
+    int count = points.size();
+    if (!(toleranceMeters > 0) || count < 3) {
+      return points;
+    }
+
+    // Project around the first point, with longitudes unwrapped relative to it.
+    LatLng origin = points.get(0);
+    double xScale = METERS_PER_DEGREE * Math.cos(Math.toRadians(origin.latitude));
+    double[] xs = new double[count];
+    double[] ys = new double[count];
+    for (int i = 0; i < count; i++) {
+      LatLng point = points.get(i);
+      xs[i] = Math.IEEEremainder(point.longitude - origin.longitude, 360) * xScale;
+      ys[i] = (point.latitude - origin.latitude) * METERS_PER_DEGREE;
+    }
+
+    boolean[] keep = new boolean[count];
+    keep[0] = true;
+    keep[count - 1] = true;
+    double toleranceSquared = toleranceMeters * toleranceMeters;
+    // Ranges still to split, processed with an explicit stack so long lines cannot overflow it.
+    ArrayDeque<int[]> ranges = new ArrayDeque<>();
+    ranges.push(new int[] {0, count - 1});
+    while (!ranges.isEmpty()) {
+      int[] range = ranges.pop();
+      int first = range[0];
+      int last = range[1];
+      double farthest = toleranceSquared;
+      int split = 0;
+      for (int i = first + 1; i < last; i++) {
+        double distance = squaredSegmentDistance(xs, ys, i, first, last);
+        if (distance > farthest) {
+          farthest = distance;
+          split = i;
+        }
+      }
+      if (split == 0) {
+        continue;
+      }
+      keep[split] = true;
+      if (split - first > 1) {
+        ranges.push(new int[] {first, split});
+      }
+      if (last - split > 1) {
+        ranges.push(new int[] {split, last});
+      }
+    }
+
+    List<LatLng> result = new ArrayList<>();
+    for (int i = 0; i < count; i++) {
+      if (keep[i]) {
+        result.add(points.get(i));
+      }
+    }
+    return result;
+  }
+
+  private static double squaredSegmentDistance(double[] xs, double[] ys, int p, int a, int b) {
+    double dx = xs[b] - xs[a];
+    double dy = ys[b] - ys[a];
+    double lengthSquared = dx * dx + dy * dy;
+    double t = 0;
+    if (lengthSquared > 0) {
+      t = ((xs[p] - xs[a]) * dx + (ys[p] - ys[a]) * dy) / lengthSquared;
+      t = Math.max(0, Math.min(1, t));
+    }
+    double ex = xs[a] + t * dx - xs[p];
+    double ey = ys[a] + t * dy - ys[p];
+    return ex * ex + ey * ey;
+  }
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.os.Handler;
+import android.os.Looper;
+import com.facebook.react.bridge.Arguments;
+import com.facebook.react.bridge.WritableMap;
+
+/**
+ * Samples frame pacing and UI-thread load of a view and moves the quality knobs between their
+ * configured bounds: quality is lowered one step when frames are late, hitching or the UI thread
+ * is saturated, and raised one step after several consecutive healthy windows.
+ */
+public class QualityGovernor {
+  private static final double LEVEL_STEP = 0.25;
+  private static final double SLOW_FRAME_FACTOR = 1.15;
+  private static final double HEALTHY_FRAME_FACTOR = 0.9;
+  private static final double MAX_HITCH_RATIO = 0.05;
+  private static final double HEALTHY_HITCH_RATIO = 0.01;
+  private static final double MAX_MAIN_THREAD_LOAD = 0.85;
+  private static final double HEALTHY_MAIN_THREAD_LOAD = 0.6;
+  private static final int HEALTHY_WINDOWS_BEFORE_UPGRADE = 3;
+
+  private static final String[] KNOBS = {
+    "polylineTolerance", "clusterRadius", "eventRate", "animationFrameRate", "virtualizationMargin"
+  };
+
+  /**
+   * Range a quality knob may be adjusted within. {@code best} is used at full quality and {@code
+   * cheapest} when quality has been degraded as far as allowed; either may be the larger value.
+   */
+  public static class Bounds {
+    public final double best;
+    public final double cheapest;
+
+    public Bounds(double best, double cheapest) {
+      this.best = best;
+      this.cheapest = cheapest;
+    }
+
+    double valueAt(double level) {
+      return best + (cheapest - best) * level;
+    }
+  }
+
+  /** Governor configuration. Knob units are documented on the corresponding getters. */
+  public static class Config {
+    public double targetFrameRate;
+    public long evaluationIntervalMs;
+    public Bounds polylineTolerance;
+    public Bounds clusterRadius;
+    public Bounds eventRate;
+    public Bounds animationFrameRate;
+    public Bounds virtualizationMargin;
+
+    Bounds[] knobBounds() {
+      return new Bounds[] {
+        polylineTolerance, clusterRadius, eventRate, animationFrameRate, virtualizationMargin
+      };
+    }
+  }
+
+  /** Receives one call per knob that changed. */
+  public interface AdjustmentListener {
+    void onAdjustment(WritableMap adjustment);
+  }
+
+  private final Config config;
+  private final FrameSampler sampler;
+  private final AdjustmentListener listener;
+  private final Handler handler = new Handler(Looper.getMainLooper());
+  private final double[] settings = new double[KNOBS.length];
+  private double qualityLevel = 0;
+  private int healthyWindows = 0;
+  private boolean running = false;
+
+  private final Runnable evaluateRunnable =
+      new Runnable() {
+        @Override
+        public void run() {
+          evaluate();
+          if (running) {
+            handler.postDelayed(this, getEvaluationIntervalMs());
+          }
+        }
+      };
+
+  public QualityGovernor(Config config, FrameSampler sampler, AdjustmentListener listener) {
+    this.config = config;
+    this.sampler = sampler;
+    this.listener = listener;
+    applyLevel();
+  }
+
+  public void start() {
+    if (running) {
+      return;
+    }
+    running = true;
+    sampler.start();
+    // Discard frames sampled for other clients before this governor started.
+    sampler.takeWindow();
+    handler.postDelayed(evaluateRunnable, getEvaluationIntervalMs());
+  }
+
+  public void stop() {
+    if (!running) {
+      return;
+    }
+    running = false;
+    handler.removeCallbacks(evaluateRunnable);
+    sampler.stop();
+  }
+
+  /** 0 for best quality, 1 for the cheapest settings allowed. */
+  public double getQualityLevel() {
+    return qualityLevel;
+  }
+
+  /** Polyline simplification tolerance in meters. */
+  public double getPolylineTolerance() {
+    return settings[0];
+  }
+
+  /** Marker clustering radius in pixels. */
+  public double getClusterRadius() {
+    return settings[1];
+  }
+
+  /** Maximum rate of high-frequency view events in Hz. */
+  public double getEventRate() {
+    return settings[2];
+  }
+
+  /** Frame rate of natively driven animations. */
+  public double getAnimationFrameRate() {
+    return settings[3];
+  }
+
+  /** Extra area around the viewport kept materialized, as a fraction of the viewport size. */
+  public double getVirtualizationMargin() {
+    return settings[4];
+  }
+
+  private long getEvaluationIntervalMs() {
+    return Math.max(250, config.evaluationIntervalMs);
+  }
+
+  private void evaluate() {
+    FrameSampler.Window window = sampler.takeWindow();
+    if (window.frameCount == 0) {
+      // Nothing was rendered, e.g. the view is off screen.
+      return;
+    }
+
+    double targetFrameMs =
+        config.targetFrameRate > 0 ? 1000.0 / config.targetFrameRate : sampler.getTargetFrameMs();
+    double hitchRatio = (double) window.hitchCount / window.frameCount;
+
+    String reason = null;
+    if (window.averageFrameMs > targetFrameMs * SLOW_FRAME_FACTOR) {
+      reason = "frameTime";
+    } else if (hitchRatio > MAX_HITCH_RATIO) {
+      reason = "hitches";
+    } else if (window.mainThreadLoad > MAX_MAIN_THREAD_LOAD) {
+      reason = "mainThreadLoad";
+    }
+
+    double level = qualityLevel;
+    if (reason != null) {
+      healthyWindows = 0;
+      level = Math.min(1.0, level + LEVEL_STEP);
+    } else if (window.averageFrameMs < targetFrameMs * HEALTHY_FRAME_FACTOR
+        && hitchRatio < HEALTHY_HITCH_RATIO
+        && window.mainThreadLoad < HEALTHY_MAIN_THREAD_LOAD) {
+      if (++healthyWindows >= HEALTHY_WINDOWS_BEFORE_UPGRADE) {
+        healthyWindows = 0;
+        level = Math.max(0.0, level - LEVEL_STEP);
+        reason = "headroom";
+      }
+    } else {
+      healthyWindows = 0;
+    }
+
+    if (level == qualityLevel) {
+      return;
+    }
+
+    double[] previous = settings.clone();
+    qualityLevel = level;
+    applyLevel();
+
+    for (int i = 0; i < KNOBS.length; i++) {
+      if (previous[i] == settings[i]) {
+        continue;
+      }
+      WritableMap adjustment = Arguments.createMap();
+      adjustment.putString("knob", KNOBS[i]);
+      adjustment.putDouble("previousValue", previous[i]);
+      adjustment.putDouble("value", settings[i]);
+      adjustment.putDouble("qualityLevel", qualityLevel);
+      adjustment.putString("reason", reason);
+      adjustment.putDouble("averageFrameMs", window.averageFrameMs);
+      adjustment.putDouble("hitchRatio", hitchRatio);
+      adjustment.putDouble("mainThreadLoad", window.mainThreadLoad);
+      listener.onAdjustment(adjustment);
+    }
+  }
+
+  private void applyLevel() {
+    Bounds[] knobBounds = config.knobBounds();
+    for (int i = 0; i < KNOBS.length; i++) {
+      Bounds bounds = knobBounds[i];
+      settings[i] = bounds != null ? bounds.valueAt(qualityLevel) : 0;
+    }
+  }
+}
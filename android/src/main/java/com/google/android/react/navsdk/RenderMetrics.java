@@ -0,0 +1,267 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.os.Handler;
+import android.os.Looper;
+import androidx.annotation.Nullable;
+import androidx.core.util.Supplier;
+import com.facebook.react.bridge.Arguments;
+import com.facebook.react.bridge.WritableArray;
+import com.facebook.react.bridge.WritableMap;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Collects cumulative frame pacing statistics of a view: a frame interval histogram, hitches and
+ * the longest frame. Each hitch is recorded with the overlay count and the module commands that
+ * preceded it, to tie jank to specific overlay loads.
+ */
+public class RenderMetrics implements FrameSampler.FrameListener {
+  /** Upper bounds in milliseconds of the histogram buckets; the last bucket is unbounded. */
+  public static final double[] HISTOGRAM_BUCKETS_MS = {8.4, 16.7, 25, 33.4, 50, 100};
+
+  private static final double HITCH_THRESHOLD = 1.5;
+  private static final int MAX_RECENT_COMMANDS = 32;
+  private static final int MAX_RECORDED_HITCHES = 16;
+  // Commands issued within this window before a hitch are attributed to it.
+  private static final long HITCH_COMMAND_WINDOW_NANOS = 1_000_000_000L;
+
+  /** Receives periodic snapshots. */
+  public interface ReportListener {
+    void onReport(WritableMap snapshot);
+  }
+
+  private static class Command {
+    final String name;
+    final long timeNanos;
+
+    Command(String name, long timeNanos) {
+      this.name = name;
+      this.timeNanos = timeNanos;
+    }
+  }
+
+  private static class Hitch {
+    final double frameMs;
+    final long timeNanos;
+    final int overlayCount;
+    final List<String> commands;
+
+    Hitch(double frameMs, long timeNanos, int overlayCount, List<String> commands) {
+      this.frameMs = frameMs;
+      this.timeNanos = timeNanos;
+      this.overlayCount = overlayCount;
+      this.commands = commands;
+    }
+  }
+
+  private final FrameSampler sampler;
+  private final Supplier<Map<String, Integer>> overlayCountsSupplier;
+  private final Handler handler = new Handler(Looper.getMainLooper());
+  private boolean started = false;
+
+  private long reportIntervalMs = 0;
+  @Nullable private ReportListener reportListener;
+
+  private long periodStartNanos;
+  private int frameCount;
+  private double frameSumMs;
+  private double longestFrameMs;
+  private long longestFrameTimeNanos;
+  private int hitchCount;
+  private final int[] histogram = new int[HISTOGRAM_BUCKETS_MS.length + 1];
+  private final ArrayDeque<Hitch> hitches = new ArrayDeque<>();
+
+  // Guarded by itself, written from the TurboModule thread.
+  private final ArrayDeque<Command> recentCommands = new ArrayDeque<>();
+
+  private final Runnable reportRunnable =
+      new Runnable() {
+        @Override
+        public void run() {
+          if (!started || reportListener == null) {
+            return;
+          }
+          reportListener.onReport(snapshot(true));
+          handler.postDelayed(this, reportIntervalMs);
+        }
+      };
+
+  public RenderMetrics(
+      FrameSampler sampler, Supplier<Map<String, Integer>> overlayCountsSupplier) {
+    this.sampler = sampler;
+    this.overlayCountsSupplier = overlayCountsSupplier;
+    reset();
+  }
+
+  /**
+   * When positive and a listener is set, a snapshot is delivered every interval and a new period
+   * is started. Must be set before {@link #start()}.
+   */
+  public void setReportListener(long intervalMs, @Nullable ReportListener listener) {
+    reportIntervalMs = intervalMs;
+    reportListener = listener;
+  }
+
+  public void start() {
+    if (started) {
+      return;
+    }
+    started = true;
+    reset();
+    sampler.setFrameListener(this);
+    sampler.start();
+    if (reportIntervalMs > 0 && reportListener != null) {
+      handler.postDelayed(reportRunnable, reportIntervalMs);
+    }
+  }
+
+  public void stop() {
+    if (!started) {
+      return;
+    }
+    started = false;
+    handler.removeCallbacks(reportRunnable);
+    sampler.setFrameListener(null);
+    sampler.stop();
+  }
+
+  /** Records a module command issued for the view. Safe to call from any thread. */
+  public void recordCommand(String name) {
+    synchronized (recentCommands) {
+      recentCommands.addLast(new Command(name, System.nanoTime()));
+      if (recentCommands.size() > MAX_RECENT_COMMANDS) {
+        recentCommands.removeFirst();
+      }
+    }
+  }
+
+  @Override
+  public void onFrame(double frameMs, long frameTimeNanos) {
+    frameCount++;
+    frameSumMs += frameMs;
+    if (frameMs > longestFrameMs) {
+      longestFrameMs = frameMs;
+      longestFrameTimeNanos = frameTimeNanos;
+    }
+
+    int bucket = 0;
+    while (bucket < HISTOGRAM_BUCKETS_MS.length && frameMs > HISTOGRAM_BUCKETS_MS[bucket]) {
+      bucket++;
+    }
+    histogram[bucket]++;
+
+    if (frameMs <= sampler.getTargetFrameMs() * HITCH_THRESHOLD) {
+      return;
+    }
+    hitchCount++;
+
+    int overlayCount = 0;
+    for (int count : overlayCountsSupplier.get().values()) {
+      overlayCount += count;
+    }
+    List<String> commands = new ArrayList<>();
+    synchronized (recentCommands) {
+      for (Command command : recentCommands) {
+        if (frameTimeNanos - command.timeNanos <= HITCH_COMMAND_WINDOW_NANOS) {
+          commands.add(command.name);
+        }
+      }
+    }
+    hitches.addLast(new Hitch(frameMs, frameTimeNanos, overlayCount, commands));
+    if (hitches.size() > MAX_RECORDED_HITCHES) {
+      hitches.removeFirst();
+    }
+  }
+
+  /** Returns the statistics collected since the last reset, optionally starting a new period. */
+  public WritableMap snapshot(boolean reset) {
+    long now = System.nanoTime();
+
+    WritableArray bucketsArray = Arguments.createArray();
+    for (double bound : HISTOGRAM_BUCKETS_MS) {
+      bucketsArray.pushDouble(bound);
+    }
+    WritableArray histogramArray = Arguments.createArray();
+    for (int count : histogram) {
+      histogramArray.pushDouble(count);
+    }
+
+    WritableArray hitchesArray = Arguments.createArray();
+    for (Hitch hitch : hitches) {
+      WritableMap hitchMap = Arguments.createMap();
+      hitchMap.putDouble("frameMs", hitch.frameMs);
+      hitchMap.putDouble("ageMs", (now - hitch.timeNanos) / 1e6);
+      hitchMap.putDouble("overlayCount", hitch.overlayCount);
+      WritableArray commandsArray = Arguments.createArray();
+      for (String command : hitch.commands) {
+        commandsArray.pushString(command);
+      }
+      hitchMap.putArray("commands", commandsArray);
+      hitchesArray.pushMap(hitchMap);
+    }
+
+    WritableArray commandsArray = Arguments.createArray();
+    synchronized (recentCommands) {
+      for (Command command : recentCommands) {
+        WritableMap commandMap = Arguments.createMap();
+        commandMap.putString("name", command.name);
+        commandMap.putDouble("ageMs", (now - command.timeNanos) / 1e6);
+        commandsArray.pushMap(commandMap);
+      }
+    }
+
+    WritableMap overlayCounts = Arguments.createMap();
+    for (Map.Entry<String, Integer> entry : overlayCountsSupplier.get().entrySet()) {
+      overlayCounts.putDouble(entry.getKey(), entry.getValue());
+    }
+
+    WritableMap map = Arguments.createMap();
+    map.putDouble("durationMs", (now - periodStartNanos) / 1e6);
+    map.putDouble("frameCount", frameCount);
+    map.putDouble("averageFrameMs", frameCount > 0 ? frameSumMs / frameCount : 0);
+    map.putDouble("longestFrameMs", longestFrameMs);
+    map.putDouble(
+        "longestFrameAgeMs", longestFrameTimeNanos > 0 ? (now - longestFrameTimeNanos) / 1e6 : 0);
+    map.putDouble("hitchCount", hitchCount);
+    map.putArray("histogramBucketsMs", bucketsArray);
+    map.putArray("histogram", histogramArray);
+    map.putArray("hitches", hitchesArray);
+    map.putArray("recentCommands", commandsArray);
+    map.putMap("overlayCounts", overlayCounts);
+
+    if (reset) {
+      reset();
+    }
+    return map;
+  }
+
+  private void reset() {
+    periodStartNanos = System.nanoTime();
+    frameCount = 0;
+    frameSumMs = 0;
+    longestFrameMs = 0;
+    longestFrameTimeNanos = 0;
+    hitchCount = 0;
+    Arrays.fill(histogram, 0);
+    hitches.clear();
+  }
+}
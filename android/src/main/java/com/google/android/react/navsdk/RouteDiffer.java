@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import com.facebook.react.bridge.Arguments;
+import com.facebook.react.bridge.WritableArray;
+import com.facebook.react.bridge.WritableMap;
+import com.google.android.gms.maps.model.LatLng;
+import com.google.android.libraries.navigation.RouteSegment;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Diffs each route against the previous one so reroutes can be reported as patches. Vertices are
+ * compared after quantizing to 1e-6 degrees; per leg, the common prefix and suffix are kept and
+ * only the vertices in between are reported.
+ */
+public class RouteDiffer {
+  private static final long[] NO_VERTICES = new long[0];
+
+  private final List<long[]> legs = new ArrayList<>();
+  private boolean hasRoute;
+
+  /**
+   * Diffs {@code segments} against the route of the previous call and remembers them for the next
+   * one. Returns an {@code onRouteChanged} payload: {fullReplacement, droppedLegCount, legCount,
+   * legChanges}, where each leg change is {legIndex, start, removedCount, latLngs} with packed
+   * [lat, lng, ...] vertices.
+   */
+  public synchronized WritableMap diff(List<RouteSegment> segments) {
+    List<List<LatLng>> newPaths = new ArrayList<>(segments.size());
+    List<long[]> newLegs = new ArrayList<>(segments.size());
+    for (RouteSegment segment : segments) {
+      List<LatLng> path = segment.getLatLngs();
+      newPaths.add(path);
+      newLegs.add(quantize(path));
+    }
+
+    // Arriving at a waypoint drops the legs before it, so the remaining legs are aligned with the
+    // end of the previous route. A route with more legs than before is reported as a whole.
+    boolean fullReplacement = !hasRoute || newLegs.size() > legs.size();
+    int dropped = fullReplacement ? 0 : legs.size() - newLegs.size();
+
+    WritableArray legChanges = Arguments.createArray();
+    for (int i = 0; i < newLegs.size(); i++) {
+      long[] current = newLegs.get(i);
+      long[] previous = fullReplacement ? NO_VERTICES : legs.get(i + dropped);
+      if (!fullReplacement && Arrays.equals(current, previous)) {
+        continue;
+      }
+
+      int limit = Math.min(current.length, previous.length);
+      int prefix = 0;
+      while (prefix < limit && current[prefix] == previous[prefix]) {
+        prefix++;
+      }
+      int suffix = 0;
+      while (suffix < limit - prefix
+          && current[current.length - 1 - suffix] == previous[previous.length - 1 - suffix]) {
+        suffix++;
+      }
+
+      WritableArray latLngs = Arguments.createArray();
+      List<LatLng> path = newPaths.get(i);
+      for (int j = prefix; j < current.length - suffix; j++) {
+        latLngs.pushDouble(path.get(j).latitude);
+        latLngs.pushDouble(path.get(j).longitude);
+      }
+
+      WritableMap legChange = Arguments.createMap();
+      legChange.putInt("legIndex", i);
+      legChange.putInt("start", prefix);
+      legChange.putInt("removedCount", previous.length - prefix - suffix);
+      legChange.putArray("latLngs", latLngs);
+      legChanges.pushMap(legChange);
+    }
+
+    legs.clear();
+    legs.addAll(newLegs);
+    hasRoute = true;
+
+    WritableMap routeChange = Arguments.createMap();
+    routeChange.putBoolean("fullReplacement", fullReplacement);
+    routeChange.putInt("droppedLegCount", dropped);
+    routeChange.putInt("legCount", newLegs.size());
+    routeChange.putArray("legChanges", legChanges);
+    return routeChange;
+  }
+
+  /** Forgets the previous route, so that the next diff is a full replacement. */
+  public synchronized void reset() {
+    legs.clear();
+    hasRoute = false;
+  }
+
+  // Packs each vertex quantized to 1e-6 degrees, about 0.1 m, into one comparable value.
+  private static long[] quantize(List<LatLng> path) {
+    long[] vertices = new long[path.size()];
+    for (int i = 0; i < vertices.length; i++) {
+      LatLng latLng = path.get(i);
+      int lat = (int) Math.round(latLng.latitude * 1e6);
+      int lng = (int) Math.round(latLng.longitude * 1e6);
+      vertices[i] = ((long) lat << 32) | (lng & 0xFFFFFFFFL);
+    }
+    return vertices;
+  }
+}
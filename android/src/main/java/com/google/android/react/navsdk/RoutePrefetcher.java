@@ -0,0 +1,597 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.os.Handler;
+import android.os.Looper;
+import androidx.annotation.Nullable;
+import com.google.android.gms.maps.model.LatLng;
+import com.google.android.libraries.navigation.RouteSegment;
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import org.json.JSONArray;
+import org.json.JSONException;
+import org.json.JSONObject;
+
+/**
+ * Loads point features along the upcoming part of the route from a file-backed tile store. The
+ * store is a directory of {@code {z}/{x}/{y}.json} files, each holding a JSON array of features
+ * with an {@code id}, {@code lat} and {@code lng}. As the road-snapped location advances, the
+ * prefetcher covers the next {@code aheadMeters} of the route with a corridor of {@code
+ * corridorMeters} on each side, reads the tiles it touches on the worker pool and stages the
+ * features inside the corridor. Once more than {@code maxFeatures} are staged, the features the
+ * car has already passed are evicted first.
+ *
+ * <p>All methods must be called on the main thread.
+ */
+public class RoutePrefetcher {
+  private static final double EARTH_RADIUS_METERS = 6371009.0;
+  // Locations farther than this from the route are ignored until the route changes.
+  private static final double OFF_ROUTE_METERS = 150;
+  // How far past the previous progress the location is searched for before searching the route.
+  private static final double PROGRESS_SEARCH_METERS = 2000;
+
+  /** Receives the features newly staged and the ids of the staged features evicted. */
+  public interface Listener {
+    void onFeaturesStaged(List<JSONObject> staged, List<String> evicted);
+  }
+
+  private static class RouteGeometry {
+    final double[] lats;
+    final double[] lngs;
+    // Distance along the route of each vertex.
+    final double[] meters;
+
+    RouteGeometry(double[] lats, double[] lngs, double[] meters) {
+      this.lats = lats;
+      this.lngs = lngs;
+      this.meters = meters;
+    }
+
+    int size() {
+      return lats.length;
+    }
+  }
+
+  // A tile requested for the corridor, with the range of route segments to test its features
+  // against. A tile loaded before and reached by new segments carries its cached features.
+  private static class TileRequest {
+    final long key;
+    final int x;
+    final int y;
+    final int firstSegment;
+    int lastSegment;
+    double routeMeters;
+    @Nullable final List<JSONObject> cachedFeatures;
+
+    TileRequest(
+        long key,
+        int x,
+        int y,
+        int segment,
+        double routeMeters,
+        @Nullable List<JSONObject> cachedFeatures) {
+      this.key = key;
+      this.x = x;
+      this.y = y;
+      this.firstSegment = segment;
+      this.lastSegment = segment;
+      this.routeMeters = routeMeters;
+      this.cachedFeatures = cachedFeatures;
+    }
+  }
+
+  // A loaded tile, with its features and the last route segment they were tested against.
+  private static class LoadedTile {
+    final List<JSONObject> features;
+    int lastSegment;
+    // Route distance past which the tile is no longer needed.
+    double routeMeters;
+
+    LoadedTile(List<JSONObject> features) {
+      this.features = features;
+    }
+  }
+
+  private static class FoundFeature {
+    final JSONObject feature;
+    final String id;
+    final double routeMeters;
+    final long tileKey;
+
+    FoundFeature(JSONObject feature, String id, double routeMeters, long tileKey) {
+      this.feature = feature;
+      this.id = id;
+      this.routeMeters = routeMeters;
+      this.tileKey = tileKey;
+    }
+  }
+
+  private final String storePath;
+  private final int tileZoom;
+  private final double aheadMeters;
+  private final double corridorMeters;
+  private final int maxFeatures;
+  private final CancellationToken lifetimeToken;
+  // Cancelled when the route changes, so loads for the previous route are dropped.
+  private CancellationToken routeToken;
+  private final Handler mainHandler = new Handler(Looper.getMainLooper());
+  @Nullable private Listener listener;
+
+  @Nullable private RouteGeometry route;
+  private boolean located;
+  @Nullable private LatLng lastLocation;
+  private int progressSegment;
+  private double progressMeters;
+  // End of the corridor requested last; the corridor is extended once progress gets close to it.
+  private double requestedUntilMeters = Double.NEGATIVE_INFINITY;
+
+  // Loaded tiles, and pending tiles with the last segment that reached them while they load.
+  private final Map<Long, LoadedTile> loadedTiles = new HashMap<>();
+  private final Map<Long, Integer> pendingTiles = new HashMap<>();
+  // Route distance of each staged feature, or -infinity for features of a previous route.
+  private final Map<String, Double> stagedMeters = new HashMap<>();
+
+  public RoutePrefetcher(
+      String storePath,
+      int tileZoom,
+      double aheadMeters,
+      double corridorMeters,
+      int maxFeatures,
+      @Nullable CancellationToken lifetimeToken) {
+    this.storePath = storePath;
+    this.tileZoom = Math.max(0, Math.min(22, tileZoom));
+    this.aheadMeters = Math.max(aheadMeters, 100);
+    this.corridorMeters = Math.max(corridorMeters, 1);
+    this.maxFeatures = Math.max(0, maxFeatures);
+    this.lifetimeToken = new CancellationToken(lifetimeToken);
+    this.routeToken = new CancellationToken(this.lifetimeToken);
+  }
+
+  public void setListener(@Nullable Listener listener) {
+    this.listener = listener;
+  }
+
+  /** Ids of the features currently staged. */
+  public List<String> getStagedIds() {
+    return new ArrayList<>(stagedMeters.keySet());
+  }
+
+  /** Drops pending tile loads. The prefetcher stages nothing afterwards. */
+  public void cancel() {
+    lifetimeToken.cancel();
+    loadedTiles.clear();
+    pendingTiles.clear();
+  }
+
+  /** Replaces the route. Features staged for the previous route count as passed. */
+  public void setRouteSegments(@Nullable List<RouteSegment> segments) {
+    routeToken.cancel();
+    routeToken = new CancellationToken(lifetimeToken);
+    loadedTiles.clear();
+    pendingTiles.clear();
+    requestedUntilMeters = Double.NEGATIVE_INFINITY;
+    located = false;
+    progressSegment = 0;
+    progressMeters = 0;
+    for (Map.Entry<String, Double> entry : stagedMeters.entrySet()) {
+      entry.setValue(Double.NEGATIVE_INFINITY);
+    }
+
+    List<LatLng> points = new ArrayList<>();
+    if (segments != null) {
+      for (RouteSegment segment : segments) {
+        for (LatLng point : segment.getLatLngs()) {
+          // Consecutive segments share their waypoint.
+          if (points.isEmpty() || !points.get(points.size() - 1).equals(point)) {
+            points.add(point);
+          }
+        }
+      }
+    }
+    if (points.size() < 2) {
+      route = null;
+    } else {
+      double[] lats = new double[points.size()];
+      double[] lngs = new double[points.size()];
+      double[] meters = new double[points.size()];
+      for (int i = 0; i < points.size(); i++) {
+        lats[i] = points.get(i).latitude;
+        lngs[i] = points.get(i).longitude;
+        if (i > 0) {
+          meters[i] = meters[i - 1] + distance(lats[i - 1], lngs[i - 1], lats[i], lngs[i]);
+        }
+      }
+      route = new RouteGeometry(lats, lngs, meters);
+    }
+
+    if (lastLocation != null) {
+      updateWithLocation(lastLocation);
+    }
+  }
+
+  public void updateWithLocation(LatLng location) {
+    lastLocation = location;
+    if (route == null || lifetimeToken.isCancelled()) {
+      return;
+    }
+    if (!located || !locate(location, progressSegment, PROGRESS_SEARCH_METERS)) {
+      // Localize against the whole route, e.g. after a route change or a loop.
+      if (!locate(location, 0, Double.POSITIVE_INFINITY)) {
+        return;
+      }
+    }
+    located = true;
+    refresh();
+  }
+
+  /** Stops tracking a feature whose overlay was removed by other means. */
+  public void forgetFeature(String featureId) {
+    stagedMeters.remove(featureId);
+  }
+
+  /** Stops tracking all features and loads the corridor again. */
+  public void forgetAllFeatures() {
+    stagedMeters.clear();
+    loadedTiles.clear();
+    requestedUntilMeters = Double.NEGATIVE_INFINITY;
+    if (located) {
+      refresh();
+    }
+  }
+
+  // Moves the progress to the closest point of the route within `limit` meters past the segment
+  // `from`. Returns false if that point is off route.
+  private boolean locate(LatLng location, int from, double limit) {
+    RouteGeometry route = this.route;
+    double end = route.meters[from] + limit;
+    double bestDistance = Double.POSITIVE_INFINITY;
+    int bestSegment = from;
+    double bestT = 0;
+    double[] t = new double[1];
+    for (int i = from; i + 1 < route.size() && route.meters[i] <= end; i++) {
+      double distance = distanceToSegment(location.latitude, location.longitude, route, i, t);
+      if (distance < bestDistance) {
+        bestDistance = distance;
+        bestSegment = i;
+        bestT = t[0];
+      }
+    }
+    if (bestDistance > OFF_ROUTE_METERS) {
+      return false;
+    }
+    progressSegment = bestSegment;
+    progressMeters =
+        route.meters[bestSegment]
+            + bestT * (route.meters[bestSegment + 1] - route.meters[bestSegment]);
+    return true;
+  }
+
+  private void refresh() {
+    // Forget tiles the car has left behind, so they do not accumulate over a long route.
+    double passedMeters = progressMeters - corridorMeters;
+    Iterator<Map.Entry<Long, LoadedTile>> tiles = loadedTiles.entrySet().iterator();
+    while (tiles.hasNext()) {
+      if (tiles.next().getValue().routeMeters < passedMeters) {
+        tiles.remove();
+      }
+    }
+
+    // Extend the corridor in steps rather than on every location update.
+    double untilMeters = progressMeters + aheadMeters;
+    if (untilMeters < requestedUntilMeters + aheadMeters / 4) {
+      return;
+    }
+    requestedUntilMeters = untilMeters;
+
+    loadTiles(tilesFrom(progressSegment, untilMeters));
+  }
+
+  // Reads the tiles that are not cached on the worker pool and tests their features against the
+  // requested segments, then stages the features found.
+  private void loadTiles(final List<TileRequest> requests) {
+    if (requests.isEmpty()) {
+      return;
+    }
+    for (TileRequest tile : requests) {
+      pendingTiles.put(tile.key, tile.lastSegment);
+    }
+
+    final RouteGeometry route = this.route;
+    final CancellationToken token = routeToken;
+    NavWorkerPool.getInstance()
+        .submit(
+            NavWorkerPool.PRIORITY_PREFETCH,
+            token,
+            () -> {
+              List<FoundFeature> found = new ArrayList<>();
+              List<List<JSONObject>> tileFeatures = new ArrayList<>(requests.size());
+              for (TileRequest tile : requests) {
+                if (token.isCancelled()) {
+                  return;
+                }
+                List<JSONObject> features = tile.cachedFeatures;
+                if (features == null) {
+                  features =
+                      readFeatures(
+                          new File(storePath, tileZoom + "/" + tile.x + "/" + tile.y + ".json"));
+                }
+                tileFeatures.add(features);
+                collectFeatures(features, tile, route, corridorMeters, found);
+              }
+              mainHandler.post(
+                  () -> {
+                    if (!token.isCancelled()) {
+                      stageFeatures(found, requests, tileFeatures);
+                    }
+                  });
+            });
+  }
+
+  // Covers the route from segment `from` to `untilMeters` with pieces no longer than the corridor
+  // width, and collects the tiles within the corridor of each piece whose features have not been
+  // tested against that piece yet. Loaded tiles are requested again with their cached features
+  // when new segments reach them; pending tiles remember the segments to test once loaded.
+  private List<TileRequest> tilesFrom(int from, double untilMeters) {
+    RouteGeometry route = this.route;
+    int tileCount = 1 << tileZoom;
+    double metersPerDegree = EARTH_RADIUS_METERS * Math.PI / 180;
+    Map<Long, TileRequest> requests = new LinkedHashMap<>();
+
+    for (int i = from; i + 1 < route.size() && route.meters[i] < untilMeters; i++) {
+      double length = route.meters[i + 1] - route.meters[i];
+      int pieces = Math.max(1, (int) Math.ceil(length / Math.max(corridorMeters, 50)));
+      for (int p = 0; p < pieces; p++) {
+        double t0 = (double) p / pieces;
+        double t1 = (double) (p + 1) / pieces;
+        double lat0 = route.lats[i] + (route.lats[i + 1] - route.lats[i]) * t0;
+        double lat1 = route.lats[i] + (route.lats[i + 1] - route.lats[i]) * t1;
+        double lng0 = route.lngs[i] + (route.lngs[i + 1] - route.lngs[i]) * t0;
+        double lng1 = route.lngs[i] + (route.lngs[i + 1] - route.lngs[i]) * t1;
+        double latPad = corridorMeters / metersPerDegree;
+        double maxLat = Math.max(Math.abs(lat0), Math.abs(lat1));
+        double lngPad = latPad / Math.max(0.01, Math.cos(Math.toRadians(maxLat)));
+        int x0 = tileX(Math.min(lng0, lng1) - lngPad, tileCount);
+        int x1 = tileX(Math.max(lng0, lng1) + lngPad, tileCount);
+        int y0 = tileY(Math.max(lat0, lat1) + latPad, tileCount);
+        int y1 = tileY(Math.min(lat0, lat1) - latPad, tileCount);
+        double pieceMeters = route.meters[i] + length * t1;
+        for (int x = x0; x <= x1; x++) {
+          for (int y = y0; y <= y1; y++) {
+            long key = ((long) x << 32) | (y & 0xffffffffL);
+            Integer pendingSegment = pendingTiles.get(key);
+            if (pendingSegment != null) {
+              pendingTiles.put(key, Math.max(pendingSegment, i));
+              continue;
+            }
+            LoadedTile loaded = loadedTiles.get(key);
+            if (loaded != null && i <= loaded.lastSegment) {
+              continue;
+            }
+            TileRequest tile = requests.get(key);
+            if (tile == null) {
+              List<JSONObject> cached = loaded != null ? loaded.features : null;
+              requests.put(key, new TileRequest(key, x, y, i, pieceMeters, cached));
+            } else {
+              tile.lastSegment = i;
+              tile.routeMeters = pieceMeters;
+            }
+          }
+        }
+      }
+    }
+    return new ArrayList<>(requests.values());
+  }
+
+  // Runs on a worker. Returns the well-formed features of a tile; a missing file holds none.
+  private static List<JSONObject> readFeatures(File file) {
+    JSONArray array;
+    try {
+      array = new JSONArray(readFile(file));
+    } catch (IOException | JSONException e) {
+      return Collections.emptyList();
+    }
+    List<JSONObject> features = new ArrayList<>(array.length());
+    for (int i = 0; i < array.length(); i++) {
+      JSONObject feature = array.optJSONObject(i);
+      if (feature != null
+          && feature.opt("id") instanceof String
+          && feature.opt("lat") instanceof Number
+          && feature.opt("lng") instanceof Number) {
+        features.add(feature);
+      }
+    }
+    return features;
+  }
+
+  // Runs on a worker.
+  private static void collectFeatures(
+      List<JSONObject> features,
+      TileRequest tile,
+      RouteGeometry route,
+      double corridorMeters,
+      List<FoundFeature> found) {
+    double[] t = new double[1];
+    for (JSONObject feature : features) {
+      double lat = feature.optDouble("lat");
+      double lng = feature.optDouble("lng");
+      // Only the segments that requested this tile can be within the corridor of its features.
+      double bestDistance = Double.POSITIVE_INFINITY;
+      double bestMeters = 0;
+      for (int s = tile.firstSegment; s <= tile.lastSegment; s++) {
+        double distance = distanceToSegment(lat, lng, route, s, t);
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestMeters = route.meters[s] + t[0] * (route.meters[s + 1] - route.meters[s]);
+        }
+      }
+      if (bestDistance <= corridorMeters) {
+        found.add(new FoundFeature(feature, feature.optString("id"), bestMeters, tile.key));
+      }
+    }
+  }
+
+  private void stageFeatures(
+      List<FoundFeature> found, List<TileRequest> requests, List<List<JSONObject>> tileFeatures) {
+    List<TileRequest> retests = new ArrayList<>();
+    for (int i = 0; i < requests.size(); i++) {
+      TileRequest tile = requests.get(i);
+      Integer pendingSegment = pendingTiles.remove(tile.key);
+      LoadedTile loaded = loadedTiles.get(tile.key);
+      if (loaded == null) {
+        loaded = new LoadedTile(tileFeatures.get(i));
+        loadedTiles.put(tile.key, loaded);
+      }
+      loaded.lastSegment = tile.lastSegment;
+      loaded.routeMeters = tile.routeMeters;
+      // Test the segments that reached the tile while it was loading.
+      if (pendingSegment != null && pendingSegment > tile.lastSegment && route != null) {
+        TileRequest retest =
+            new TileRequest(
+                tile.key,
+                tile.x,
+                tile.y,
+                tile.lastSegment + 1,
+                route.meters[pendingSegment + 1],
+                loaded.features);
+        retest.lastSegment = pendingSegment;
+        retests.add(retest);
+      }
+    }
+    loadTiles(retests);
+
+    // Features already staged, e.g. seen from a neighbouring tile or a previous route, only move.
+    List<FoundFeature> added = new ArrayList<>();
+    Set<String> addedIds = new HashSet<>();
+    for (FoundFeature feature : found) {
+      if (stagedMeters.containsKey(feature.id)) {
+        stagedMeters.put(feature.id, feature.routeMeters);
+      } else if (addedIds.add(feature.id)) {
+        added.add(feature);
+      }
+    }
+    Collections.sort(added, (a, b) -> Double.compare(a.routeMeters, b.routeMeters));
+
+    List<String> evicted = new ArrayList<>();
+    int needed = stagedMeters.size() + added.size();
+    if (needed > maxFeatures) {
+      // Evict the features passed longest ago, never the ones still ahead.
+      List<String> passed = new ArrayList<>();
+      for (Map.Entry<String, Double> entry : stagedMeters.entrySet()) {
+        if (entry.getValue() < progressMeters) {
+          passed.add(entry.getKey());
+        }
+      }
+      Collections.sort(passed, (a, b) -> Double.compare(stagedMeters.get(a), stagedMeters.get(b)));
+      for (String featureId : passed) {
+        if (needed <= maxFeatures) {
+          break;
+        }
+        stagedMeters.remove(featureId);
+        evicted.add(featureId);
+        needed--;
+      }
+    }
+
+    // Without enough room, stage the nearest features. The tiles of the others are loaded again
+    // when the corridor is next extended.
+    int room = Math.max(0, maxFeatures - stagedMeters.size());
+    if (added.size() > room) {
+      for (int i = room; i < added.size(); i++) {
+        loadedTiles.remove(added.get(i).tileKey);
+      }
+      added = added.subList(0, room);
+    }
+
+    List<JSONObject> staged = new ArrayList<>(added.size());
+    for (FoundFeature feature : added) {
+      stagedMeters.put(feature.id, feature.routeMeters);
+      staged.add(feature.feature);
+    }
+    if ((!staged.isEmpty() || !evicted.isEmpty()) && listener != null) {
+      listener.onFeaturesStaged(staged, evicted);
+    }
+  }
+
+  private static String readFile(File file) throws IOException {
+    try (InputStream input = new FileInputStream(file)) {
+      ByteArrayOutputStream output = new ByteArrayOutputStream();
+      byte[] buffer = new byte[8192];
+      int read;
+      while ((read = input.read(buffer)) != -1) {
+        output.write(buffer, 0, read);
+      }
+      return new String(output.toByteArray(), StandardCharsets.UTF_8);
+    }
+  }
+
+  private static double distance(double lat1, double lng1, double lat2, double lng2) {
+    double phi1 = Math.toRadians(lat1);
+    double phi2 = Math.toRadians(lat2);
+    double dPhi = phi2 - phi1;
+    double dLambda = Math.toRadians(lng2 - lng1);
+    double h =
+        Math.sin(dPhi / 2) * Math.sin(dPhi / 2)
+            + Math.cos(phi1) * Math.cos(phi2) * Math.sin(dLambda / 2) * Math.sin(dLambda / 2);
+    return 2 * EARTH_RADIUS_METERS * Math.asin(Math.min(1, Math.sqrt(h)));
+  }
+
+  // Projects the point on segment `i` of the route in a local equirectangular frame, which is
+  // accurate at corridor scale. Returns the distance and stores the position on the segment in t.
+  private static double distanceToSegment(
+      double lat, double lng, RouteGeometry route, int i, double[] t) {
+    double metersPerDegree = EARTH_RADIUS_METERS * Math.PI / 180;
+    double lngScale = metersPerDegree * Math.cos(Math.toRadians(lat));
+    double ax = (route.lngs[i] - lng) * lngScale;
+    double ay = (route.lats[i] - lat) * metersPerDegree;
+    double bx = (route.lngs[i + 1] - lng) * lngScale;
+    double by = (route.lats[i + 1] - lat) * metersPerDegree;
+    double dx = bx - ax;
+    double dy = by - ay;
+    double lengthSquared = dx * dx + dy * dy;
+    double position =
+        lengthSquared > 0 ? Math.max(0, Math.min(1, -(ax * dx + ay * dy) / lengthSquared)) : 0;
+    t[0] = position;
+    double x = ax + position * dx;
+    double y = ay + position * dy;
+    return Math.sqrt(x * x + y * y);
+  }
+
+  private static int tileX(double lng, int tileCount) {
+    int x = (int) Math.floor((lng + 180) / 360 * tileCount);
+    return Math.max(0, Math.min(tileCount - 1, x));
+  }
+
+  private static int tileY(double lat, int tileCount) {
+    double clamped = Math.toRadians(Math.max(-85.05112878, Math.min(85.05112878, lat)));
+    double y = (1 - Math.log(Math.tan(clamped) + 1 / Math.cos(clamped)) / Math.PI) / 2;
+    return Math.max(0, Math.min(tileCount - 1, (int) Math.floor(y * tileCount)));
+  }
+}
@@ -0,0 +1,328 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.content.Context;
+import android.graphics.Bitmap;
+import android.graphics.Canvas;
+import android.graphics.Paint;
+import android.graphics.Path;
+import android.net.Uri;
+import androidx.annotation.Nullable;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * Renders route previews without a map: the path and stops are drawn with anti-aliasing on a
+ * software bitmap on the shared worker pool and written as PNGs to the cache directory.
+ * Thumbnails are keyed by a hash of their inputs, so a row that scrolls back into view gets the
+ * file of its first render, and concurrent requests for the same thumbnail share one render.
+ */
+public class RouteThumbnailRenderer {
+  private static final String DIRECTORY_NAME = "route_thumbnails";
+
+  // Latitude at which Web Mercator is square.
+  private static final double MAX_MERCATOR_LATITUDE = 85.05112878;
+
+  // Largest side of a thumbnail in pixels.
+  private static final int MAX_PIXEL_SIZE = 2048;
+
+  private static RouteThumbnailRenderer instance;
+
+  /** Called with a file URI of the thumbnail PNG, or null and an error message. */
+  public interface Callback {
+    void onRendered(@Nullable String uri, @Nullable String error);
+  }
+
+  /** Sizes in pixels and colors as ARGB integers. */
+  public static class Style {
+    public int width;
+    public int height;
+    public float padding;
+    public float strokeWidth;
+    public int strokeColor = 0xFF1A73E8;
+    public float stopRadius;
+    public float stopOutlineWidth;
+    public int stopColor = 0xFFEA4335;
+    public int stopOutlineColor = 0xFFFFFFFF;
+    public int backgroundColor;
+  }
+
+  private final File directory;
+  // Callbacks of the renders in flight by file name. Guarded by `this`.
+  private final Map<String, List<Callback>> pending = new HashMap<>();
+
+  private RouteThumbnailRenderer(Context context) {
+    directory = new File(context.getCacheDir(), DIRECTORY_NAME);
+  }
+
+  public static synchronized RouteThumbnailRenderer getInstance(Context context) {
+    if (instance == null) {
+      instance = new RouteThumbnailRenderer(context.getApplicationContext());
+    }
+    return instance;
+  }
+
+  /**
+   * Renders a thumbnail of {@code path}, or of {@code encodedPath} when it is not empty, with
+   * {@code stops}; paths and stops are packed as [lat, lng, ...]. The callback is called on a
+   * worker thread, or on the calling thread when the thumbnail is already cached.
+   */
+  public void render(
+      double[] path, @Nullable String encodedPath, double[] stops, Style style, Callback callback) {
+    final String encoded = encodedPath != null ? encodedPath : "";
+    style.width = Math.max(1, Math.min(MAX_PIXEL_SIZE, style.width));
+    style.height = Math.max(1, Math.min(MAX_PIXEL_SIZE, style.height));
+
+    long hash = 0xcbf29ce484222325L;
+    hash = hash(hash, style.width);
+    hash = hash(hash, style.height);
+    hash = hash(hash, Float.floatToIntBits(style.padding));
+    hash = hash(hash, Float.floatToIntBits(style.strokeWidth));
+    hash = hash(hash, Float.floatToIntBits(style.stopRadius));
+    hash = hash(hash, Float.floatToIntBits(style.stopOutlineWidth));
+    hash = hash(hash, style.strokeColor);
+    hash = hash(hash, style.stopColor);
+    hash = hash(hash, style.stopOutlineColor);
+    hash = hash(hash, style.backgroundColor);
+    hash = hash(hash, encoded.length());
+    for (int i = 0; i < encoded.length(); i++) {
+      hash = hash(hash, encoded.charAt(i));
+    }
+    double[] pathPoints = encoded.isEmpty() ? path : new double[0];
+    for (double[] points : new double[][] {pathPoints, stops}) {
+      hash = hash(hash, points.length);
+      for (double value : points) {
+        hash = hash(hash, Double.doubleToLongBits(value));
+      }
+    }
+
+    final String fileName = String.format(Locale.US, "%016x.png", hash);
+    final File file = new File(directory, fileName);
+    if (file.exists()) {
+      callback.onRendered(Uri.fromFile(file).toString(), null);
+      return;
+    }
+
+    synchronized (this) {
+      List<Callback> callbacks = pending.get(fileName);
+      if (callbacks != null) {
+        callbacks.add(callback);
+        return;
+      }
+      callbacks = new ArrayList<>();
+      callbacks.add(callback);
+      pending.put(fileName, callbacks);
+    }
+
+    NavWorkerPool.getInstance()
+        .submit(
+            NavWorkerPool.PRIORITY_INTERACTIVE,
+            null,
+            () -> {
+              String error = null;
+              try {
+                double[] points = encoded.isEmpty() ? pathPoints : decodePolyline(encoded);
+                write(draw(points, stops, style), file);
+              } catch (IOException | RuntimeException e) {
+                error = e.getMessage() != null ? e.getMessage() : "Failed to render thumbnail";
+              }
+
+              List<Callback> callbacks;
+              synchronized (this) {
+                callbacks = pending.remove(fileName);
+              }
+              String uri = error == null ? Uri.fromFile(file).toString() : null;
+              for (Callback pendingCallback : callbacks) {
+                pendingCallback.onRendered(uri, error);
+              }
+            });
+  }
+
+  /**
+   * Decodes a path in the Encoded Polyline Algorithm Format into packed [lat, lng, ...]. Decoding
+   * stops at the first malformed value, keeping the points before it.
+   */
+  public static double[] decodePolyline(String encoded) {
+    double[] points = new double[encoded.length() * 2];
+    int count = 0;
+    int index = 0;
+    long lat = 0;
+    long lng = 0;
+    decode:
+    while (index < encoded.length()) {
+      long[] deltas = new long[2];
+      for (int d = 0; d < 2; d++) {
+        long result = 0;
+        int shift = 0;
+        int chunk;
+        do {
+          if (index >= encoded.length() || shift > 60) {
+            break decode;
+          }
+          chunk = encoded.charAt(index++) - 63;
+          if (chunk < 0) {
+            break decode;
+          }
+          result |= (long) (chunk & 0x1f) << shift;
+          shift += 5;
+        } while (chunk >= 0x20);
+        deltas[d] = (result & 1) != 0 ? ~(result >>> 1) : result >>> 1;
+      }
+      lat += deltas[0];
+      lng += deltas[1];
+      points[count++] = lat * 1e-5;
+      points[count++] = lng * 1e-5;
+    }
+    double[] trimmed = new double[count];
+    System.arraycopy(points, 0, trimmed, 0, count);
+    return trimmed;
+  }
+
+  private static Bitmap draw(double[] path, double[] stops, Style style) {
+    // Projects to radians of Web Mercator, y up, keeping each longitude within 180 degrees of the
+    // previous point so that paths crossing the antimeridian stay continuous.
+    double[] projectedPath = new double[path.length - path.length % 2];
+    double[] projectedStops = new double[stops.length - stops.length % 2];
+    double previousLng = Double.NaN;
+    for (double[][] pair : new double[][][] {{path, projectedPath}, {stops, projectedStops}}) {
+      double[] points = pair[0];
+      double[] projected = pair[1];
+      for (int i = 0; i + 1 < points.length; i += 2) {
+        double lng = points[i + 1];
+        if (!Double.isNaN(previousLng)) {
+          lng -= 360 * Math.rint((lng - previousLng) / 360);
+        }
+        previousLng = lng;
+        double lat = Math.max(-MAX_MERCATOR_LATITUDE, Math.min(MAX_MERCATOR_LATITUDE, points[i]));
+        projected[i] = Math.toRadians(lng);
+        projected[i + 1] = Math.log(Math.tan(Math.PI / 4 + Math.toRadians(lat) / 2));
+      }
+    }
+
+    // Fits the bounds of everything drawn into the padded image, centered and without distortion.
+    double minX = Double.POSITIVE_INFINITY;
+    double minY = Double.POSITIVE_INFINITY;
+    double maxX = Double.NEGATIVE_INFINITY;
+    double maxY = Double.NEGATIVE_INFINITY;
+    for (double[] projected : new double[][] {projectedPath, projectedStops}) {
+      for (int i = 0; i + 1 < projected.length; i += 2) {
+        minX = Math.min(minX, projected[i]);
+        maxX = Math.max(maxX, projected[i]);
+        minY = Math.min(minY, projected[i + 1]);
+        maxY = Math.max(maxY, projected[i + 1]);
+      }
+    }
+    double availableWidth = Math.max(1, style.width - 2 * style.padding);
+    double availableHeight = Math.max(1, style.height - 2 * style.padding);
+    double spanX = maxX - minX;
+    double spanY = maxY - minY;
+    double scale = 0;
+    if (spanX > 0 || spanY > 0) {
+      scale =
+          Math.min(
+              spanX > 0 ? availableWidth / spanX : Double.POSITIVE_INFINITY,
+              spanY > 0 ? availableHeight / spanY : Double.POSITIVE_INFINITY);
+    }
+    double centerX = (minX + maxX) / 2;
+    double centerY = (minY + maxY) / 2;
+
+    Bitmap bitmap = Bitmap.createBitmap(style.width, style.height, Bitmap.Config.ARGB_8888);
+    Canvas canvas = new Canvas(bitmap);
+    if ((style.backgroundColor >>> 24) != 0) {
+      canvas.drawColor(style.backgroundColor);
+    }
+
+    if (projectedPath.length > 0 && style.strokeWidth > 0) {
+      Path line = new Path();
+      for (int i = 0; i + 1 < projectedPath.length; i += 2) {
+        float x = (float) (style.width / 2.0 + (projectedPath[i] - centerX) * scale);
+        float y = (float) (style.height / 2.0 - (projectedPath[i + 1] - centerY) * scale);
+        if (i == 0) {
+          line.moveTo(x, y);
+        } else {
+          line.lineTo(x, y);
+        }
+      }
+      if (projectedPath.length == 2) {
+        // A single point is drawn as a dot by its round cap.
+        line.rLineTo(0, 0);
+      }
+      Paint paint = new Paint(Paint.ANTI_ALIAS_FLAG);
+      paint.setStyle(Paint.Style.STROKE);
+      paint.setStrokeWidth(style.strokeWidth);
+      paint.setStrokeCap(Paint.Cap.ROUND);
+      paint.setStrokeJoin(Paint.Join.ROUND);
+      paint.setColor(style.strokeColor);
+      canvas.drawPath(line, paint);
+    }
+
+    if (projectedStops.length > 0 && style.stopRadius > 0) {
+      Paint outlinePaint = new Paint(Paint.ANTI_ALIAS_FLAG);
+      outlinePaint.setColor(style.stopOutlineColor);
+      Paint stopPaint = new Paint(Paint.ANTI_ALIAS_FLAG);
+      stopPaint.setColor(style.stopColor);
+      // All outlines first, so that overlapping stops keep their dots visible.
+      for (Paint paint : new Paint[] {outlinePaint, stopPaint}) {
+        if (paint == outlinePaint && style.stopOutlineWidth <= 0) {
+          continue;
+        }
+        float radius = style.stopRadius + (paint == outlinePaint ? style.stopOutlineWidth : 0);
+        for (int i = 0; i + 1 < projectedStops.length; i += 2) {
+          float x = (float) (style.width / 2.0 + (projectedStops[i] - centerX) * scale);
+          float y = (float) (style.height / 2.0 - (projectedStops[i + 1] - centerY) * scale);
+          canvas.drawCircle(x, y, radius, paint);
+        }
+      }
+    }
+    return bitmap;
+  }
+
+  private void write(Bitmap bitmap, File file) throws IOException {
+    if (!directory.isDirectory() && !directory.mkdirs()) {
+      throw new IOException("Failed to create " + directory);
+    }
+    // Written next to the target and renamed, so that readers never see a partial file.
+    File temporary = new File(directory, file.getName() + ".tmp");
+    try (OutputStream output = new FileOutputStream(temporary)) {
+      if (!bitmap.compress(Bitmap.CompressFormat.PNG, 100, output)) {
+        throw new IOException("Failed to encode thumbnail");
+      }
+    } finally {
+      bitmap.recycle();
+    }
+    if (!temporary.renameTo(file)) {
+      temporary.delete();
+      throw new IOException("Failed to write " + file);
+    }
+  }
+
+  // FNV-1a over the bytes of `value`.
+  private static long hash(long hash, long value) {
+    for (int i = 0; i < 8; i++) {
+      hash = (hash ^ ((value >>> (i * 8)) & 0xff)) * 0x100000001b3L;
+    }
+    return hash;
+  }
+}
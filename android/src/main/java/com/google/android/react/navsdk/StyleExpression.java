@@ -0,0 +1,527 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.google.android.react.navsdk;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import org.json.JSONArray;
+import org.json.JSONObject;
+
+/**
+ * A compiled style expression, evaluated against the attribute record of an overlay and the
+ * current zoom. Expressions use a JSON array syntax:
+ *
+ * <pre>
+ *   ["get", key], ["has", key], ["zoom"]
+ *   ["==" | "!=" | "<" | "<=" | ">" | ">=", a, b], ["!", a], ["all", ...], ["any", ...]
+ *   ["+" | "-" | "*" | "/", a, b]
+ *   ["case", condition, output, ..., fallback]
+ *   ["match", input, label | [labels], output, ..., fallback]
+ *   ["interpolate", ["linear"] | ["exponential", base], input, stop, output, ...]
+ *   ["step", input, output, stop, output, ...]
+ * </pre>
+ *
+ * Numbers, strings, booleans and null are literals. Match tables and stops are built once at
+ * compile time, so evaluation is a single walk of the compiled tree.
+ */
+public final class StyleExpression {
+  /** Thrown when an expression cannot be compiled. */
+  public static class InvalidExpressionException extends Exception {
+    public InvalidExpressionException(String message) {
+      super(message);
+    }
+  }
+
+  private enum Op {
+    LITERAL,
+    GET,
+    HAS,
+    ZOOM,
+    EQUAL,
+    NOT_EQUAL,
+    LESS,
+    LESS_OR_EQUAL,
+    GREATER,
+    GREATER_OR_EQUAL,
+    NOT,
+    ALL,
+    ANY,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    CASE,
+    MATCH,
+    INTERPOLATE,
+    STEP,
+  }
+
+  private static final Map<String, Op> OPERATORS = new HashMap<>();
+
+  static {
+    OPERATORS.put("get", Op.GET);
+    OPERATORS.put("has", Op.HAS);
+    OPERATORS.put("zoom", Op.ZOOM);
+    OPERATORS.put("==", Op.EQUAL);
+    OPERATORS.put("!=", Op.NOT_EQUAL);
+    OPERATORS.put("<", Op.LESS);
+    OPERATORS.put("<=", Op.LESS_OR_EQUAL);
+    OPERATORS.put(">", Op.GREATER);
+    OPERATORS.put(">=", Op.GREATER_OR_EQUAL);
+    OPERATORS.put("!", Op.NOT);
+    OPERATORS.put("all", Op.ALL);
+    OPERATORS.put("any", Op.ANY);
+    OPERATORS.put("+", Op.ADD);
+    OPERATORS.put("-", Op.SUBTRACT);
+    OPERATORS.put("*", Op.MULTIPLY);
+    OPERATORS.put("/", Op.DIVIDE);
+    OPERATORS.put("case", Op.CASE);
+    OPERATORS.put("match", Op.MATCH);
+    OPERATORS.put("interpolate", Op.INTERPOLATE);
+    OPERATORS.put("step", Op.STEP);
+  }
+
+  private Op op = Op.LITERAL;
+  @Nullable private Object source;
+  @Nullable private Object value;
+  @Nullable private String key;
+  private StyleExpression[] args = new StyleExpression[0];
+  // Match: label -> index of the output in args.
+  @Nullable private Map<Object, Integer> matchTable;
+  // Interpolate and step: ascending input stops, aligned with the outputs in args.
+  private double[] stops = new double[0];
+  private double base = 1;
+
+  private boolean usesZoom;
+  private Set<String> attributeKeys = Collections.emptySet();
+
+  private StyleExpression() {}
+
+  /** Compiles a parsed JSON value (from {@code org.json}) into an expression. */
+  @NonNull
+  public static StyleExpression compile(@Nullable Object json) throws InvalidExpressionException {
+    StyleExpression expression = new StyleExpression();
+    expression.compileNode(json);
+    return expression;
+  }
+
+  /** The parsed JSON this expression was compiled from. */
+  @Nullable
+  public Object getSource() {
+    return source;
+  }
+
+  /** Whether the result depends on the camera zoom. */
+  public boolean usesZoom() {
+    return usesZoom;
+  }
+
+  /** Attribute keys read by this expression. */
+  @NonNull
+  public Set<String> getAttributeKeys() {
+    return attributeKeys;
+  }
+
+  /**
+   * Converts a parsed JSON scalar to the value model used by expressions: numbers become {@link
+   * Double}, JSON null becomes {@code null}.
+   */
+  @Nullable
+  public static Object normalize(@Nullable Object value) {
+    if (value == null || value == JSONObject.NULL) {
+      return null;
+    }
+    if (value instanceof Number) {
+      return ((Number) value).doubleValue();
+    }
+    return value;
+  }
+
+  private void compileNode(@Nullable Object json) throws InvalidExpressionException {
+    source = json;
+    if (!(json instanceof JSONArray)) {
+      Object literal = normalize(json);
+      if (literal != null
+          && !(literal instanceof Double)
+          && !(literal instanceof String)
+          && !(literal instanceof Boolean)) {
+        throw new InvalidExpressionException("Literals must be numbers, strings, booleans or null");
+      }
+      value = literal;
+      return;
+    }
+
+    JSONArray array = (JSONArray) json;
+    Object name = array.opt(0);
+    Op compiledOp = name instanceof String ? OPERATORS.get(name) : null;
+    if (compiledOp == null) {
+      throw new InvalidExpressionException("Unknown expression operator '" + name + "'");
+    }
+    op = compiledOp;
+    List<Object> operands = new ArrayList<>();
+    for (int i = 1; i < array.length(); i++) {
+      operands.add(array.opt(i));
+    }
+    compileOperands(operands, (String) name);
+
+    Set<String> keys = new HashSet<>();
+    if (key != null) {
+      keys.add(key);
+    }
+    boolean zoom = op == Op.ZOOM;
+    for (StyleExpression arg : args) {
+      keys.addAll(arg.attributeKeys);
+      zoom = zoom || arg.usesZoom;
+    }
+    attributeKeys = keys;
+    usesZoom = zoom;
+  }
+
+  private void compileOperands(List<Object> operands, String name)
+      throws InvalidExpressionException {
+    int count = operands.size();
+    switch (op) {
+      case GET:
+      case HAS:
+        if (count != 1 || !(operands.get(0) instanceof String)) {
+          throw new InvalidExpressionException("'" + name + "' expects a single attribute name");
+        }
+        key = (String) operands.get(0);
+        return;
+      case ZOOM:
+        if (count != 0) {
+          throw new InvalidExpressionException("'zoom' takes no arguments");
+        }
+        return;
+      case NOT:
+        if (count != 1) {
+          throw new InvalidExpressionException("'!' expects one argument");
+        }
+        compileArgs(operands);
+        return;
+      case ALL:
+      case ANY:
+        compileArgs(operands);
+        return;
+      case CASE:
+        if (count < 3 || count % 2 == 0) {
+          throw new InvalidExpressionException(
+              "'case' expects condition/output pairs and a fallback");
+        }
+        compileArgs(operands);
+        return;
+      case MATCH:
+        compileMatch(operands);
+        return;
+      case INTERPOLATE:
+        compileInterpolate(operands);
+        return;
+      case STEP:
+        compileStep(operands);
+        return;
+      default:
+        // Comparisons and arithmetic.
+        if (count != 2) {
+          throw new InvalidExpressionException("'" + name + "' expects two arguments");
+        }
+        compileArgs(operands);
+    }
+  }
+
+  private void compileArgs(List<Object> operands) throws InvalidExpressionException {
+    args = new StyleExpression[operands.size()];
+    for (int i = 0; i < args.length; i++) {
+      args[i] = compile(operands.get(i));
+    }
+  }
+
+  private void compileMatch(List<Object> operands) throws InvalidExpressionException {
+    int count = operands.size();
+    if (count < 4 || count % 2 != 0) {
+      throw new InvalidExpressionException(
+          "'match' expects an input, label/output pairs and a fallback");
+    }
+    List<Object> rest = new ArrayList<>();
+    rest.add(operands.get(0));
+    Map<Object, Integer> table = new HashMap<>();
+    for (int i = 1; i + 1 < count; i += 2) {
+      Object labels = operands.get(i);
+      List<Object> labelList = new ArrayList<>();
+      if (labels instanceof JSONArray) {
+        for (int j = 0; j < ((JSONArray) labels).length(); j++) {
+          labelList.add(((JSONArray) labels).opt(j));
+        }
+      } else {
+        labelList.add(labels);
+      }
+      for (Object rawLabel : labelList) {
+        Object label = normalize(rawLabel);
+        if (!(label instanceof Double) && !(label instanceof String)) {
+          throw new InvalidExpressionException("'match' labels must be numbers or strings");
+        }
+        // The first label wins, as in a chain of comparisons.
+        if (!table.containsKey(label)) {
+          table.put(label, rest.size());
+        }
+      }
+      rest.add(operands.get(i + 1));
+    }
+    rest.add(operands.get(count - 1));
+    matchTable = table;
+    compileArgs(rest);
+  }
+
+  private void compileInterpolate(List<Object> operands) throws InvalidExpressionException {
+    int count = operands.size();
+    Object type = count > 0 ? operands.get(0) : null;
+    if (count < 4 || count % 2 != 0 || !(type instanceof JSONArray)) {
+      throw new InvalidExpressionException(
+          "'interpolate' expects a type, an input and stop/output pairs");
+    }
+    JSONArray typeArray = (JSONArray) type;
+    if ("linear".equals(typeArray.opt(0)) && typeArray.length() == 1) {
+      base = 1;
+    } else if ("exponential".equals(typeArray.opt(0))
+        && typeArray.length() == 2
+        && typeArray.opt(1) instanceof Number) {
+      base = ((Number) typeArray.opt(1)).doubleValue();
+    } else {
+      throw new InvalidExpressionException(
+          "'interpolate' type must be [\"linear\"] or [\"exponential\", base]");
+    }
+    List<Object> rest = new ArrayList<>();
+    rest.add(operands.get(1));
+    collectStops(operands, 2, rest, "interpolate");
+    compileArgs(rest);
+  }
+
+  private void compileStep(List<Object> operands) throws InvalidExpressionException {
+    int count = operands.size();
+    if (count < 2 || count % 2 != 0) {
+      throw new InvalidExpressionException(
+          "'step' expects an input, a base output and stop/output pairs");
+    }
+    List<Object> rest = new ArrayList<>(Arrays.asList(operands.get(0), operands.get(1)));
+    collectStops(operands, 2, rest, "step");
+    compileArgs(rest);
+  }
+
+  private void collectStops(List<Object> operands, int start, List<Object> outputs, String name)
+      throws InvalidExpressionException {
+    stops = new double[(operands.size() - start) / 2];
+    for (int i = start, s = 0; i + 1 < operands.size(); i += 2, s++) {
+      Object stop = operands.get(i);
+      if (!(stop instanceof Number)
+          || (s > 0 && ((Number) stop).doubleValue() <= stops[s - 1])) {
+        throw new InvalidExpressionException(
+            "'" + name + "' stops must be numbers in ascending order");
+      }
+      stops[s] = ((Number) stop).doubleValue();
+      outputs.add(operands.get(i + 1));
+    }
+  }
+
+  /** Evaluates the expression as a boolean; null is false. */
+  public boolean evaluateBoolean(@Nullable Map<String, Object> attributes, double zoom) {
+    return isTruthy(evaluate(attributes, zoom));
+  }
+
+  /** Evaluates the expression. Returns a Double, a String, a Boolean or null. */
+  @Nullable
+  public Object evaluate(@Nullable Map<String, Object> attributes, double zoom) {
+    switch (op) {
+      case LITERAL:
+        return value;
+      case GET:
+        return attributes != null ? attributes.get(key) : null;
+      case HAS:
+        return attributes != null && attributes.get(key) != null;
+      case ZOOM:
+        return zoom;
+      case EQUAL:
+      case NOT_EQUAL:
+        {
+          Object a = args[0].evaluate(attributes, zoom);
+          Object b = args[1].evaluate(attributes, zoom);
+          boolean equal = a == null ? b == null : a.equals(b);
+          return op == Op.EQUAL ? equal : !equal;
+        }
+      case LESS:
+      case LESS_OR_EQUAL:
+      case GREATER:
+      case GREATER_OR_EQUAL:
+        {
+          Integer order =
+              compare(args[0].evaluate(attributes, zoom), args[1].evaluate(attributes, zoom));
+          if (order == null) {
+            return false;
+          }
+          switch (op) {
+            case LESS:
+              return order < 0;
+            case LESS_OR_EQUAL:
+              return order <= 0;
+            case GREATER:
+              return order > 0;
+            default:
+              return order >= 0;
+          }
+        }
+      case NOT:
+        return !args[0].evaluateBoolean(attributes, zoom);
+      case ALL:
+        for (StyleExpression arg : args) {
+          if (!arg.evaluateBoolean(attributes, zoom)) {
+            return false;
+          }
+        }
+        return true;
+      case ANY:
+        for (StyleExpression arg : args) {
+          if (arg.evaluateBoolean(attributes, zoom)) {
+            return true;
+          }
+        }
+        return false;
+      case ADD:
+      case SUBTRACT:
+      case MULTIPLY:
+      case DIVIDE:
+        {
+          Object a = args[0].evaluate(attributes, zoom);
+          Object b = args[1].evaluate(attributes, zoom);
+          if (!(a instanceof Double) || !(b instanceof Double)) {
+            return null;
+          }
+          double x = (Double) a;
+          double y = (Double) b;
+          switch (op) {
+            case ADD:
+              return x + y;
+            case SUBTRACT:
+              return x - y;
+            case MULTIPLY:
+              return x * y;
+            default:
+              return y == 0 ? null : x / y;
+          }
+        }
+      case CASE:
+        for (int i = 0; i + 1 < args.length; i += 2) {
+          if (args[i].evaluateBoolean(attributes, zoom)) {
+            return args[i + 1].evaluate(attributes, zoom);
+          }
+        }
+        return args[args.length - 1].evaluate(attributes, zoom);
+      case MATCH:
+        {
+          Object input = args[0].evaluate(attributes, zoom);
+          Integer index = input != null && matchTable != null ? matchTable.get(input) : null;
+          return args[index != null ? index : args.length - 1].evaluate(attributes, zoom);
+        }
+      case INTERPOLATE:
+        return interpolate(attributes, zoom);
+      case STEP:
+        {
+          Object input = args[0].evaluate(attributes, zoom);
+          if (!(input instanceof Double)) {
+            return args[1].evaluate(attributes, zoom);
+          }
+          // Outputs follow the base output, so stop i selects args[i + 2].
+          return args[upperBound((Double) input) + 1].evaluate(attributes, zoom);
+        }
+    }
+    return null;
+  }
+
+  @Nullable
+  private Object interpolate(@Nullable Map<String, Object> attributes, double zoom) {
+    Object input = args[0].evaluate(attributes, zoom);
+    if (!(input instanceof Double)) {
+      return null;
+    }
+    double x = (Double) input;
+    // Outputs follow the input, so stop i selects args[i + 1].
+    int upper = upperBound(x);
+    if (upper == 0) {
+      return args[1].evaluate(attributes, zoom);
+    }
+    if (upper == stops.length) {
+      return args[args.length - 1].evaluate(attributes, zoom);
+    }
+    Object lower = args[upper].evaluate(attributes, zoom);
+    Object higher = args[upper + 1].evaluate(attributes, zoom);
+    if (!(lower instanceof Double) || !(higher instanceof Double)) {
+      return lower;
+    }
+
+    double range = stops[upper] - stops[upper - 1];
+    double progress = x - stops[upper - 1];
+    double t =
+        base == 1
+            ? progress / range
+            : (Math.pow(base, progress) - 1) / (Math.pow(base, range) - 1);
+    return (Double) lower + t * ((Double) higher - (Double) lower);
+  }
+
+  // Number of stops less than or equal to x.
+  private int upperBound(double x) {
+    int low = 0;
+    int high = stops.length;
+    while (low < high) {
+      int mid = (low + high) >>> 1;
+      if (stops[mid] <= x) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+
+  private static boolean isTruthy(@Nullable Object value) {
+    if (value instanceof Boolean) {
+      return (Boolean) value;
+    }
+    if (value instanceof Double) {
+      return (Double) value != 0;
+    }
+    if (value instanceof String) {
+      return !((String) value).isEmpty();
+    }
+    return false;
+  }
+
+  // Orders two values of the same kind. Returns null when they cannot be ordered.
+  @Nullable
+  private static Integer compare(@Nullable Object a, @Nullable Object b) {
+    if (a instanceof Double && b instanceof Double) {
+      return Double.compare((Double) a, (Double) b);
+    }
+    if (a instanceof String && b instanceof String) {
+      return ((String) a).compareTo((String) b);
+    }
+    return null;
+  }
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Schedules an ordered list of stops with time windows and service times, the Java counterpart of
+ * NavTimeWindowEvaluator.cpp on iOS. A leg between two consecutive stops uses the travel time of
+ * the current route when the route has the same leg, and an estimate otherwise.
+ *
+ * <p>Changes only invalidate the schedule from the first stop they affect, and {@link #evaluate()}
+ * recomputes that suffix, so a single-stop edit costs time proportional to the stops after it.
+ */
+public final class TimeWindowEvaluator {
+  private static final double EARTH_RADIUS_METERS = 6371009.0;
+
+  public static final class Stop {
+    final double lat;
+    final double lng;
+    // Seconds since the epoch. Open ends are infinite.
+    final double windowStart;
+    final double windowEnd;
+    final double serviceSeconds;
+
+    public Stop(
+        double lat, double lng, double windowStart, double windowEnd, double serviceSeconds) {
+      this.lat = lat;
+      this.lng = lng;
+      this.windowStart = windowStart;
+      this.windowEnd = windowEnd;
+      this.serviceSeconds = serviceSeconds;
+    }
+  }
+
+  /**
+   * A leg of the current route, with its travel time from the destination of the previous leg, or
+   * from the current location for the first leg. The time is NaN when unknown.
+   */
+  public static final class RouteLeg {
+    final double lat;
+    final double lng;
+    final double seconds;
+
+    public RouteLeg(double lat, double lng, double seconds) {
+      this.lat = lat;
+      this.lng = lng;
+      this.seconds = seconds;
+    }
+  }
+
+  public static final class Schedule {
+    // Seconds since the epoch.
+    public double arrival;
+    // Seconds waiting for the window to open.
+    public double waitSeconds;
+    // Seconds between the start of service and the end of the window, negative when late and
+    // infinite for open windows.
+    public double slackSeconds;
+    // Whether the travel time to the stop came from the current route rather than an estimate.
+    public boolean routed;
+  }
+
+  // Travel times of legs not on the current route are estimated from the great-circle distance,
+  // scaled by the detour factor, at this speed.
+  private final double speedMetersPerSecond;
+  private final double detourFactor;
+  // Stops within this distance of the destination of a route leg are on that leg.
+  private final double matchRadiusMeters;
+
+  private double originLat;
+  private double originLng;
+  private double departureTime;
+  private List<RouteLeg> legs = new ArrayList<>();
+  private final ArrayList<Stop> stops = new ArrayList<>();
+  // Index of the route leg ending at each stop, or -1.
+  private final ArrayList<Integer> stopLegs = new ArrayList<>();
+  private final ArrayList<Schedule> schedules = new ArrayList<>();
+  private int firstStale = 0;
+
+  public TimeWindowEvaluator(
+      double speedMetersPerSecond, double detourFactor, double matchRadiusMeters) {
+    this.speedMetersPerSecond = speedMetersPerSecond;
+    this.detourFactor = detourFactor;
+    this.matchRadiusMeters = matchRadiusMeters;
+  }
+
+  /** Where and when the sequence starts, usually the current location and time. */
+  public void setOrigin(double lat, double lng, double departureTime) {
+    originLat = lat;
+    originLng = lng;
+    this.departureTime = departureTime;
+    invalidate(0);
+  }
+
+  public void setRouteLegs(List<RouteLeg> legs) {
+    this.legs = legs;
+    for (int i = 0; i < stops.size(); i++) {
+      stopLegs.set(i, matchLeg(stops.get(i)));
+    }
+    invalidate(0);
+  }
+
+  public void setStops(List<Stop> newStops) {
+    stops.clear();
+    stopLegs.clear();
+    schedules.clear();
+    for (Stop stop : newStops) {
+      stops.add(stop);
+      stopLegs.add(matchLeg(stop));
+      schedules.add(new Schedule());
+    }
+    invalidate(0);
+  }
+
+  // Edits of single stops. Indices must be valid; an insert index may equal the stop count.
+
+  public void replaceStop(int index, Stop stop) {
+    stops.set(index, stop);
+    stopLegs.set(index, matchLeg(stop));
+    invalidate(index);
+  }
+
+  public void insertStop(int index, Stop stop) {
+    stops.add(index, stop);
+    stopLegs.add(index, matchLeg(stop));
+    schedules.add(index, new Schedule());
+    invalidate(index);
+  }
+
+  public void removeStop(int index) {
+    stops.remove(index);
+    stopLegs.remove(index);
+    schedules.remove(index);
+    invalidate(index);
+  }
+
+  public void moveStop(int from, int to) {
+    if (from == to) {
+      return;
+    }
+    // Rotating the range between the two indices moves the stop and keeps the others in order.
+    if (from < to) {
+      Collections.rotate(stops.subList(from, to + 1), -1);
+      Collections.rotate(stopLegs.subList(from, to + 1), -1);
+    } else {
+      Collections.rotate(stops.subList(to, from + 1), 1);
+      Collections.rotate(stopLegs.subList(to, from + 1), 1);
+    }
+    invalidate(Math.min(from, to));
+  }
+
+  /**
+   * Recomputes the schedules from the first stop changed since the last evaluation and returns its
+   * index, which equals the stop count if nothing changed.
+   */
+  public int evaluate() {
+    int first = Math.min(firstStale, stops.size());
+    double departure = departureTime;
+    if (first > 0) {
+      Schedule previous = schedules.get(first - 1);
+      departure = previous.arrival + previous.waitSeconds + stops.get(first - 1).serviceSeconds;
+    }
+    for (int i = first; i < stops.size(); i++) {
+      Stop stop = stops.get(i);
+      Schedule schedule = schedules.get(i);
+      schedule.arrival = departure + travelSeconds(i, schedule);
+      schedule.waitSeconds = Math.max(0, stop.windowStart - schedule.arrival);
+      double start = schedule.arrival + schedule.waitSeconds;
+      schedule.slackSeconds = stop.windowEnd - start;
+      departure = start + stop.serviceSeconds;
+    }
+    firstStale = stops.size();
+    return first;
+  }
+
+  public double getOriginLat() {
+    return originLat;
+  }
+
+  public double getOriginLng() {
+    return originLng;
+  }
+
+  public int getStopCount() {
+    return stops.size();
+  }
+
+  public Schedule getSchedule(int index) {
+    return schedules.get(index);
+  }
+
+  private int matchLeg(Stop stop) {
+    int match = -1;
+    double best = matchRadiusMeters;
+    for (int i = 0; i < legs.size(); i++) {
+      RouteLeg leg = legs.get(i);
+      double distance = distanceMeters(stop.lat, stop.lng, leg.lat, leg.lng);
+      if (distance <= best) {
+        best = distance;
+        match = i;
+      }
+    }
+    return match;
+  }
+
+  // Sets whether the leg to the stop is on the route and returns its travel time.
+  private double travelSeconds(int index, Schedule schedule) {
+    // The route has this leg if it continues from the leg ending at the previous stop, or, for the
+    // first stop, if it is the first leg of the route.
+    int leg = stopLegs.get(index);
+    int previousLeg = index == 0 ? -1 : stopLegs.get(index - 1);
+    boolean onRoute =
+        leg >= 0 && (index == 0 ? leg == 0 : previousLeg >= 0 && leg == previousLeg + 1);
+    if (onRoute && !Double.isNaN(legs.get(leg).seconds)) {
+      schedule.routed = true;
+      return legs.get(leg).seconds;
+    }
+    schedule.routed = false;
+    Stop stop = stops.get(index);
+    double fromLat = index == 0 ? originLat : stops.get(index - 1).lat;
+    double fromLng = index == 0 ? originLng : stops.get(index - 1).lng;
+    return distanceMeters(fromLat, fromLng, stop.lat, stop.lng)
+        * detourFactor
+        / speedMetersPerSecond;
+  }
+
+  private void invalidate(int index) {
+    firstStale = Math.min(firstStale, index);
+  }
+
+  private static double distanceMeters(double lat1, double lng1, double lat2, double lng2) {
+    double dLat = Math.toRadians(lat2 - lat1);
+    double dLng = Math.toRadians(lng2 - lng1);
+    double h =
+        Math.sin(dLat / 2) * Math.sin(dLat / 2)
+            + Math.cos(Math.toRadians(lat1))
+                * Math.cos(Math.toRadians(lat2))
+                * Math.sin(dLng / 2)
+                * Math.sin(dLng / 2);
+    return 2 * EARTH_RADIUS_METERS * Math.asin(Math.min(1, Math.sqrt(h)));
+  }
+}
@@ -0,0 +1,378 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import android.view.Choreographer;
+import androidx.annotation.Nullable;
+import com.google.android.gms.maps.GoogleMap;
+import com.google.android.gms.maps.model.BitmapDescriptor;
+import com.google.android.gms.maps.model.LatLng;
+import com.google.android.gms.maps.model.Marker;
+import com.google.android.gms.maps.model.MarkerOptions;
+import com.google.android.gms.maps.model.Polyline;
+import com.google.android.gms.maps.model.PolylineOptions;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Plays back a recorded trip on a map: a marker moves along the trace in trace time and a trail
+ * follows it. Positions are found by binary search over the timestamps, or by stepping from the
+ * previous index while playing. The trail is split into frozen chunks of fixed size and a live
+ * tail, so moving the playback position only rewrites the tail and adds or removes whole chunks.
+ *
+ * <p>All methods must be called on the UI thread.
+ */
+public class TripPlayback implements Choreographer.FrameCallback {
+  // Vertices per frozen trail chunk. Adjacent chunks share their boundary vertex.
+  private static final int TRAIL_CHUNK_SIZE = 256;
+  // While playing, the index is stepped forward at most this far before falling back to a search.
+  private static final int MAX_INDEX_STEPS = 8;
+
+  /** Receives the playback position when it is reported. */
+  public interface ProgressListener {
+    void onProgress(TripPlayback playback);
+  }
+
+  private final double[] times;
+  private final LatLng[] coordinates;
+
+  @Nullable private Integer trailColor;
+  private float trailWidth = 6;
+  @Nullable private BitmapDescriptor markerIcon;
+  private long progressIntervalMs = 250;
+  // Lower bounds set by the quality governor of the view; 0 leaves the rates unchanged.
+  private long minFrameIntervalMs = 0;
+  private long minProgressIntervalMs = 0;
+  @Nullable private ProgressListener progressListener;
+  private double rate = 1;
+
+  private double timeMs;
+  private int index;
+  private LatLng position;
+  private double heading;
+  private boolean playing;
+
+  @Nullable private GoogleMap map;
+  @Nullable private Marker marker;
+  private final List<Polyline> trailChunks = new ArrayList<>();
+  @Nullable private Polyline trailTail;
+  private long lastFrameTimeNanos;
+  private long lastProgressTimeNanos;
+
+  private TripPlayback(double[] times, LatLng[] coordinates) {
+    this.times = times;
+    this.coordinates = coordinates;
+    this.timeMs = times[0];
+    this.position = coordinates[0];
+  }
+
+  /**
+   * Copies the trace. {@code latLngs} is packed as [lat0, lng0, ...].
+   *
+   * @throws IllegalArgumentException if the trace is empty, its arrays do not align or its
+   *     timestamps decrease.
+   */
+  public static TripPlayback fromTrace(double[] latLngs, double[] timestamps) {
+    int count = timestamps.length;
+    if (count == 0) {
+      throw new IllegalArgumentException("A trace needs at least one coordinate");
+    }
+    if (latLngs.length != count * 2) {
+      throw new IllegalArgumentException("A trace needs one timestamp per coordinate");
+    }
+    double[] times = new double[count];
+    LatLng[] coordinates = new LatLng[count];
+    for (int i = 0; i < count; i++) {
+      double time = timestamps[i];
+      if (Double.isNaN(time) || Double.isInfinite(time) || (i > 0 && time < times[i - 1])) {
+        throw new IllegalArgumentException("Trace timestamps must be finite and non-decreasing");
+      }
+      times[i] = time;
+      coordinates[i] = new LatLng(latLngs[2 * i], latLngs[2 * i + 1]);
+    }
+    return new TripPlayback(times, coordinates);
+  }
+
+  public void setTrailColor(@Nullable Integer color) {
+    trailColor = color;
+  }
+
+  public void setTrailWidth(float width) {
+    trailWidth = width;
+  }
+
+  /** A custom icon is drawn flat and rotated to the heading; null uses the default marker. */
+  public void setMarkerIcon(@Nullable BitmapDescriptor icon) {
+    markerIcon = icon;
+  }
+
+  /** Minimum interval between progress reports while playing. */
+  public void setProgressIntervalMs(long intervalMs) {
+    progressIntervalMs = intervalMs;
+  }
+
+  /**
+   * Caps the rate of rendered frames and progress reports to the intervals set by the quality
+   * governor of the view. Use 0 to leave a rate unchanged.
+   */
+  public void setQualityIntervals(long frameIntervalMs, long progressIntervalMs) {
+    minFrameIntervalMs = frameIntervalMs;
+    minProgressIntervalMs = progressIntervalMs;
+  }
+
+  public void setProgressListener(@Nullable ProgressListener listener) {
+    progressListener = listener;
+  }
+
+  /** Playback speed relative to real time; zero holds the position. */
+  public void setRate(double rate) {
+    this.rate = Double.isNaN(rate) || Double.isInfinite(rate) ? 0 : Math.max(rate, 0);
+  }
+
+  public double getTimeMs() {
+    return timeMs;
+  }
+
+  /** Index of the last trace coordinate at or before the current time. */
+  public int getIndex() {
+    return index;
+  }
+
+  public LatLng getPosition() {
+    return position;
+  }
+
+  public double getHeading() {
+    return heading;
+  }
+
+  public boolean isPlaying() {
+    return playing;
+  }
+
+  /** Draws the playback at its current time on {@code googleMap}. */
+  public void show(GoogleMap googleMap) {
+    removeOverlays();
+    map = googleMap;
+
+    PolylineOptions tailOptions = new PolylineOptions().width(trailWidth);
+    if (trailColor != null) {
+      tailOptions.color(trailColor);
+    }
+    trailTail = googleMap.addPolyline(tailOptions);
+
+    MarkerOptions markerOptions = new MarkerOptions().position(position).zIndex(1);
+    if (markerIcon != null) {
+      markerOptions.icon(markerIcon).flat(true).anchor(0.5f, 0.5f);
+    }
+    marker = googleMap.addMarker(markerOptions);
+
+    renderAtTime(timeMs);
+  }
+
+  /** Plays from the current time, or from the start once the end was reached. */
+  public void play() {
+    if (playing) {
+      return;
+    }
+    if (timeMs >= times[times.length - 1]) {
+      renderAtTime(times[0]);
+    }
+    playing = true;
+    lastFrameTimeNanos = 0;
+    Choreographer.getInstance().postFrameCallback(this);
+    reportProgress();
+  }
+
+  public void pause() {
+    if (!playing) {
+      return;
+    }
+    stopFrames();
+    reportProgress();
+  }
+
+  /** Moves to {@code timeMs}, clamped to the time range of the trace. */
+  public void seek(double timeMs) {
+    if (Double.isNaN(timeMs)) {
+      return;
+    }
+    renderAtTime(Math.max(times[0], Math.min(timeMs, times[times.length - 1])));
+    reportProgress();
+  }
+
+  /** Stops playback without reporting progress and removes the marker and trail. */
+  public void remove() {
+    stopFrames();
+    removeOverlays();
+  }
+
+  @Override
+  public void doFrame(long frameTimeNanos) {
+    if (!playing) {
+      return;
+    }
+    if (lastFrameTimeNanos > 0) {
+      if (frameTimeNanos - lastFrameTimeNanos < minFrameIntervalMs * 1_000_000L) {
+        // Skipped frames are caught up by the next rendered one.
+        Choreographer.getInstance().postFrameCallback(this);
+        return;
+      }
+      double nextTimeMs = timeMs + (frameTimeNanos - lastFrameTimeNanos) / 1e6 * rate;
+      double endMs = times[times.length - 1];
+      if (nextTimeMs >= endMs) {
+        renderAtTime(endMs);
+        stopFrames();
+        reportProgress();
+        return;
+      }
+      renderAtTime(nextTimeMs);
+      long intervalMs = Math.max(progressIntervalMs, minProgressIntervalMs);
+      if (frameTimeNanos - lastProgressTimeNanos >= intervalMs * 1_000_000L) {
+        reportProgress();
+      }
+    }
+    lastFrameTimeNanos = frameTimeNanos;
+    Choreographer.getInstance().postFrameCallback(this);
+  }
+
+  private void stopFrames() {
+    playing = false;
+    Choreographer.getInstance().removeFrameCallback(this);
+  }
+
+  private void removeOverlays() {
+    for (Polyline chunk : trailChunks) {
+      chunk.remove();
+    }
+    trailChunks.clear();
+    if (trailTail != null) {
+      trailTail.remove();
+      trailTail = null;
+    }
+    if (marker != null) {
+      marker.remove();
+      marker = null;
+    }
+    map = null;
+  }
+
+  private void reportProgress() {
+    lastProgressTimeNanos = System.nanoTime();
+    if (progressListener != null) {
+      progressListener.onProgress(this);
+    }
+  }
+
+  private int indexForTime(double timeMs) {
+    // Playback moves forward a few samples per frame; step instead of searching.
+    if (times[index] <= timeMs) {
+      int next = index;
+      for (int step = 0; step < MAX_INDEX_STEPS; step++) {
+        if (next + 1 >= times.length || times[next + 1] > timeMs) {
+          return next;
+        }
+        next++;
+      }
+    }
+    int found = Arrays.binarySearch(times, timeMs);
+    if (found < 0) {
+      return Math.max(0, -found - 2);
+    }
+    // Equal timestamps: use the last sample at this time.
+    while (found + 1 < times.length && times[found + 1] == timeMs) {
+      found++;
+    }
+    return found;
+  }
+
+  private void renderAtTime(double timeMs) {
+    this.timeMs = timeMs;
+    index = indexForTime(timeMs);
+
+    LatLng from = coordinates[index];
+    position = from;
+    if (index + 1 < coordinates.length) {
+      LatLng to = coordinates[index + 1];
+      double duration = times[index + 1] - times[index];
+      if (duration > 0) {
+        double fraction = (timeMs - times[index]) / duration;
+        position =
+            new LatLng(
+                from.latitude + (to.latitude - from.latitude) * fraction,
+                from.longitude + (to.longitude - from.longitude) * fraction);
+      }
+      if (!from.equals(to)) {
+        heading = computeHeading(from, to);
+      }
+    }
+
+    if (map == null) {
+      return;
+    }
+    if (marker != null) {
+      marker.setPosition(position);
+      if (markerIcon != null) {
+        marker.setRotation((float) heading);
+      }
+    }
+    updateTrail();
+  }
+
+  private void updateTrail() {
+    // Chunk k spans vertices [k * size, (k + 1) * size] and is complete once the index reaches its
+    // end.
+    int completeChunks = index / TRAIL_CHUNK_SIZE;
+    while (trailChunks.size() > completeChunks) {
+      trailChunks.remove(trailChunks.size() - 1).remove();
+    }
+    while (trailChunks.size() < completeChunks) {
+      int start = trailChunks.size() * TRAIL_CHUNK_SIZE;
+      PolylineOptions options =
+          new PolylineOptions()
+              .addAll(Arrays.asList(coordinates).subList(start, start + TRAIL_CHUNK_SIZE + 1))
+              .width(trailWidth);
+      if (trailColor != null) {
+        options.color(trailColor);
+      }
+      trailChunks.add(map.addPolyline(options));
+    }
+
+    if (trailTail != null) {
+      List<LatLng> tail = new ArrayList<>(index - completeChunks * TRAIL_CHUNK_SIZE + 2);
+      for (int i = completeChunks * TRAIL_CHUNK_SIZE; i <= index; i++) {
+        tail.add(coordinates[i]);
+      }
+      tail.add(position);
+      trailTail.setPoints(tail);
+    }
+  }
+
+  /** Initial bearing from {@code from} to {@code to}, in degrees clockwise from north. */
+  private static double computeHeading(LatLng from, LatLng to) {
+    double fromLat = Math.toRadians(from.latitude);
+    double toLat = Math.toRadians(to.latitude);
+    double deltaLng = Math.toRadians(to.longitude - from.longitude);
+    double heading =
+        Math.atan2(
+            Math.sin(deltaLng) * Math.cos(toLat),
+            Math.cos(fromLat) * Math.sin(toLat)
+                - Math.sin(fromLat) * Math.cos(toLat) * Math.cos(deltaLng));
+    return (Math.toDegrees(heading) + 360) % 360;
+  }
+}
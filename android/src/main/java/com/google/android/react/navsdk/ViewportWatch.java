@@ -0,0 +1,247 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import com.google.android.gms.maps.model.LatLng;
+import com.google.android.gms.maps.model.LatLngBounds;
+import com.google.android.gms.maps.model.VisibleRegion;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+/**
+ * Tracks which of a set of overlays intersect the visible region. The extents of the watched
+ * overlays are bucketed into a uniform grid, so an update only tests the overlays in the cells
+ * the viewport covers, and reports the ids that entered and left since the previous update.
+ */
+public class ViewportWatch {
+  // Cells are at least this large, so dense clusters do not produce a huge grid.
+  private static final double MIN_CELL_DEGREES = 1e-4;
+  // Entries spanning more cells than this are tested on every update instead.
+  private static final long MAX_CELLS_PER_ENTRY = 16;
+
+  public final Set<String> overlayIds;
+  public boolean needsIndex = true;
+
+  private final List<String> indexedIds = new ArrayList<>();
+  // {south, west, north, east} of each indexed overlay.
+  private final List<double[]> entries = new ArrayList<>();
+  private final Map<Long, List<Integer>> cells = new HashMap<>();
+  private final List<Integer> oversized = new ArrayList<>();
+  private double cellSize;
+  private Set<String> visible = new HashSet<>();
+
+  public ViewportWatch(List<String> overlayIds) {
+    this.overlayIds = new HashSet<>(overlayIds);
+  }
+
+  public void beginIndex() {
+    indexedIds.clear();
+    entries.clear();
+    cells.clear();
+    oversized.clear();
+  }
+
+  public void indexOverlay(String overlayId, double[] extent) {
+    indexedIds.add(overlayId);
+    entries.add(extent.clone());
+  }
+
+  public void endIndex() {
+    needsIndex = false;
+    if (entries.isEmpty()) {
+      return;
+    }
+
+    // Aim for about one entry per cell over the extent of all entries.
+    double south = Double.POSITIVE_INFINITY;
+    double west = Double.POSITIVE_INFINITY;
+    double north = Double.NEGATIVE_INFINITY;
+    double east = Double.NEGATIVE_INFINITY;
+    for (double[] entry : entries) {
+      south = Math.min(south, entry[0]);
+      west = Math.min(west, entry[1]);
+      north = Math.max(north, entry[2]);
+      east = Math.max(east, entry[3]);
+    }
+    double span = Math.max(north - south, east - west);
+    cellSize = Math.max(MIN_CELL_DEGREES, span / Math.ceil(Math.sqrt(entries.size())));
+
+    for (int i = 0; i < entries.size(); i++) {
+      double[] entry = entries.get(i);
+      long row0 = cell(entry[0]);
+      long row1 = cell(entry[2]);
+      long column0 = cell(entry[1]);
+      long column1 = cell(entry[3]);
+      if ((row1 - row0 + 1) * (column1 - column0 + 1) > MAX_CELLS_PER_ENTRY) {
+        oversized.add(i);
+        continue;
+      }
+      for (long row = row0; row <= row1; row++) {
+        for (long column = column0; column <= column1; column++) {
+          List<Integer> bucket = cells.get(cellKey(row, column));
+          if (bucket == null) {
+            bucket = new ArrayList<>();
+            cells.put(cellKey(row, column), bucket);
+          }
+          bucket.add(i);
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluates membership against {@code region} and fills {@code entered} and {@code left} with
+   * the changes since the previous update. Returns whether anything changed.
+   */
+  public boolean update(VisibleRegion region, List<String> entered, List<String> left) {
+    LatLngBounds bounds = region.latLngBounds;
+    double south = bounds.southwest.latitude;
+    double north = bounds.northeast.latitude;
+    double west = bounds.southwest.longitude;
+    double east = bounds.northeast.longitude;
+
+    boolean[] seen = new boolean[entries.size()];
+    List<Integer> candidates = new ArrayList<>();
+    if (west <= east) {
+      collect(south, west, north, east, candidates, seen);
+    } else {
+      // The viewport crosses the antimeridian.
+      collect(south, west, north, 180, candidates, seen);
+      collect(south, -180, north, east, candidates, seen);
+    }
+
+    LatLng[] quad = {region.nearLeft, region.nearRight, region.farRight, region.farLeft};
+    Set<String> nowVisible = new HashSet<>();
+    for (int i : candidates) {
+      double[] entry = entries.get(i);
+      boolean isPoint = entry[0] == entry[2] && entry[1] == entry[3];
+      if (isPoint && !quadContains(quad, entry[0], entry[1])) {
+        continue;
+      }
+      nowVisible.add(indexedIds.get(i));
+    }
+
+    for (String id : nowVisible) {
+      if (!visible.contains(id)) {
+        entered.add(id);
+      }
+    }
+    for (String id : visible) {
+      if (!nowVisible.contains(id)) {
+        left.add(id);
+      }
+    }
+    visible = nowVisible;
+    return !entered.isEmpty() || !left.isEmpty();
+  }
+
+  private void collect(
+      double south,
+      double west,
+      double north,
+      double east,
+      List<Integer> candidates,
+      boolean[] seen) {
+    if (entries.isEmpty()) {
+      return;
+    }
+
+    long row0 = cell(south);
+    long row1 = cell(north);
+    long column0 = cell(west);
+    long column1 = cell(east);
+    if ((double) (row1 - row0 + 1) * (column1 - column0 + 1) > entries.size()) {
+      // Zoomed out past the watched area: scanning the entries is cheaper than the cells.
+      for (int i = 0; i < entries.size(); i++) {
+        consider(i, south, west, north, east, candidates, seen);
+      }
+      return;
+    }
+    for (long row = row0; row <= row1; row++) {
+      for (long column = column0; column <= column1; column++) {
+        List<Integer> bucket = cells.get(cellKey(row, column));
+        if (bucket != null) {
+          for (int i : bucket) {
+            consider(i, south, west, north, east, candidates, seen);
+          }
+        }
+      }
+    }
+    for (int i : oversized) {
+      consider(i, south, west, north, east, candidates, seen);
+    }
+  }
+
+  private void consider(
+      int i,
+      double south,
+      double west,
+      double north,
+      double east,
+      List<Integer> candidates,
+      boolean[] seen) {
+    if (seen[i]) {
+      return;
+    }
+    double[] entry = entries.get(i);
+    if (entry[0] <= north && entry[2] >= south && entry[1] <= east && entry[3] >= west) {
+      seen[i] = true;
+      candidates.add(i);
+    }
+  }
+
+  private long cell(double degrees) {
+    return (long) Math.floor(degrees / cellSize);
+  }
+
+  private static long cellKey(long row, long column) {
+    return (row << 32) | (column & 0xffffffffL);
+  }
+
+  // Crossing test in degrees, with longitudes unwrapped around the first corner so viewports
+  // across the antimeridian work too.
+  private static boolean quadContains(LatLng[] quad, double lat, double lng) {
+    double reference = quad[0].longitude;
+    double x = unwrap(lng, reference);
+    boolean inside = false;
+    for (int i = 0, j = quad.length - 1; i < quad.length; j = i++) {
+      double xi = unwrap(quad[i].longitude, reference);
+      double xj = unwrap(quad[j].longitude, reference);
+      double yi = quad[i].latitude;
+      double yj = quad[j].latitude;
+      if ((yi > lat) != (yj > lat) && x < (xj - xi) * (lat - yi) / (yj - yi) + xi) {
+        inside = !inside;
+      }
+    }
+    return inside;
+  }
+
+  private static double unwrap(double lng, double reference) {
+    double delta = lng - reference;
+    if (delta > 180) {
+      return lng - 360;
+    }
+    if (delta < -180) {
+      return lng + 360;
+    }
+    return lng;
+  }
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.google.android.react.navsdk;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Spatial index over zone polygons for classifying many points, the Java counterpart of
+ * NavZoneIndex.cpp on iOS. Each zone is the even-odd area of its outer ring and holes. The index
+ * is immutable once built, so one index can be queried from several threads at once.
+ */
+public final class ZoneIndex {
+  // Average number of edges per band of a zone, and of zones per grid cell.
+  private static final int EDGES_PER_BAND = 4;
+  private static final int ZONES_PER_CELL = 4;
+  private static final int MAX_GRID_SIZE = 256;
+
+  private static final class Zone {
+    double minX = Double.POSITIVE_INFINITY;
+    double minY = Double.POSITIVE_INFINITY;
+    double maxX = Double.NEGATIVE_INFINITY;
+    double maxY = Double.NEGATIVE_INFINITY;
+    double bandMinY;
+    double bandHeight = 1;
+    // Edges of band i are entries bandOffsets[i] to bandOffsets[i + 1] - 1 of the arrays below.
+    int[] bandOffsets = {0, 0};
+    // Edges as a structure of arrays with a precomputed inverse slope, which keeps the crossing
+    // test a short loop over primitive arrays.
+    double[] y0 = new double[0];
+    double[] y1 = new double[0];
+    double[] x0 = new double[0];
+    double[] slope = new double[0];
+  }
+
+  private final Zone[] zones;
+  // Uniform grid over the bounds of all zones. Each cell lists, in ascending order, the zones
+  // whose bounds overlap it.
+  private double minX;
+  private double minY;
+  private double cellWidth = 1;
+  private double cellHeight = 1;
+  private int columns;
+  private int rows;
+  private int[] cellOffsets;
+  private int[] cellZones;
+
+  public ZoneIndex(List<PolygonClipper.GeoPolygon> polygons) {
+    zones = new Zone[polygons.size()];
+    double boundsMinX = Double.POSITIVE_INFINITY;
+    double boundsMinY = Double.POSITIVE_INFINITY;
+    double boundsMaxX = Double.NEGATIVE_INFINITY;
+    double boundsMaxY = Double.NEGATIVE_INFINITY;
+    for (int i = 0; i < zones.length; i++) {
+      Zone zone = buildZone(polygons.get(i));
+      zones[i] = zone;
+      if (zone.minX <= zone.maxX) {
+        boundsMinX = Math.min(boundsMinX, zone.minX);
+        boundsMinY = Math.min(boundsMinY, zone.minY);
+        boundsMaxX = Math.max(boundsMaxX, zone.maxX);
+        boundsMaxY = Math.max(boundsMaxY, zone.maxY);
+      }
+    }
+    if (boundsMinX > boundsMaxX) {
+      return;
+    }
+
+    int size = (int) Math.ceil(Math.sqrt((double) zones.length / ZONES_PER_CELL));
+    columns = rows = Math.max(1, Math.min(size, MAX_GRID_SIZE));
+    minX = boundsMinX;
+    minY = boundsMinY;
+    cellWidth = Math.max((boundsMaxX - boundsMinX) / columns, 1e-12);
+    cellHeight = Math.max((boundsMaxY - boundsMinY) / rows, 1e-12);
+
+    List<List<Integer>> cells = new ArrayList<>(columns * rows);
+    for (int i = 0; i < columns * rows; i++) {
+      cells.add(new ArrayList<>());
+    }
+    for (int i = 0; i < zones.length; i++) {
+      Zone zone = zones[i];
+      if (zone.minX > zone.maxX) {
+        continue;
+      }
+      int lastColumn = cellIndex(zone.maxX, minX, cellWidth, columns);
+      int lastRow = cellIndex(zone.maxY, minY, cellHeight, rows);
+      for (int row = cellIndex(zone.minY, minY, cellHeight, rows); row <= lastRow; row++) {
+        for (int column = cellIndex(zone.minX, minX, cellWidth, columns);
+            column <= lastColumn;
+            column++) {
+          cells.get(row * columns + column).add(i);
+        }
+      }
+    }
+    cellOffsets = new int[cells.size() + 1];
+    int total = 0;
+    for (int i = 0; i < cells.size(); i++) {
+      total += cells.get(i).size();
+      cellOffsets[i + 1] = total;
+    }
+    cellZones = new int[total];
+    for (int i = 0; i < cells.size(); i++) {
+      List<Integer> cell = cells.get(i);
+      for (int k = 0; k < cell.size(); k++) {
+        cellZones[cellOffsets[i] + k] = cell.get(k);
+      }
+    }
+  }
+
+  /** Index of the first zone containing the point, or -1 if none does. */
+  public int classify(double lat, double lng) {
+    double x = lng;
+    double y = lat;
+    // Written so that NaN coordinates are rejected too.
+    if (columns == 0
+        || !(x >= minX && x <= minX + cellWidth * columns)
+        || !(y >= minY && y <= minY + cellHeight * rows)) {
+      return -1;
+    }
+    int cell =
+        cellIndex(y, minY, cellHeight, rows) * columns + cellIndex(x, minX, cellWidth, columns);
+    for (int i = cellOffsets[cell]; i < cellOffsets[cell + 1]; i++) {
+      if (contains(zones[cellZones[i]], x, y)) {
+        return cellZones[i];
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * Classifies points [begin, end) of {@code latLngs}, packed as [lat0, lng0, ...], writing the
+   * zone of point i to {@code result[i]}.
+   */
+  public void classifyRange(double[] latLngs, int begin, int end, int[] result) {
+    for (int i = begin; i < end; i++) {
+      result[i] = classify(latLngs[2 * i], latLngs[2 * i + 1]);
+    }
+  }
+
+  private static int cellIndex(double value, double origin, double size, int count) {
+    int cell = (int) ((value - origin) / size);
+    return Math.max(0, Math.min(cell, count - 1));
+  }
+
+  private static boolean contains(Zone zone, double x, double y) {
+    if (x < zone.minX || x > zone.maxX || y < zone.minY || y > zone.maxY) {
+      return false;
+    }
+    int band = cellIndex(y, zone.bandMinY, zone.bandHeight, zone.bandOffsets.length - 1);
+    double[] y0 = zone.y0;
+    double[] y1 = zone.y1;
+    double[] x0 = zone.x0;
+    double[] slope = zone.slope;
+    int crossings = 0;
+    for (int i = zone.bandOffsets[band]; i < zone.bandOffsets[band + 1]; i++) {
+      if ((y0[i] > y) != (y1[i] > y) && x < x0[i] + (y - y0[i]) * slope[i]) {
+        crossings++;
+      }
+    }
+    return (crossings & 1) != 0;
+  }
+
+  private static Zone buildZone(PolygonClipper.GeoPolygon polygon) {
+    Zone zone = new Zone();
+    if (polygon.outer.length < 6) {
+      return zone;
+    }
+
+    // Edges packed as [x0, y0, x1, y1, ...].
+    List<double[]> rings = new ArrayList<>();
+    rings.add(polygon.outer);
+    for (double[] hole : polygon.holes) {
+      if (hole.length >= 6) {
+        rings.add(hole);
+      }
+    }
+    double[] edges = new double[0];
+    int edgeCount = 0;
+    for (double[] ring : rings) {
+      int count = ring.length / 2;
+      edges = Arrays.copyOf(edges, (edgeCount + count) * 4);
+      for (int i = 0, j = count - 1; i < count; j = i++) {
+        // Horizontal edges never cross a horizontal ray.
+        if (ring[2 * j] != ring[2 * i]) {
+          edges[4 * edgeCount] = ring[2 * j + 1];
+          edges[4 * edgeCount + 1] = ring[2 * j];
+          edges[4 * edgeCount + 2] = ring[2 * i + 1];
+          edges[4 * edgeCount + 3] = ring[2 * i];
+          edgeCount++;
+        }
+      }
+    }
+    for (int i = 0; i + 1 < polygon.outer.length; i += 2) {
+      zone.minX = Math.min(zone.minX, polygon.outer[i + 1]);
+      zone.minY = Math.min(zone.minY, polygon.outer[i]);
+      zone.maxX = Math.max(zone.maxX, polygon.outer[i + 1]);
+      zone.maxY = Math.max(zone.maxY, polygon.outer[i]);
+    }
+    if (edgeCount == 0) {
+      return zone;
+    }
+
+    int bandCount = Math.max(1, edgeCount / EDGES_PER_BAND);
+    zone.bandMinY = zone.minY;
+    zone.bandHeight = Math.max((zone.maxY - zone.minY) / bandCount, 1e-12);
+
+    int[] offsets = new int[bandCount + 1];
+    for (int e = 0; e < edgeCount; e++) {
+      double edgeMinY = Math.min(edges[4 * e + 1], edges[4 * e + 3]);
+      double edgeMaxY = Math.max(edges[4 * e + 1], edges[4 * e + 3]);
+      int last = cellIndex(edgeMaxY, zone.bandMinY, zone.bandHeight, bandCount);
+      for (int b = cellIndex(edgeMinY, zone.bandMinY, zone.bandHeight, bandCount); b <= last; b++) {
+        offsets[b + 1]++;
+      }
+    }
+    for (int b = 0; b < bandCount; b++) {
+      offsets[b + 1] += offsets[b];
+    }
+    int total = offsets[bandCount];
+    zone.y0 = new double[total];
+    zone.y1 = new double[total];
+    zone.x0 = new double[total];
+    zone.slope = new double[total];
+    int[] fill = Arrays.copyOf(offsets, bandCount);
+    for (int e = 0; e < edgeCount; e++) {
+      double x0 = edges[4 * e];
+      double y0 = edges[4 * e + 1];
+      double x1 = edges[4 * e + 2];
+      double y1 = edges[4 * e + 3];
+      double slope = (x1 - x0) / (y1 - y0);
+      int last = cellIndex(Math.max(y0, y1), zone.bandMinY, zone.bandHeight, bandCount);
+      for (int b = cellIndex(Math.min(y0, y1), zone.bandMinY, zone.bandHeight, bandCount);
+          b <= last;
+          b++) {
+        int entry = fill[b]++;
+        zone.y0[entry] = y0;
+        zone.y1[entry] = y1;
+        zone.x0[entry] = x0;
+        zone.slope[entry] = slope;
+      }
+    }
+    zone.bandOffsets = offsets;
+    return zone;
+  }
+}
@@ -15,6 +15,7 @@
  */
 #import <CarPlay/CarPlay.h>
 #import "INavigationViewStateDelegate.h"
+#import "NavStopListModel.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -31,6 +32,21 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, assign) BOOL sessionAttached;
 @property(nonatomic, assign) BOOL viewControllerRegistered;
 
+/**
+ * Time in seconds the CarPlay NavViewController, together with its overlays, styling and camera,
+ * is kept alive after the CarPlay interface disconnects. Reconnecting within this period reuses
+ * the existing controller in the new CPWindow instead of rebuilding the map.
+ * Defaults to 30 seconds; set to 0 to release the controller immediately on disconnect.
+ */
+@property(nonatomic, assign) NSTimeInterval reconnectGracePeriod;
+
+/**
+ * Stops shown in a list template, kept up to date with the ETA of each route leg while CarPlay is
+ * connected. Bind it by setting its `listTemplate`, and feed it the stops from
+ * `onCustomMessageReceived:data:` with `setStopsFromArray:` and `setStatus:forStopId:`.
+ */
+@property(nonatomic, strong, readonly) NavStopListModel *stopListModel;
+
 - (CPMapTemplate *)getTemplate;
 
 /**
@@ -21,8 +21,36 @@
 #import "NavModule.h"
 #import "NavViewController.h"
 
+static const NSTimeInterval kDefaultReconnectGracePeriod = 30.0;
+
+// The NavViewController kept alive after a disconnect. UIKit discards the scene delegate on
+// disconnect and creates a new one on reconnect, so the controller, whether it was attached to the
+// session, and the generation that invalidates its pending release live at process scope. Only
+// accessed on the main thread.
+static NavViewController *sRetainedNavViewController = nil;
+static BOOL sRetainedSessionAttached = NO;
+// Incremented on every connect and disconnect to invalidate pending delayed releases.
+static NSUInteger sRetentionGeneration = 0;
+
+static void ReleaseRetainedNavViewController(void) {
+  if (sRetainedSessionAttached) {
+    [sRetainedNavViewController detachFromNavigationSession];
+  }
+  sRetainedNavViewController = nil;
+  sRetainedSessionAttached = NO;
+}
+
 @implementation BaseCarSceneDelegate
 
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _reconnectGracePeriod = kDefaultReconnectGracePeriod;
+    _stopListModel = [[NavStopListModel alloc] init];
+  }
+  return self;
+}
+
 - (void)templateApplicationScene:(CPTemplateApplicationScene *)templateApplicationScene
     didConnectInterfaceController:(CPInterfaceController *)interfaceController
                          toWindow:(CPWindow *)window {
@@ -31,8 +59,20 @@
   self.mapTemplate = [self getTemplate];
   self.mapTemplate.mapDelegate = self;
 
-  self.navViewController = [[NavViewController alloc] init];
-  [self.navViewController setMapViewType:NAVIGATION];
+  // Take over the controller retained from the previous connection, possibly by another delegate,
+  // and cancel its pending release.
+  sRetentionGeneration++;
+  if (self.navViewController == nil && sRetainedNavViewController != nil) {
+    self.navViewController = sRetainedNavViewController;
+    self.sessionAttached = sRetainedSessionAttached;
+  }
+  sRetainedNavViewController = nil;
+  sRetainedSessionAttached = NO;
+
+  if (self.navViewController == nil) {
+    self.navViewController = [[NavViewController alloc] init];
+    [self.navViewController setMapViewType:NAVIGATION];
+  }
   self.navViewController.stateDelegate = self;
 
   self.carWindow.rootViewController = self.navViewController;
@@ -47,6 +87,11 @@
   [NavAutoModule registerNavAutoModuleReadyCallback:^{
     [self registerViewController];
   }];
+  __weak NavStopListModel *weakStopListModel = self.stopListModel;
+  [NavModule registerLegTimesCallback:^(NSArray<NSNumber *> *legSeconds,
+                                        NSArray<NSNumber *> *legMeters) {
+    [weakStopListModel updateWithLegSeconds:legSeconds meters:legMeters];
+  }];
 }
 
 - (CPMapTemplate *)getTemplate {
@@ -58,11 +103,47 @@
 - (void)templateApplicationScene:(CPTemplateApplicationScene *)templateApplicationScene
     didDisconnectInterfaceController:(CPInterfaceController *)interfaceController {
   [self unRegisterViewController];
+  [NavModule unregisterLegTimesCallback];
+  self.carWindow.rootViewController = nil;
   self.interfaceController = nil;
   self.carWindow = nil;
   self.mapTemplate = nil;
-  self.navViewController = nil;
   self.viewControllerRegistered = NO;
+
+  if (self.reconnectGracePeriod <= 0) {
+    [self releaseNavViewController];
+    return;
+  }
+
+  // Keep the controller alive for the grace period so that a quick reconnect can re-parent it to
+  // the new CPWindow with its map, overlays and session attachment intact. It is handed over to
+  // process scope because this delegate does not survive the disconnect.
+  sRetainedNavViewController = self.navViewController;
+  sRetainedSessionAttached = self.sessionAttached;
+  self.navViewController = nil;
+  self.sessionAttached = NO;
+  [NavModule registerNavigationSessionDisposedCallback:^{
+    if (sRetainedSessionAttached) {
+      [sRetainedNavViewController detachFromNavigationSession];
+      sRetainedSessionAttached = NO;
+    }
+  }];
+
+  NSUInteger generation = ++sRetentionGeneration;
+  dispatch_after(
+      dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.reconnectGracePeriod * NSEC_PER_SEC)),
+      dispatch_get_main_queue(), ^{
+        if (sRetentionGeneration == generation) {
+          ReleaseRetainedNavViewController();
+        }
+      });
+}
+
+- (void)releaseNavViewController {
+  if (_sessionAttached) {
+    [self.navViewController detachFromNavigationSession];
+  }
+  self.navViewController = nil;
   self.sessionAttached = NO;
 }
 
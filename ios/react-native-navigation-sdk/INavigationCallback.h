@@ -26,7 +26,7 @@ NS_ASSUME_NONNULL_BEGIN
 @required
 
 - (void)onRemainingTimeOrDistanceChanged;
-- (void)onRouteChanged;
+- (void)onRouteChanged:(NSDictionary *)routeChange;
 - (void)onArrival:(NSDictionary *)waypoint;
 - (void)onTurnByTurn:(GMSNavigationNavInfo *)navInfo;
 - (void)onTurnByTurn:(GMSNavigationNavInfo *)navInfo
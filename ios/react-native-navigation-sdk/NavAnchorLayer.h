@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavAnchorLayer_h
+#define NavAnchorLayer_h
+
+#import <UIKit/UIKit.h>
+
+@class NavAnchorLayer;
+@class NavAnchorView;
+
+NS_ASSUME_NONNULL_BEGIN
+
+@protocol NavAnchorLayerDelegate <NSObject>
+
+/// Asks the delegate to position `views` from the current map projection.
+- (void)anchorLayer:(NavAnchorLayer *)layer layoutAnchoredViews:(NSArray<NavAnchorView *> *)views;
+
+@end
+
+/**
+ * Transparent container stacked above the map that hosts the React children of a NavView.
+ * Touches that do not hit a child fall through to the map.
+ */
+@interface NavAnchorLayer : UIView
+
+@property(nonatomic, weak, nullable) id<NavAnchorLayerDelegate> delegate;
+
+/// Subviews that are pinned to map coordinates.
+@property(nonatomic, readonly) NSArray<NavAnchorView *> *anchoredViews;
+
+/// Repositions a single anchored view, e.g. after its coordinate changed.
+- (void)setNeedsLayoutForAnchoredView:(NavAnchorView *)view;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavAnchorLayer_h */
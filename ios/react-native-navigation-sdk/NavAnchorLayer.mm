@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavAnchorLayer.h"
+#import "NavAnchorView.h"
+
+@implementation NavAnchorLayer {
+  // Cached so camera frames do not filter the subview list; rebuilt when children change.
+  NSArray<NavAnchorView *> *_anchoredViews;
+}
+
+- (instancetype)initWithFrame:(CGRect)frame {
+  if (self = [super initWithFrame:frame]) {
+    self.backgroundColor = [UIColor clearColor];
+  }
+  return self;
+}
+
+- (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event {
+  UIView *hitView = [super hitTest:point withEvent:event];
+  return hitView == self ? nil : hitView;
+}
+
+- (NSArray<NavAnchorView *> *)anchoredViews {
+  if (_anchoredViews == nil) {
+    NSMutableArray<NavAnchorView *> *views = [NSMutableArray array];
+    for (UIView *subview in self.subviews) {
+      if ([subview isKindOfClass:[NavAnchorView class]]) {
+        [views addObject:(NavAnchorView *)subview];
+      }
+    }
+    _anchoredViews = views;
+  }
+  return _anchoredViews;
+}
+
+- (void)didAddSubview:(UIView *)subview {
+  [super didAddSubview:subview];
+  if ([subview isKindOfClass:[NavAnchorView class]]) {
+    _anchoredViews = nil;
+    [self setNeedsLayoutForAnchoredView:(NavAnchorView *)subview];
+  }
+}
+
+- (void)willRemoveSubview:(UIView *)subview {
+  [super willRemoveSubview:subview];
+  if ([subview isKindOfClass:[NavAnchorView class]]) {
+    _anchoredViews = nil;
+  }
+}
+
+- (void)setNeedsLayoutForAnchoredView:(NavAnchorView *)view {
+  [self.delegate anchorLayer:self layoutAnchoredViews:@[ view ]];
+}
+
+- (void)layoutSubviews {
+  [super layoutSubviews];
+  // The culling rect follows the layer bounds.
+  NSArray<NavAnchorView *> *views = self.anchoredViews;
+  if (views.count > 0) {
+    [self.delegate anchorLayer:self layoutAnchoredViews:views];
+  }
+}
+
+@end
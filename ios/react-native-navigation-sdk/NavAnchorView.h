@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavAnchorView_h
+#define NavAnchorView_h
+
+#import <CoreLocation/CoreLocation.h>
+#import <React/RCTViewComponentView.h>
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Fabric ComponentView for a React Native view pinned to a map coordinate. It is mounted into the
+ * anchor layer of its parent NavView, and NavViewController moves it from the map projection.
+ */
+@interface NavAnchorView : RCTViewComponentView
+
+/// The map coordinate the view is pinned to.
+@property(nonatomic, readonly) CLLocationCoordinate2D coordinate;
+
+/**
+ * Places the anchor point of the view on `point`, in the coordinate space of the superview. The
+ * position is kept across React layout updates. Hidden views are culled and not hit-tested.
+ */
+- (void)placeAtPoint:(CGPoint)point visible:(BOOL)visible;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavAnchorView_h */
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavAnchorView.h"
+#import "NavAnchorLayer.h"
+
+#import <react/renderer/components/RNNavigationSdkSpec/ComponentDescriptors.h>
+#import <react/renderer/components/RNNavigationSdkSpec/Props.h>
+#import <react/renderer/components/RNNavigationSdkSpec/RCTComponentViewHelpers.h>
+
+using namespace facebook::react;
+
+@interface NavAnchorView () <RCTNavAnchorViewViewProtocol>
+@end
+
+@implementation NavAnchorView {
+  CGFloat _anchorX;
+  CGFloat _anchorY;
+  CGPoint _point;
+  BOOL _placed;
+  BOOL _visible;
+}
+
+- (instancetype)initWithFrame:(CGRect)frame {
+  if (self = [super initWithFrame:frame]) {
+    static const auto defaultProps = std::make_shared<const NavAnchorViewProps>();
+    _props = defaultProps;
+    _coordinate = kCLLocationCoordinate2DInvalid;
+    _anchorX = 0.5;
+    _anchorY = 1.0;
+    // Stay hidden until the first projection, so the view never flashes at the map origin.
+    self.hidden = YES;
+  }
+  return self;
+}
+
+// View recycling is not supported for this component
++ (BOOL)shouldBeRecycled {
+  return NO;
+}
+
+- (void)updateProps:(Props::Shared const &)props oldProps:(Props::Shared const &)oldProps {
+  const auto &newViewProps = *std::static_pointer_cast<NavAnchorViewProps const>(props);
+
+  _coordinate = CLLocationCoordinate2DMake(newViewProps.latitude, newViewProps.longitude);
+  _anchorX = newViewProps.anchorX;
+  _anchorY = newViewProps.anchorY;
+
+  [super updateProps:props oldProps:oldProps];
+
+  if ([self.superview isKindOfClass:[NavAnchorLayer class]]) {
+    [(NavAnchorLayer *)self.superview setNeedsLayoutForAnchoredView:self];
+  }
+}
+
+- (void)updateLayoutMetrics:(const LayoutMetrics &)layoutMetrics
+           oldLayoutMetrics:(const LayoutMetrics &)oldLayoutMetrics {
+  [super updateLayoutMetrics:layoutMetrics oldLayoutMetrics:oldLayoutMetrics];
+  // React lays the view out at the origin of the layer; re-apply the projected position on top.
+  if (_placed) {
+    [self placeAtPoint:_point visible:_visible];
+  } else {
+    self.hidden = YES;
+  }
+}
+
+- (void)placeAtPoint:(CGPoint)point visible:(BOOL)visible {
+  _point = point;
+  _visible = visible;
+  _placed = YES;
+  self.hidden = !visible;
+  if (!visible) {
+    return;
+  }
+  CGSize size = self.bounds.size;
+  self.center = CGPointMake(point.x + (0.5 - _anchorX) * size.width,
+                            point.y + (0.5 - _anchorY) * size.height);
+}
+
++ (ComponentDescriptorProvider)componentDescriptorProvider {
+  return concreteComponentDescriptorProvider<NavAnchorViewComponentDescriptor>();
+}
+
+// Required method from RCTNavAnchorViewViewProtocol
+Class<RCTNavAnchorViewViewProtocol> NavAnchorViewCls(void) { return NavAnchorView.class; }
+
+@end
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavAttributeIndex_h
+#define NavAttributeIndex_h
+
+#import <Foundation/Foundation.h>
+#import "NavStyleExpression.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Secondary indexes over the attribute records of overlays. Every attribute key has a set of the
+ * overlays that have it, whatever the value, a hash index from number and string values to overlay
+ * ids, and the distinct numbers and strings of the key in sorted order for range lookups. All are
+ * updated incrementally as records change.
+ */
+@interface NavAttributeIndex : NSObject
+
+/// Replaces the indexed record of `overlayId`. Pass nil to remove the overlay.
+- (void)updateOverlayId:(NSString *)overlayId
+         fromAttributes:(nullable NSDictionary<NSString *, id> *)previous
+           toAttributes:(nullable NSDictionary<NSString *, id> *)attributes;
+
+- (void)removeAllOverlays;
+
+/**
+ * Returns the ids that may satisfy `predicate`, resolved through the indexes, or nil if the
+ * predicate cannot narrow the overlays down and every overlay has to be evaluated. Equality,
+ * comparisons against literals, "has", "all" and "any" of such terms are resolved; the candidates
+ * still need to be checked against the predicate.
+ */
+- (nullable NSSet<NSString *> *)candidatesForPredicate:(NavStyleExpression *)predicate;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavAttributeIndex_h */
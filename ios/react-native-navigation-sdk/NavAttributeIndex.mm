@@ -0,0 +1,276 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavAttributeIndex.h"
+
+static BOOL IsIndexable(id value) {
+  return [value isKindOfClass:[NSNumber class]] || [value isKindOfClass:[NSString class]];
+}
+
+// Returns the attribute key of a ["get", key] expression, or nil.
+static NSString *GetKey(id json) {
+  if (![json isKindOfClass:[NSArray class]] || [json count] != 2 ||
+      ![[json firstObject] isEqual:@"get"] || ![json[1] isKindOfClass:[NSString class]]) {
+    return nil;
+  }
+  return json[1];
+}
+
+// The comparison that holds with its operands swapped, e.g. 3 < x is x > 3.
+static NSString *FlippedComparison(NSString *op) {
+  static NSDictionary<NSString *, NSString *> *flipped;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    flipped = @{@"==" : @"==", @"<" : @">", @"<=" : @">=", @">" : @"<", @">=" : @"<="};
+  });
+  return flipped[op];
+}
+
+@implementation NavAttributeIndex {
+  // key -> ids of the overlays that have attribute `key`, whatever its value.
+  NSMutableDictionary<NSString *, NSMutableSet<NSString *> *> *_presence;
+  // key -> value -> ids of the overlays whose attribute `key` equals `value`.
+  NSMutableDictionary<NSString *, NSMutableDictionary<id, NSMutableSet<NSString *> *> *> *_buckets;
+  // key -> distinct numeric values in ascending order, kept sorted as values come and go.
+  NSMutableDictionary<NSString *, NSMutableArray<NSNumber *> *> *_sortedNumbers;
+  // key -> distinct string values in ascending order, kept sorted as values come and go.
+  NSMutableDictionary<NSString *, NSMutableArray<NSString *> *> *_sortedStrings;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _presence = [NSMutableDictionary dictionary];
+    _buckets = [NSMutableDictionary dictionary];
+    _sortedNumbers = [NSMutableDictionary dictionary];
+    _sortedStrings = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
+- (void)updateOverlayId:(NSString *)overlayId
+         fromAttributes:(NSDictionary<NSString *, id> *)previous
+           toAttributes:(NSDictionary<NSString *, id> *)attributes {
+  [previous enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+    id current = attributes[key];
+    if (current == nil) {
+      [self removePresenceOfOverlayId:overlayId key:key];
+    }
+    if (IsIndexable(value) && ![current isEqual:value]) {
+      [self removeOverlayId:overlayId key:key value:value];
+    }
+  }];
+  [attributes enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+    id old = previous[key];
+    if (old == nil) {
+      [self addPresenceOfOverlayId:overlayId key:key];
+    }
+    if (IsIndexable(value) && ![old isEqual:value]) {
+      [self addOverlayId:overlayId key:key value:value];
+    }
+  }];
+}
+
+- (void)removeAllOverlays {
+  [_presence removeAllObjects];
+  [_buckets removeAllObjects];
+  [_sortedNumbers removeAllObjects];
+  [_sortedStrings removeAllObjects];
+}
+
+- (void)addPresenceOfOverlayId:(NSString *)overlayId key:(NSString *)key {
+  NSMutableSet<NSString *> *ids = _presence[key];
+  if (ids == nil) {
+    ids = [NSMutableSet set];
+    _presence[key] = ids;
+  }
+  [ids addObject:overlayId];
+}
+
+- (void)removePresenceOfOverlayId:(NSString *)overlayId key:(NSString *)key {
+  NSMutableSet<NSString *> *ids = _presence[key];
+  [ids removeObject:overlayId];
+  if (ids != nil && ids.count == 0) {
+    [_presence removeObjectForKey:key];
+  }
+}
+
+- (void)addOverlayId:(NSString *)overlayId key:(NSString *)key value:(id)value {
+  NSMutableDictionary<id, NSMutableSet<NSString *> *> *values = _buckets[key];
+  if (values == nil) {
+    values = [NSMutableDictionary dictionary];
+    _buckets[key] = values;
+  }
+  NSMutableSet<NSString *> *ids = values[value];
+  if (ids == nil) {
+    ids = [NSMutableSet set];
+    values[value] = ids;
+    NSMutableArray *sorted = [self sortedValuesForKey:key like:value create:YES];
+    [sorted insertObject:value
+                 atIndex:[self indexOfValue:value
+                                   inSorted:sorted
+                                    options:NSBinarySearchingInsertionIndex]];
+  }
+  [ids addObject:overlayId];
+}
+
+- (void)removeOverlayId:(NSString *)overlayId key:(NSString *)key value:(id)value {
+  NSMutableDictionary<id, NSMutableSet<NSString *> *> *values = _buckets[key];
+  NSMutableSet<NSString *> *ids = values[value];
+  [ids removeObject:overlayId];
+  if (ids != nil && ids.count == 0) {
+    [values removeObjectForKey:value];
+    if (values.count == 0) {
+      [_buckets removeObjectForKey:key];
+    }
+    NSMutableArray *sorted = [self sortedValuesForKey:key like:value create:NO];
+    NSUInteger index = [self indexOfValue:value inSorted:sorted options:0];
+    if (index != NSNotFound) {
+      [sorted removeObjectAtIndex:index];
+    }
+    if (sorted.count == 0) {
+      NSMutableDictionary *lists =
+          [value isKindOfClass:[NSNumber class]] ? _sortedNumbers : _sortedStrings;
+      [lists removeObjectForKey:key];
+    }
+  }
+}
+
+// Sorted distinct values of `key` of the same kind as `value`, numbers or strings.
+- (NSMutableArray *)sortedValuesForKey:(NSString *)key like:(id)value create:(BOOL)create {
+  NSMutableDictionary *lists =
+      [value isKindOfClass:[NSNumber class]] ? _sortedNumbers : _sortedStrings;
+  NSMutableArray *sorted = lists[key];
+  if (sorted == nil && create) {
+    sorted = [NSMutableArray array];
+    lists[key] = sorted;
+  }
+  return sorted;
+}
+
+- (NSUInteger)indexOfValue:(id)value
+                  inSorted:(NSArray *)sorted
+                   options:(NSBinarySearchingOptions)options {
+  return [sorted indexOfObject:value
+                 inSortedRange:NSMakeRange(0, sorted.count)
+                       options:options
+               usingComparator:^NSComparisonResult(id a, id b) {
+                 return [a compare:b];
+               }];
+}
+
+- (NSSet<NSString *> *)candidatesForPredicate:(NavStyleExpression *)predicate {
+  return [self candidatesForJSON:predicate.source];
+}
+
+- (NSSet<NSString *> *)candidatesForJSON:(id)json {
+  if (![json isKindOfClass:[NSArray class]] || [json count] == 0) {
+    return nil;
+  }
+  NSArray *expression = json;
+  NSString *op = expression.firstObject;
+  NSArray *operands = [expression subarrayWithRange:NSMakeRange(1, expression.count - 1)];
+
+  if ([op isEqual:@"all"]) {
+    // Terms that cannot be resolved only widen the candidates, which are checked anyway.
+    NSMutableSet<NSString *> *result = nil;
+    for (id operand in operands) {
+      NSSet<NSString *> *candidates = [self candidatesForJSON:operand];
+      if (candidates == nil) {
+        continue;
+      }
+      if (result == nil) {
+        result = [candidates mutableCopy];
+      } else {
+        [result intersectSet:candidates];
+      }
+    }
+    return result;
+  }
+
+  if ([op isEqual:@"any"]) {
+    NSMutableSet<NSString *> *result = [NSMutableSet set];
+    for (id operand in operands) {
+      NSSet<NSString *> *candidates = [self candidatesForJSON:operand];
+      if (candidates == nil) {
+        return nil;
+      }
+      [result unionSet:candidates];
+    }
+    return result;
+  }
+
+  if ([op isEqual:@"has"]) {
+    NSString *key = operands.count == 1 ? operands[0] : nil;
+    if (![key isKindOfClass:[NSString class]]) {
+      return nil;
+    }
+    return [_presence[key] copy] ?: [NSSet set];
+  }
+
+  if (operands.count != 2 || FlippedComparison(op) == nil) {
+    return nil;
+  }
+  NSString *key = GetKey(operands[0]);
+  id literal = operands[1];
+  if (key == nil) {
+    key = GetKey(operands[1]);
+    literal = operands[0];
+    op = FlippedComparison(op);
+  }
+  if (key == nil || !IsIndexable(literal)) {
+    return nil;
+  }
+
+  NSDictionary<id, NSMutableSet<NSString *> *> *values = _buckets[key];
+  if ([op isEqual:@"=="]) {
+    return [values[literal] copy] ?: [NSSet set];
+  }
+
+  // Numbers and strings compare within their own kind only.
+  NSArray *sorted = [literal isKindOfClass:[NSNumber class]] ? _sortedNumbers[key]
+                                                             : _sortedStrings[key];
+  NSRange range = [self rangeOfSortedValues:sorted comparison:op literal:literal];
+  NSMutableSet<NSString *> *result = [NSMutableSet set];
+  for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+    [result unionSet:values[sorted[i]]];
+  }
+  return result;
+}
+
+// Range of the values in `sorted` for which `value op literal` holds.
+- (NSRange)rangeOfSortedValues:(NSArray *)sorted comparison:(NSString *)op literal:(id)literal {
+  NSUInteger lower =
+      [self indexOfValue:literal
+                inSorted:sorted
+                 options:NSBinarySearchingInsertionIndex | NSBinarySearchingFirstEqual];
+  NSUInteger upper =
+      [self indexOfValue:literal
+                inSorted:sorted
+                 options:NSBinarySearchingInsertionIndex | NSBinarySearchingLastEqual];
+  if ([op isEqual:@"<"]) {
+    return NSMakeRange(0, lower);
+  }
+  if ([op isEqual:@"<="]) {
+    return NSMakeRange(0, upper);
+  }
+  if ([op isEqual:@">"]) {
+    return NSMakeRange(upper, sorted.count - upper);
+  }
+  return NSMakeRange(lower, sorted.count - lower);
+}
+
+@end
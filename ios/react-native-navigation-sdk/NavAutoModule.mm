@@ -432,6 +432,41 @@ static NavAutoModuleReadyCallback _navAutoModuleReadyCallback;
   }
 }
 
+- (void)fitCameraToOverlays:(FitCameraOptionsSpec &)options
+                    resolve:(RCTPromiseResolveBlock)resolve
+                     reject:(RCTPromiseRejectBlock)reject {
+  if (!_viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found", nil);
+    return;
+  }
+
+  NSArray<NSString *> *ids = nil;
+  if (options.ids().has_value()) {
+    facebook::react::LazyVector<NSString *> idVector = options.ids().value();
+    NSMutableArray<NSString *> *idList = [NSMutableArray arrayWithCapacity:idVector.size()];
+    for (size_t i = 0; i < idVector.size(); i++) {
+      [idList addObject:idVector[i]];
+    }
+    ids = idList;
+  }
+  NSString *group = [options.group() copy];
+  UIEdgeInsets padding = UIEdgeInsetsZero;
+  if (options.padding().has_value()) {
+    auto insets = options.padding().value();
+    padding = UIEdgeInsetsMake(insets.top(), insets.left(), insets.bottom(), insets.right());
+  }
+  NSNumber *maxZoom = options.maxZoom().has_value() ? @(options.maxZoom().value()) : nil;
+  NSNumber *bearing = options.bearing().has_value() ? @(options.bearing().value()) : nil;
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    resolve(@([self->_viewController fitCameraToOverlaysWithIds:ids
+                                                          group:group
+                                                        padding:padding
+                                                        maxZoom:maxZoom
+                                                        bearing:bearing]));
+  });
+}
+
 - (void)removeMarker:(NSString *)id
              resolve:(RCTPromiseResolveBlock)resolve
               reject:(RCTPromiseRejectBlock)reject {
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import <QuartzCore/QuartzCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Frame pacing summary for the frames presented since the previous window was taken.
+ */
+typedef struct {
+  NSUInteger frameCount;
+  double durationMs;
+  double averageFrameMs;
+  double maxFrameMs;
+  /// Frames that took longer than 1.5 target frame intervals.
+  NSUInteger hitchCount;
+  /// Fraction of wall time the main run loop was busy, between 0 and 1.
+  double mainThreadLoad;
+} NavFrameWindow;
+
+/// Called on the main thread for every presented frame, with its duration and timestamp.
+typedef void (^NavFrameHandler)(double frameMs, CFTimeInterval timestamp);
+
+/**
+ * Samples frame pacing with a CADisplayLink and main-thread load with a run loop observer.
+ * A sampler is shared by the clients of one view: calls to start and stop are balanced, and
+ * sampling runs while at least one client has started it, so idle views pay nothing.
+ */
+@interface NavFrameSampler : NSObject
+
+/// Target frame interval in milliseconds, as scheduled by the display link.
+@property(nonatomic, readonly) double targetFrameMs;
+@property(nonatomic, readonly, getter=isRunning) BOOL running;
+
+/// Optional per-frame handler, used for cumulative statistics.
+@property(nonatomic, copy, nullable) NavFrameHandler frameHandler;
+
+- (void)start;
+- (void)stop;
+
+/// Returns the summary of the current window and starts a new one.
+- (NavFrameWindow)takeWindow;
+
+@end
+
+NS_ASSUME_NONNULL_END
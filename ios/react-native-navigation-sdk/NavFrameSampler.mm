@@ -0,0 +1,173 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavFrameSampler.h"
+#import <UIKit/UIKit.h>
+
+static const double kHitchThreshold = 1.5;
+
+// Forwards display link callbacks without retaining the sampler.
+@interface NavFrameSamplerDisplayLinkTarget : NSObject
+@property(nonatomic, weak) NavFrameSampler *sampler;
+@end
+
+@interface NavFrameSampler ()
+- (void)onDisplayLink:(CADisplayLink *)displayLink;
+@end
+
+@implementation NavFrameSamplerDisplayLinkTarget
+- (void)onDisplayLink:(CADisplayLink *)displayLink {
+  [self.sampler onDisplayLink:displayLink];
+}
+@end
+
+@implementation NavFrameSampler {
+  CADisplayLink *_displayLink;
+  CFRunLoopObserverRef _runLoopObserver;
+  CFTimeInterval _lastTimestamp;
+  NSUInteger _startCount;
+
+  // Current window.
+  CFTimeInterval _windowStart;
+  NSUInteger _frameCount;
+  double _frameSumMs;
+  double _maxFrameMs;
+  NSUInteger _hitchCount;
+  CFTimeInterval _busySince;
+  double _busyMs;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    // Replaced by the scheduled interval from the first frame on.
+    NSInteger maxFps = [UIScreen mainScreen].maximumFramesPerSecond;
+    _targetFrameMs = 1000.0 / (double)(maxFps > 0 ? maxFps : 60);
+  }
+  return self;
+}
+
+- (void)dealloc {
+  _startCount = 1;
+  [self stop];
+}
+
+- (void)start {
+  if (_startCount++ > 0) {
+    return;
+  }
+  _running = YES;
+  _lastTimestamp = 0;
+  [self resetWindow];
+
+  NavFrameSamplerDisplayLinkTarget *target = [[NavFrameSamplerDisplayLinkTarget alloc] init];
+  target.sampler = self;
+  _displayLink = [CADisplayLink displayLinkWithTarget:target selector:@selector(onDisplayLink:)];
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+
+  // The main run loop is busy between waking up and going back to sleep.
+  __weak NavFrameSampler *weakSelf = self;
+  _runLoopObserver = CFRunLoopObserverCreateWithHandler(
+      kCFAllocatorDefault, kCFRunLoopAfterWaiting | kCFRunLoopBeforeWaiting, YES, 0,
+      ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+        NavFrameSampler *strongSelf = weakSelf;
+        if (strongSelf == nil) {
+          return;
+        }
+        CFTimeInterval now = CACurrentMediaTime();
+        if (activity == kCFRunLoopAfterWaiting) {
+          strongSelf->_busySince = now;
+        } else if (strongSelf->_busySince > 0) {
+          strongSelf->_busyMs += (now - strongSelf->_busySince) * 1000.0;
+          strongSelf->_busySince = 0;
+        }
+      });
+  CFRunLoopAddObserver(CFRunLoopGetMain(), _runLoopObserver, kCFRunLoopCommonModes);
+}
+
+- (void)stop {
+  if (_startCount == 0 || --_startCount > 0) {
+    return;
+  }
+  _running = NO;
+  [_displayLink invalidate];
+  _displayLink = nil;
+  if (_runLoopObserver) {
+    CFRunLoopRemoveObserver(CFRunLoopGetMain(), _runLoopObserver, kCFRunLoopCommonModes);
+    CFRelease(_runLoopObserver);
+    _runLoopObserver = NULL;
+  }
+}
+
+- (void)onDisplayLink:(CADisplayLink *)displayLink {
+  CFTimeInterval timestamp = displayLink.timestamp;
+  // The link may run below the screen maximum (ProMotion, Low Power Mode), so the frame budget
+  // is the interval it is actually scheduled at.
+  double scheduledMs = (displayLink.targetTimestamp - timestamp) * 1000.0;
+  if (scheduledMs > 0) {
+    _targetFrameMs = scheduledMs;
+  }
+  if (_lastTimestamp > 0) {
+    double frameMs = (timestamp - _lastTimestamp) * 1000.0;
+    [self recordFrame:frameMs];
+    if (_frameHandler) {
+      _frameHandler(frameMs, timestamp);
+    }
+  }
+  _lastTimestamp = timestamp;
+}
+
+- (void)recordFrame:(double)frameMs {
+  _frameCount++;
+  _frameSumMs += frameMs;
+  _maxFrameMs = MAX(_maxFrameMs, frameMs);
+  if (frameMs > _targetFrameMs * kHitchThreshold) {
+    _hitchCount++;
+  }
+}
+
+- (NavFrameWindow)takeWindow {
+  CFTimeInterval now = CACurrentMediaTime();
+  double durationMs = (now - _windowStart) * 1000.0;
+  double busyMs = _busyMs;
+  if (_busySince > 0) {
+    // Account for the busy period in progress, i.e. the current call.
+    busyMs += (now - _busySince) * 1000.0;
+    _busySince = now;
+  }
+
+  NavFrameWindow window;
+  window.frameCount = _frameCount;
+  window.durationMs = durationMs;
+  window.averageFrameMs = _frameCount > 0 ? _frameSumMs / _frameCount : 0;
+  window.maxFrameMs = _maxFrameMs;
+  window.hitchCount = _hitchCount;
+  window.mainThreadLoad = durationMs > 0 ? MIN(1.0, busyMs / durationMs) : 0;
+
+  [self resetWindow];
+  return window;
+}
+
+- (void)resetWindow {
+  _windowStart = CACurrentMediaTime();
+  _frameCount = 0;
+  _frameSumMs = 0;
+  _maxFrameMs = 0;
+  _hitchCount = 0;
+  _busyMs = 0;
+}
+
+@end
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavGeometry_h
+#define NavGeometry_h
+
+// Plain geometry types shared by the portable C++ cores.
+
+#include <vector>
+
+namespace navsdk {
+
+struct GeoPoint {
+  double lat;
+  double lng;
+};
+
+struct GeoPolygon {
+  std::vector<GeoPoint> outer;
+  std::vector<std::vector<GeoPoint>> holes;
+};
+
+}  // namespace navsdk
+
+#endif /* NavGeometry_h */
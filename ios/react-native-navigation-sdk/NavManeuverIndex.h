@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavManeuverIndex_h
+#define NavManeuverIndex_h
+
+#import <Foundation/Foundation.h>
+#import <GoogleNavigation/GoogleNavigation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Places the steps of the current route on its geometry, so that maneuver markers can be drawn
+ * without processing the route in JS. A step's maneuver is located by its distance along the route,
+ * taken from the first nav info that reports it after a route change and kept until the next one.
+ */
+@interface NavManeuverIndex : NSObject
+
+/// The points of the last update, packed as [stepNumber, lat, lng, legIndex, firstVertex,
+/// lastVertex, ...], where the vertex range of each step is within the leg of its maneuver.
+@property(nonatomic, readonly) NSArray<NSNumber *> *maneuverPoints;
+
+/// Indexes the geometry of `legs` and forgets the step positions of the previous route.
+- (void)resetWithLegs:(nullable NSArray<GMSRouteLeg *> *)legs;
+
+/// Locates the current and remaining steps of `navInfo` and returns the packed maneuver points.
+- (NSArray<NSNumber *> *)updateWithNavInfo:(GMSNavigationNavInfo *)navInfo;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavManeuverIndex_h */
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavManeuverIndex.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Nav info distances are rounded to whole meters, so a maneuver this close to a vertex of the route
+// is placed on the vertex rather than interpolated next to it.
+const double kVertexSnapMeters = 10;
+
+// Number of values packed per step.
+const NSUInteger kValuesPerStep = 6;
+
+struct RouteVertex {
+  CLLocationCoordinate2D coordinate;
+  // Distance along the whole route, from the first vertex of the first leg.
+  double meters;
+  int leg;
+  int index;
+};
+
+}  // namespace
+
+@implementation NavManeuverIndex {
+  std::vector<RouteVertex> _vertices;
+  std::unordered_map<NSInteger, double> _stepMeters;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _maneuverPoints = @[];
+  }
+  return self;
+}
+
+- (void)resetWithLegs:(NSArray<GMSRouteLeg *> *)legs {
+  _vertices.clear();
+  _stepMeters.clear();
+  _maneuverPoints = @[];
+
+  double meters = 0;
+  int legIndex = 0;
+  for (GMSRouteLeg *leg in legs) {
+    GMSPath *path = leg.path;
+    NSUInteger count = path.count;
+    for (NSUInteger i = 0; i < count; i++) {
+      CLLocationCoordinate2D coordinate = [path coordinateAtIndex:i];
+      if (!_vertices.empty()) {
+        meters += GMSGeometryDistance(_vertices.back().coordinate, coordinate);
+      }
+      _vertices.push_back({coordinate, meters, legIndex, static_cast<int>(i)});
+    }
+    legIndex++;
+  }
+}
+
+- (NSArray<NSNumber *> *)updateWithNavInfo:(GMSNavigationNavInfo *)navInfo {
+  GMSNavigationStepInfo *currentStep = navInfo.currentStep;
+  if (_vertices.empty() || currentStep == nil) {
+    _maneuverPoints = @[];
+    return _maneuverPoints;
+  }
+
+  // Distance travelled along the route; the route geometry is assumed to be as long as the driving
+  // distance the navigator reports for it.
+  double progress =
+      std::max(0.0, _vertices.back().meters - navInfo.distanceToFinalDestinationMeters);
+
+  NSMutableArray<NSNumber *> *points =
+      [NSMutableArray arrayWithCapacity:(navInfo.remainingSteps.count + 1) * kValuesPerStep];
+  double meters = [self metersOfStep:currentStep
+                           ifUnknown:progress + navInfo.distanceToCurrentStepMeters];
+  [self appendStep:currentStep atMeters:meters toPoints:points];
+  for (GMSNavigationStepInfo *step in navInfo.remainingSteps) {
+    meters = [self metersOfStep:step ifUnknown:meters + step.distanceFromPrevStepMeters];
+    [self appendStep:step atMeters:meters toPoints:points];
+  }
+
+  _maneuverPoints = points;
+  return points;
+}
+
+#pragma mark - Private
+
+// Returns the remembered position of `step`, or remembers `meters` for it. Keeping the first
+// position stops maneuver points from moving as the rounded distances of later nav infos change.
+- (double)metersOfStep:(GMSNavigationStepInfo *)step ifUnknown:(double)meters {
+  auto found = _stepMeters.find(step.stepNumber);
+  if (found != _stepMeters.end()) {
+    return found->second;
+  }
+  meters = std::min(meters, _vertices.back().meters);
+  _stepMeters.emplace(step.stepNumber, meters);
+  return meters;
+}
+
+- (void)appendStep:(GMSNavigationStepInfo *)step
+          atMeters:(double)meters
+          toPoints:(NSMutableArray<NSNumber *> *)points {
+  auto byMeters = [](const RouteVertex &vertex, double value) { return vertex.meters < value; };
+  auto byValue = [](double value, const RouteVertex &vertex) { return value < vertex.meters; };
+
+  // The maneuver ends its step at the first vertex at or after it.
+  size_t last = std::lower_bound(_vertices.begin(), _vertices.end(), meters, byMeters) -
+                _vertices.begin();
+  last = std::min(last, _vertices.size() - 1);
+  CLLocationCoordinate2D coordinate = _vertices[last].coordinate;
+  if (last > 0 && _vertices[last].meters - meters > kVertexSnapMeters) {
+    const RouteVertex &from = _vertices[last - 1];
+    const RouteVertex &to = _vertices[last];
+    if (meters - from.meters <= kVertexSnapMeters) {
+      last--;
+      coordinate = from.coordinate;
+    } else {
+      coordinate = GMSGeometryInterpolate(from.coordinate, to.coordinate,
+                                          (meters - from.meters) / (to.meters - from.meters));
+    }
+  }
+
+  // The step starts at the last vertex at or before the previous maneuver, within the same leg.
+  double startMeters = meters - step.distanceFromPrevStepMeters;
+  size_t first = std::upper_bound(_vertices.begin(), _vertices.end(), startMeters, byValue) -
+                 _vertices.begin();
+  first = std::min(first > 0 ? first - 1 : 0, last);
+  const RouteVertex &end = _vertices[last];
+  int firstIndex = _vertices[first].leg == end.leg ? _vertices[first].index : 0;
+
+  [points addObject:@(step.stepNumber)];
+  [points addObject:@(coordinate.latitude)];
+  [points addObject:@(coordinate.longitude)];
+  [points addObject:@(end.leg)];
+  [points addObject:@(firstIndex)];
+  [points addObject:@(end.index)];
+}
+
+@end
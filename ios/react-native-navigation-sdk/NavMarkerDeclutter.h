@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavMarkerDeclutter_h
+#define NavMarkerDeclutter_h
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+#import "NavStyleExpression.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Screen-space collision resolver for markers. Each marker occupies a box of `boxSize` around its
+ * projected position; boxes are placed in priority order and a marker whose box overlaps an
+ * already placed one is hidden. Placed boxes are bucketed in a uniform grid so a pass stays linear
+ * in the number of on-screen markers.
+ */
+@interface NavMarkerDeclutter : NSObject
+
+/**
+ * Parses options of the form {priority?, boxSize?, anchor?, padding?, animationIntervalMs?}, or
+ * returns nil and sets `error` describing the first invalid option.
+ */
++ (nullable instancetype)declutterWithJSON:(NSDictionary<NSString *, id> *)json
+                                     error:(NSError **)error;
+
+/// Evaluated against marker attributes; higher values win. Markers fall back to their zIndex.
+@property(nonatomic, readonly, nullable) NavStyleExpression *priority;
+/// Collision box of a marker, in points.
+@property(nonatomic, readonly) CGSize boxSize;
+/// Position of the marker coordinate within its box, as a fraction of the box size.
+@property(nonatomic, readonly) CGPoint anchor;
+/// Extra spacing kept between boxes, in points.
+@property(nonatomic, readonly) CGFloat padding;
+/// Minimum time between passes while the camera is moving. Zero disables those passes.
+@property(nonatomic, readonly) NSTimeInterval animationInterval;
+
+/// Returns the collision box of a marker projected at `point`.
+- (CGRect)boxAtPoint:(CGPoint)point;
+
+/**
+ * Resolves collisions between `count` boxes. `order` lists box indices from the highest priority
+ * to the lowest; on return `placed[i]` tells whether box `i` is shown.
+ */
+- (void)resolveBoxes:(const CGRect *)boxes
+               order:(const NSUInteger *)order
+               count:(NSUInteger)count
+              placed:(BOOL *)placed;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavMarkerDeclutter_h */
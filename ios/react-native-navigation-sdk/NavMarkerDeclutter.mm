@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavMarkerDeclutter.h"
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+// Size of the default marker pin, in points.
+static const CGFloat kDefaultBoxWidth = 26;
+static const CGFloat kDefaultBoxHeight = 40;
+static const NSTimeInterval kDefaultAnimationInterval = 0.25;
+
+@implementation NavMarkerDeclutter
+
++ (instancetype)declutterWithJSON:(NSDictionary<NSString *, id> *)json error:(NSError **)error {
+  NavMarkerDeclutter *declutter = [[NavMarkerDeclutter alloc] init];
+  declutter->_boxSize = CGSizeMake(kDefaultBoxWidth, kDefaultBoxHeight);
+  declutter->_anchor = CGPointMake(0.5, 1.0);
+  declutter->_animationInterval = kDefaultAnimationInterval;
+
+  NSString *message = nil;
+  for (NSString *option in json) {
+    id value = json[option];
+    if ([option isEqualToString:@"priority"]) {
+      NSError *compileError = nil;
+      declutter->_priority = [NavStyleExpression expressionWithJSON:value error:&compileError];
+      if (declutter->_priority == nil) {
+        message = [NSString stringWithFormat:@"priority: %@", compileError.localizedDescription];
+        break;
+      }
+    } else if ([option isEqualToString:@"boxSize"]) {
+      NSNumber *width = [value isKindOfClass:[NSDictionary class]] ? value[@"width"] : nil;
+      NSNumber *height = [value isKindOfClass:[NSDictionary class]] ? value[@"height"] : nil;
+      if (![width isKindOfClass:[NSNumber class]] || ![height isKindOfClass:[NSNumber class]] ||
+          width.doubleValue <= 0 || height.doubleValue <= 0) {
+        message = @"boxSize must have a positive width and height";
+        break;
+      }
+      declutter->_boxSize = CGSizeMake(width.doubleValue, height.doubleValue);
+    } else if ([option isEqualToString:@"anchor"]) {
+      NSNumber *x = [value isKindOfClass:[NSDictionary class]] ? value[@"x"] : nil;
+      NSNumber *y = [value isKindOfClass:[NSDictionary class]] ? value[@"y"] : nil;
+      if (![x isKindOfClass:[NSNumber class]] || ![y isKindOfClass:[NSNumber class]]) {
+        message = @"anchor must have numeric x and y";
+        break;
+      }
+      declutter->_anchor = CGPointMake(x.doubleValue, y.doubleValue);
+    } else if ([option isEqualToString:@"padding"]) {
+      if (![value isKindOfClass:[NSNumber class]] || [value doubleValue] < 0) {
+        message = @"padding must be a non-negative number";
+        break;
+      }
+      declutter->_padding = [value doubleValue];
+    } else if ([option isEqualToString:@"animationIntervalMs"]) {
+      if (![value isKindOfClass:[NSNumber class]] || [value doubleValue] < 0) {
+        message = @"animationIntervalMs must be a non-negative number";
+        break;
+      }
+      declutter->_animationInterval = [value doubleValue] / 1000.0;
+    } else {
+      message = [NSString stringWithFormat:@"Unknown declutter option '%@'", option];
+      break;
+    }
+  }
+
+  if (message != nil) {
+    if (error != NULL) {
+      *error = [NSError errorWithDomain:@"NavMarkerDeclutter"
+                                   code:0
+                               userInfo:@{NSLocalizedDescriptionKey : message}];
+    }
+    return nil;
+  }
+  return declutter;
+}
+
+- (CGRect)boxAtPoint:(CGPoint)point {
+  // Half the padding on every side keeps `padding` between two neighbouring boxes.
+  CGFloat inset = -_padding / 2;
+  return CGRectInset(CGRectMake(point.x - _anchor.x * _boxSize.width,
+                                point.y - _anchor.y * _boxSize.height, _boxSize.width,
+                                _boxSize.height),
+                     inset, inset);
+}
+
+- (void)resolveBoxes:(const CGRect *)boxes
+               order:(const NSUInteger *)order
+               count:(NSUInteger)count
+              placed:(BOOL *)placed {
+  // Cells as large as a box, so each box touches at most four of them.
+  const double cellSize = MAX(_boxSize.width, _boxSize.height) + _padding;
+  auto cellKey = [](int64_t column, int64_t row) -> uint64_t {
+    return (static_cast<uint64_t>(column) << 32) ^ static_cast<uint32_t>(row);
+  };
+  std::unordered_map<uint64_t, std::vector<NSUInteger>> grid;
+  grid.reserve(count);
+
+  for (NSUInteger i = 0; i < count; i++) {
+    NSUInteger index = order[i];
+    const CGRect box = boxes[index];
+    const int64_t minColumn = static_cast<int64_t>(std::floor(CGRectGetMinX(box) / cellSize));
+    const int64_t maxColumn = static_cast<int64_t>(std::floor(CGRectGetMaxX(box) / cellSize));
+    const int64_t minRow = static_cast<int64_t>(std::floor(CGRectGetMinY(box) / cellSize));
+    const int64_t maxRow = static_cast<int64_t>(std::floor(CGRectGetMaxY(box) / cellSize));
+
+    BOOL collides = NO;
+    for (int64_t column = minColumn; column <= maxColumn && !collides; column++) {
+      for (int64_t row = minRow; row <= maxRow && !collides; row++) {
+        auto cell = grid.find(cellKey(column, row));
+        if (cell == grid.end()) {
+          continue;
+        }
+        for (NSUInteger other : cell->second) {
+          if (CGRectIntersectsRect(box, boxes[other])) {
+            collides = YES;
+            break;
+          }
+        }
+      }
+    }
+
+    placed[index] = !collides;
+    if (collides) {
+      continue;
+    }
+    for (int64_t column = minColumn; column <= maxColumn; column++) {
+      for (int64_t row = minRow; row <= maxRow; row++) {
+        grid[cellKey(column, row)].push_back(index);
+      }
+    }
+  }
+}
+
+@end
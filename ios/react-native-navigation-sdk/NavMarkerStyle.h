@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavMarkerStyle_h
+#define NavMarkerStyle_h
+
+#import <Foundation/Foundation.h>
+#import "NavStyleExpression.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Data-driven marker style: one compiled expression per styled property, evaluated against the
+ * attribute record of each marker. Properties without an expression keep their option values.
+ */
+@interface NavMarkerStyle : NSObject
+
+/**
+ * Compiles a style of the form {filter?, alpha?, zIndex?, rotation?, color?}, or returns nil and
+ * sets `error` describing the first invalid expression.
+ */
++ (nullable instancetype)styleWithJSON:(NSDictionary<NSString *, id> *)json
+                                 error:(NSError **)error;
+
+/// Markers for which the filter evaluates to false are hidden.
+@property(nonatomic, readonly, nullable) NavStyleExpression *filter;
+@property(nonatomic, readonly, nullable) NavStyleExpression *alpha;
+@property(nonatomic, readonly, nullable) NavStyleExpression *zIndex;
+@property(nonatomic, readonly, nullable) NavStyleExpression *rotation;
+/// Tints the default marker icon. Evaluates to an AARRGGBB number or a "#RRGGBB[AA]" string.
+@property(nonatomic, readonly, nullable) NavStyleExpression *color;
+
+/// Whether any property depends on the camera zoom.
+@property(nonatomic, readonly) BOOL usesZoom;
+
+/// Whether any property reads the attribute `key`.
+- (BOOL)dependsOnAttribute:(NSString *)key;
+
+/// Converts an evaluated color to an AARRGGBB number, or nil if it is not a color.
++ (nullable NSNumber *)colorIntFromValue:(nullable id)value;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavMarkerStyle_h */
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavMarkerStyle.h"
+
+@implementation NavMarkerStyle {
+  NSSet<NSString *> *_attributeKeys;
+}
+
++ (instancetype)styleWithJSON:(NSDictionary<NSString *, id> *)json error:(NSError **)error {
+  NavMarkerStyle *style = [[NavMarkerStyle alloc] init];
+  NSMutableSet<NSString *> *keys = [NSMutableSet set];
+  BOOL usesZoom = NO;
+
+  for (NSString *property in json) {
+    NSError *compileError = nil;
+    NavStyleExpression *expression = [NavStyleExpression expressionWithJSON:json[property]
+                                                                      error:&compileError];
+    if (expression == nil) {
+      if (error != NULL) {
+        *error = [NSError
+            errorWithDomain:compileError.domain
+                       code:compileError.code
+                   userInfo:@{
+                     NSLocalizedDescriptionKey :
+                         [NSString stringWithFormat:@"%@: %@", property,
+                                                    compileError.localizedDescription]
+                   }];
+      }
+      return nil;
+    }
+
+    if ([property isEqualToString:@"filter"]) {
+      style->_filter = expression;
+    } else if ([property isEqualToString:@"alpha"]) {
+      style->_alpha = expression;
+    } else if ([property isEqualToString:@"zIndex"]) {
+      style->_zIndex = expression;
+    } else if ([property isEqualToString:@"rotation"]) {
+      style->_rotation = expression;
+    } else if ([property isEqualToString:@"color"]) {
+      style->_color = expression;
+    } else {
+      if (error != NULL) {
+        *error = [NSError
+            errorWithDomain:@"NavMarkerStyle"
+                       code:0
+                   userInfo:@{
+                     NSLocalizedDescriptionKey :
+                         [NSString stringWithFormat:@"Unknown marker style property '%@'", property]
+                   }];
+      }
+      return nil;
+    }
+    [keys unionSet:expression.attributeKeys];
+    usesZoom = usesZoom || expression.usesZoom;
+  }
+
+  style->_attributeKeys = keys;
+  style->_usesZoom = usesZoom;
+  return style;
+}
+
+- (BOOL)dependsOnAttribute:(NSString *)key {
+  return [_attributeKeys containsObject:key];
+}
+
++ (NSNumber *)colorIntFromValue:(id)value {
+  if ([value isKindOfClass:[NSNumber class]]) {
+    return @([value unsignedIntValue]);
+  }
+  if (![value isKindOfClass:[NSString class]]) {
+    return nil;
+  }
+  NSString *string = value;
+  if (![string hasPrefix:@"#"] || (string.length != 7 && string.length != 9)) {
+    return nil;
+  }
+  unsigned int rgba = 0;
+  NSScanner *scanner = [NSScanner scannerWithString:[string substringFromIndex:1]];
+  if (![scanner scanHexInt:&rgba] || !scanner.isAtEnd) {
+    return nil;
+  }
+  // Reorder CSS #RRGGBBAA to AARRGGBB.
+  unsigned int argb =
+      string.length == 7 ? (0xFF000000 | rgba) : ((rgba & 0xFF) << 24) | (rgba >> 8);
+  return @(argb);
+}
+
+@end
@@ -30,6 +30,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 typedef void (^NavigationSessionReadyCallback)(void);
 typedef void (^NavigationSessionDisposedCallback)(void);
+/// Time and distance to the destination of each remaining route leg; empty without a route.
+typedef void (^NavigationLegTimesCallback)(NSArray<NSNumber *> *legSeconds,
+                                           NSArray<NSNumber *> *legMeters);
 
 @property BOOL enableUpdateInfo;
 
@@ -40,6 +43,8 @@ typedef void (^NavigationSessionDisposedCallback)(void);
 + (void)registerNavigationSessionReadyCallback:(NavigationSessionReadyCallback)callback;
 + (void)unregisterNavigationSessionDisposedCallback;
 + (void)registerNavigationSessionDisposedCallback:(NavigationSessionDisposedCallback)callback;
++ (void)unregisterLegTimesCallback;
++ (void)registerLegTimesCallback:(NavigationLegTimesCallback)callback;
 
 // Class method to access the singleton instance
 + (instancetype)sharedInstance;
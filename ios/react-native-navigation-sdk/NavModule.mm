@@ -15,10 +15,20 @@
  */
 
 #import "NavModule.h"
+#import <ReactCommon/RCTTurboModuleWithJSIBindings.h>
 #import "NavAutoModule.h"
+#import "NavManeuverIndex.h"
+#import "NavRouteDiff.h"
+#import "NavStateBuffer.h"
 #import "NavViewModule.h"
 #import "ObjectTranslationUtil.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "NavTimeWindowEvaluator.h"
+
 using namespace JS::NativeNavModule;
 
 static NSString *const kNoNavigatorErrorCode = @"NO_NAVIGATOR_ERROR_CODE";
@@ -26,17 +36,33 @@ static NSString *const kNoNavigatorErrorMessage =
     @"Make sure to initialize the navigator is ready before executing.";
 static NSString *const kNoDestinationsErrorCode = @"NO_DESTINATIONS";
 static NSString *const kNoDestinationsErrorMessage = @"Destinations not set";
+static NSString *const kInvalidWaypointsErrorCode = @"INVALID_WAYPOINTS";
+static NSString *const kInvalidTimeWindowsErrorCode = @"INVALID_TIME_WINDOWS";
+
+@interface NavModule () <RCTTurboModuleWithJSIBindings>
+@end
 
 @implementation NavModule {
   GMSNavigationSession *_session;
   NSMutableArray<GMSNavigationMutableWaypoint *> *_destinations;
   RCTPromiseResolveBlock _pendingInitResolve;
   RCTPromiseRejectBlock _pendingInitReject;
+  BOOL _isUpdatingLocation;
+  BOOL _isSuspended;
+  BOOL _resumeGuidanceOnResume;
+  BOOL _resumeSimulationOnResume;
+  NSUInteger _routeRequestGeneration;
+  NavRouteDiff *_routeDiff;
+  NavManeuverIndex *_maneuverIndex;
+  RCTPromiseResolveBlock _pendingRouteResolve;
+  // Schedule of the last evaluated stop sequence, kept to re-evaluate single-stop edits.
+  std::unique_ptr<navsdk::TimeWindowEvaluator> _timeWindowEvaluator;
 }
 
 @synthesize enableUpdateInfo = _enableUpdateInfo;
 static NavigationSessionReadyCallback _navigationSessionReadyCallback;
 static NavigationSessionDisposedCallback _navigationSessionDisposedCallback;
+static NavigationLegTimesCallback _legTimesCallback;
 static NavModule *sharedInstance = nil;
 
 RCT_EXPORT_MODULE(NavModule);
@@ -46,6 +72,12 @@ RCT_EXPORT_MODULE(NavModule);
   return std::make_shared<facebook::react::NativeNavModuleSpecJSI>(params);
 }
 
+- (void)installJSIBindingsWithRuntime:(facebook::jsi::Runtime &)runtime
+                          callInvoker:
+                              (const std::shared_ptr<facebook::react::CallInvoker> &)callInvoker {
+  [[NavStateBuffer sharedBuffer] installInRuntime:runtime];
+}
+
 + (id)allocWithZone:(NSZone *)zone {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
@@ -137,6 +169,14 @@ RCT_EXPORT_MODULE(NavModule);
   _navigationSessionDisposedCallback = nil;
 }
 
++ (void)registerLegTimesCallback:(NavigationLegTimesCallback)callback {
+  _legTimesCallback = [callback copy];
+}
+
++ (void)unregisterLegTimesCallback {
+  _legTimesCallback = nil;
+}
+
 - (void)showTermsAndConditionsDialog:(NSString *)title
                          companyName:(NSString *)companyName
                   showOnlyDisclaimer:(BOOL)showOnlyDisclaimer
@@ -266,6 +306,8 @@ RCT_EXPORT_MODULE(NavModule);
       [self->_session.locationSimulator stopSimulation];
     }
 
+    [self cancelPendingRouteRequest];
+
     if (self->_session.navigator != nil) {
       [self->_session.navigator removeListener:self];
       [self->_session.navigator clearDestinations];
@@ -279,6 +321,12 @@ RCT_EXPORT_MODULE(NavModule);
 
     self->_session.started = NO;
     self->_session = nil;
+    self->_isSuspended = NO;
+    self->_isUpdatingLocation = NO;
+    [[NavStateBuffer sharedBuffer] reset];
+    [self->_routeDiff reset];
+    [self->_maneuverIndex resetWithLegs:nil];
+    self->_timeWindowEvaluator.reset();
 
     NavViewModule *navViewModule = [NavViewModule sharedInstance];
     [navViewModule navigationSessionDestroyed];
@@ -286,10 +334,73 @@ RCT_EXPORT_MODULE(NavModule);
     if (_navigationSessionDisposedCallback) {
       _navigationSessionDisposedCallback();
     }
+    if (_legTimesCallback) {
+      _legTimesCallback(@[], @[]);
+    }
     resolve(@(YES));
   });
 }
 
+// Silences the session without releasing it: listeners are detached, guidance and location
+// updates are stopped and simulation is paused. The session, destinations and attached views are
+// kept so that resumeNavigation can restore the previous state without re-initializing.
+- (void)suspendNavigation:(RCTPromiseResolveBlock)resolve reject:(RCTPromiseRejectBlock)reject {
+  dispatch_async(dispatch_get_main_queue(), ^{
+    GMSNavigator *navigator = nil;
+    if (![self checkNavigatorWithError:reject navigator:&navigator]) {
+      return;
+    }
+    if (self->_isSuspended) {
+      resolve(nil);
+      return;
+    }
+
+    self->_isSuspended = YES;
+    self->_resumeGuidanceOnResume = navigator.guidanceActive;
+    self->_resumeSimulationOnResume = !self->_session.locationSimulator.paused;
+
+    [navigator removeListener:self];
+    navigator.guidanceActive = NO;
+    navigator.sendsBackgroundNotifications = NO;
+    self->_session.locationSimulator.paused = YES;
+
+    [self->_session.roadSnappedLocationProvider removeListener:self];
+    if (self->_isUpdatingLocation) {
+      [self->_session.roadSnappedLocationProvider stopUpdatingLocation];
+    }
+    resolve(nil);
+  });
+}
+
+- (void)resumeNavigation:(RCTPromiseResolveBlock)resolve reject:(RCTPromiseRejectBlock)reject {
+  dispatch_async(dispatch_get_main_queue(), ^{
+    GMSNavigator *navigator = nil;
+    if (![self checkNavigatorWithError:reject navigator:&navigator]) {
+      return;
+    }
+    if (!self->_isSuspended) {
+      resolve(nil);
+      return;
+    }
+
+    self->_isSuspended = NO;
+    [navigator addListener:self];
+    [self->_session.roadSnappedLocationProvider addListener:self];
+    if (self->_isUpdatingLocation) {
+      [self->_session.roadSnappedLocationProvider startUpdatingLocation];
+    }
+    if (self->_resumeSimulationOnResume) {
+      self->_session.locationSimulator.paused = NO;
+    }
+    if (self->_resumeGuidanceOnResume && self->_destinations != nil) {
+      navigator.guidanceActive = YES;
+      navigator.sendsBackgroundNotifications = YES;
+      [self onStartGuidance];
+    }
+    resolve(nil);
+  });
+}
+
 - (void)setTurnByTurnLoggingEnabled:(BOOL)isEnabled {
   dispatch_async(dispatch_get_main_queue(), ^{
     self.enableUpdateInfo = isEnabled;
@@ -401,6 +512,7 @@ RCT_EXPORT_MODULE(NavModule);
       return;
     }
 
+    [self cancelPendingRouteRequest];
     [navigator clearDestinations];
     self->_destinations = NULL;
     resolve(@(YES));
@@ -420,15 +532,30 @@ RCT_EXPORT_MODULE(NavModule);
   });
 }
 
-- (void)setDestinations:(NSArray *)waypoints
+- (void)setDestinations:(WaypointBatchSpec &)waypoints
          routingOptions:(RoutingOptionsSpec &)routingOptions
          displayOptions:(DisplayOptionsSpec &)displayOptions
       routeTokenOptions:(RouteTokenOptionsSpec &)routeTokenOptions
+             debounceMs:(double)debounceMs
                 resolve:(RCTPromiseResolveBlock)resolve
                  reject:(RCTPromiseRejectBlock)reject {
+  // Validate and build all waypoints up front, so that an invalid list is reported without
+  // superseding the request that is currently in flight.
+  NSMutableArray<NSDictionary *> *waypointErrors = [NSMutableArray array];
+  NSArray<GMSNavigationMutableWaypoint *> *destinations =
+      [NavModule waypointsFromBatch:waypoints errors:waypointErrors];
+  if (waypointErrors.count > 0) {
+    NSError *error = [NSError errorWithDomain:@"NavModule"
+                                         code:0
+                                     userInfo:@{@"errors" : waypointErrors}];
+    NSString *message = [NSString
+        stringWithFormat:@"%lu invalid waypoint(s)", (unsigned long)waypointErrors.count];
+    reject(kInvalidWaypointsErrorCode, message, error);
+    return;
+  }
+
   // Copy values before async dispatch.
   // JS always sends objects with defaults (never null), so copies are safe.
-  NSArray *waypointsCopy = [waypoints copy];
   RoutingOptionsSpec routingOptionsCopy(routingOptions);
   DisplayOptionsSpec displayOptionsCopy(displayOptions);
   RouteTokenOptionsSpec routeTokenOptionsCopy(routeTokenOptions);
@@ -446,92 +573,221 @@ RCT_EXPORT_MODULE(NavModule);
       return;
     }
 
-    // Apply display options to views (only if valid flag is set)
-    if (displayOptionsCopy.valid().value_or(false)) {
-      std::optional<bool> showDestinationMarkers = displayOptionsCopy.showDestinationMarkers();
-      std::optional<bool> showStopSigns = displayOptionsCopy.showStopSigns();
-      std::optional<bool> showTrafficLights = displayOptionsCopy.showTrafficLights();
-      if (showDestinationMarkers.has_value() || showStopSigns.has_value() ||
-          showTrafficLights.has_value()) {
-        [strongSelf applyNavigationUISettingsShowDestinationMarkers:showDestinationMarkers
-                                                      showStopSigns:showStopSigns
-                                                  showTrafficLights:showTrafficLights];
+    // Any request still in flight is superseded by this one.
+    NSUInteger generation = [strongSelf beginRouteRequestWithResolve:resolve];
+
+    void (^issueRequest)(void) = ^{
+      __strong __typeof(weakSelf) requestSelf = weakSelf;
+      if (!requestSelf || generation != requestSelf->_routeRequestGeneration) {
+        return;
       }
-    }
+      if (![requestSelf isNavigatorAvailable]) {
+        [requestSelf completeRouteRequest:generation status:GMSRouteStatusCanceled];
+        return;
+      }
+      [requestSelf issueRouteRequest:generation
+                        destinations:destinations
+                      routingOptions:routingOptionsCopy
+                      displayOptions:displayOptionsCopy
+                   routeTokenOptions:routeTokenOptionsCopy];
+    };
 
-    strongSelf->_destinations = [[NSMutableArray alloc] init];
+    if (debounceMs > 0) {
+      // Collapse bursts: only the last call within the window reaches the navigator.
+      dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(debounceMs * NSEC_PER_MSEC)),
+                     dispatch_get_main_queue(), issueRequest);
+    } else {
+      issueRequest();
+    }
+  });
+}
 
-    for (NSDictionary *wp in waypointsCopy) {
-      GMSNavigationMutableWaypoint *w;
+// Builds navigation waypoints from a typed batch in a single pass. Waypoints without a place ID
+// or explicit position take their coordinate from the packed [lat, lng, ...] array at the same
+// index; packed coordinates beyond the end of the waypoint list become plain waypoints. Every
+// invalid entry is reported in `errors` as {index, code, message}, and nil is returned.
++ (NSArray<GMSNavigationMutableWaypoint *> *)waypointsFromBatch:(const WaypointBatchSpec &)batch
+                                                          errors:(NSMutableArray<NSDictionary *> *)
+                                                                     errors {
+  facebook::react::LazyVector<WaypointSpec> specs = batch.waypoints();
+  facebook::react::LazyVector<double> packed = batch.packedPositions();
+  size_t packedCount = packed.size() / 2;
+  size_t count = std::max(specs.size(), packedCount);
+
+  void (^addError)(size_t, NSString *, NSString *) = ^(size_t index, NSString *code,
+                                                       NSString *message) {
+    [errors addObject:@{@"index" : @(index), @"code" : code, @"message" : message}];
+  };
+
+  if (packed.size() % 2 != 0) {
+    addError(packedCount, @"INVALID_PACKED_POSITIONS",
+             @"Packed positions must contain lat/lng pairs");
+  }
 
-      NSString *placeId = wp[@"placeId"];
+  NSMutableArray<GMSNavigationMutableWaypoint *> *result =
+      [NSMutableArray arrayWithCapacity:count];
+  NSString *previousPlaceId = nil;
+  BOOL hasPreviousCoordinate = NO;
+  CLLocationCoordinate2D previousCoordinate = kCLLocationCoordinate2DInvalid;
+
+  for (size_t i = 0; i < count; i++) {
+    std::optional<WaypointSpec> spec =
+        i < specs.size() ? std::optional<WaypointSpec>(specs[i]) : std::nullopt;
+    NSString *placeId = spec ? spec->placeId() : nil;
+    NSString *title = spec ? spec->title() : nil;
+
+    BOOL hasCoordinate = NO;
+    CLLocationCoordinate2D coordinate = kCLLocationCoordinate2DInvalid;
+    if (spec && spec->position().has_value()) {
+      coordinate = CLLocationCoordinate2DMake(spec->position()->lat(), spec->position()->lng());
+      hasCoordinate = YES;
+    } else if (i < packedCount) {
+      coordinate = CLLocationCoordinate2DMake(packed[2 * i], packed[2 * i + 1]);
+      hasCoordinate = YES;
+    }
 
-      if (placeId && ![placeId isEqual:@""]) {
-        w = [[GMSNavigationMutableWaypoint alloc] initWithPlaceID:placeId title:wp[@"title"]];
-      } else if (wp[@"position"]) {
-        w = [[GMSNavigationMutableWaypoint alloc]
-            initWithLocation:[ObjectTranslationUtil getLocationCoordinateFrom:wp[@"position"]]
-                       title:wp[@"title"]];
-      } else {
+    GMSNavigationMutableWaypoint *waypoint = nil;
+    if (placeId.length > 0) {
+      if ([placeId isEqualToString:previousPlaceId]) {
+        addError(i, @"DUPLICATE_WAYPOINT", @"Place ID repeats the previous waypoint");
         continue;
       }
-
-      if (wp[@"preferSameSideOfRoad"] != nil) {
-        w.preferSameSideOfRoad = [wp[@"preferSameSideOfRoad"] boolValue];
+      waypoint = [[GMSNavigationMutableWaypoint alloc] initWithPlaceID:placeId title:title];
+      previousPlaceId = placeId;
+      hasPreviousCoordinate = NO;
+    } else if (hasCoordinate) {
+      if (!CLLocationCoordinate2DIsValid(coordinate)) {
+        addError(i, @"INVALID_POSITION", @"Position is out of range");
+        continue;
       }
-
-      if (wp[@"vehicleStopover"] != nil) {
-        w.vehicleStopover = [wp[@"vehicleStopover"] boolValue];
+      if (hasPreviousCoordinate &&
+          fabs(coordinate.latitude - previousCoordinate.latitude) < 1e-6 &&
+          fabs(coordinate.longitude - previousCoordinate.longitude) < 1e-6) {
+        addError(i, @"DUPLICATE_WAYPOINT", @"Position repeats the previous waypoint");
+        continue;
       }
+      waypoint = [[GMSNavigationMutableWaypoint alloc] initWithLocation:coordinate title:title];
+      previousCoordinate = coordinate;
+      hasPreviousCoordinate = YES;
+      previousPlaceId = nil;
+    } else {
+      addError(i, @"MISSING_LOCATION", @"Waypoint requires a placeId or a position");
+      continue;
+    }
 
-      if (wp[@"preferredHeading"] != nil) {
-        w.preferredHeading = [wp[@"preferredHeading"] intValue];
-      }
+    if (waypoint == nil) {
+      addError(i, @"INVALID_PLACE_ID", @"Waypoint could not be created from the place ID");
+      continue;
+    }
 
-      [strongSelf->_destinations addObject:w];
+    if (spec) {
+      std::optional<double> preferredHeading = spec->preferredHeading();
+      if (preferredHeading.has_value()) {
+        double heading = preferredHeading.value();
+        if (heading < 0 || heading > 360) {
+          addError(i, @"INVALID_HEADING", @"Preferred heading has to be between 0 and 360");
+          continue;
+        }
+        waypoint.preferredHeading = (int32_t)heading;
+      }
+      waypoint.preferSameSideOfRoad = spec->preferSameSideOfRoad().value_or(false);
+      waypoint.vehicleStopover = spec->vehicleStopover().value_or(false);
     }
 
-    void (^routeStatusCallback)(GMSRouteStatus) = ^(GMSRouteStatus routeStatus) {
-      __strong __typeof(weakSelf) innerStrongSelf = weakSelf;
-      if (!innerStrongSelf) return;
-      // Return the route status string to match codegen RouteStatusSpec enum
-      NSString *status = [NavModule routeStatusToString:routeStatus];
-      resolve(status);
-    };
+    [result addObject:waypoint];
+  }
 
-    // If valid route token options are provided, use route token for navigation
-    if (routeTokenOptionsCopy.valid().value_or(false)) {
-      NSString *routeToken = routeTokenOptionsCopy.routeToken();
-      std::optional<double> travelMode = routeTokenOptionsCopy.travelMode();
-      [strongSelf configureNavigatorWithTravelMode:navigator travelMode:travelMode];
-      [navigator setDestinations:strongSelf->_destinations
-                      routeToken:routeToken
-                        callback:routeStatusCallback];
-    } else if (routingOptionsCopy.valid().value_or(false)) {
-      // Use routing options if valid
-      std::optional<double> travelMode = routingOptionsCopy.travelMode();
-      std::optional<bool> avoidTolls = routingOptionsCopy.avoidTolls();
-      std::optional<bool> avoidFerries = routingOptionsCopy.avoidFerries();
-      std::optional<bool> avoidHighways = routingOptionsCopy.avoidHighways();
-      std::optional<double> routingStrategy = routingOptionsCopy.routingStrategy();
-      std::optional<double> alternateRoutesStrategy = routingOptionsCopy.alternateRoutesStrategy();
-
-      [strongSelf configureNavigatorWithTravelMode:navigator travelMode:travelMode];
-      [strongSelf configureNavigatorWithAvoidOptions:navigator
-                                          avoidTolls:avoidTolls
-                                        avoidFerries:avoidFerries
-                                       avoidHighways:avoidHighways];
-      GMSNavigationRoutingOptions *gmRoutingOptions =
-          [NavModule routingOptionsWithStrategy:routingStrategy
-                        alternateRoutesStrategy:alternateRoutesStrategy];
-      [navigator setDestinations:strongSelf->_destinations
-                  routingOptions:gmRoutingOptions
-                        callback:routeStatusCallback];
-    } else {
-      // No valid options provided, use defaults
-      [navigator setDestinations:strongSelf->_destinations callback:routeStatusCallback];
+  return errors.count > 0 ? nil : result;
+}
+
+// Starts a new route request generation, resolving the previous pending request (if any) as
+// ROUTE_CANCELED. Must be called on the main thread.
+- (NSUInteger)beginRouteRequestWithResolve:(RCTPromiseResolveBlock)resolve {
+  [self cancelPendingRouteRequest];
+  _pendingRouteResolve = resolve;
+  return _routeRequestGeneration;
+}
+
+// Invalidates the current route request generation. Must be called on the main thread.
+- (void)cancelPendingRouteRequest {
+  _routeRequestGeneration++;
+  RCTPromiseResolveBlock pendingResolve = _pendingRouteResolve;
+  _pendingRouteResolve = nil;
+  if (pendingResolve) {
+    pendingResolve([NavModule routeStatusToString:GMSRouteStatusCanceled]);
+  }
+}
+
+- (void)completeRouteRequest:(NSUInteger)generation status:(GMSRouteStatus)routeStatus {
+  // Results of superseded requests were already resolved as ROUTE_CANCELED.
+  if (generation != _routeRequestGeneration || !_pendingRouteResolve) {
+    return;
+  }
+  RCTPromiseResolveBlock pendingResolve = _pendingRouteResolve;
+  _pendingRouteResolve = nil;
+  // Return the route status string to match codegen RouteStatusSpec enum
+  pendingResolve([NavModule routeStatusToString:routeStatus]);
+}
+
+- (void)issueRouteRequest:(NSUInteger)generation
+             destinations:(NSArray<GMSNavigationMutableWaypoint *> *)destinations
+           routingOptions:(const RoutingOptionsSpec &)routingOptions
+           displayOptions:(const DisplayOptionsSpec &)displayOptions
+        routeTokenOptions:(const RouteTokenOptionsSpec &)routeTokenOptions {
+  GMSNavigator *navigator = _session.navigator;
+
+  // Apply display options to views (only if valid flag is set)
+  if (displayOptions.valid().value_or(false)) {
+    std::optional<bool> showDestinationMarkers = displayOptions.showDestinationMarkers();
+    std::optional<bool> showStopSigns = displayOptions.showStopSigns();
+    std::optional<bool> showTrafficLights = displayOptions.showTrafficLights();
+    if (showDestinationMarkers.has_value() || showStopSigns.has_value() ||
+        showTrafficLights.has_value()) {
+      [self applyNavigationUISettingsShowDestinationMarkers:showDestinationMarkers
+                                              showStopSigns:showStopSigns
+                                          showTrafficLights:showTrafficLights];
     }
-  });
+  }
+
+  _destinations = [destinations mutableCopy];
+
+  __weak __typeof(self) weakSelf = self;
+  void (^routeStatusCallback)(GMSRouteStatus) = ^(GMSRouteStatus routeStatus) {
+    __strong __typeof(weakSelf) strongSelf = weakSelf;
+    if (!strongSelf) return;
+    [strongSelf completeRouteRequest:generation status:routeStatus];
+  };
+
+  // If valid route token options are provided, use route token for navigation
+  if (routeTokenOptions.valid().value_or(false)) {
+    NSString *routeToken = routeTokenOptions.routeToken();
+    std::optional<double> travelMode = routeTokenOptions.travelMode();
+    [self configureNavigatorWithTravelMode:navigator travelMode:travelMode];
+    [navigator setDestinations:_destinations routeToken:routeToken callback:routeStatusCallback];
+  } else if (routingOptions.valid().value_or(false)) {
+    // Use routing options if valid
+    std::optional<double> travelMode = routingOptions.travelMode();
+    std::optional<bool> avoidTolls = routingOptions.avoidTolls();
+    std::optional<bool> avoidFerries = routingOptions.avoidFerries();
+    std::optional<bool> avoidHighways = routingOptions.avoidHighways();
+    std::optional<double> routingStrategy = routingOptions.routingStrategy();
+    std::optional<double> alternateRoutesStrategy = routingOptions.alternateRoutesStrategy();
+
+    [self configureNavigatorWithTravelMode:navigator travelMode:travelMode];
+    [self configureNavigatorWithAvoidOptions:navigator
+                                  avoidTolls:avoidTolls
+                                avoidFerries:avoidFerries
+                               avoidHighways:avoidHighways];
+    GMSNavigationRoutingOptions *gmRoutingOptions =
+        [NavModule routingOptionsWithStrategy:routingStrategy
+                      alternateRoutesStrategy:alternateRoutesStrategy];
+    [navigator setDestinations:_destinations
+                routingOptions:gmRoutingOptions
+                      callback:routeStatusCallback];
+  } else {
+    // No valid options provided, use defaults
+    [navigator setDestinations:_destinations callback:routeStatusCallback];
+  }
 }
 
 - (void)applyNavigationUISettingsShowDestinationMarkers:(std::optional<bool>)showDestinationMarkers
@@ -646,6 +902,189 @@ RCT_EXPORT_MODULE(NavModule);
   });
 }
 
+- (void)getManeuverPoints:(RCTPromiseResolveBlock)resolve reject:(RCTPromiseRejectBlock)reject {
+  dispatch_async(dispatch_get_main_queue(), ^{
+    GMSNavigator *navigator = nil;
+    if (![self checkNavigatorWithError:reject navigator:&navigator]) {
+      return;
+    }
+
+    NSArray<NSNumber *> *maneuverPoints = self->_maneuverIndex.maneuverPoints;
+    resolve(maneuverPoints != nil ? maneuverPoints : @[]);
+  });
+}
+
+// Converts a stop from JS, with times in milliseconds since the epoch. Returns NO if the stop is
+// invalid.
+static BOOL TimeWindowStopFromSpec(const TimeWindowStopSpec &spec, navsdk::TimeWindowStop *stop) {
+  stop->position = {spec.lat(), spec.lng()};
+  std::optional<double> windowStart = spec.windowStart();
+  std::optional<double> windowEnd = spec.windowEnd();
+  stop->windowStart = windowStart.has_value() ? windowStart.value() / 1000 : -INFINITY;
+  stop->windowEnd = windowEnd.has_value() ? windowEnd.value() / 1000 : INFINITY;
+  stop->serviceSeconds = spec.serviceSeconds().value_or(0);
+  return CLLocationCoordinate2DIsValid(
+             CLLocationCoordinate2DMake(stop->position.lat, stop->position.lng)) &&
+         !(stop->windowStart > stop->windowEnd) && stop->serviceSeconds >= 0;
+}
+
+// Travel time of each leg of the current route from the end of the previous leg, derived from
+// the cached time to each waypoint. Times the navigator does not know are NaN.
+static std::vector<navsdk::RouteLegTime> RouteLegTimes(GMSNavigator *navigator) {
+  std::vector<navsdk::RouteLegTime> legTimes;
+  NSArray<GMSRouteLeg *> *legs = navigator.routeLegs;
+  legTimes.reserve(legs.count);
+  NSTimeInterval previous = 0;
+  for (GMSRouteLeg *leg in legs) {
+    NSTimeInterval time = [navigator timeToWaypoint:leg.destinationWaypoint];
+    CLLocationCoordinate2D destination = leg.destinationCoordinate;
+    double seconds = time == CLTimeIntervalMax || previous == CLTimeIntervalMax
+                         ? NAN
+                         : std::max(0.0, time - previous);
+    legTimes.push_back({{destination.latitude, destination.longitude}, seconds});
+    previous = time;
+  }
+  return legTimes;
+}
+
+// Packs the schedules from `first` to the end for JS, with times in milliseconds since the epoch.
+static NSDictionary *TimeWindowSchedule(const navsdk::TimeWindowEvaluator &evaluator,
+                                        size_t first) {
+  const std::vector<navsdk::StopSchedule> &schedules = evaluator.schedules();
+  size_t count = schedules.size() - first;
+  NSMutableArray<NSNumber *> *arrivalTimes = [NSMutableArray arrayWithCapacity:count];
+  NSMutableArray<NSNumber *> *waitSeconds = [NSMutableArray arrayWithCapacity:count];
+  NSMutableArray<NSNumber *> *slackSeconds = [NSMutableArray arrayWithCapacity:count];
+  NSMutableArray<NSNumber *> *routed = [NSMutableArray arrayWithCapacity:count];
+  for (size_t i = first; i < schedules.size(); i++) {
+    const navsdk::StopSchedule &schedule = schedules[i];
+    [arrivalTimes addObject:@(schedule.arrival * 1000)];
+    [waitSeconds addObject:@(schedule.wait)];
+    [slackSeconds addObject:@(std::isinf(schedule.slack) ? DBL_MAX : schedule.slack)];
+    [routed addObject:@(schedule.routed)];
+  }
+  return @{
+    @"firstIndex" : @(first),
+    @"stopCount" : @(schedules.size()),
+    @"arrivalTimes" : arrivalTimes,
+    @"waitSeconds" : waitSeconds,
+    @"slackSeconds" : slackSeconds,
+    @"routed" : routed,
+  };
+}
+
+- (void)evaluateTimeWindows:(TimeWindowRequestSpec &)request
+                    resolve:(RCTPromiseResolveBlock)resolve
+                     reject:(RCTPromiseRejectBlock)reject {
+  facebook::react::LazyVector<TimeWindowStopSpec> specs = request.stops();
+  __block std::vector<navsdk::TimeWindowStop> stops(specs.size());
+  for (size_t i = 0; i < specs.size(); i++) {
+    if (!TimeWindowStopFromSpec(specs[i], &stops[i])) {
+      reject(kInvalidTimeWindowsErrorCode,
+             [NSString stringWithFormat:@"Stop %zu has an invalid position or time window", i],
+             nil);
+      return;
+    }
+  }
+
+  navsdk::TimeWindowOptions options;
+  options.speedMetersPerSecond = request.speedMetersPerSecond().value_or(11);
+  options.detourFactor = request.detourFactor().value_or(1.3);
+  if (!(options.speedMetersPerSecond > 0) || !(options.detourFactor > 0)) {
+    reject(kInvalidTimeWindowsErrorCode, @"Speed and detour factor must be positive", nil);
+    return;
+  }
+  std::optional<LatLngSpec> originSpec = request.origin();
+  BOOL hasOrigin = originSpec.has_value();
+  navsdk::GeoPoint origin = hasOrigin ? navsdk::GeoPoint{originSpec->lat(), originSpec->lng()}
+                                      : navsdk::GeoPoint{0, 0};
+  double departureTime = request.departureTime().has_value()
+                             ? request.departureTime().value() / 1000
+                             : [[NSDate date] timeIntervalSince1970];
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    GMSNavigator *navigator = nil;
+    if (![self checkNavigatorWithError:reject navigator:&navigator]) {
+      return;
+    }
+
+    navsdk::GeoPoint start = origin;
+    if (!hasOrigin) {
+      CLLocation *location = self->_session.roadSnappedLocationProvider.location;
+      if (location == nil) {
+        reject(kInvalidTimeWindowsErrorCode,
+               @"An origin is required while the current location is unknown", nil);
+        return;
+      }
+      start = {location.coordinate.latitude, location.coordinate.longitude};
+    }
+
+    auto evaluator = std::make_unique<navsdk::TimeWindowEvaluator>(options);
+    evaluator->SetOrigin(start, departureTime);
+    evaluator->SetRouteLegs(RouteLegTimes(navigator));
+    evaluator->SetStops(std::move(stops));
+    evaluator->Evaluate();
+    self->_timeWindowEvaluator = std::move(evaluator);
+    resolve(TimeWindowSchedule(*self->_timeWindowEvaluator, 0));
+  });
+}
+
+- (void)updateTimeWindowStop:(TimeWindowEditSpec &)edit
+                     resolve:(RCTPromiseResolveBlock)resolve
+                      reject:(RCTPromiseRejectBlock)reject {
+  int type = static_cast<int>(edit.type());
+  double index = edit.index();
+  double toIndex = edit.toIndex().value_or(-1);
+  if (index != std::floor(index) || (type == 3 && toIndex != std::floor(toIndex))) {
+    reject(kInvalidTimeWindowsErrorCode, @"Stop indices must be whole numbers", nil);
+    return;
+  }
+  navsdk::TimeWindowStop stop;
+  if (type == 0 || type == 1) {
+    std::optional<TimeWindowStopSpec> stopSpec = edit.stop();
+    if (!stopSpec.has_value() || !TimeWindowStopFromSpec(stopSpec.value(), &stop)) {
+      reject(kInvalidTimeWindowsErrorCode, @"The stop is missing or invalid", nil);
+      return;
+    }
+  }
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    navsdk::TimeWindowEvaluator *evaluator = self->_timeWindowEvaluator.get();
+    if (evaluator == nullptr) {
+      reject(kInvalidTimeWindowsErrorCode, @"Time windows have not been evaluated", nil);
+      return;
+    }
+
+    double count = evaluator->stop_count();
+    // Inserts may append a stop; every other edit needs an existing stop.
+    double limit = type == 1 ? count + 1 : count;
+    if (!(index >= 0 && index < limit) || (type == 3 && !(toIndex >= 0 && toIndex < count))) {
+      reject(kInvalidTimeWindowsErrorCode, @"Stop index is out of range", nil);
+      return;
+    }
+
+    size_t position = static_cast<size_t>(index);
+    switch (type) {
+      case 0:
+        evaluator->ReplaceStop(position, stop);
+        break;
+      case 1:
+        evaluator->InsertStop(position, stop);
+        break;
+      case 2:
+        evaluator->RemoveStop(position);
+        break;
+      case 3:
+        evaluator->MoveStop(position, static_cast<size_t>(toIndex));
+        break;
+      default:
+        reject(kInvalidTimeWindowsErrorCode, @"Unknown edit type", nil);
+        return;
+    }
+    resolve(TimeWindowSchedule(*evaluator, evaluator->Evaluate()));
+  });
+}
+
 - (void)getTraveledPath:(RCTPromiseResolveBlock)resolve reject:(RCTPromiseRejectBlock)reject {
   dispatch_async(dispatch_get_main_queue(), ^{
     GMSNavigator *navigator = nil;
@@ -725,7 +1164,11 @@ RCT_EXPORT_MODULE(NavModule);
                          reject:(RCTPromiseRejectBlock)reject {
   dispatch_async(dispatch_get_main_queue(), ^{
     if (self->_session != nil) {
-      self->_session.locationSimulator.paused = YES;
+      if (self->_isSuspended) {
+        self->_resumeSimulationOnResume = NO;
+      } else {
+        self->_session.locationSimulator.paused = YES;
+      }
       resolve(@(YES));
     } else {
       reject(@"no_session", @"No navigation session available", nil);
@@ -737,7 +1180,11 @@ RCT_EXPORT_MODULE(NavModule);
                           reject:(RCTPromiseRejectBlock)reject {
   dispatch_async(dispatch_get_main_queue(), ^{
     if (self->_session != nil) {
-      self->_session.locationSimulator.paused = NO;
+      if (self->_isSuspended) {
+        self->_resumeSimulationOnResume = YES;
+      } else {
+        self->_session.locationSimulator.paused = NO;
+      }
       resolve(@(YES));
     } else {
       reject(@"no_session", @"No navigation session available", nil);
@@ -765,13 +1212,18 @@ RCT_EXPORT_MODULE(NavModule);
 
 - (void)startUpdatingLocation:(RCTPromiseResolveBlock)resolve reject:(RCTPromiseRejectBlock)reject {
   dispatch_async(dispatch_get_main_queue(), ^{
-    [self->_session.roadSnappedLocationProvider startUpdatingLocation];
+    self->_isUpdatingLocation = YES;
+    // While suspended, updates are started by resumeNavigation.
+    if (!self->_isSuspended) {
+      [self->_session.roadSnappedLocationProvider startUpdatingLocation];
+    }
     resolve(@(YES));
   });
 }
 
 - (void)stopUpdatingLocation:(RCTPromiseResolveBlock)resolve reject:(RCTPromiseRejectBlock)reject {
   dispatch_async(dispatch_get_main_queue(), ^{
+    self->_isUpdatingLocation = NO;
     [self->_session.roadSnappedLocationProvider stopUpdatingLocation];
     resolve(@(YES));
   });
@@ -795,6 +1247,8 @@ RCT_EXPORT_MODULE(NavModule);
 // Listener for continuous location updates.
 - (void)locationProvider:(GMSRoadSnappedLocationProvider *)locationProvider
        didUpdateLocation:(CLLocation *)location {
+  [[NavStateBuffer sharedBuffer] writeLocation:location];
+  [[NavViewModule sharedInstance] informRoadSnappedLocation:location];
   [self onLocationChanged:[ObjectTranslationUtil transformCLLocationToDictionary:location]];
 }
 
@@ -816,9 +1270,28 @@ RCT_EXPORT_MODULE(NavModule);
   [self onArrival:eventMap];
 }
 
-// Listener for route change events.
+// Listener for route change events. Reports the route as a patch of the previous one.
 - (void)navigatorDidChangeRoute:(GMSNavigator *)navigator {
-  [self onRouteChanged];
+  if (_routeDiff == nil) {
+    _routeDiff = [[NavRouteDiff alloc] init];
+  }
+  [self onRouteChanged:[_routeDiff diffWithLegs:navigator.routeLegs]];
+  if (_maneuverIndex == nil) {
+    _maneuverIndex = [[NavManeuverIndex alloc] init];
+  }
+  [_maneuverIndex resetWithLegs:navigator.routeLegs];
+  if (_timeWindowEvaluator) {
+    // The new leg times are measured from where the car is now, so the sequence restarts here.
+    CLLocation *location = _session.roadSnappedLocationProvider.location;
+    navsdk::GeoPoint origin =
+        location != nil
+            ? navsdk::GeoPoint{location.coordinate.latitude, location.coordinate.longitude}
+            : _timeWindowEvaluator->origin();
+    _timeWindowEvaluator->SetOrigin(origin, [[NSDate date] timeIntervalSince1970]);
+    _timeWindowEvaluator->SetRouteLegs(RouteLegTimes(navigator));
+  }
+  [self notifyLegTimesWithNavigator:navigator];
+  [[NavViewModule sharedInstance] informRouteChanged:navigator.routeLegs];
 }
 
 // Listener for time to next destination.
@@ -833,6 +1306,9 @@ RCT_EXPORT_MODULE(NavModule);
 }
 
 - (void)navigator:(GMSNavigator *)navigator didUpdateNavInfo:(GMSNavigationNavInfo *)navInfo {
+  if (navInfo.navState == GMSNavigationNavStateEnroute) {
+    [_maneuverIndex updateWithNavInfo:navInfo];
+  }
   if (self.enableUpdateInfo == TRUE && navInfo.navState == GMSNavigationNavStateEnroute) {
     [self onTurnByTurn:navInfo
         distanceToNextDestinationMeters:navigator.distanceToNextDestination
@@ -860,6 +1336,7 @@ RCT_EXPORT_MODULE(NavModule);
 }
 
 - (void)onRemainingTimeOrDistanceChangedWithNavigator:(GMSNavigator *)navigator {
+  [self notifyLegTimesWithNavigator:navigator];
   if (!navigator.currentRouteLeg) {
     return;
   }
@@ -867,6 +1344,9 @@ RCT_EXPORT_MODULE(NavModule);
   GMSNavigationDelayCategory severity = navigator.delayCategoryToNextDestination;
   NSTimeInterval time = navigator.timeToNextDestination;
   CLLocationDistance distance = navigator.distanceToNextDestination;
+  [[NavStateBuffer sharedBuffer] writeRemainingMeters:distance
+                                              seconds:time
+                                        delaySeverity:severity];
 
   NSDictionary *timeAndDistance =
       @{@"delaySeverity" : @(severity), @"meters" : @(distance), @"seconds" : @(time)};
@@ -874,8 +1354,27 @@ RCT_EXPORT_MODULE(NavModule);
   [self emitOnRemainingTimeOrDistanceChanged:@{@"timeAndDistance" : timeAndDistance}];
 }
 
-- (void)onRouteChanged {
-  [self emitOnRouteChanged];
+// Reports the time and distance to the destination of each remaining leg to the native listener,
+// e.g. a CarPlay stop list, without going through JS.
+- (void)notifyLegTimesWithNavigator:(GMSNavigator *)navigator {
+  if (_legTimesCallback == nil) {
+    return;
+  }
+
+  NSArray<GMSRouteLeg *> *legs = navigator.routeLegs;
+  NSMutableArray<NSNumber *> *seconds = [NSMutableArray arrayWithCapacity:legs.count];
+  NSMutableArray<NSNumber *> *meters = [NSMutableArray arrayWithCapacity:legs.count];
+  for (GMSRouteLeg *leg in legs) {
+    NSTimeInterval time = [navigator timeToWaypoint:leg.destinationWaypoint];
+    CLLocationDistance distance = [navigator distanceToWaypoint:leg.destinationWaypoint];
+    [seconds addObject:@(time == CLTimeIntervalMax ? -1 : time)];
+    [meters addObject:@(distance == CLLocationDistanceMax ? -1 : distance)];
+  }
+  _legTimesCallback(seconds, meters);
+}
+
+- (void)onRouteChanged:(NSDictionary *)routeChange {
+  [self emitOnRouteChanged:@{@"routeChange" : routeChange}];
 }
 
 - (void)onReroutingRequestedByOffRoute {
@@ -965,6 +1464,11 @@ RCT_EXPORT_MODULE(NavModule);
 
   [obj setObject:steps forKey:@"getRemainingSteps"];
 
+  NSArray<NSNumber *> *maneuverPoints = _maneuverIndex.maneuverPoints;
+  if (maneuverPoints.count > 0) {
+    [obj setObject:maneuverPoints forKey:@"maneuverPoints"];
+  }
+
   NSMutableArray *params = [NSMutableArray array];
   [params addObject:obj];
 
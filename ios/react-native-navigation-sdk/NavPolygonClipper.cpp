@@ -0,0 +1,612 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NavPolygonClipper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace navsdk {
+
+namespace {
+
+const double kFinestGridDegrees = 1e-7;
+
+// Largest extent of the operands in grid units. Keeping coordinates below 2^30 keeps every product
+// of the predicates below 2^62.
+const double kMaxGridExtent = static_cast<double>(int64_t{1} << 30);
+
+struct Point {
+  int64_t x;
+  int64_t y;
+
+  bool operator==(const Point &other) const { return x == other.x && y == other.y; }
+  bool operator!=(const Point &other) const { return !(*this == other); }
+};
+
+struct PointHash {
+  size_t operator()(const Point &point) const {
+    return static_cast<size_t>(static_cast<uint64_t>(point.x) * 0x9E3779B97F4A7C15ULL ^
+                               static_cast<uint64_t>(point.y));
+  }
+};
+
+// A directed edge. After orientation, the inside of its operand is on its left.
+struct Edge {
+  Point from;
+  Point to;
+
+  bool operator==(const Edge &other) const { return from == other.from && to == other.to; }
+};
+
+struct EdgeHash {
+  size_t operator()(const Edge &edge) const {
+    PointHash hash;
+    return hash(edge.from) * 31 + hash(edge.to);
+  }
+};
+
+using Ring = std::vector<Point>;
+using EdgeSet = std::unordered_set<Edge, EdgeHash>;
+
+enum class Location {
+  kInside,
+  kOutside,
+  // Coincides with an edge of the other operand running the same way.
+  kSharedSame,
+  // Coincides with an edge of the other operand running the opposite way.
+  kSharedOpposite,
+};
+
+int64_t Cross(Point origin, Point a, Point b) {
+  return (a.x - origin.x) * (b.y - origin.y) - (a.y - origin.y) * (b.x - origin.x);
+}
+
+int Sign(int64_t value) { return (value > 0) - (value < 0); }
+
+// Twice the signed area, positive for counterclockwise rings.
+double SignedArea(const Ring &ring) {
+  double area = 0;
+  for (size_t i = 1; i + 1 < ring.size(); i++) {
+    area += static_cast<double>(Cross(ring[0], ring[i], ring[i + 1]));
+  }
+  return area;
+}
+
+bool OnSegment(Point point, Point a, Point b) {
+  return Cross(a, b, point) == 0 && std::min(a.x, b.x) <= point.x &&
+         point.x <= std::max(a.x, b.x) && std::min(a.y, b.y) <= point.y &&
+         point.y <= std::max(a.y, b.y);
+}
+
+// Whether the ray from `doubled` / 2 towards +x crosses the edge from `a` to `b`. The point is
+// given doubled so that edge midpoints are exact.
+bool RayCrosses(Point a, Point b, Point doubled) {
+  if ((2 * a.y > doubled.y) == (2 * b.y > doubled.y)) {
+    return false;
+  }
+  int64_t dx = b.x - a.x;
+  int64_t dy = b.y - a.y;
+  int64_t side = (2 * a.x - doubled.x) * dy + (doubled.y - 2 * a.y) * dx;
+  return dy > 0 ? side > 0 : side < 0;
+}
+
+bool RingContains(const Ring &ring, Point doubled) {
+  bool inside = false;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    if (RayCrosses(ring[j], ring[i], doubled)) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+class Grid {
+ public:
+  Grid(const std::vector<GeoPolygon> &subject, const std::vector<GeoPolygon> &clip) {
+    double minLat = INFINITY;
+    double minLng = INFINITY;
+    double maxLat = -INFINITY;
+    double maxLng = -INFINITY;
+    auto extend = [&](const std::vector<GeoPoint> &points) {
+      for (const GeoPoint &point : points) {
+        minLat = std::min(minLat, point.lat);
+        minLng = std::min(minLng, point.lng);
+        maxLat = std::max(maxLat, point.lat);
+        maxLng = std::max(maxLng, point.lng);
+      }
+    };
+    for (const std::vector<GeoPolygon> *operand : {&subject, &clip}) {
+      for (const GeoPolygon &polygon : *operand) {
+        extend(polygon.outer);
+        for (const std::vector<GeoPoint> &hole : polygon.holes) {
+          extend(hole);
+        }
+      }
+    }
+    if (minLat > maxLat) {
+      minLat = maxLat = minLng = maxLng = 0;
+    }
+    minLat_ = minLat;
+    minLng_ = minLng;
+    unit_ = std::max(kFinestGridDegrees,
+                     std::max(maxLat - minLat, maxLng - minLng) / kMaxGridExtent);
+  }
+
+  Point ToGrid(GeoPoint point) const {
+    return {std::llround((point.lng - minLng_) / unit_),
+            std::llround((point.lat - minLat_) / unit_)};
+  }
+
+  GeoPoint ToGeo(Point point) const {
+    return {minLat_ + static_cast<double>(point.y) * unit_,
+            minLng_ + static_cast<double>(point.x) * unit_};
+  }
+
+ private:
+  double minLat_;
+  double minLng_;
+  double unit_;
+};
+
+// Buckets edges into horizontal bands, so that crossing candidates and ray casts only look at the
+// edges spanning the same rows.
+class BandIndex {
+ public:
+  explicit BandIndex(const std::vector<Edge> &edges) {
+    if (edges.empty()) {
+      bands_.resize(1);
+      return;
+    }
+    minY_ = INT64_MAX;
+    int64_t maxY = INT64_MIN;
+    for (const Edge &edge : edges) {
+      minY_ = std::min(minY_, std::min(edge.from.y, edge.to.y));
+      maxY = std::max(maxY, std::max(edge.from.y, edge.to.y));
+    }
+    size_t count = std::max<size_t>(1, std::min<size_t>(edges.size() / 2, 1 << 16));
+    bandHeight_ = (maxY - minY_) / static_cast<int64_t>(count) + 1;
+    bands_.resize(count);
+    for (uint32_t i = 0; i < edges.size(); i++) {
+      const Edge &edge = edges[i];
+      size_t last = Band(std::max(edge.from.y, edge.to.y));
+      for (size_t band = Band(std::min(edge.from.y, edge.to.y)); band <= last; band++) {
+        bands_[band].push_back(i);
+      }
+    }
+  }
+
+  size_t Band(int64_t y) const {
+    int64_t band = (y - minY_) / bandHeight_;
+    return static_cast<size_t>(
+        std::max<int64_t>(0, std::min<int64_t>(band, static_cast<int64_t>(bands_.size()) - 1)));
+  }
+
+  const std::vector<uint32_t> &EdgesInBand(size_t band) const { return bands_[band]; }
+
+ private:
+  int64_t minY_ = 0;
+  int64_t bandHeight_ = 1;
+  std::vector<std::vector<uint32_t>> bands_;
+};
+
+void AddRing(const std::vector<GeoPoint> &points, const Grid &grid, std::vector<Ring> *rings) {
+  Ring ring;
+  ring.reserve(points.size());
+  for (const GeoPoint &point : points) {
+    Point snapped = grid.ToGrid(point);
+    if (ring.empty() || snapped != ring.back()) {
+      ring.push_back(snapped);
+    }
+  }
+  while (ring.size() > 1 && ring.front() == ring.back()) {
+    ring.pop_back();
+  }
+  if (ring.size() >= 3) {
+    rings->push_back(std::move(ring));
+  }
+}
+
+// Adds the points where the two edges cross or touch to the split points of each.
+void Intersect(const Edge &a, const Edge &b, std::vector<Point> *splitsA,
+               std::vector<Point> *splitsB) {
+  int64_t d1 = Cross(b.from, b.to, a.from);
+  int64_t d2 = Cross(b.from, b.to, a.to);
+  int64_t d3 = Cross(a.from, a.to, b.from);
+  int64_t d4 = Cross(a.from, a.to, b.to);
+  if (Sign(d1) * Sign(d2) < 0 && Sign(d3) * Sign(d4) < 0) {
+    // A proper crossing, rounded to the grid.
+    double t = static_cast<double>(d1) / (static_cast<double>(d1) - static_cast<double>(d2));
+    Point crossing{
+        std::llround(static_cast<double>(a.from.x) + static_cast<double>(a.to.x - a.from.x) * t),
+        std::llround(static_cast<double>(a.from.y) + static_cast<double>(a.to.y - a.from.y) * t)};
+    splitsA->push_back(crossing);
+    splitsB->push_back(crossing);
+    return;
+  }
+  // Touching or collinear: split each edge at the endpoints of the other that lie on it.
+  if (OnSegment(b.from, a.from, a.to)) {
+    splitsA->push_back(b.from);
+  }
+  if (OnSegment(b.to, a.from, a.to)) {
+    splitsA->push_back(b.to);
+  }
+  if (OnSegment(a.from, b.from, b.to)) {
+    splitsB->push_back(a.from);
+  }
+  if (OnSegment(a.to, b.from, b.to)) {
+    splitsB->push_back(a.to);
+  }
+}
+
+// Finds where the edges of `a` meet those of `b`. When both are the same set, each pair is tested
+// once.
+void FindIntersections(const std::vector<Edge> &a, const std::vector<Edge> &b,
+                       std::vector<std::vector<Point>> *splitsA,
+                       std::vector<std::vector<Point>> *splitsB) {
+  if (a.empty() || b.empty()) {
+    return;
+  }
+  bool self = &a == &b;
+  BandIndex index(b);
+  for (uint32_t i = 0; i < a.size(); i++) {
+    const Edge &edge = a[i];
+    int64_t minX = std::min(edge.from.x, edge.to.x);
+    int64_t maxX = std::max(edge.from.x, edge.to.x);
+    int64_t minY = std::min(edge.from.y, edge.to.y);
+    int64_t maxY = std::max(edge.from.y, edge.to.y);
+    size_t last = index.Band(maxY);
+    for (size_t band = index.Band(minY); band <= last; band++) {
+      for (uint32_t j : index.EdgesInBand(band)) {
+        if (self && j <= i) {
+          continue;
+        }
+        const Edge &other = b[j];
+        int64_t overlapMinY = std::max(minY, std::min(other.from.y, other.to.y));
+        if (overlapMinY > std::min(maxY, std::max(other.from.y, other.to.y)) ||
+            std::max(minX, std::min(other.from.x, other.to.x)) >
+                std::min(maxX, std::max(other.from.x, other.to.x))) {
+          continue;
+        }
+        // Pairs sharing several bands are only tested in the first band of their overlap.
+        if (index.Band(overlapMinY) != band) {
+          continue;
+        }
+        Intersect(edge, other, &(*splitsA)[i], &(*splitsB)[j]);
+      }
+    }
+  }
+}
+
+std::vector<Edge> SplitEdges(const std::vector<Edge> &edges,
+                             std::vector<std::vector<Point>> *splits) {
+  std::vector<Edge> result;
+  result.reserve(edges.size());
+  for (size_t i = 0; i < edges.size(); i++) {
+    const Edge &edge = edges[i];
+    std::vector<Point> &points = (*splits)[i];
+    int64_t dx = edge.to.x - edge.from.x;
+    int64_t dy = edge.to.y - edge.from.y;
+    int64_t length = dx * dx + dy * dy;
+    auto along = [&](Point point) {
+      return (point.x - edge.from.x) * dx + (point.y - edge.from.y) * dy;
+    };
+    std::sort(points.begin(), points.end(),
+              [&](Point p, Point q) { return along(p) < along(q); });
+    Point current = edge.from;
+    for (const Point &point : points) {
+      int64_t position = along(point);
+      if (position <= 0 || position >= length || point == current || point == edge.to) {
+        continue;
+      }
+      result.push_back({current, point});
+      current = point;
+    }
+    result.push_back({current, edge.to});
+  }
+  return result;
+}
+
+Edge Reversed(const Edge &edge) { return {edge.to, edge.from}; }
+
+Edge Transpose(const Edge &edge) {
+  return {{edge.from.y, edge.from.x}, {edge.to.y, edge.to.x}};
+}
+
+// Whether the even-odd area of `edges` is on the left of `edges[i]`. The ray from the midpoint of
+// the edge towards +x gives the parity right next to it on that side; horizontal edges are cast
+// towards +y with the transposed edges instead.
+bool AreaOnLeft(size_t i, const std::vector<Edge> &edges, const BandIndex &rows,
+                const std::vector<Edge> &transposed, const BandIndex &columns) {
+  const Edge &edge = edges[i];
+  bool horizontal = edge.from.y == edge.to.y;
+  const std::vector<Edge> &cast = horizontal ? transposed : edges;
+  const BandIndex &index = horizontal ? columns : rows;
+  const Edge &probe = cast[i];
+  Point doubled{probe.from.x + probe.to.x, probe.from.y + probe.to.y};
+  bool beyond = false;
+  for (uint32_t j : index.EdgesInBand(index.Band(doubled.y / 2))) {
+    if (RayCrosses(cast[j].from, cast[j].to, doubled)) {
+      beyond = !beyond;
+    }
+  }
+  // An upward edge has +x on its right, a rightward edge has +y on its left.
+  return horizontal ? (edge.to.x > edge.from.x) == beyond : (edge.to.y > edge.from.y) != beyond;
+}
+
+// Returns the boundary of the even-odd area of the rings, oriented so that the area (or its
+// complement when `complement` is set) is on the left of every edge. Rings may cross or overlap
+// themselves and each other: edges are split where they meet, pieces covered an even number of
+// times are not on the boundary, and the side of the area is found by a ray cast from each piece.
+std::vector<Edge> OrientedEdges(const std::vector<GeoPolygon> &polygons, const Grid &grid,
+                                bool complement) {
+  std::vector<Ring> rings;
+  for (const GeoPolygon &polygon : polygons) {
+    AddRing(polygon.outer, grid, &rings);
+    for (const std::vector<GeoPoint> &hole : polygon.holes) {
+      AddRing(hole, grid, &rings);
+    }
+  }
+  std::vector<Edge> edges;
+  for (const Ring &ring : rings) {
+    for (size_t k = 0; k < ring.size(); k++) {
+      edges.push_back({ring[k], ring[(k + 1) % ring.size()]});
+    }
+  }
+  std::vector<std::vector<Point>> splits(edges.size());
+  FindIntersections(edges, edges, &splits, &splits);
+  std::vector<Edge> pieces = SplitEdges(edges, &splits);
+
+  // Pieces are counted regardless of direction, under the direction of their lower endpoint.
+  auto canonical = [](const Edge &edge) {
+    bool forward = edge.from.x < edge.to.x || (edge.from.x == edge.to.x && edge.from.y < edge.to.y);
+    return forward ? edge : Reversed(edge);
+  };
+  std::unordered_map<Edge, int, EdgeHash> counts;
+  counts.reserve(pieces.size());
+  for (const Edge &piece : pieces) {
+    counts[canonical(piece)]++;
+  }
+  std::vector<Edge> boundary;
+  for (const Edge &piece : pieces) {
+    auto found = counts.find(canonical(piece));
+    if (found->second % 2 == 1) {
+      boundary.push_back(piece);
+      found->second = 0;
+    }
+  }
+
+  std::vector<Edge> transposed;
+  transposed.reserve(boundary.size());
+  for (const Edge &edge : boundary) {
+    transposed.push_back(Transpose(edge));
+  }
+  BandIndex rows(boundary);
+  BandIndex columns(transposed);
+  std::vector<Edge> oriented;
+  oriented.reserve(boundary.size());
+  for (size_t i = 0; i < boundary.size(); i++) {
+    bool keep = AreaOnLeft(i, boundary, rows, transposed, columns) != complement;
+    oriented.push_back(keep ? boundary[i] : Reversed(boundary[i]));
+  }
+  return oriented;
+}
+
+Location Locate(const Edge &edge, const EdgeSet &otherEdges, const BandIndex &otherIndex,
+                const std::vector<Edge> &other) {
+  if (otherEdges.count(edge) > 0) {
+    return Location::kSharedSame;
+  }
+  if (otherEdges.count({edge.to, edge.from}) > 0) {
+    return Location::kSharedOpposite;
+  }
+  Point doubled{edge.from.x + edge.to.x, edge.from.y + edge.to.y};
+  bool inside = false;
+  for (uint32_t i : otherIndex.EdgesInBand(otherIndex.Band(doubled.y / 2))) {
+    if (RayCrosses(other[i].from, other[i].to, doubled)) {
+      inside = !inside;
+    }
+  }
+  return inside ? Location::kInside : Location::kOutside;
+}
+
+// Follows the edges into rings. At a vertex with several outgoing edges, the first one clockwise
+// from the incoming edge is taken, which keeps the inside on the left and separates rings that
+// touch at a vertex.
+std::vector<Ring> LinkRings(const std::vector<Edge> &edges) {
+  std::unordered_map<Point, std::vector<uint32_t>, PointHash> outgoing;
+  for (uint32_t i = 0; i < edges.size(); i++) {
+    outgoing[edges[i].from].push_back(i);
+  }
+
+  std::vector<Ring> rings;
+  std::vector<bool> used(edges.size(), false);
+  for (uint32_t start = 0; start < edges.size(); start++) {
+    if (used[start]) {
+      continue;
+    }
+    Ring ring;
+    uint32_t current = start;
+    bool closed = false;
+    while (true) {
+      used[current] = true;
+      const Edge &incoming = edges[current];
+      ring.push_back(incoming.from);
+      double backX = static_cast<double>(incoming.from.x - incoming.to.x);
+      double backY = static_cast<double>(incoming.from.y - incoming.to.y);
+      uint32_t next = UINT32_MAX;
+      double bestAngle = INFINITY;
+      for (uint32_t candidate : outgoing[incoming.to]) {
+        const Edge &edge = edges[candidate];
+        double outX = static_cast<double>(edge.to.x - edge.from.x);
+        double outY = static_cast<double>(edge.to.y - edge.from.y);
+        double angle = -std::atan2(backX * outY - backY * outX, backX * outX + backY * outY);
+        if (angle <= 0) {
+          angle += 2 * M_PI;
+        }
+        if (angle < bestAngle) {
+          bestAngle = angle;
+          next = candidate;
+        }
+      }
+      if (next == start) {
+        closed = true;
+        break;
+      }
+      if (next == UINT32_MAX || used[next]) {
+        break;
+      }
+      current = next;
+    }
+    if (closed) {
+      rings.push_back(std::move(ring));
+    }
+  }
+  return rings;
+}
+
+// Removes collinear vertices and spikes.
+Ring Simplify(const Ring &ring) {
+  Ring result;
+  result.reserve(ring.size());
+  for (const Point &point : ring) {
+    while (result.size() >= 2 && Cross(result[result.size() - 2], result.back(), point) == 0) {
+      result.pop_back();
+    }
+    result.push_back(point);
+  }
+  bool changed = true;
+  while (changed && result.size() >= 3) {
+    changed = false;
+    if (Cross(result[result.size() - 2], result.back(), result[0]) == 0) {
+      result.pop_back();
+      changed = true;
+    } else if (Cross(result.back(), result[0], result[1]) == 0) {
+      result.erase(result.begin());
+      changed = true;
+    }
+  }
+  return result;
+}
+
+std::vector<GeoPoint> ToGeo(const Ring &ring, const Grid &grid) {
+  std::vector<GeoPoint> points;
+  points.reserve(ring.size());
+  for (const Point &point : ring) {
+    points.push_back(grid.ToGeo(point));
+  }
+  return points;
+}
+
+// Groups the rings into polygons, each hole going to the smallest outer ring that contains it.
+std::vector<GeoPolygon> Assemble(const std::vector<Ring> &rings, const Grid &grid) {
+  std::vector<Ring> outers;
+  std::vector<double> outerAreas;
+  std::vector<Ring> holes;
+  for (const Ring &linked : rings) {
+    Ring ring = Simplify(linked);
+    if (ring.size() < 3) {
+      continue;
+    }
+    double area = SignedArea(ring);
+    if (area > 0) {
+      outers.push_back(std::move(ring));
+      outerAreas.push_back(area);
+    } else if (area < 0) {
+      holes.push_back(std::move(ring));
+    }
+  }
+
+  std::vector<GeoPolygon> polygons(outers.size());
+  for (size_t i = 0; i < outers.size(); i++) {
+    polygons[i].outer = ToGeo(outers[i], grid);
+  }
+  for (const Ring &hole : holes) {
+    Point doubled{hole[0].x + hole[1].x, hole[0].y + hole[1].y};
+    double holeArea = -SignedArea(hole);
+    size_t owner = outers.size();
+    for (size_t i = 0; i < outers.size(); i++) {
+      bool smaller = owner == outers.size() || outerAreas[i] < outerAreas[owner];
+      if (outerAreas[i] > holeArea && smaller && RingContains(outers[i], doubled)) {
+        owner = i;
+      }
+    }
+    if (owner < outers.size()) {
+      polygons[owner].holes.push_back(ToGeo(hole, grid));
+    }
+  }
+  return polygons;
+}
+
+}  // namespace
+
+std::vector<GeoPolygon> ClipPolygons(const std::vector<GeoPolygon> &subject,
+                                     const std::vector<GeoPolygon> &clip,
+                                     ClipOperation operation) {
+  Grid grid(subject, clip);
+  // The difference is computed as the intersection with the complement of the clip operand.
+  std::vector<Edge> a = OrientedEdges(subject, grid, false);
+  std::vector<Edge> b = OrientedEdges(clip, grid, operation == ClipOperation::kDifference);
+
+  std::vector<std::vector<Point>> splitsA(a.size());
+  std::vector<std::vector<Point>> splitsB(b.size());
+  FindIntersections(a, b, &splitsA, &splitsB);
+  std::vector<Edge> pieces[2] = {SplitEdges(a, &splitsA), SplitEdges(b, &splitsB)};
+  EdgeSet pieceSets[2] = {EdgeSet(pieces[0].begin(), pieces[0].end()),
+                          EdgeSet(pieces[1].begin(), pieces[1].end())};
+  BandIndex indices[2] = {BandIndex(pieces[0]), BandIndex(pieces[1])};
+
+  // A piece is kept when the result is on its left and not on its right. Pieces shared by both
+  // operands are kept once, from the subject.
+  bool keepInside[2] = {operation == ClipOperation::kIntersection,
+                        operation != ClipOperation::kUnion};
+  std::vector<Edge> kept;
+  for (int operand = 0; operand < 2; operand++) {
+    int other = 1 - operand;
+    for (const Edge &piece : pieces[operand]) {
+      Location location = Locate(piece, pieceSets[other], indices[other], pieces[other]);
+      bool keep = location == (keepInside[operand] ? Location::kInside : Location::kOutside) ||
+                  (operand == 0 && location == Location::kSharedSame);
+      if (keep) {
+        kept.push_back(piece);
+      }
+    }
+  }
+
+  // Pieces kept in both directions are inside on both sides and cancel out. Duplicates are kept
+  // once.
+  std::unordered_map<Edge, int, EdgeHash> counts;
+  for (const Edge &edge : kept) {
+    counts[edge]++;
+  }
+  std::vector<Edge> edges;
+  EdgeSet emitted;
+  for (const Edge &edge : kept) {
+    Edge reversed{edge.to, edge.from};
+    auto found = counts.find(reversed);
+    if (counts[edge] > (found != counts.end() ? found->second : 0) && emitted.insert(edge).second) {
+      edges.push_back(edge);
+    }
+  }
+
+  return Assemble(LinkRings(edges), grid);
+}
+
+}  // namespace navsdk
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavPolygonClipper_h
+#define NavPolygonClipper_h
+
+// Portable C++ core of the polygon boolean operations. It has no platform dependencies, so that
+// it can be built and checked on any host.
+
+#include <vector>
+
+#include "NavGeometry.h"
+
+namespace navsdk {
+
+// Values match the operations of the JS API.
+enum class ClipOperation {
+  kUnion = 0,
+  kIntersection = 1,
+  kDifference = 2,
+};
+
+// Computes `subject` <operation> `clip`, where each operand is the even-odd area of all its
+// rings, so ring orientation does not matter. Rings may cross or overlap themselves and other
+// rings of the same operand; where an even number of them overlap, the area is outside.
+//
+// Coordinates are snapped to an integer grid of 1e-7 degrees, coarsened for operands spanning
+// more than about 100 degrees, so that every predicate is evaluated exactly in 64-bit integers.
+// Crossings are rounded to the grid. Result outer rings are counterclockwise and holes clockwise,
+// with longitude as x.
+std::vector<GeoPolygon> ClipPolygons(const std::vector<GeoPolygon> &subject,
+                                     const std::vector<GeoPolygon> &clip,
+                                     ClipOperation operation);
+
+}  // namespace navsdk
+
+#endif /* NavPolygonClipper_h */
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NavPolylineSimplifier.h"
+
+#include <cmath>
+#include <utility>
+
+namespace navsdk {
+
+namespace {
+
+const double kMetersPerDegree = 6371009 * M_PI / 180;
+
+struct Point {
+  double x;
+  double y;
+};
+
+double SquaredSegmentDistance(Point p, Point a, Point b) {
+  double dx = b.x - a.x;
+  double dy = b.y - a.y;
+  double lengthSquared = dx * dx + dy * dy;
+  double t = 0;
+  if (lengthSquared > 0) {
+    t = ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared;
+    t = std::fmax(0.0, std::fmin(1.0, t));
+  }
+  double ex = a.x + t * dx - p.x;
+  double ey = a.y + t * dy - p.y;
+  return ex * ex + ey * ey;
+}
+
+}  // namespace
+
+std::vector<GeoPoint> SimplifyPolyline(const std::vector<GeoPoint> &points,
+                                       double toleranceMeters) {
+  size_t count = points.size();
+  if (!(toleranceMeters > 0) || count < 3) {
+    return points;
+  }
+
+  // Project around the first point, with longitudes unwrapped relative to it.
+  double xScale = kMetersPerDegree * std::cos(points[0].lat * M_PI / 180);
+  std::vector<Point> projected(count);
+  for (size_t i = 0; i < count; i++) {
+    double dLng = std::remainder(points[i].lng - points[0].lng, 360.0);
+    projected[i] = {dLng * xScale, (points[i].lat - points[0].lat) * kMetersPerDegree};
+  }
+
+  std::vector<bool> keep(count, false);
+  keep[0] = true;
+  keep[count - 1] = true;
+  double toleranceSquared = toleranceMeters * toleranceMeters;
+  // Ranges still to split, processed with an explicit stack so long lines cannot overflow it.
+  std::vector<std::pair<size_t, size_t>> ranges = {{0, count - 1}};
+  while (!ranges.empty()) {
+    auto [first, last] = ranges.back();
+    ranges.pop_back();
+    double farthest = toleranceSquared;
+    size_t split = 0;
+    for (size_t i = first + 1; i < last; i++) {
+      double distance = SquaredSegmentDistance(projected[i], projected[first], projected[last]);
+      if (distance > farthest) {
+        farthest = distance;
+        split = i;
+      }
+    }
+    if (split == 0) {
+      continue;
+    }
+    keep[split] = true;
+    if (split - first > 1) {
+      ranges.emplace_back(first, split);
+    }
+    if (last - split > 1) {
+      ranges.emplace_back(split, last);
+    }
+  }
+
+  std::vector<GeoPoint> result;
+  for (size_t i = 0; i < count; i++) {
+    if (keep[i]) {
+      result.push_back(points[i]);
+    }
+  }
+  return result;
+}
+
+}  // namespace navsdk
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavPolylineSimplifier_h
+#define NavPolylineSimplifier_h
+
+// Portable C++ core of polyline simplification. It has no platform dependencies, so that it can be
+// built and checked on any host.
+
+#include <vector>
+
+#include "NavGeometry.h"
+
+namespace navsdk {
+
+// Douglas-Peucker simplification: keeps the end points and every vertex needed so that no removed
+// vertex is farther than `toleranceMeters` from the simplified line. Distances are measured in a
+// local equirectangular projection, which is accurate for the short tolerances used on screen.
+// Returns the points unchanged when the tolerance is not positive.
+std::vector<GeoPoint> SimplifyPolyline(const std::vector<GeoPoint> &points,
+                                       double toleranceMeters);
+
+}  // namespace navsdk
+
+#endif /* NavPolylineSimplifier_h */
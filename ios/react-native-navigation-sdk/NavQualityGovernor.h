@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import "NavFrameSampler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Range a quality knob may be adjusted within. `best` is used at full quality and `cheapest`
+ * when the governor has degraded quality as far as allowed; either may be the larger value.
+ */
+typedef struct {
+  double best;
+  double cheapest;
+} NavQualityBounds;
+
+/// Governor configuration. Knob values are in the units documented on NavQualitySettings.
+@interface NavQualityGovernorConfig : NSObject
+@property(nonatomic, assign) double targetFrameRate;
+@property(nonatomic, assign) NSTimeInterval evaluationInterval;
+@property(nonatomic, assign) NavQualityBounds polylineTolerance;
+@property(nonatomic, assign) NavQualityBounds clusterRadius;
+@property(nonatomic, assign) NavQualityBounds eventRate;
+@property(nonatomic, assign) NavQualityBounds animationFrameRate;
+@property(nonatomic, assign) NavQualityBounds virtualizationMargin;
+@end
+
+/// Current values of the quality knobs, read by the features they control.
+@interface NavQualitySettings : NSObject
+/// Polyline simplification tolerance in meters.
+@property(nonatomic, assign) double polylineTolerance;
+/// Marker clustering radius in points.
+@property(nonatomic, assign) double clusterRadius;
+/// Maximum rate of high-frequency view events in Hz.
+@property(nonatomic, assign) double eventRate;
+/// Frame rate of natively driven animations.
+@property(nonatomic, assign) double animationFrameRate;
+/// Extra area around the viewport kept materialized, as a fraction of the viewport size.
+@property(nonatomic, assign) double virtualizationMargin;
+@end
+
+/// Called once per knob that changed, with the knob name, its previous and new value and the
+/// frame window that triggered the change.
+typedef void (^NavQualityAdjustmentHandler)(NSDictionary *adjustment);
+
+/**
+ * Samples frame pacing and main-thread load of a view and moves the quality knobs between their
+ * configured bounds: quality is lowered one step when frames are late, hitching or the main
+ * thread is saturated, and raised one step after several consecutive healthy windows.
+ */
+@interface NavQualityGovernor : NSObject
+
+@property(nonatomic, readonly) NavQualityGovernorConfig *config;
+@property(nonatomic, readonly) NavQualitySettings *settings;
+/// 0 for best quality, 1 for the cheapest settings allowed.
+@property(nonatomic, readonly) double qualityLevel;
+
+- (instancetype)initWithConfig:(NavQualityGovernorConfig *)config
+                       sampler:(NavFrameSampler *)sampler
+                  onAdjustment:(NavQualityAdjustmentHandler)onAdjustment;
+
+- (void)start;
+- (void)stop;
+
+@end
+
+NS_ASSUME_NONNULL_END
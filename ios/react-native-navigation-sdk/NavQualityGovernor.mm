@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavQualityGovernor.h"
+
+static const double kLevelStep = 0.25;
+static const double kSlowFrameFactor = 1.15;
+static const double kHealthyFrameFactor = 0.9;
+static const double kMaxHitchRatio = 0.05;
+static const double kHealthyHitchRatio = 0.01;
+static const double kMaxMainThreadLoad = 0.85;
+static const double kHealthyMainThreadLoad = 0.6;
+static const NSUInteger kHealthyWindowsBeforeUpgrade = 3;
+
+@implementation NavQualityGovernorConfig
+@end
+
+@implementation NavQualitySettings
+@end
+
+static double NavQualityValue(NavQualityBounds bounds, double level) {
+  return bounds.best + (bounds.cheapest - bounds.best) * level;
+}
+
+@implementation NavQualityGovernor {
+  NavFrameSampler *_sampler;
+  NSTimer *_timer;
+  NavQualityAdjustmentHandler _onAdjustment;
+  NSUInteger _healthyWindows;
+}
+
+- (instancetype)initWithConfig:(NavQualityGovernorConfig *)config
+                       sampler:(NavFrameSampler *)sampler
+                  onAdjustment:(NavQualityAdjustmentHandler)onAdjustment {
+  self = [super init];
+  if (self) {
+    _config = config;
+    _onAdjustment = [onAdjustment copy];
+    _sampler = sampler;
+    _settings = [[NavQualitySettings alloc] init];
+    _qualityLevel = 0;
+    [self applyLevel];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [self stop];
+}
+
+- (void)start {
+  if (_timer != nil) {
+    return;
+  }
+  [_sampler start];
+  // Discard frames sampled for other clients before this governor started.
+  [_sampler takeWindow];
+  __weak NavQualityGovernor *weakSelf = self;
+  _timer = [NSTimer scheduledTimerWithTimeInterval:MAX(0.25, _config.evaluationInterval)
+                                           repeats:YES
+                                             block:^(NSTimer *timer) {
+                                               [weakSelf evaluate];
+                                             }];
+}
+
+- (void)stop {
+  if (_timer == nil) {
+    return;
+  }
+  [_timer invalidate];
+  _timer = nil;
+  [_sampler stop];
+}
+
+- (void)evaluate {
+  NavFrameWindow window = [_sampler takeWindow];
+  if (window.frameCount == 0) {
+    // Nothing was rendered, e.g. the view is off screen.
+    return;
+  }
+
+  double targetFrameMs = _config.targetFrameRate > 0 ? 1000.0 / _config.targetFrameRate
+                                                     : _sampler.targetFrameMs;
+  double hitchRatio = (double)window.hitchCount / (double)window.frameCount;
+
+  NSString *reason = nil;
+  if (window.averageFrameMs > targetFrameMs * kSlowFrameFactor) {
+    reason = @"frameTime";
+  } else if (hitchRatio > kMaxHitchRatio) {
+    reason = @"hitches";
+  } else if (window.mainThreadLoad > kMaxMainThreadLoad) {
+    reason = @"mainThreadLoad";
+  }
+
+  double level = _qualityLevel;
+  if (reason != nil) {
+    _healthyWindows = 0;
+    level = MIN(1.0, level + kLevelStep);
+  } else if (window.averageFrameMs < targetFrameMs * kHealthyFrameFactor &&
+             hitchRatio < kHealthyHitchRatio && window.mainThreadLoad < kHealthyMainThreadLoad) {
+    if (++_healthyWindows >= kHealthyWindowsBeforeUpgrade) {
+      _healthyWindows = 0;
+      level = MAX(0.0, level - kLevelStep);
+      reason = @"headroom";
+    }
+  } else {
+    _healthyWindows = 0;
+  }
+
+  if (level == _qualityLevel) {
+    return;
+  }
+
+  NavQualitySettings *previous = [self snapshotSettings];
+  _qualityLevel = level;
+  [self applyLevel];
+  [self reportChangesFrom:previous reason:reason window:window hitchRatio:hitchRatio];
+}
+
+- (void)applyLevel {
+  _settings.polylineTolerance = NavQualityValue(_config.polylineTolerance, _qualityLevel);
+  _settings.clusterRadius = NavQualityValue(_config.clusterRadius, _qualityLevel);
+  _settings.eventRate = NavQualityValue(_config.eventRate, _qualityLevel);
+  _settings.animationFrameRate = NavQualityValue(_config.animationFrameRate, _qualityLevel);
+  _settings.virtualizationMargin = NavQualityValue(_config.virtualizationMargin, _qualityLevel);
+}
+
+- (NavQualitySettings *)snapshotSettings {
+  NavQualitySettings *snapshot = [[NavQualitySettings alloc] init];
+  snapshot.polylineTolerance = _settings.polylineTolerance;
+  snapshot.clusterRadius = _settings.clusterRadius;
+  snapshot.eventRate = _settings.eventRate;
+  snapshot.animationFrameRate = _settings.animationFrameRate;
+  snapshot.virtualizationMargin = _settings.virtualizationMargin;
+  return snapshot;
+}
+
+- (void)reportChangesFrom:(NavQualitySettings *)previous
+                   reason:(NSString *)reason
+                   window:(NavFrameWindow)window
+               hitchRatio:(double)hitchRatio {
+  if (_onAdjustment == nil) {
+    return;
+  }
+  NSArray<NSString *> *knobs = @[
+    @"polylineTolerance", @"clusterRadius", @"eventRate", @"animationFrameRate",
+    @"virtualizationMargin"
+  ];
+  for (NSString *knob in knobs) {
+    double previousValue = [[previous valueForKey:knob] doubleValue];
+    double value = [[_settings valueForKey:knob] doubleValue];
+    if (previousValue == value) {
+      continue;
+    }
+    _onAdjustment(@{
+      @"knob" : knob,
+      @"previousValue" : @(previousValue),
+      @"value" : @(value),
+      @"qualityLevel" : @(_qualityLevel),
+      @"reason" : reason,
+      @"averageFrameMs" : @(window.averageFrameMs),
+      @"hitchRatio" : @(hitchRatio),
+      @"mainThreadLoad" : @(window.mainThreadLoad),
+    });
+  }
+}
+
+@end
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import "NavFrameSampler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Returns the current number of overlays per type, keyed by type name.
+typedef NSDictionary<NSString *, NSNumber *> *_Nonnull (^NavOverlayCountsProvider)(void);
+
+/**
+ * Collects cumulative frame pacing statistics of a view: a frame interval histogram, hitches and
+ * the longest frame. Each hitch is recorded with the overlay count and the module commands that
+ * preceded it, to tie jank to specific overlay loads.
+ */
+@interface NavRenderMetrics : NSObject
+
+/// Upper bounds in milliseconds of the histogram buckets; the last bucket is unbounded.
+@property(class, nonatomic, readonly) NSArray<NSNumber *> *histogramBucketsMs;
+
+- (instancetype)initWithSampler:(NavFrameSampler *)sampler
+          overlayCountsProvider:(NavOverlayCountsProvider)overlayCountsProvider;
+
+/**
+ * When positive and a report handler is set, a snapshot is delivered every `reportInterval`
+ * seconds and a new period is started. Must be set before start.
+ */
+@property(nonatomic, assign) NSTimeInterval reportInterval;
+@property(nonatomic, copy, nullable) void (^reportHandler)(NSDictionary *snapshot);
+
+- (void)start;
+- (void)stop;
+
+/// Records a module command issued for the view. Must be called on the main thread.
+- (void)recordCommand:(NSString *)name;
+
+/// Returns the statistics collected since the last reset, optionally starting a new period.
+- (NSDictionary *)snapshotAndReset:(BOOL)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
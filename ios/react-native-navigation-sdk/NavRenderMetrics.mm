@@ -0,0 +1,208 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavRenderMetrics.h"
+
+static const double kHitchThreshold = 1.5;
+static const NSUInteger kMaxRecentCommands = 32;
+static const NSUInteger kMaxRecordedHitches = 16;
+// Commands issued within this window before a hitch are attributed to it.
+static const CFTimeInterval kHitchCommandWindow = 1.0;
+
+@implementation NavRenderMetrics {
+  NavFrameSampler *_sampler;
+  NavOverlayCountsProvider _overlayCountsProvider;
+  BOOL _started;
+  NSTimer *_reportTimer;
+
+  CFTimeInterval _periodStart;
+  NSUInteger _frameCount;
+  double _frameSumMs;
+  double _longestFrameMs;
+  CFTimeInterval _longestFrameTimestamp;
+  NSUInteger _hitchCount;
+  NSMutableArray<NSNumber *> *_histogram;
+  NSMutableArray<NSDictionary *> *_hitches;
+
+  // Like the frame statistics, only accessed on the main thread.
+  NSMutableArray<NSDictionary *> *_recentCommands;
+}
+
++ (NSArray<NSNumber *> *)histogramBucketsMs {
+  return @[ @8.4, @16.7, @25, @33.4, @50, @100 ];
+}
+
+- (instancetype)initWithSampler:(NavFrameSampler *)sampler
+          overlayCountsProvider:(NavOverlayCountsProvider)overlayCountsProvider {
+  self = [super init];
+  if (self) {
+    _sampler = sampler;
+    _overlayCountsProvider = [overlayCountsProvider copy];
+    _recentCommands = [NSMutableArray array];
+    _hitches = [NSMutableArray array];
+    _histogram = [NSMutableArray array];
+    [self reset];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [self stop];
+}
+
+- (void)start {
+  if (_started) {
+    return;
+  }
+  _started = YES;
+  [self reset];
+  __weak NavRenderMetrics *weakSelf = self;
+  _sampler.frameHandler = ^(double frameMs, CFTimeInterval timestamp) {
+    [weakSelf recordFrame:frameMs timestamp:timestamp];
+  };
+  [_sampler start];
+
+  if (_reportInterval > 0 && _reportHandler) {
+    _reportTimer = [NSTimer scheduledTimerWithTimeInterval:_reportInterval
+                                                   repeats:YES
+                                                     block:^(NSTimer *timer) {
+                                                       [weakSelf report];
+                                                     }];
+  }
+}
+
+- (void)report {
+  if (_reportHandler) {
+    _reportHandler([self snapshotAndReset:YES]);
+  }
+}
+
+- (void)stop {
+  if (!_started) {
+    return;
+  }
+  _started = NO;
+  [_reportTimer invalidate];
+  _reportTimer = nil;
+  _sampler.frameHandler = nil;
+  [_sampler stop];
+}
+
+- (void)reset {
+  _periodStart = CACurrentMediaTime();
+  _frameCount = 0;
+  _frameSumMs = 0;
+  _longestFrameMs = 0;
+  _longestFrameTimestamp = 0;
+  _hitchCount = 0;
+  [_hitches removeAllObjects];
+  [_histogram removeAllObjects];
+  for (NSUInteger i = 0; i <= [NavRenderMetrics histogramBucketsMs].count; i++) {
+    [_histogram addObject:@0];
+  }
+}
+
+- (void)recordCommand:(NSString *)name {
+  [_recentCommands addObject:@{@"name" : name, @"timestamp" : @(CACurrentMediaTime())}];
+  if (_recentCommands.count > kMaxRecentCommands) {
+    [_recentCommands removeObjectAtIndex:0];
+  }
+}
+
+- (void)recordFrame:(double)frameMs timestamp:(CFTimeInterval)timestamp {
+  _frameCount++;
+  _frameSumMs += frameMs;
+  if (frameMs > _longestFrameMs) {
+    _longestFrameMs = frameMs;
+    _longestFrameTimestamp = timestamp;
+  }
+
+  NSArray<NSNumber *> *buckets = [NavRenderMetrics histogramBucketsMs];
+  NSUInteger bucket = 0;
+  while (bucket < buckets.count && frameMs > buckets[bucket].doubleValue) {
+    bucket++;
+  }
+  _histogram[bucket] = @(_histogram[bucket].unsignedIntegerValue + 1);
+
+  if (frameMs <= _sampler.targetFrameMs * kHitchThreshold) {
+    return;
+  }
+  _hitchCount++;
+
+  NSUInteger overlayCount = 0;
+  for (NSNumber *count in _overlayCountsProvider().allValues) {
+    overlayCount += count.unsignedIntegerValue;
+  }
+  NSMutableArray<NSString *> *commands = [NSMutableArray array];
+  for (NSDictionary *command in _recentCommands) {
+    if (timestamp - [command[@"timestamp"] doubleValue] <= kHitchCommandWindow) {
+      [commands addObject:command[@"name"]];
+    }
+  }
+  [_hitches addObject:@{
+    @"frameMs" : @(frameMs),
+    @"timestamp" : @(timestamp),
+    @"overlayCount" : @(overlayCount),
+    @"commands" : commands,
+  }];
+  if (_hitches.count > kMaxRecordedHitches) {
+    [_hitches removeObjectAtIndex:0];
+  }
+}
+
+- (NSDictionary *)snapshotAndReset:(BOOL)reset {
+  CFTimeInterval now = CACurrentMediaTime();
+
+  NSMutableArray<NSDictionary *> *hitches = [NSMutableArray array];
+  for (NSDictionary *hitch in _hitches) {
+    [hitches addObject:@{
+      @"frameMs" : hitch[@"frameMs"],
+      @"ageMs" : @((now - [hitch[@"timestamp"] doubleValue]) * 1000.0),
+      @"overlayCount" : hitch[@"overlayCount"],
+      @"commands" : hitch[@"commands"],
+    }];
+  }
+
+  NSMutableArray<NSDictionary *> *recentCommands = [NSMutableArray array];
+  for (NSDictionary *command in _recentCommands) {
+    [recentCommands addObject:@{
+      @"name" : command[@"name"],
+      @"ageMs" : @((now - [command[@"timestamp"] doubleValue]) * 1000.0),
+    }];
+  }
+
+  NSDictionary *snapshot = @{
+    @"durationMs" : @((now - _periodStart) * 1000.0),
+    @"frameCount" : @(_frameCount),
+    @"averageFrameMs" : @(_frameCount > 0 ? _frameSumMs / _frameCount : 0),
+    @"longestFrameMs" : @(_longestFrameMs),
+    @"longestFrameAgeMs" :
+        @(_longestFrameTimestamp > 0 ? (now - _longestFrameTimestamp) * 1000.0 : 0),
+    @"hitchCount" : @(_hitchCount),
+    @"histogramBucketsMs" : [NavRenderMetrics histogramBucketsMs],
+    @"histogram" : [_histogram copy],
+    @"hitches" : hitches,
+    @"recentCommands" : recentCommands,
+    @"overlayCounts" : _overlayCountsProvider(),
+  };
+
+  if (reset) {
+    [self reset];
+  }
+  return snapshot;
+}
+
+@end
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavRouteDiff_h
+#define NavRouteDiff_h
+
+#import <Foundation/Foundation.h>
+#import <GoogleNavigation/GoogleNavigation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Diffs each route against the previous one so reroutes can be reported as patches. Vertices are
+ * compared after quantizing to 1e-6 degrees; per leg, the common prefix and suffix are kept and
+ * only the vertices in between are reported.
+ */
+@interface NavRouteDiff : NSObject
+
+/**
+ * Diffs `legs` against the route of the previous call and remembers them for the next one. Returns
+ * an `onRouteChanged` payload: {fullReplacement, droppedLegCount, legCount, legChanges}, where each
+ * leg change is {legIndex, start, removedCount, latLngs} with packed [lat, lng, ...] vertices.
+ */
+- (NSDictionary *)diffWithLegs:(nullable NSArray<GMSRouteLeg *> *)legs;
+
+/// Forgets the previous route, so that the next diff is a full replacement.
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavRouteDiff_h */
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavRouteDiff.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+const std::vector<uint64_t> kNoVertices;
+
+// Packs a coordinate quantized to 1e-6 degrees, about 0.1 m, into one comparable value.
+uint64_t QuantizeCoordinate(CLLocationCoordinate2D coordinate) {
+  int32_t lat = static_cast<int32_t>(std::lround(coordinate.latitude * 1e6));
+  int32_t lng = static_cast<int32_t>(std::lround(coordinate.longitude * 1e6));
+  return (static_cast<uint64_t>(static_cast<uint32_t>(lat)) << 32) | static_cast<uint32_t>(lng);
+}
+
+std::vector<uint64_t> QuantizePath(GMSPath *path) {
+  NSUInteger count = path.count;
+  std::vector<uint64_t> vertices(count);
+  for (NSUInteger i = 0; i < count; i++) {
+    vertices[i] = QuantizeCoordinate([path coordinateAtIndex:i]);
+  }
+  return vertices;
+}
+
+NSArray<NSNumber *> *PackPath(GMSPath *path, NSUInteger start, NSUInteger end) {
+  NSMutableArray<NSNumber *> *latLngs = [NSMutableArray arrayWithCapacity:(end - start) * 2];
+  for (NSUInteger i = start; i < end; i++) {
+    CLLocationCoordinate2D coordinate = [path coordinateAtIndex:i];
+    [latLngs addObject:@(coordinate.latitude)];
+    [latLngs addObject:@(coordinate.longitude)];
+  }
+  return latLngs;
+}
+
+}  // namespace
+
+@implementation NavRouteDiff {
+  std::vector<std::vector<uint64_t>> _legs;
+  BOOL _hasRoute;
+}
+
+- (NSDictionary *)diffWithLegs:(NSArray<GMSRouteLeg *> *)legs {
+  std::vector<std::vector<uint64_t>> newLegs;
+  newLegs.reserve(legs.count);
+  for (GMSRouteLeg *leg in legs) {
+    newLegs.push_back(QuantizePath(leg.path));
+  }
+
+  // Arriving at a waypoint drops the legs before it, so the remaining legs are aligned with the end
+  // of the previous route. A route with more legs than before is reported as a whole.
+  BOOL fullReplacement = !_hasRoute || newLegs.size() > _legs.size();
+  NSUInteger dropped = fullReplacement ? 0 : _legs.size() - newLegs.size();
+
+  NSMutableArray<NSDictionary *> *legChanges = [NSMutableArray array];
+  for (NSUInteger i = 0; i < newLegs.size(); i++) {
+    const std::vector<uint64_t> &current = newLegs[i];
+    const std::vector<uint64_t> &previous = fullReplacement ? kNoVertices : _legs[i + dropped];
+    if (!fullReplacement && current == previous) {
+      continue;
+    }
+
+    size_t limit = std::min(current.size(), previous.size());
+    size_t prefix = 0;
+    while (prefix < limit && current[prefix] == previous[prefix]) {
+      prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < limit - prefix &&
+           current[current.size() - 1 - suffix] == previous[previous.size() - 1 - suffix]) {
+      suffix++;
+    }
+
+    [legChanges addObject:@{
+      @"legIndex" : @(i),
+      @"start" : @(prefix),
+      @"removedCount" : @(previous.size() - prefix - suffix),
+      @"latLngs" : PackPath(legs[i].path, prefix, current.size() - suffix),
+    }];
+  }
+
+  _legs = std::move(newLegs);
+  _hasRoute = YES;
+  return @{
+    @"fullReplacement" : @(fullReplacement),
+    @"droppedLegCount" : @(dropped),
+    @"legCount" : @(legs.count),
+    @"legChanges" : legChanges,
+  };
+}
+
+- (void)reset {
+  _legs.clear();
+  _hasRoute = NO;
+}
+
+@end
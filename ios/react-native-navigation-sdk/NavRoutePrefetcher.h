@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NavRoutePrefetcher_h
+#define NavRoutePrefetcher_h
+
+#import <GoogleNavigation/GoogleNavigation.h>
+#import "NavWorkerPool.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Called on the main thread with the features newly staged by a prefetcher and the ids of the
+ * staged features it evicted. Features are the JSON objects of the store.
+ */
+typedef void (^NavRoutePrefetchHandler)(NSArray<NSDictionary<NSString *, id> *> *staged,
+                                        NSArray<NSString *> *evicted);
+
+/**
+ * Loads point features along the upcoming part of the route from a file-backed tile store. The
+ * store is a directory of `{z}/{x}/{y}.json` files, each holding a JSON array of features with an
+ * `id`, `lat` and `lng`. As the road-snapped location advances, the prefetcher covers the next
+ * `aheadMeters` of the route with a corridor of `corridorMeters` on each side, reads the tiles it
+ * touches on the worker pool and stages the features inside the corridor. Once more than
+ * `maxFeatures` are staged, the features the car has already passed are evicted first.
+ *
+ * All methods must be called on the main thread.
+ */
+@interface NavRoutePrefetcher : NSObject
+
+- (instancetype)initWithStorePath:(NSString *)storePath
+                         tileZoom:(NSInteger)tileZoom
+                      aheadMeters:(double)aheadMeters
+                   corridorMeters:(double)corridorMeters
+                      maxFeatures:(NSUInteger)maxFeatures
+                    lifetimeToken:(nullable NavCancellationToken *)lifetimeToken
+    NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+@property(nonatomic, readonly) NSString *storePath;
+@property(nonatomic, copy, nullable) NavRoutePrefetchHandler handler;
+/// Ids of the features currently staged.
+@property(nonatomic, readonly) NSArray<NSString *> *stagedIds;
+
+/// Replaces the route. Features staged for the previous route count as passed.
+- (void)setRouteLegs:(nullable NSArray<GMSRouteLeg *> *)routeLegs;
+- (void)updateWithLocation:(CLLocationCoordinate2D)coordinate;
+
+/// Stops tracking a feature whose overlay was removed by other means.
+- (void)forgetFeatureId:(NSString *)featureId;
+/// Stops tracking all features and loads the corridor again.
+- (void)forgetAllFeatures;
+
+/// Drops pending tile loads. The prefetcher stages nothing afterwards.
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavRoutePrefetcher_h */
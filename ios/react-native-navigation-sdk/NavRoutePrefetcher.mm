@@ -0,0 +1,524 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "NavRoutePrefetcher.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const double kEarthRadiusMeters = 6371009.0;
+// Locations farther than this from the route are ignored until the route changes.
+const double kOffRouteMeters = 150;
+// How far past the previous progress the location is searched for before searching the whole route.
+const double kProgressSearchMeters = 2000;
+
+struct RouteGeometry {
+  std::vector<CLLocationCoordinate2D> coordinates;
+  // Distance along the route of each vertex.
+  std::vector<double> meters;
+};
+
+// A tile requested for the corridor, with the range of route segments to test its features
+// against. A tile loaded before and reached by new segments carries its cached features.
+struct TileRequest {
+  uint64_t key;
+  long x;
+  long y;
+  size_t firstSegment;
+  size_t lastSegment;
+  double routeMeters;
+  NSArray<NSDictionary<NSString *, id> *> *cachedFeatures;
+};
+
+// A loaded tile, with its features and the last route segment they were tested against.
+struct LoadedTile {
+  NSArray<NSDictionary<NSString *, id> *> *features;
+  size_t lastSegment;
+  // Route distance past which the tile is no longer needed.
+  double routeMeters;
+};
+
+struct FoundFeature {
+  NSDictionary<NSString *, id> *feature;
+  NSString *featureId;
+  double routeMeters;
+  uint64_t tileKey;
+};
+
+uint64_t TileKey(long x, long y) { return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y; }
+
+double Distance(CLLocationCoordinate2D a, CLLocationCoordinate2D b) {
+  double lat1 = a.latitude * M_PI / 180;
+  double lat2 = b.latitude * M_PI / 180;
+  double dLat = lat2 - lat1;
+  double dLng = (b.longitude - a.longitude) * M_PI / 180;
+  double h = std::sin(dLat / 2) * std::sin(dLat / 2) +
+             std::cos(lat1) * std::cos(lat2) * std::sin(dLng / 2) * std::sin(dLng / 2);
+  return 2 * kEarthRadiusMeters * std::asin(std::min(1.0, std::sqrt(h)));
+}
+
+// Projects `point` on the segment from `a` to `b` in a local equirectangular frame, which is
+// accurate at corridor scale. Returns the distance and sets `t` to the position on the segment.
+double DistanceToSegment(CLLocationCoordinate2D point, CLLocationCoordinate2D a,
+                         CLLocationCoordinate2D b, double *t) {
+  double metersPerDegree = kEarthRadiusMeters * M_PI / 180;
+  double lngScale = metersPerDegree * std::cos(point.latitude * M_PI / 180);
+  double ax = (a.longitude - point.longitude) * lngScale;
+  double ay = (a.latitude - point.latitude) * metersPerDegree;
+  double bx = (b.longitude - point.longitude) * lngScale;
+  double by = (b.latitude - point.latitude) * metersPerDegree;
+  double dx = bx - ax;
+  double dy = by - ay;
+  double lengthSquared = dx * dx + dy * dy;
+  double position = lengthSquared > 0 ? std::clamp(-(ax * dx + ay * dy) / lengthSquared, 0.0, 1.0)
+                                      : 0;
+  *t = position;
+  double x = ax + position * dx;
+  double y = ay + position * dy;
+  return std::sqrt(x * x + y * y);
+}
+
+long TileX(double lng, long tileCount) {
+  long x = (long)std::floor((lng + 180) / 360 * tileCount);
+  return std::clamp(x, 0L, tileCount - 1);
+}
+
+long TileY(double lat, long tileCount) {
+  double clamped = std::clamp(lat, -85.05112878, 85.05112878) * M_PI / 180;
+  double y = (1 - std::log(std::tan(clamped) + 1 / std::cos(clamped)) / M_PI) / 2;
+  return std::clamp((long)std::floor(y * tileCount), 0L, tileCount - 1);
+}
+
+}  // namespace
+
+@implementation NavRoutePrefetcher {
+  NSInteger _tileZoom;
+  double _aheadMeters;
+  double _corridorMeters;
+  NSUInteger _maxFeatures;
+  NavCancellationToken *_lifetimeToken;
+  // Cancelled when the route changes, so loads for the previous route are dropped.
+  NavCancellationToken *_routeToken;
+
+  std::shared_ptr<const RouteGeometry> _route;
+  BOOL _located;
+  BOOL _hasLocation;
+  CLLocationCoordinate2D _lastLocation;
+  size_t _progressSegment;
+  double _progressMeters;
+  // End of the corridor requested last; the corridor is extended once progress gets close to it.
+  double _requestedUntilMeters;
+
+  // Loaded tiles, and pending tiles with the last segment that reached them while they load.
+  std::unordered_map<uint64_t, LoadedTile> _loadedTiles;
+  std::unordered_map<uint64_t, size_t> _pendingTiles;
+  // Route distance of each staged feature, or -infinity for features of a previous route.
+  NSMutableDictionary<NSString *, NSNumber *> *_stagedMeters;
+}
+
+- (instancetype)initWithStorePath:(NSString *)storePath
+                         tileZoom:(NSInteger)tileZoom
+                      aheadMeters:(double)aheadMeters
+                   corridorMeters:(double)corridorMeters
+                      maxFeatures:(NSUInteger)maxFeatures
+                    lifetimeToken:(NavCancellationToken *)lifetimeToken {
+  self = [super init];
+  if (self) {
+    _storePath = [storePath copy];
+    _tileZoom = std::clamp<NSInteger>(tileZoom, 0, 22);
+    _aheadMeters = std::max(aheadMeters, 100.0);
+    _corridorMeters = std::max(corridorMeters, 1.0);
+    _maxFeatures = maxFeatures;
+    _lifetimeToken = [[NavCancellationToken alloc] initWithParent:lifetimeToken];
+    _routeToken = [[NavCancellationToken alloc] initWithParent:_lifetimeToken];
+    _requestedUntilMeters = -INFINITY;
+    _stagedMeters = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
+- (NSArray<NSString *> *)stagedIds {
+  return _stagedMeters.allKeys;
+}
+
+- (void)cancel {
+  [_lifetimeToken cancel];
+  _loadedTiles.clear();
+  _pendingTiles.clear();
+}
+
+- (void)setRouteLegs:(NSArray<GMSRouteLeg *> *)routeLegs {
+  [_routeToken cancel];
+  _routeToken = [[NavCancellationToken alloc] initWithParent:_lifetimeToken];
+  _loadedTiles.clear();
+  _pendingTiles.clear();
+  _requestedUntilMeters = -INFINITY;
+  _located = NO;
+  _progressSegment = 0;
+  _progressMeters = 0;
+  for (NSString *featureId in _stagedMeters.allKeys) {
+    _stagedMeters[featureId] = @(-INFINITY);
+  }
+
+  auto route = std::make_shared<RouteGeometry>();
+  for (GMSRouteLeg *leg in routeLegs) {
+    GMSPath *path = leg.path;
+    for (NSUInteger i = 0; i < path.count; i++) {
+      CLLocationCoordinate2D coordinate = [path coordinateAtIndex:i];
+      if (!route->coordinates.empty()) {
+        // Consecutive legs share their waypoint.
+        double step = Distance(route->coordinates.back(), coordinate);
+        if (step == 0) {
+          continue;
+        }
+        route->meters.push_back(route->meters.back() + step);
+      } else {
+        route->meters.push_back(0);
+      }
+      route->coordinates.push_back(coordinate);
+    }
+  }
+  _route = route->coordinates.size() >= 2 ? route : nullptr;
+
+  if (_hasLocation) {
+    [self updateWithLocation:_lastLocation];
+  }
+}
+
+- (void)updateWithLocation:(CLLocationCoordinate2D)coordinate {
+  _hasLocation = YES;
+  _lastLocation = coordinate;
+  if (_route == nullptr || _lifetimeToken.cancelled) {
+    return;
+  }
+
+  if (!_located || ![self locate:coordinate from:_progressSegment limit:kProgressSearchMeters]) {
+    // Localize against the whole route, e.g. after a route change or a loop.
+    if (![self locate:coordinate from:0 limit:INFINITY]) {
+      return;
+    }
+  }
+  _located = YES;
+  [self refresh];
+}
+
+// Moves the progress to the closest point of the route within `limit` meters past the segment
+// `from`. Returns NO if that point is off route.
+- (BOOL)locate:(CLLocationCoordinate2D)coordinate from:(size_t)from limit:(double)limit {
+  const RouteGeometry &route = *_route;
+  double end = route.meters[from] + limit;
+  double bestDistance = INFINITY;
+  size_t bestSegment = from;
+  double bestT = 0;
+  for (size_t i = from; i + 1 < route.coordinates.size() && route.meters[i] <= end; i++) {
+    double t;
+    double distance =
+        DistanceToSegment(coordinate, route.coordinates[i], route.coordinates[i + 1], &t);
+    if (distance < bestDistance) {
+      bestDistance = distance;
+      bestSegment = i;
+      bestT = t;
+    }
+  }
+  if (bestDistance > kOffRouteMeters) {
+    return NO;
+  }
+  _progressSegment = bestSegment;
+  _progressMeters = route.meters[bestSegment] +
+                    bestT * (route.meters[bestSegment + 1] - route.meters[bestSegment]);
+  return YES;
+}
+
+- (void)refresh {
+  // Forget tiles the car has left behind, so they do not accumulate over a long route.
+  double passedMeters = _progressMeters - _corridorMeters;
+  for (auto it = _loadedTiles.begin(); it != _loadedTiles.end();) {
+    it = it->second.routeMeters < passedMeters ? _loadedTiles.erase(it) : std::next(it);
+  }
+
+  // Extend the corridor in steps rather than on every location update.
+  double untilMeters = _progressMeters + _aheadMeters;
+  if (untilMeters < _requestedUntilMeters + _aheadMeters / 4) {
+    return;
+  }
+  _requestedUntilMeters = untilMeters;
+
+  [self loadTiles:[self tilesFrom:_progressSegment untilMeters:untilMeters]];
+}
+
+// Reads the tiles that are not cached on the worker pool and tests their features against the
+// requested segments, then stages the features found.
+- (void)loadTiles:(std::vector<TileRequest>)tiles {
+  if (tiles.empty()) {
+    return;
+  }
+  for (const TileRequest &tile : tiles) {
+    _pendingTiles[tile.key] = tile.lastSegment;
+  }
+
+  std::shared_ptr<const RouteGeometry> route = _route;
+  NavCancellationToken *token = _routeToken;
+  NSString *storePath = _storePath;
+  NSInteger tileZoom = _tileZoom;
+  double corridorMeters = _corridorMeters;
+  __weak NavRoutePrefetcher *weakSelf = self;
+  [[NavWorkerPool sharedPool]
+      submitWithPriority:NavTaskPriorityPrefetch
+                   token:token
+                   block:^{
+                     auto found = std::make_shared<std::vector<FoundFeature>>();
+                     NSMutableArray<NSArray *> *tileFeatures =
+                         [NSMutableArray arrayWithCapacity:tiles.size()];
+                     for (const TileRequest &tile : tiles) {
+                       if (token.cancelled) {
+                         return;
+                       }
+                       NSArray<NSDictionary<NSString *, id> *> *features = tile.cachedFeatures;
+                       if (features == nil) {
+                         NSString *path =
+                             [NSString stringWithFormat:@"%@/%ld/%ld/%ld.json", storePath,
+                                                        (long)tileZoom, tile.x, tile.y];
+                         features = [NavRoutePrefetcher featuresAtPath:path];
+                       }
+                       [tileFeatures addObject:features];
+                       [NavRoutePrefetcher collectFeatures:features
+                                                      tile:tile
+                                                     route:*route
+                                            corridorMeters:corridorMeters
+                                                      into:*found];
+                     }
+                     dispatch_async(dispatch_get_main_queue(), ^{
+                       NavRoutePrefetcher *strongSelf = weakSelf;
+                       if (strongSelf != nil && !token.cancelled) {
+                         [strongSelf stageFeatures:*found
+                                          forTiles:tiles
+                                      tileFeatures:tileFeatures];
+                       }
+                     });
+                   }];
+}
+
+// Covers the route from segment `from` to `untilMeters` with pieces no longer than the corridor
+// width, and collects the tiles within the corridor of each piece whose features have not been
+// tested against that piece yet. Loaded tiles are requested again with their cached features
+// when new segments reach them; pending tiles remember the segments to test once loaded.
+- (std::vector<TileRequest>)tilesFrom:(size_t)from untilMeters:(double)untilMeters {
+  const RouteGeometry &route = *_route;
+  long tileCount = 1L << _tileZoom;
+  double metersPerDegree = kEarthRadiusMeters * M_PI / 180;
+  std::unordered_map<uint64_t, size_t> indexes;
+  std::vector<TileRequest> tiles;
+
+  for (size_t i = from; i + 1 < route.coordinates.size() && route.meters[i] < untilMeters; i++) {
+    CLLocationCoordinate2D a = route.coordinates[i];
+    CLLocationCoordinate2D b = route.coordinates[i + 1];
+    double length = route.meters[i + 1] - route.meters[i];
+    int pieces = std::max(1, (int)std::ceil(length / std::max(_corridorMeters, 50.0)));
+    for (int p = 0; p < pieces; p++) {
+      double t0 = (double)p / pieces;
+      double t1 = (double)(p + 1) / pieces;
+      double lat0 = a.latitude + (b.latitude - a.latitude) * t0;
+      double lat1 = a.latitude + (b.latitude - a.latitude) * t1;
+      double lng0 = a.longitude + (b.longitude - a.longitude) * t0;
+      double lng1 = a.longitude + (b.longitude - a.longitude) * t1;
+      double latPad = _corridorMeters / metersPerDegree;
+      double lngPad = latPad / std::max(0.01, std::cos(std::max(std::fabs(lat0), std::fabs(lat1)) *
+                                                       M_PI / 180));
+      long x0 = TileX(std::min(lng0, lng1) - lngPad, tileCount);
+      long x1 = TileX(std::max(lng0, lng1) + lngPad, tileCount);
+      long y0 = TileY(std::max(lat0, lat1) + latPad, tileCount);
+      long y1 = TileY(std::min(lat0, lat1) - latPad, tileCount);
+      double pieceMeters = route.meters[i] + length * t1;
+      for (long x = x0; x <= x1; x++) {
+        for (long y = y0; y <= y1; y++) {
+          uint64_t key = TileKey(x, y);
+          auto pending = _pendingTiles.find(key);
+          if (pending != _pendingTiles.end()) {
+            pending->second = std::max(pending->second, i);
+            continue;
+          }
+          auto loaded = _loadedTiles.find(key);
+          if (loaded != _loadedTiles.end() && i <= loaded->second.lastSegment) {
+            continue;
+          }
+          auto index = indexes.find(key);
+          if (index == indexes.end()) {
+            NSArray *cached = loaded != _loadedTiles.end() ? loaded->second.features : nil;
+            indexes.emplace(key, tiles.size());
+            tiles.push_back({key, x, y, i, i, pieceMeters, cached});
+          } else {
+            TileRequest &tile = tiles[index->second];
+            tile.lastSegment = i;
+            tile.routeMeters = pieceMeters;
+          }
+        }
+      }
+    }
+  }
+  return tiles;
+}
+
+// Runs on a worker. Returns the well-formed features of a tile; a missing file holds none.
++ (NSArray<NSDictionary<NSString *, id> *> *)featuresAtPath:(NSString *)path {
+  NSData *data = [NSData dataWithContentsOfFile:path];
+  if (data == nil) {
+    return @[];
+  }
+  NSArray *array = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+  if (![array isKindOfClass:[NSArray class]]) {
+    return @[];
+  }
+  NSMutableArray<NSDictionary<NSString *, id> *> *features =
+      [NSMutableArray arrayWithCapacity:array.count];
+  for (NSDictionary *feature in array) {
+    if ([feature isKindOfClass:[NSDictionary class]] &&
+        [feature[@"id"] isKindOfClass:[NSString class]] &&
+        [feature[@"lat"] isKindOfClass:[NSNumber class]] &&
+        [feature[@"lng"] isKindOfClass:[NSNumber class]]) {
+      [features addObject:feature];
+    }
+  }
+  return features;
+}
+
+// Runs on a worker.
++ (void)collectFeatures:(NSArray<NSDictionary<NSString *, id> *> *)features
+                   tile:(const TileRequest &)tile
+                  route:(const RouteGeometry &)route
+         corridorMeters:(double)corridorMeters
+                   into:(std::vector<FoundFeature> &)found {
+  for (NSDictionary<NSString *, id> *feature in features) {
+    NSString *featureId = feature[@"id"];
+    CLLocationCoordinate2D position = CLLocationCoordinate2DMake(
+        [feature[@"lat"] doubleValue], [feature[@"lng"] doubleValue]);
+    // Only the segments that requested this tile can be within the corridor of its features.
+    double bestDistance = INFINITY;
+    double bestMeters = 0;
+    for (size_t i = tile.firstSegment; i <= tile.lastSegment; i++) {
+      double t;
+      double distance =
+          DistanceToSegment(position, route.coordinates[i], route.coordinates[i + 1], &t);
+      if (distance < bestDistance) {
+        bestDistance = distance;
+        bestMeters = route.meters[i] + t * (route.meters[i + 1] - route.meters[i]);
+      }
+    }
+    if (bestDistance <= corridorMeters) {
+      found.push_back({feature, featureId, bestMeters, tile.key});
+    }
+  }
+}
+
+- (void)stageFeatures:(std::vector<FoundFeature> &)found
+             forTiles:(const std::vector<TileRequest> &)tiles
+         tileFeatures:(NSArray<NSArray *> *)tileFeatures {
+  std::vector<TileRequest> retests;
+  for (size_t i = 0; i < tiles.size(); i++) {
+    const TileRequest &tile = tiles[i];
+    auto pending = _pendingTiles.find(tile.key);
+    size_t pendingSegment = pending != _pendingTiles.end() ? pending->second : tile.lastSegment;
+    if (pending != _pendingTiles.end()) {
+      _pendingTiles.erase(pending);
+    }
+    LoadedTile &loaded = _loadedTiles[tile.key];
+    if (loaded.features == nil) {
+      loaded.features = tileFeatures[i];
+    }
+    loaded.lastSegment = tile.lastSegment;
+    loaded.routeMeters = tile.routeMeters;
+    // Test the segments that reached the tile while it was loading.
+    if (pendingSegment > tile.lastSegment && _route != nullptr) {
+      retests.push_back({tile.key, tile.x, tile.y, tile.lastSegment + 1, pendingSegment,
+                         _route->meters[pendingSegment + 1], loaded.features});
+    }
+  }
+  [self loadTiles:retests];
+
+  // Features already staged, e.g. seen from a neighbouring tile or a previous route, only move.
+  std::vector<FoundFeature> added;
+  NSMutableSet<NSString *> *addedIds = [NSMutableSet set];
+  for (const FoundFeature &feature : found) {
+    if (_stagedMeters[feature.featureId] != nil) {
+      _stagedMeters[feature.featureId] = @(feature.routeMeters);
+    } else if (![addedIds containsObject:feature.featureId]) {
+      [addedIds addObject:feature.featureId];
+      added.push_back(feature);
+    }
+  }
+  std::sort(added.begin(), added.end(), [](const FoundFeature &a, const FoundFeature &b) {
+    return a.routeMeters < b.routeMeters;
+  });
+
+  NSMutableArray<NSString *> *evicted = [NSMutableArray array];
+  NSUInteger needed = _stagedMeters.count + added.size();
+  if (needed > _maxFeatures) {
+    // Evict the features passed longest ago, never the ones still ahead.
+    NSArray<NSString *> *passed = [[_stagedMeters keysOfEntriesPassingTest:^BOOL(
+        NSString *featureId, NSNumber *meters, BOOL *stop) {
+      return meters.doubleValue < self->_progressMeters;
+    }] allObjects];
+    passed = [passed sortedArrayUsingComparator:^NSComparisonResult(NSString *a, NSString *b) {
+      return [self->_stagedMeters[a] compare:self->_stagedMeters[b]];
+    }];
+    for (NSString *featureId in passed) {
+      if (needed <= _maxFeatures) {
+        break;
+      }
+      [_stagedMeters removeObjectForKey:featureId];
+      [evicted addObject:featureId];
+      needed--;
+    }
+  }
+
+  // Without enough room, stage the nearest features. The tiles of the others are loaded again when
+  // the corridor is next extended.
+  NSUInteger room = _maxFeatures > _stagedMeters.count ? _maxFeatures - _stagedMeters.count : 0;
+  if (added.size() > room) {
+    for (size_t i = room; i < added.size(); i++) {
+      _loadedTiles.erase(added[i].tileKey);
+    }
+    added.resize(room);
+  }
+
+  NSMutableArray<NSDictionary<NSString *, id> *> *staged =
+      [NSMutableArray arrayWithCapacity:added.size()];
+  for (const FoundFeature &feature : added) {
+    _stagedMeters[feature.featureId] = @(feature.routeMeters);
+    [staged addObject:feature.feature];
+  }
+  if ((staged.count > 0 || evicted.count > 0) && _handler != nil) {
+    _handler(staged, evicted);
+  }
+}
+
+- (void)forgetFeatureId:(NSString *)featureId {
+  [_stagedMeters removeObjectForKey:featureId];
+}
+
+- (void)forgetAllFeatures {
+  [_stagedMeters removeAllObjects];
+  _loadedTiles.clear();
+  _requestedUntilMeters = -INFINITY;
+  if (_located) {
+    [self refresh];
+  }
+}
+
+@end
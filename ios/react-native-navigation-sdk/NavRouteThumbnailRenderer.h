@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavRouteThumbnailRenderer_h
+#define NavRouteThumbnailRenderer_h
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Called with a file URI of the thumbnail PNG, or an error.
+typedef void (^NavRouteThumbnailCompletion)(NSString *_Nullable uri, NSError *_Nullable error);
+
+/**
+ * Renders route previews without a map: the path and stops are rasterized by the portable
+ * NavThumbnailRasterizer on the shared worker pool and written as PNGs to the caches directory.
+ * Thumbnails are keyed by a hash of their inputs, so a row that scrolls back into view gets the
+ * file of its first render, and concurrent requests for the same thumbnail share one render.
+ */
+@interface NavRouteThumbnailRenderer : NSObject
+
++ (instancetype)sharedRenderer;
+
+/**
+ * Renders a thumbnail of `size` points at `scale` pixels per point. The path is `encodedPath` when
+ * given, otherwise `path` as packed [lat, lng, ...]; `stops` are packed the same way. `style`
+ * holds the optional padding, strokeWidth, stopRadius and stopOutlineWidth in points, and the
+ * strokeColor, stopColor, stopOutlineColor and backgroundColor as AARRGGBB integers. The
+ * completion is called on the main queue.
+ */
+- (void)renderPath:(NSArray<NSNumber *> *)path
+       encodedPath:(nullable NSString *)encodedPath
+             stops:(NSArray<NSNumber *> *)stops
+              size:(CGSize)size
+             scale:(CGFloat)scale
+             style:(NSDictionary<NSString *, NSNumber *> *)style
+        completion:(NavRouteThumbnailCompletion)completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavRouteThumbnailRenderer_h */
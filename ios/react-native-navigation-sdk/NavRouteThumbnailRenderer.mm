@@ -0,0 +1,244 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavRouteThumbnailRenderer.h"
+#import "NavThumbnailRasterizer.h"
+#import "NavWorkerPool.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+static NSString *const kThumbnailDirectoryName = @"NavRouteThumbnails";
+static NSString *const kThumbnailErrorDomain = @"NavRouteThumbnailRenderer";
+
+// Defaults of the style, sizes in points.
+static const double kDefaultPadding = 8;
+static const double kDefaultStrokeWidth = 3;
+static const double kDefaultStopRadius = 4;
+static const double kDefaultStopOutlineWidth = 1.5;
+static const uint32_t kDefaultStrokeColor = 0xFF1A73E8;
+static const uint32_t kDefaultStopColor = 0xFFEA4335;
+static const uint32_t kDefaultStopOutlineColor = 0xFFFFFFFF;
+
+// Largest side of a thumbnail in pixels.
+static const double kMaxPixelSize = 2048;
+
+namespace {
+
+// FNV-1a over the inputs of a thumbnail, used as its file name.
+class InputHash {
+ public:
+  void Add(const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+      value_ = (value_ ^ bytes[i]) * 1099511628211ULL;
+    }
+  }
+  template <typename T>
+  void Add(T value) {
+    Add(&value, sizeof(value));
+  }
+  uint64_t value() const { return value_; }
+
+ private:
+  uint64_t value_ = 14695981039346656037ULL;
+};
+
+double StyleValue(NSDictionary<NSString *, NSNumber *> *style, NSString *key, double fallback) {
+  NSNumber *value = style[key];
+  return [value isKindOfClass:[NSNumber class]] ? value.doubleValue : fallback;
+}
+
+uint32_t StyleColor(NSDictionary<NSString *, NSNumber *> *style, NSString *key,
+                    uint32_t fallback) {
+  NSNumber *value = style[key];
+  return [value isKindOfClass:[NSNumber class]] ? static_cast<uint32_t>(value.longLongValue)
+                                                : fallback;
+}
+
+std::vector<navsdk::GeoPoint> UnpackPoints(NSArray<NSNumber *> *packed) {
+  std::vector<navsdk::GeoPoint> points;
+  points.reserve(packed.count / 2);
+  for (NSUInteger i = 0; i + 1 < packed.count; i += 2) {
+    points.push_back({packed[i].doubleValue, packed[i + 1].doubleValue});
+  }
+  return points;
+}
+
+}  // namespace
+
+@implementation NavRouteThumbnailRenderer {
+  NSURL *_directory;
+  // Completions of the renders in flight by file name. Guarded by @synchronized(self).
+  NSMutableDictionary<NSString *, NSMutableArray<NavRouteThumbnailCompletion> *> *_pending;
+}
+
++ (instancetype)sharedRenderer {
+  static NavRouteThumbnailRenderer *sharedRenderer = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedRenderer = [[self alloc] init];
+  });
+  return sharedRenderer;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *caches = [fileManager URLsForDirectory:NSCachesDirectory
+                                        inDomains:NSUserDomainMask]
+                        .firstObject;
+    _directory = [caches URLByAppendingPathComponent:kThumbnailDirectoryName isDirectory:YES];
+    [fileManager createDirectoryAtURL:_directory
+          withIntermediateDirectories:YES
+                           attributes:nil
+                                error:nil];
+    _pending = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
+- (void)renderPath:(NSArray<NSNumber *> *)path
+       encodedPath:(NSString *)encodedPath
+             stops:(NSArray<NSNumber *> *)stops
+              size:(CGSize)size
+             scale:(CGFloat)scale
+             style:(NSDictionary<NSString *, NSNumber *> *)style
+        completion:(NavRouteThumbnailCompletion)completion {
+  double pixelScale = scale > 0 ? scale : 1;
+  navsdk::ThumbnailStyle thumbnailStyle;
+  thumbnailStyle.width =
+      static_cast<int>(std::max(1.0, std::min(kMaxPixelSize, std::round(size.width * pixelScale))));
+  thumbnailStyle.height = static_cast<int>(
+      std::max(1.0, std::min(kMaxPixelSize, std::round(size.height * pixelScale))));
+  thumbnailStyle.padding = StyleValue(style, @"padding", kDefaultPadding) * pixelScale;
+  thumbnailStyle.strokeWidth = StyleValue(style, @"strokeWidth", kDefaultStrokeWidth) * pixelScale;
+  thumbnailStyle.stopRadius = StyleValue(style, @"stopRadius", kDefaultStopRadius) * pixelScale;
+  thumbnailStyle.stopOutlineWidth =
+      StyleValue(style, @"stopOutlineWidth", kDefaultStopOutlineWidth) * pixelScale;
+  thumbnailStyle.strokeColor = StyleColor(style, @"strokeColor", kDefaultStrokeColor);
+  thumbnailStyle.stopColor = StyleColor(style, @"stopColor", kDefaultStopColor);
+  thumbnailStyle.stopOutlineColor =
+      StyleColor(style, @"stopOutlineColor", kDefaultStopOutlineColor);
+  thumbnailStyle.backgroundColor = StyleColor(style, @"backgroundColor", 0);
+
+  std::string encoded = encodedPath.length > 0 ? std::string(encodedPath.UTF8String) : "";
+  std::vector<navsdk::GeoPoint> pathPoints =
+      encoded.empty() ? UnpackPoints(path) : std::vector<navsdk::GeoPoint>();
+  std::vector<navsdk::GeoPoint> stopPoints = UnpackPoints(stops);
+
+  InputHash hash;
+  hash.Add(thumbnailStyle.width);
+  hash.Add(thumbnailStyle.height);
+  hash.Add(thumbnailStyle.padding);
+  hash.Add(thumbnailStyle.strokeWidth);
+  hash.Add(thumbnailStyle.stopRadius);
+  hash.Add(thumbnailStyle.stopOutlineWidth);
+  hash.Add(thumbnailStyle.strokeColor);
+  hash.Add(thumbnailStyle.stopColor);
+  hash.Add(thumbnailStyle.stopOutlineColor);
+  hash.Add(thumbnailStyle.backgroundColor);
+  hash.Add(encoded.size());
+  hash.Add(encoded.data(), encoded.size());
+  hash.Add(pathPoints.size());
+  hash.Add(pathPoints.data(), pathPoints.size() * sizeof(navsdk::GeoPoint));
+  hash.Add(stopPoints.size());
+  hash.Add(stopPoints.data(), stopPoints.size() * sizeof(navsdk::GeoPoint));
+
+  NSString *fileName = [NSString stringWithFormat:@"%016llx.png", hash.value()];
+  NSURL *fileURL = [_directory URLByAppendingPathComponent:fileName];
+  if ([[NSFileManager defaultManager] fileExistsAtPath:fileURL.path]) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      completion(fileURL.absoluteString, nil);
+    });
+    return;
+  }
+
+  @synchronized(self) {
+    NSMutableArray<NavRouteThumbnailCompletion> *completions = _pending[fileName];
+    if (completions != nil) {
+      [completions addObject:[completion copy]];
+      return;
+    }
+    _pending[fileName] = [NSMutableArray arrayWithObject:[completion copy]];
+  }
+
+  [[NavWorkerPool sharedPool]
+      submitWithPriority:NavTaskPriorityInteractive
+                   token:nil
+                   block:^{
+                     std::vector<navsdk::GeoPoint> points =
+                         encoded.empty() ? pathPoints : navsdk::DecodePolyline(encoded);
+                     std::vector<uint8_t> rgba =
+                         navsdk::RenderRouteThumbnail(points, stopPoints, thumbnailStyle);
+                     NSError *error = nil;
+                     BOOL written = [self writePixels:rgba
+                                                width:thumbnailStyle.width
+                                               height:thumbnailStyle.height
+                                                scale:pixelScale
+                                                toURL:fileURL
+                                                error:&error];
+
+                     NSArray<NavRouteThumbnailCompletion> *completions;
+                     @synchronized(self) {
+                       completions = self->_pending[fileName];
+                       [self->_pending removeObjectForKey:fileName];
+                     }
+                     dispatch_async(dispatch_get_main_queue(), ^{
+                       for (NavRouteThumbnailCompletion pendingCompletion in completions) {
+                         pendingCompletion(written ? fileURL.absoluteString : nil, error);
+                       }
+                     });
+                   }];
+}
+
+#pragma mark - Private
+
+- (BOOL)writePixels:(const std::vector<uint8_t> &)rgba
+              width:(int)width
+             height:(int)height
+              scale:(double)scale
+              toURL:(NSURL *)fileURL
+              error:(NSError **)error {
+  NSData *data = [NSData dataWithBytes:rgba.data() length:rgba.size()];
+  CGDataProviderRef provider = CGDataProviderCreateWithCFData((__bridge CFDataRef)data);
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGImageRef image = CGImageCreate(width, height, 8, 32, static_cast<size_t>(width) * 4,
+                                   colorSpace, kCGImageAlphaPremultipliedLast, provider, NULL,
+                                   false, kCGRenderingIntentDefault);
+  CGColorSpaceRelease(colorSpace);
+  CGDataProviderRelease(provider);
+
+  NSData *png = nil;
+  if (image != NULL) {
+    png = UIImagePNGRepresentation([UIImage imageWithCGImage:image
+                                                       scale:scale
+                                                 orientation:UIImageOrientationUp]);
+    CGImageRelease(image);
+  }
+  if (png == nil) {
+    if (error != NULL) {
+      NSDictionary *userInfo = @{NSLocalizedDescriptionKey : @"Failed to encode thumbnail"};
+      *error = [NSError errorWithDomain:kThumbnailErrorDomain code:0 userInfo:userInfo];
+    }
+    return NO;
+  }
+  return [png writeToURL:fileURL options:NSDataWritingAtomic error:error];
+}
+
+@end
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <CoreLocation/CoreLocation.h>
+#import <Foundation/Foundation.h>
+
+#ifdef __cplusplus
+#include <jsi/jsi.h>
+#include <memory>
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Native-owned buffer holding the latest navigation state, shared with JS as an ArrayBuffer so
+ * that animation code can poll it every frame without events or allocations.
+ *
+ * Layout (little endian):
+ *   bytes 0-3   uint32 sequence, odd while a write is in progress (seqlock)
+ *   bytes 4-7   uint32 layout version
+ *   bytes 8+    float64 slots, see NavStateSlot; NaN marks an unknown value
+ *
+ * Writes happen on the main thread from the navigation listener callbacks. Readers retry until
+ * they observe the same even sequence before and after copying the slots.
+ */
+typedef NS_ENUM(NSInteger, NavStateSlot) {
+  NavStateSlotLatitude = 0,
+  NavStateSlotLongitude,
+  NavStateSlotSpeed,
+  NavStateSlotBearing,
+  NavStateSlotAccuracy,
+  NavStateSlotLocationTime,
+  NavStateSlotRemainingMeters,
+  NavStateSlotRemainingSeconds,
+  NavStateSlotDelaySeverity,
+  NavStateSlotCount,
+};
+
+@interface NavStateBuffer : NSObject
+
++ (instancetype)sharedBuffer;
+
+- (void)writeLocation:(CLLocation *)location;
+- (void)writeRemainingMeters:(double)meters
+                     seconds:(double)seconds
+               delaySeverity:(NSInteger)delaySeverity;
+/// Marks every slot as unknown, e.g. when the navigation session is cleaned up.
+- (void)reset;
+
+#ifdef __cplusplus
+/// Exposes the buffer to the given runtime as `global.__RNNavigationSdkStateBuffer`.
+- (void)installInRuntime:(facebook::jsi::Runtime &)runtime;
+#endif
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavStateBuffer.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kLayoutVersion = 1;
+constexpr size_t kHeaderSize = 8;
+constexpr size_t kBufferSize = kHeaderSize + NavStateSlotCount * sizeof(double);
+
+// Backing store handed to JSI. The runtime keeps it alive for as long as JS references the
+// ArrayBuffer, the writer keeps it alive for the lifetime of the process.
+class NavStateMutableBuffer : public facebook::jsi::MutableBuffer {
+ public:
+  NavStateMutableBuffer() {
+    std::memset(bytes_, 0, sizeof(bytes_));
+    std::memcpy(bytes_ + sizeof(uint32_t), &kLayoutVersion, sizeof(kLayoutVersion));
+    double *slots = this->slots();
+    for (size_t i = 0; i < NavStateSlotCount; i++) {
+      slots[i] = NAN;
+    }
+  }
+
+  size_t size() const override { return kBufferSize; }
+  uint8_t *data() override { return bytes_; }
+
+  uint32_t *sequence() { return reinterpret_cast<uint32_t *>(bytes_); }
+  double *slots() { return reinterpret_cast<double *>(bytes_ + kHeaderSize); }
+
+ private:
+  alignas(8) uint8_t bytes_[kBufferSize];
+};
+
+}  // namespace
+
+@implementation NavStateBuffer {
+  std::shared_ptr<NavStateMutableBuffer> _buffer;
+}
+
++ (instancetype)sharedBuffer {
+  static NavStateBuffer *sharedBuffer;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedBuffer = [[NavStateBuffer alloc] init];
+  });
+  return sharedBuffer;
+}
+
+- (instancetype)init {
+  if (self = [super init]) {
+    _buffer = std::make_shared<NavStateMutableBuffer>();
+  }
+  return self;
+}
+
+// Single-writer seqlock: the sequence is odd while the slots are being updated.
+- (void)write:(void (^)(double *slots))update {
+  uint32_t *sequence = _buffer->sequence();
+  uint32_t next = __atomic_load_n(sequence, __ATOMIC_RELAXED) + 1;
+  __atomic_store_n(sequence, next, __ATOMIC_RELAXED);
+  std::atomic_thread_fence(std::memory_order_release);
+  update(_buffer->slots());
+  __atomic_store_n(sequence, next + 1, __ATOMIC_RELEASE);
+}
+
+- (void)writeLocation:(CLLocation *)location {
+  [self write:^(double *slots) {
+    slots[NavStateSlotLatitude] = location.coordinate.latitude;
+    slots[NavStateSlotLongitude] = location.coordinate.longitude;
+    slots[NavStateSlotSpeed] = location.speed >= 0 ? location.speed : NAN;
+    slots[NavStateSlotBearing] = location.course >= 0 ? location.course : NAN;
+    slots[NavStateSlotAccuracy] =
+        location.horizontalAccuracy >= 0 ? location.horizontalAccuracy : NAN;
+    slots[NavStateSlotLocationTime] = location.timestamp.timeIntervalSince1970 * 1000;
+  }];
+}
+
+- (void)writeRemainingMeters:(double)meters
+                     seconds:(double)seconds
+               delaySeverity:(NSInteger)delaySeverity {
+  [self write:^(double *slots) {
+    slots[NavStateSlotRemainingMeters] = meters;
+    slots[NavStateSlotRemainingSeconds] = seconds;
+    slots[NavStateSlotDelaySeverity] = delaySeverity;
+  }];
+}
+
+- (void)reset {
+  [self write:^(double *slots) {
+    for (size_t i = 0; i < NavStateSlotCount; i++) {
+      slots[i] = NAN;
+    }
+  }];
+}
+
+- (void)installInRuntime:(facebook::jsi::Runtime &)runtime {
+  runtime.global().setProperty(runtime, "__RNNavigationSdkStateBuffer",
+                               facebook::jsi::ArrayBuffer(runtime, _buffer));
+}
+
+@end
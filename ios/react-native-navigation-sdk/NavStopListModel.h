@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavStopListModel_h
+#define NavStopListModel_h
+
+#import <CarPlay/CarPlay.h>
+#import <CoreLocation/CoreLocation.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, NavStopStatus) {
+  NavStopStatusUpcoming = 0,
+  NavStopStatusArrived,
+  NavStopStatusSkipped,
+};
+
+/// A stop of a stop list. The stops of a list are the destinations of the route, in order.
+@interface NavStop : NSObject
+
+@property(nonatomic, copy, readonly) NSString *stopId;
+@property(nonatomic, copy) NSString *title;
+@property(nonatomic, assign) NavStopStatus status;
+/// Time to the stop as reported by the navigator, or a negative value while unknown.
+@property(nonatomic, assign) NSTimeInterval remainingSeconds;
+/// Driving distance to the stop as reported by the navigator, or a negative value while unknown.
+@property(nonatomic, assign) CLLocationDistance remainingMeters;
+
+- (instancetype)initWithStopId:(NSString *)stopId title:(NSString *)title;
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/// Returns the detail text shown for `stop`, or nil for none.
+typedef NSString *_Nullable (^NavStopDetailTextProvider)(NavStop *stop);
+/// Called when `stop` is selected on the CarPlay screen; call `completion` once handled.
+typedef void (^NavStopSelectionHandler)(NavStop *stop, dispatch_block_t completion);
+
+/**
+ * Keeps a CPListTemplate in sync with a list of stops without rebuilding it. Stop and ETA changes
+ * are rendered to text and compared with the items on screen, so only the items whose text changed
+ * are updated, and the sections are replaced only when stops are added, removed or reordered.
+ * Updates are coalesced to at most one per `minimumUpdateInterval`, as CarPlay throttles templates
+ * that are updated more often.
+ *
+ * Must be used on the main thread.
+ */
+@interface NavStopListModel : NSObject
+
+/// The template showing the stops. Binding a template replaces its sections with the stops.
+@property(nonatomic, weak, nullable) CPListTemplate *listTemplate;
+/// Minimum time in seconds between two updates of the template. Defaults to 1 second.
+@property(nonatomic, assign) NSTimeInterval minimumUpdateInterval;
+/// Overrides the default detail text, which shows the ETA of upcoming stops and the status of
+/// the others.
+@property(nonatomic, copy, nullable) NavStopDetailTextProvider detailTextProvider;
+@property(nonatomic, copy, nullable) NavStopSelectionHandler selectionHandler;
+@property(nonatomic, copy, readonly) NSArray<NavStop *> *stops;
+
+/// Replaces the stops. Stops that keep their id keep their last known ETA.
+- (void)setStops:(NSArray<NavStop *> *)stops;
+
+/**
+ * Replaces the stops with those of a custom message, as an array of {id, title, status}
+ * dictionaries where status is one of "upcoming", "arrived" or "skipped". Entries without an id are
+ * ignored.
+ */
+- (void)setStopsFromArray:(NSArray<NSDictionary *> *)array;
+
+- (void)setStatus:(NavStopStatus)status forStopId:(NSString *)stopId;
+
+/**
+ * Applies the time and distance to the destination of each remaining route leg. The legs are the
+ * last stops of the list, as arriving at a waypoint drops the legs before it; upcoming stops before
+ * them are marked as arrived.
+ */
+- (void)updateWithLegSeconds:(NSArray<NSNumber *> *)seconds meters:(NSArray<NSNumber *> *)meters;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavStopListModel_h */
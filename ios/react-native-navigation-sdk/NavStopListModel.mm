@@ -0,0 +1,281 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavStopListModel.h"
+#import <QuartzCore/QuartzCore.h>
+
+static const NSTimeInterval kDefaultMinimumUpdateInterval = 1.0;
+
+// ETAs are rounded so that their text, and hence the item, changes about once a minute or every
+// 100 meters rather than on every navigator tick.
+static NSString *FormatEta(NavStop *stop) {
+  static NSDateComponentsFormatter *timeFormatter;
+  static NSMeasurementFormatter *distanceFormatter;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    timeFormatter = [[NSDateComponentsFormatter alloc] init];
+    timeFormatter.unitsStyle = NSDateComponentsFormatterUnitsStyleAbbreviated;
+    timeFormatter.allowedUnits = NSCalendarUnitHour | NSCalendarUnitMinute;
+    distanceFormatter = [[NSMeasurementFormatter alloc] init];
+    distanceFormatter.unitOptions = NSMeasurementFormatterUnitOptionsNaturalScale;
+    distanceFormatter.numberFormatter.maximumFractionDigits = 1;
+  });
+
+  NSString *time = [timeFormatter stringFromTimeInterval:ceil(stop.remainingSeconds / 60) * 60];
+  if (stop.remainingMeters < 0) {
+    return time;
+  }
+  NSMeasurement *distance =
+      [[NSMeasurement alloc] initWithDoubleValue:round(stop.remainingMeters / 100) * 100
+                                            unit:NSUnitLength.meters];
+  return [NSString
+      stringWithFormat:@"%@ · %@", time, [distanceFormatter stringFromMeasurement:distance]];
+}
+
+static NavStopStatus StatusFromString(id value) {
+  if ([value isEqual:@"arrived"]) {
+    return NavStopStatusArrived;
+  }
+  if ([value isEqual:@"skipped"]) {
+    return NavStopStatusSkipped;
+  }
+  return NavStopStatusUpcoming;
+}
+
+@implementation NavStop
+
+- (instancetype)initWithStopId:(NSString *)stopId title:(NSString *)title {
+  self = [super init];
+  if (self) {
+    _stopId = [stopId copy];
+    _title = [title copy];
+    _status = NavStopStatusUpcoming;
+    _remainingSeconds = -1;
+    _remainingMeters = -1;
+  }
+  return self;
+}
+
+@end
+
+@implementation NavStopListModel {
+  NSMutableArray<NavStop *> *_stops;
+  // Items on the template by stop id, reused so that unchanged stops are never re-sent.
+  NSMutableDictionary<NSString *, CPListItem *> *_items;
+  // Stop ids in the order of the template's items; nil when the template shows none of them.
+  NSArray<NSString *> *_renderedIds;
+  BOOL _updateScheduled;
+  CFTimeInterval _lastUpdateTime;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _stops = [NSMutableArray array];
+    _items = [NSMutableDictionary dictionary];
+    _minimumUpdateInterval = kDefaultMinimumUpdateInterval;
+  }
+  return self;
+}
+
+- (NSArray<NavStop *> *)stops {
+  return [_stops copy];
+}
+
+- (void)setListTemplate:(CPListTemplate *)listTemplate {
+  _listTemplate = listTemplate;
+  _renderedIds = nil;
+  [_items removeAllObjects];
+  [self setNeedsUpdate];
+}
+
+- (void)setStops:(NSArray<NavStop *> *)stops {
+  NSMutableDictionary<NSString *, NavStop *> *previous = [NSMutableDictionary dictionary];
+  for (NavStop *stop in _stops) {
+    previous[stop.stopId] = stop;
+  }
+
+  NSMutableSet<NSString *> *seen = [NSMutableSet set];
+  NSMutableArray<NavStop *> *newStops = [NSMutableArray arrayWithCapacity:stops.count];
+  for (NavStop *stop in stops) {
+    if ([seen containsObject:stop.stopId]) {
+      continue;
+    }
+    [seen addObject:stop.stopId];
+    NavStop *old = previous[stop.stopId];
+    if (old != nil && stop.remainingSeconds < 0) {
+      stop.remainingSeconds = old.remainingSeconds;
+      stop.remainingMeters = old.remainingMeters;
+    }
+    [newStops addObject:stop];
+  }
+  _stops = newStops;
+  [self setNeedsUpdate];
+}
+
+- (void)setStopsFromArray:(NSArray<NSDictionary *> *)array {
+  NSMutableArray<NavStop *> *stops = [NSMutableArray arrayWithCapacity:array.count];
+  for (NSDictionary *entry in array) {
+    if (![entry isKindOfClass:[NSDictionary class]]) {
+      continue;
+    }
+    id stopId = entry[@"id"];
+    if (![stopId isKindOfClass:[NSString class]]) {
+      continue;
+    }
+    id title = entry[@"title"];
+    NavStop *stop =
+        [[NavStop alloc] initWithStopId:stopId
+                                  title:[title isKindOfClass:[NSString class]] ? title : @""];
+    stop.status = StatusFromString(entry[@"status"]);
+    [stops addObject:stop];
+  }
+  [self setStops:stops];
+}
+
+- (void)setStatus:(NavStopStatus)status forStopId:(NSString *)stopId {
+  for (NavStop *stop in _stops) {
+    if ([stop.stopId isEqualToString:stopId]) {
+      if (stop.status != status) {
+        stop.status = status;
+        [self setNeedsUpdate];
+      }
+      return;
+    }
+  }
+}
+
+- (void)updateWithLegSeconds:(NSArray<NSNumber *> *)seconds meters:(NSArray<NSNumber *> *)meters {
+  NSInteger legCount = (NSInteger)MIN(seconds.count, meters.count);
+  NSInteger stopCount = (NSInteger)_stops.count;
+  NSInteger firstLegStop = stopCount - legCount;
+  for (NSInteger i = 0; i < stopCount; i++) {
+    NavStop *stop = _stops[i];
+    if (i < firstLegStop) {
+      // Without a route there are no legs to align with, so statuses are left as they are.
+      if (legCount > 0 && stop.status == NavStopStatusUpcoming) {
+        stop.status = NavStopStatusArrived;
+      }
+      stop.remainingSeconds = -1;
+      stop.remainingMeters = -1;
+    } else {
+      stop.remainingSeconds = seconds[i - firstLegStop].doubleValue;
+      stop.remainingMeters = meters[i - firstLegStop].doubleValue;
+    }
+  }
+  [self setNeedsUpdate];
+}
+
+#pragma mark - Private
+
+- (void)setNeedsUpdate {
+  if (_updateScheduled || _listTemplate == nil) {
+    return;
+  }
+  _updateScheduled = YES;
+
+  NSTimeInterval delay = MAX(0, _lastUpdateTime + _minimumUpdateInterval - CACurrentMediaTime());
+  __weak NavStopListModel *weakSelf = self;
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   [weakSelf updateTemplate];
+                 });
+}
+
+- (void)updateTemplate {
+  _updateScheduled = NO;
+  CPListTemplate *listTemplate = _listTemplate;
+  if (listTemplate == nil) {
+    return;
+  }
+  _lastUpdateTime = CACurrentMediaTime();
+
+  NSUInteger count = MIN(_stops.count, CPListTemplate.maximumItemCount);
+  NSMutableArray<NSString *> *ids = [NSMutableArray arrayWithCapacity:count];
+  for (NSUInteger i = 0; i < count; i++) {
+    [ids addObject:_stops[i].stopId];
+  }
+  BOOL structureChanged = ![ids isEqualToArray:_renderedIds];
+
+  NSMutableArray<CPListItem *> *items = [NSMutableArray arrayWithCapacity:count];
+  NSMutableDictionary<NSString *, CPListItem *> *itemsById =
+      [NSMutableDictionary dictionaryWithCapacity:count];
+  for (NSUInteger i = 0; i < count; i++) {
+    NavStop *stop = _stops[i];
+    NSString *detailText = [self detailTextForStop:stop];
+    CPListItem *item = _items[stop.stopId];
+    if (item == nil) {
+      item = [self itemForStop:stop detailText:detailText];
+    } else {
+      if (![item.text isEqualToString:stop.title]) {
+        [item setText:stop.title];
+      }
+      if (item.detailText != detailText && ![item.detailText isEqualToString:detailText]) {
+        [item setDetailText:detailText];
+      }
+    }
+    [items addObject:item];
+    itemsById[stop.stopId] = item;
+  }
+
+  if (structureChanged) {
+    _items = itemsById;
+    _renderedIds = ids;
+    [listTemplate updateSections:@[ [[CPListSection alloc] initWithItems:items] ]];
+  }
+}
+
+- (CPListItem *)itemForStop:(NavStop *)stop detailText:(NSString *)detailText {
+  CPListItem *item = [[CPListItem alloc] initWithText:stop.title detailText:detailText];
+  NSString *stopId = stop.stopId;
+  __weak NavStopListModel *weakSelf = self;
+  item.handler = ^(id<CPSelectableListItem> selectedItem, dispatch_block_t completion) {
+    NavStopListModel *strongSelf = weakSelf;
+    if (strongSelf == nil) {
+      completion();
+      return;
+    }
+    NavStop *selectedStop = nil;
+    for (NavStop *candidate in strongSelf->_stops) {
+      if ([candidate.stopId isEqualToString:stopId]) {
+        selectedStop = candidate;
+        break;
+      }
+    }
+    if (selectedStop == nil || strongSelf.selectionHandler == nil) {
+      completion();
+      return;
+    }
+    strongSelf.selectionHandler(selectedStop, completion);
+  };
+  return item;
+}
+
+- (nullable NSString *)detailTextForStop:(NavStop *)stop {
+  if (_detailTextProvider != nil) {
+    return _detailTextProvider(stop);
+  }
+  switch (stop.status) {
+    case NavStopStatusArrived:
+      return @"Arrived";
+    case NavStopStatusSkipped:
+      return @"Skipped";
+    case NavStopStatusUpcoming:
+      return stop.remainingSeconds >= 0 ? FormatEta(stop) : nil;
+  }
+}
+
+@end
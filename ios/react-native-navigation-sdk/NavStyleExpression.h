@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavStyleExpression_h
+#define NavStyleExpression_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A compiled style expression, evaluated against the attribute record of an overlay and the
+ * current zoom. Expressions use a JSON array syntax:
+ *
+ *   ["get", key], ["has", key], ["zoom"]
+ *   ["==" | "!=" | "<" | "<=" | ">" | ">=", a, b], ["!", a], ["all", ...], ["any", ...]
+ *   ["+" | "-" | "*" | "/", a, b]
+ *   ["case", condition, output, ..., fallback]
+ *   ["match", input, label | [labels], output, ..., fallback]
+ *   ["interpolate", ["linear"] | ["exponential", base], input, stop, output, ...]
+ *   ["step", input, output, stop, output, ...]
+ *
+ * Numbers, strings, booleans and null are literals. Match tables and stops are built once at
+ * compile time, so evaluation is a single walk of the compiled tree.
+ */
+@interface NavStyleExpression : NSObject
+
+/// Compiles `json`, or returns nil and sets `error` describing the first invalid node.
++ (nullable instancetype)expressionWithJSON:(nullable id)json error:(NSError **)error;
+
+/// The JSON this expression was compiled from.
+@property(nonatomic, readonly, nullable) id source;
+
+/// Whether the result depends on the camera zoom.
+@property(nonatomic, readonly) BOOL usesZoom;
+
+/// Attribute keys read by this expression.
+@property(nonatomic, readonly) NSSet<NSString *> *attributeKeys;
+
+/// Evaluates the expression. Returns an NSNumber, an NSString, or nil for null.
+- (nullable id)evaluateWithAttributes:(nullable NSDictionary<NSString *, id> *)attributes
+                                 zoom:(double)zoom;
+
+/// Evaluates the expression as a boolean; null is false.
+- (BOOL)evaluateBoolWithAttributes:(nullable NSDictionary<NSString *, id> *)attributes
+                              zoom:(double)zoom;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavStyleExpression_h */
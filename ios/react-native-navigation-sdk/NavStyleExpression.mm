@@ -0,0 +1,489 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavStyleExpression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+typedef NS_ENUM(NSInteger, NavExpressionOp) {
+  NavExpressionOpLiteral,
+  NavExpressionOpGet,
+  NavExpressionOpHas,
+  NavExpressionOpZoom,
+  NavExpressionOpEqual,
+  NavExpressionOpNotEqual,
+  NavExpressionOpLess,
+  NavExpressionOpLessOrEqual,
+  NavExpressionOpGreater,
+  NavExpressionOpGreaterOrEqual,
+  NavExpressionOpNot,
+  NavExpressionOpAll,
+  NavExpressionOpAny,
+  NavExpressionOpAdd,
+  NavExpressionOpSubtract,
+  NavExpressionOpMultiply,
+  NavExpressionOpDivide,
+  NavExpressionOpCase,
+  NavExpressionOpMatch,
+  NavExpressionOpInterpolate,
+  NavExpressionOpStep,
+};
+
+static NSString *const kNavStyleExpressionErrorDomain = @"NavStyleExpression";
+
+static NSError *ExpressionError(NSString *message) {
+  return [NSError errorWithDomain:kNavStyleExpressionErrorDomain
+                             code:0
+                         userInfo:@{NSLocalizedDescriptionKey : message}];
+}
+
+static BOOL IsNumber(id value) { return [value isKindOfClass:[NSNumber class]]; }
+
+static BOOL IsTruthy(id value) {
+  if (IsNumber(value)) {
+    return [value boolValue];
+  }
+  if ([value isKindOfClass:[NSString class]]) {
+    return [value length] > 0;
+  }
+  return NO;
+}
+
+static BOOL ValuesEqual(id a, id b) {
+  if (a == nil || b == nil) {
+    return a == b;
+  }
+  return [a isEqual:b];
+}
+
+// Orders two values of the same kind. Returns NO when they cannot be ordered.
+static BOOL CompareValues(id a, id b, NSComparisonResult *result) {
+  if (IsNumber(a) && IsNumber(b)) {
+    *result = [(NSNumber *)a compare:(NSNumber *)b];
+    return YES;
+  }
+  if ([a isKindOfClass:[NSString class]] && [b isKindOfClass:[NSString class]]) {
+    *result = [(NSString *)a compare:(NSString *)b];
+    return YES;
+  }
+  return NO;
+}
+
+static NSDictionary<NSString *, NSNumber *> *OperatorTable(void) {
+  static NSDictionary<NSString *, NSNumber *> *table;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    table = @{
+      @"get" : @(NavExpressionOpGet),
+      @"has" : @(NavExpressionOpHas),
+      @"zoom" : @(NavExpressionOpZoom),
+      @"==" : @(NavExpressionOpEqual),
+      @"!=" : @(NavExpressionOpNotEqual),
+      @"<" : @(NavExpressionOpLess),
+      @"<=" : @(NavExpressionOpLessOrEqual),
+      @">" : @(NavExpressionOpGreater),
+      @">=" : @(NavExpressionOpGreaterOrEqual),
+      @"!" : @(NavExpressionOpNot),
+      @"all" : @(NavExpressionOpAll),
+      @"any" : @(NavExpressionOpAny),
+      @"+" : @(NavExpressionOpAdd),
+      @"-" : @(NavExpressionOpSubtract),
+      @"*" : @(NavExpressionOpMultiply),
+      @"/" : @(NavExpressionOpDivide),
+      @"case" : @(NavExpressionOpCase),
+      @"match" : @(NavExpressionOpMatch),
+      @"interpolate" : @(NavExpressionOpInterpolate),
+      @"step" : @(NavExpressionOpStep),
+    };
+  });
+  return table;
+}
+
+@implementation NavStyleExpression {
+  NavExpressionOp _op;
+  id _value;
+  NSString *_key;
+  NSArray<NavStyleExpression *> *_args;
+  // Match: label -> index of the output in _args.
+  NSDictionary<id, NSNumber *> *_matchTable;
+  // Interpolate and step: ascending input stops, aligned with the outputs in _args.
+  std::vector<double> _stops;
+  double _base;
+}
+
++ (instancetype)expressionWithJSON:(id)json error:(NSError **)error {
+  NSError *compileError = nil;
+  NavStyleExpression *expression = [[NavStyleExpression alloc] initWithJSON:json
+                                                                      error:&compileError];
+  if (expression == nil && error != NULL) {
+    *error = compileError;
+  }
+  return expression;
+}
+
+- (nullable instancetype)initWithJSON:(id)json error:(NSError **)error {
+  if (self = [super init]) {
+    _source = json;
+    _attributeKeys = [NSSet set];
+    if (![json isKindOfClass:[NSArray class]]) {
+      if (json != nil && ![json isKindOfClass:[NSNull class]] && !IsNumber(json) &&
+          ![json isKindOfClass:[NSString class]]) {
+        *error = ExpressionError(@"Literals must be numbers, strings, booleans or null");
+        return nil;
+      }
+      _op = NavExpressionOpLiteral;
+      _value = [json isKindOfClass:[NSNull class]] ? nil : json;
+      return self;
+    }
+
+    NSArray *array = json;
+    NSString *name = array.firstObject;
+    NSNumber *op = [name isKindOfClass:[NSString class]] ? OperatorTable()[name] : nil;
+    if (op == nil) {
+      *error = ExpressionError(
+          [NSString stringWithFormat:@"Unknown expression operator '%@'", array.firstObject]);
+      return nil;
+    }
+    _op = (NavExpressionOp)op.integerValue;
+    if (![self compileOperands:[array subarrayWithRange:NSMakeRange(1, array.count - 1)]
+                          name:name
+                         error:error]) {
+      return nil;
+    }
+
+    NSMutableSet<NSString *> *keys = [NSMutableSet set];
+    if (_key != nil) {
+      [keys addObject:_key];
+    }
+    BOOL usesZoom = _op == NavExpressionOpZoom;
+    for (NavStyleExpression *arg in _args) {
+      [keys unionSet:arg.attributeKeys];
+      usesZoom = usesZoom || arg.usesZoom;
+    }
+    _attributeKeys = keys;
+    _usesZoom = usesZoom;
+  }
+  return self;
+}
+
+- (BOOL)compileOperands:(NSArray *)operands name:(NSString *)name error:(NSError **)error {
+  NSUInteger count = operands.count;
+  switch (_op) {
+    case NavExpressionOpGet:
+    case NavExpressionOpHas:
+      if (count != 1 || ![operands[0] isKindOfClass:[NSString class]]) {
+        *error = ExpressionError(
+            [NSString stringWithFormat:@"'%@' expects a single attribute name", name]);
+        return NO;
+      }
+      _key = operands[0];
+      return YES;
+
+    case NavExpressionOpZoom:
+      if (count != 0) {
+        *error = ExpressionError(@"'zoom' takes no arguments");
+        return NO;
+      }
+      return YES;
+
+    case NavExpressionOpNot:
+      if (count != 1) {
+        *error = ExpressionError(@"'!' expects one argument");
+        return NO;
+      }
+      return [self compileArgs:operands error:error];
+
+    case NavExpressionOpAll:
+    case NavExpressionOpAny:
+      return [self compileArgs:operands error:error];
+
+    case NavExpressionOpCase:
+      if (count < 3 || count % 2 == 0) {
+        *error = ExpressionError(@"'case' expects condition/output pairs and a fallback");
+        return NO;
+      }
+      return [self compileArgs:operands error:error];
+
+    case NavExpressionOpMatch:
+      return [self compileMatch:operands error:error];
+
+    case NavExpressionOpInterpolate:
+      return [self compileInterpolate:operands error:error];
+
+    case NavExpressionOpStep:
+      return [self compileStep:operands error:error];
+
+    default:
+      // Comparisons and arithmetic.
+      if (count != 2) {
+        *error = ExpressionError([NSString stringWithFormat:@"'%@' expects two arguments", name]);
+        return NO;
+      }
+      return [self compileArgs:operands error:error];
+  }
+}
+
+- (BOOL)compileArgs:(NSArray *)operands error:(NSError **)error {
+  NSMutableArray<NavStyleExpression *> *args = [NSMutableArray arrayWithCapacity:operands.count];
+  for (id operand in operands) {
+    NavStyleExpression *arg = [[NavStyleExpression alloc] initWithJSON:operand error:error];
+    if (arg == nil) {
+      return NO;
+    }
+    [args addObject:arg];
+  }
+  _args = args;
+  return YES;
+}
+
+- (BOOL)compileMatch:(NSArray *)operands error:(NSError **)error {
+  NSUInteger count = operands.count;
+  if (count < 4 || count % 2 != 0) {
+    *error = ExpressionError(@"'match' expects an input, label/output pairs and a fallback");
+    return NO;
+  }
+  NSMutableArray *rest = [NSMutableArray arrayWithObject:operands[0]];
+  NSMutableDictionary<id, NSNumber *> *table = [NSMutableDictionary dictionary];
+  for (NSUInteger i = 1; i + 1 < count; i += 2) {
+    NSArray *labels = [operands[i] isKindOfClass:[NSArray class]] ? operands[i] : @[ operands[i] ];
+    for (id label in labels) {
+      if (!IsNumber(label) && ![label isKindOfClass:[NSString class]]) {
+        *error = ExpressionError(@"'match' labels must be numbers or strings");
+        return NO;
+      }
+      // The first label wins, as in a chain of comparisons.
+      if (table[label] == nil) {
+        table[label] = @(rest.count);
+      }
+    }
+    [rest addObject:operands[i + 1]];
+  }
+  [rest addObject:operands.lastObject];
+  _matchTable = table;
+  return [self compileArgs:rest error:error];
+}
+
+- (BOOL)compileInterpolate:(NSArray *)operands error:(NSError **)error {
+  NSUInteger count = operands.count;
+  NSArray *type = count > 0 ? operands[0] : nil;
+  if (count < 4 || count % 2 != 0 || ![type isKindOfClass:[NSArray class]]) {
+    *error = ExpressionError(@"'interpolate' expects a type, an input and stop/output pairs");
+    return NO;
+  }
+  if ([type.firstObject isEqual:@"linear"] && type.count == 1) {
+    _base = 1;
+  } else if ([type.firstObject isEqual:@"exponential"] && type.count == 2 && IsNumber(type[1])) {
+    _base = [type[1] doubleValue];
+  } else {
+    *error = ExpressionError(@"'interpolate' type must be [\"linear\"] or [\"exponential\", base]");
+    return NO;
+  }
+  NSMutableArray *rest = [NSMutableArray arrayWithObject:operands[1]];
+  if (![self collectStops:operands from:2 outputs:rest name:@"interpolate" error:error]) {
+    return NO;
+  }
+  return [self compileArgs:rest error:error];
+}
+
+- (BOOL)compileStep:(NSArray *)operands error:(NSError **)error {
+  NSUInteger count = operands.count;
+  if (count < 2 || count % 2 != 0) {
+    *error = ExpressionError(@"'step' expects an input, a base output and stop/output pairs");
+    return NO;
+  }
+  NSMutableArray *rest = [NSMutableArray arrayWithObjects:operands[0], operands[1], nil];
+  if (![self collectStops:operands from:2 outputs:rest name:@"step" error:error]) {
+    return NO;
+  }
+  return [self compileArgs:rest error:error];
+}
+
+- (BOOL)collectStops:(NSArray *)operands
+                from:(NSUInteger)start
+             outputs:(NSMutableArray *)outputs
+                name:(NSString *)name
+               error:(NSError **)error {
+  for (NSUInteger i = start; i + 1 < operands.count; i += 2) {
+    if (!IsNumber(operands[i]) ||
+        (!_stops.empty() && [operands[i] doubleValue] <= _stops.back())) {
+      *error = ExpressionError(
+          [NSString stringWithFormat:@"'%@' stops must be numbers in ascending order", name]);
+      return NO;
+    }
+    _stops.push_back([operands[i] doubleValue]);
+    [outputs addObject:operands[i + 1]];
+  }
+  return YES;
+}
+
+- (BOOL)evaluateBoolWithAttributes:(NSDictionary<NSString *, id> *)attributes zoom:(double)zoom {
+  return IsTruthy([self evaluateWithAttributes:attributes zoom:zoom]);
+}
+
+- (id)evaluateWithAttributes:(NSDictionary<NSString *, id> *)attributes zoom:(double)zoom {
+  switch (_op) {
+    case NavExpressionOpLiteral:
+      return _value;
+
+    case NavExpressionOpGet: {
+      id value = attributes[_key];
+      return [value isKindOfClass:[NSNull class]] ? nil : value;
+    }
+
+    case NavExpressionOpHas:
+      return @(attributes[_key] != nil && ![attributes[_key] isKindOfClass:[NSNull class]]);
+
+    case NavExpressionOpZoom:
+      return @(zoom);
+
+    case NavExpressionOpEqual:
+    case NavExpressionOpNotEqual: {
+      BOOL equal = ValuesEqual([_args[0] evaluateWithAttributes:attributes zoom:zoom],
+                               [_args[1] evaluateWithAttributes:attributes zoom:zoom]);
+      return @(_op == NavExpressionOpEqual ? equal : !equal);
+    }
+
+    case NavExpressionOpLess:
+    case NavExpressionOpLessOrEqual:
+    case NavExpressionOpGreater:
+    case NavExpressionOpGreaterOrEqual: {
+      NSComparisonResult order;
+      if (!CompareValues([_args[0] evaluateWithAttributes:attributes zoom:zoom],
+                         [_args[1] evaluateWithAttributes:attributes zoom:zoom], &order)) {
+        return @NO;
+      }
+      switch (_op) {
+        case NavExpressionOpLess:
+          return @(order == NSOrderedAscending);
+        case NavExpressionOpLessOrEqual:
+          return @(order != NSOrderedDescending);
+        case NavExpressionOpGreater:
+          return @(order == NSOrderedDescending);
+        default:
+          return @(order != NSOrderedAscending);
+      }
+    }
+
+    case NavExpressionOpNot:
+      return @(![_args[0] evaluateBoolWithAttributes:attributes zoom:zoom]);
+
+    case NavExpressionOpAll:
+      for (NavStyleExpression *arg in _args) {
+        if (![arg evaluateBoolWithAttributes:attributes zoom:zoom]) {
+          return @NO;
+        }
+      }
+      return @YES;
+
+    case NavExpressionOpAny:
+      for (NavStyleExpression *arg in _args) {
+        if ([arg evaluateBoolWithAttributes:attributes zoom:zoom]) {
+          return @YES;
+        }
+      }
+      return @NO;
+
+    case NavExpressionOpAdd:
+    case NavExpressionOpSubtract:
+    case NavExpressionOpMultiply:
+    case NavExpressionOpDivide: {
+      id a = [_args[0] evaluateWithAttributes:attributes zoom:zoom];
+      id b = [_args[1] evaluateWithAttributes:attributes zoom:zoom];
+      if (!IsNumber(a) || !IsNumber(b)) {
+        return nil;
+      }
+      double x = [a doubleValue];
+      double y = [b doubleValue];
+      switch (_op) {
+        case NavExpressionOpAdd:
+          return @(x + y);
+        case NavExpressionOpSubtract:
+          return @(x - y);
+        case NavExpressionOpMultiply:
+          return @(x * y);
+        default:
+          return y == 0 ? nil : @(x / y);
+      }
+    }
+
+    case NavExpressionOpCase: {
+      NSUInteger count = _args.count;
+      for (NSUInteger i = 0; i + 1 < count; i += 2) {
+        if ([_args[i] evaluateBoolWithAttributes:attributes zoom:zoom]) {
+          return [_args[i + 1] evaluateWithAttributes:attributes zoom:zoom];
+        }
+      }
+      return [_args.lastObject evaluateWithAttributes:attributes zoom:zoom];
+    }
+
+    case NavExpressionOpMatch: {
+      id input = [_args[0] evaluateWithAttributes:attributes zoom:zoom];
+      NSNumber *index = input != nil ? _matchTable[input] : nil;
+      NavStyleExpression *output =
+          index != nil ? _args[index.unsignedIntegerValue] : _args.lastObject;
+      return [output evaluateWithAttributes:attributes zoom:zoom];
+    }
+
+    case NavExpressionOpInterpolate:
+      return [self interpolateWithAttributes:attributes zoom:zoom];
+
+    case NavExpressionOpStep: {
+      id input = [_args[0] evaluateWithAttributes:attributes zoom:zoom];
+      if (!IsNumber(input)) {
+        return [_args[1] evaluateWithAttributes:attributes zoom:zoom];
+      }
+      // Outputs follow the base output, so stop i selects _args[i + 2].
+      auto upper = std::upper_bound(_stops.begin(), _stops.end(), [input doubleValue]);
+      NSUInteger index = (NSUInteger)(upper - _stops.begin()) + 1;
+      return [_args[index] evaluateWithAttributes:attributes zoom:zoom];
+    }
+  }
+  return nil;
+}
+
+- (id)interpolateWithAttributes:(NSDictionary<NSString *, id> *)attributes zoom:(double)zoom {
+  id input = [_args[0] evaluateWithAttributes:attributes zoom:zoom];
+  if (!IsNumber(input)) {
+    return nil;
+  }
+  double x = [input doubleValue];
+  // Outputs follow the input, so stop i selects _args[i + 1].
+  auto upper = std::upper_bound(_stops.begin(), _stops.end(), x);
+  if (upper == _stops.begin()) {
+    return [_args[1] evaluateWithAttributes:attributes zoom:zoom];
+  }
+  if (upper == _stops.end()) {
+    return [_args.lastObject evaluateWithAttributes:attributes zoom:zoom];
+  }
+  NSUInteger upperIndex = (NSUInteger)(upper - _stops.begin());
+  double lowerStop = _stops[upperIndex - 1];
+  double upperStop = _stops[upperIndex];
+  id lower = [_args[upperIndex] evaluateWithAttributes:attributes zoom:zoom];
+  id higher = [_args[upperIndex + 1] evaluateWithAttributes:attributes zoom:zoom];
+  if (!IsNumber(lower) || !IsNumber(higher)) {
+    return lower;
+  }
+
+  double range = upperStop - lowerStop;
+  double progress = x - lowerStop;
+  double t = _base == 1 ? progress / range
+                        : (std::pow(_base, progress) - 1) / (std::pow(_base, range) - 1);
+  return @([lower doubleValue] + t * ([higher doubleValue] - [lower doubleValue]));
+}
+
+@end
@@ -0,0 +1,349 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NavThumbnailRasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace navsdk {
+
+namespace {
+
+// Latitude at which Web Mercator is square.
+const double kMaxMercatorLatitude = 85.05112878;
+
+// Path vertices closer than this to the previous one, in pixels, are dropped before stroking.
+const double kMinVertexSpacing = 0.25;
+
+// Pixels with less coverage are left untouched.
+const float kMinCoverage = 1.0f / 512;
+
+double MercatorY(double lat) {
+  double clamped = std::max(-kMaxMercatorLatitude, std::min(kMaxMercatorLatitude, lat));
+  double phi = clamped * M_PI / 180;
+  return std::log(std::tan(M_PI / 4 + phi / 2));
+}
+
+// Projects to radians of Web Mercator, y up, keeping each longitude within 180 degrees of the
+// previous point so that paths crossing the antimeridian stay continuous.
+void Project(const std::vector<GeoPoint> &points, double *previousLng,
+             std::vector<PixelPoint> *projected) {
+  for (const GeoPoint &point : points) {
+    double lng = point.lng;
+    if (!std::isnan(*previousLng)) {
+      lng -= 360 * std::round((lng - *previousLng) / 360);
+    }
+    *previousLng = lng;
+    projected->push_back({lng * M_PI / 180, MercatorY(point.lat)});
+  }
+}
+
+}  // namespace
+
+std::vector<GeoPoint> DecodePolyline(const std::string &encoded) {
+  std::vector<GeoPoint> points;
+  size_t index = 0;
+  int64_t lat = 0;
+  int64_t lng = 0;
+  while (index < encoded.size()) {
+    int64_t deltas[2];
+    for (int64_t &delta : deltas) {
+      uint64_t result = 0;
+      int shift = 0;
+      int chunk;
+      do {
+        if (index >= encoded.size() || shift > 60) {
+          return points;
+        }
+        chunk = encoded[index++] - 63;
+        if (chunk < 0) {
+          return points;
+        }
+        result |= static_cast<uint64_t>(chunk & 0x1f) << shift;
+        shift += 5;
+      } while (chunk >= 0x20);
+      delta = (result & 1) ? ~static_cast<int64_t>(result >> 1)
+                           : static_cast<int64_t>(result >> 1);
+    }
+    lat += deltas[0];
+    lng += deltas[1];
+    points.push_back({static_cast<double>(lat) * 1e-5, static_cast<double>(lng) * 1e-5});
+  }
+  return points;
+}
+
+std::vector<uint8_t> RenderRouteThumbnail(const std::vector<GeoPoint> &path,
+                                          const std::vector<GeoPoint> &stops,
+                                          const ThumbnailStyle &style) {
+  int width = std::max(1, style.width);
+  int height = std::max(1, style.height);
+  std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4, 0);
+
+  double previousLng = NAN;
+  std::vector<PixelPoint> projectedPath;
+  std::vector<PixelPoint> projectedStops;
+  Project(path, &previousLng, &projectedPath);
+  Project(stops, &previousLng, &projectedStops);
+
+  // Fits the bounds of everything drawn into the padded image, centered and without distortion.
+  double minX = INFINITY;
+  double minY = INFINITY;
+  double maxX = -INFINITY;
+  double maxY = -INFINITY;
+  for (const std::vector<PixelPoint> *points : {&projectedPath, &projectedStops}) {
+    for (const PixelPoint &point : *points) {
+      minX = std::min(minX, point.x);
+      minY = std::min(minY, point.y);
+      maxX = std::max(maxX, point.x);
+      maxY = std::max(maxY, point.y);
+    }
+  }
+  double availableWidth = std::max(1.0, width - 2 * style.padding);
+  double availableHeight = std::max(1.0, height - 2 * style.padding);
+  double spanX = maxX - minX;
+  double spanY = maxY - minY;
+  double scale = 0;
+  if (spanX > 0 || spanY > 0) {
+    scale = std::min(spanX > 0 ? availableWidth / spanX : INFINITY,
+                     spanY > 0 ? availableHeight / spanY : INFINITY);
+  }
+  double centerX = (minX + maxX) / 2;
+  double centerY = (minY + maxY) / 2;
+  auto toPixels = [&](PixelPoint point) {
+    return PixelPoint{width / 2.0 + (point.x - centerX) * scale,
+                      height / 2.0 - (point.y - centerY) * scale};
+  };
+
+  std::vector<PixelPoint> pathPixels;
+  pathPixels.reserve(projectedPath.size());
+  for (size_t i = 0; i < projectedPath.size(); i++) {
+    PixelPoint point = toPixels(projectedPath[i]);
+    if (!pathPixels.empty() && i + 1 < projectedPath.size() &&
+        std::hypot(point.x - pathPixels.back().x, point.y - pathPixels.back().y) <
+            kMinVertexSpacing) {
+      continue;
+    }
+    pathPixels.push_back(point);
+  }
+
+  CoverageRasterizer rasterizer(width, height);
+  if ((style.backgroundColor >> 24) != 0) {
+    PixelPoint corners[] = {{0, 0}, {static_cast<double>(width), 0},
+                            {static_cast<double>(width), static_cast<double>(height)},
+                            {0, static_cast<double>(height)}};
+    rasterizer.AddPolygon(corners, 4);
+    rasterizer.Composite(style.backgroundColor, rgba.data());
+  }
+  if (!pathPixels.empty() && style.strokeWidth > 0) {
+    rasterizer.Clear();
+    rasterizer.AddStroke(pathPixels, style.strokeWidth / 2);
+    rasterizer.Composite(style.strokeColor, rgba.data());
+  }
+  if (!projectedStops.empty() && style.stopRadius > 0) {
+    if (style.stopOutlineWidth > 0) {
+      rasterizer.Clear();
+      for (const PixelPoint &stop : projectedStops) {
+        rasterizer.AddCircle(toPixels(stop), style.stopRadius + style.stopOutlineWidth);
+      }
+      rasterizer.Composite(style.stopOutlineColor, rgba.data());
+    }
+    rasterizer.Clear();
+    for (const PixelPoint &stop : projectedStops) {
+      rasterizer.AddCircle(toPixels(stop), style.stopRadius);
+    }
+    rasterizer.Composite(style.stopColor, rgba.data());
+  }
+  return rgba;
+}
+
+CoverageRasterizer::CoverageRasterizer(int width, int height)
+    : width_(std::max(1, width)),
+      height_(std::max(1, height)),
+      stride_(width_ + 2),
+      accumulation_(static_cast<size_t>(stride_) * height_, 0.0f) {}
+
+void CoverageRasterizer::Clear() {
+  std::fill(accumulation_.begin(), accumulation_.end(), 0.0f);
+}
+
+void CoverageRasterizer::AddPolygon(const PixelPoint *points, size_t count) {
+  if (count < 3) {
+    return;
+  }
+  double area = 0;
+  for (size_t i = 0, j = count - 1; i < count; j = i++) {
+    area += points[j].x * points[i].y - points[i].x * points[j].y;
+  }
+  // Every polygon is walked in the same direction, so that overlaps add up instead of cancelling.
+  for (size_t i = 0; i < count; i++) {
+    size_t from = area >= 0 ? i : count - 1 - i;
+    size_t to = area >= 0 ? (i + 1) % count : (2 * count - 2 - i) % count;
+    AddLine(points[from], points[to]);
+  }
+}
+
+void CoverageRasterizer::AddCircle(PixelPoint center, double radius) {
+  if (radius <= 0) {
+    return;
+  }
+  // About one vertex per 1.5 pixels of circumference keeps the chord error well below a pixel.
+  int count = std::max(12, std::min(256, static_cast<int>(std::ceil(2 * M_PI * radius / 1.5))));
+  std::vector<PixelPoint> points(count);
+  for (int i = 0; i < count; i++) {
+    double angle = 2 * M_PI * i / count;
+    points[i] = {center.x + radius * std::cos(angle), center.y + radius * std::sin(angle)};
+  }
+  AddPolygon(points.data(), points.size());
+}
+
+void CoverageRasterizer::AddStroke(const std::vector<PixelPoint> &points, double halfWidth) {
+  if (halfWidth <= 0) {
+    return;
+  }
+  for (size_t i = 0; i + 1 < points.size(); i++) {
+    PixelPoint from = points[i];
+    PixelPoint to = points[i + 1];
+    double length = std::hypot(to.x - from.x, to.y - from.y);
+    if (length == 0) {
+      continue;
+    }
+    double nx = -(to.y - from.y) / length * halfWidth;
+    double ny = (to.x - from.x) / length * halfWidth;
+    PixelPoint quad[] = {{from.x + nx, from.y + ny},
+                         {to.x + nx, to.y + ny},
+                         {to.x - nx, to.y - ny},
+                         {from.x - nx, from.y - ny}};
+    AddPolygon(quad, 4);
+  }
+  for (const PixelPoint &point : points) {
+    AddCircle(point, halfWidth);
+  }
+}
+
+void CoverageRasterizer::Composite(uint32_t color, uint8_t *rgba) const {
+  float alpha = static_cast<float>((color >> 24) & 0xff) / 255;
+  float red = static_cast<float>((color >> 16) & 0xff);
+  float green = static_cast<float>((color >> 8) & 0xff);
+  float blue = static_cast<float>(color & 0xff);
+  for (int y = 0; y < height_; y++) {
+    const float *row = &accumulation_[static_cast<size_t>(y) * stride_];
+    uint8_t *pixel = rgba + static_cast<size_t>(y) * width_ * 4;
+    float sum = 0;
+    for (int x = 0; x < width_; x++, pixel += 4) {
+      sum += row[x];
+      float coverage = std::min(1.0f, std::fabs(sum));
+      if (coverage < kMinCoverage) {
+        continue;
+      }
+      float a = alpha * coverage;
+      float keep = 1 - a;
+      pixel[0] = static_cast<uint8_t>(red * a + pixel[0] * keep + 0.5f);
+      pixel[1] = static_cast<uint8_t>(green * a + pixel[1] * keep + 0.5f);
+      pixel[2] = static_cast<uint8_t>(blue * a + pixel[2] * keep + 0.5f);
+      pixel[3] = static_cast<uint8_t>(255 * a + pixel[3] * keep + 0.5f);
+    }
+  }
+}
+
+void CoverageRasterizer::AddLine(PixelPoint from, PixelPoint to) {
+  // Parts of the edge left or right of the image are moved onto its border, where they still
+  // contribute their winding to the pixels beside them.
+  double right = width_;
+  double dx = to.x - from.x;
+  double ts[4] = {0, 0, 0, 0};
+  int count = 1;
+  if (dx != 0) {
+    // Borders in the order the edge crosses them.
+    double borders[2] = {dx > 0 ? 0 : right, dx > 0 ? right : 0};
+    for (double border : borders) {
+      double t = (border - from.x) / dx;
+      if (t > 0 && t < 1) {
+        ts[count++] = t;
+      }
+    }
+  }
+  ts[count++] = 1;
+  for (int i = 0; i + 1 < count; i++) {
+    double t0 = ts[i];
+    double t1 = ts[i + 1];
+    AccumulateLine(std::max(0.0, std::min(right, from.x + dx * t0)),
+                   from.y + (to.y - from.y) * t0,
+                   std::max(0.0, std::min(right, from.x + dx * t1)),
+                   from.y + (to.y - from.y) * t1);
+  }
+}
+
+// Adds the signed area that the edge covers in each pixel of the rows it spans, to the right of
+// the edge. `x0` and `x1` must be within [0, width].
+void CoverageRasterizer::AccumulateLine(double x0, double y0, double x1, double y1) {
+  if (y0 == y1) {
+    return;
+  }
+  double direction = 1;
+  if (y0 > y1) {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+    direction = -1;
+  }
+  double dxdy = (x1 - x0) / (y1 - y0);
+  double x = x0;
+  if (y0 < 0) {
+    x -= y0 * dxdy;
+  }
+  int yStart = std::max(0, static_cast<int>(std::floor(y0)));
+  int yEnd = std::min(height_, static_cast<int>(std::ceil(y1)));
+  for (int y = yStart; y < yEnd; y++) {
+    float *row = &accumulation_[static_cast<size_t>(y) * stride_];
+    double dy = std::min(y + 1.0, y1) - std::max(static_cast<double>(y), y0);
+    double xNext = x + dxdy * dy;
+    double d = dy * direction;
+    double left = std::min(x, xNext);
+    double right = std::max(x, xNext);
+    double leftFloor = std::floor(left);
+    int leftIndex = static_cast<int>(leftFloor);
+    double rightCeil = std::ceil(right);
+    int rightIndex = static_cast<int>(rightCeil);
+    if (rightIndex <= leftIndex + 1) {
+      // The edge stays within one pixel of the row.
+      double middle = 0.5 * (x + xNext) - leftFloor;
+      row[leftIndex] += static_cast<float>(d - d * middle);
+      row[leftIndex + 1] += static_cast<float>(d * middle);
+    } else {
+      double slope = 1 / (right - left);
+      double leftFraction = left - leftFloor;
+      double firstArea = 0.5 * slope * (1 - leftFraction) * (1 - leftFraction);
+      double rightFraction = right - rightCeil + 1;
+      double lastArea = 0.5 * slope * rightFraction * rightFraction;
+      row[leftIndex] += static_cast<float>(d * firstArea);
+      if (rightIndex == leftIndex + 2) {
+        row[leftIndex + 1] += static_cast<float>(d * (1 - firstArea - lastArea));
+      } else {
+        double secondArea = slope * (1.5 - leftFraction);
+        row[leftIndex + 1] += static_cast<float>(d * (secondArea - firstArea));
+        for (int i = leftIndex + 2; i < rightIndex - 1; i++) {
+          row[i] += static_cast<float>(d * slope);
+        }
+        double beforeLast = secondArea + (rightIndex - leftIndex - 3) * slope;
+        row[rightIndex - 1] += static_cast<float>(d * (1 - beforeLast - lastArea));
+      }
+      row[rightIndex] += static_cast<float>(d * lastArea);
+    }
+    x = xNext;
+  }
+}
+
+}  // namespace navsdk
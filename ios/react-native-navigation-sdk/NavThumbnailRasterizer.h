@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavThumbnailRasterizer_h
+#define NavThumbnailRasterizer_h
+
+// Portable C++ core of the route thumbnail renderer. It has no platform dependencies, so that it
+// can be built and checked on any host.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "NavGeometry.h"
+
+namespace navsdk {
+
+struct PixelPoint {
+  double x;
+  double y;
+};
+
+// Sizes are in pixels and colors in AARRGGBB format.
+struct ThumbnailStyle {
+  int width = 0;
+  int height = 0;
+  double padding = 0;
+  double strokeWidth = 0;
+  uint32_t strokeColor = 0;
+  double stopRadius = 0;
+  double stopOutlineWidth = 0;
+  uint32_t stopColor = 0;
+  uint32_t stopOutlineColor = 0;
+  uint32_t backgroundColor = 0;
+};
+
+// Decodes a path in the Encoded Polyline Algorithm Format. Decoding stops at the first malformed
+// value, keeping the points before it.
+std::vector<GeoPoint> DecodePolyline(const std::string &encoded);
+
+// Renders `path` with round joins and caps and `stops` as outlined dots, fitted into the image in
+// Web Mercator. Returns premultiplied RGBA pixels, row by row without padding.
+std::vector<uint8_t> RenderRouteThumbnail(const std::vector<GeoPoint> &path,
+                                          const std::vector<GeoPoint> &stops,
+                                          const ThumbnailStyle &style);
+
+// Anti-aliased scanline rasterizer. Shapes are accumulated as signed pixel area along their edges
+// and resolved with a prefix sum per row, which gives exact coverage of each pixel. All shapes
+// are added with the same orientation and coverage is clamped, so overlapping shapes of a layer
+// are drawn as their union.
+class CoverageRasterizer {
+ public:
+  CoverageRasterizer(int width, int height);
+
+  void Clear();
+  void AddPolygon(const PixelPoint *points, size_t count);
+  void AddCircle(PixelPoint center, double radius);
+  // Strokes `points` with round joins and caps.
+  void AddStroke(const std::vector<PixelPoint> &points, double halfWidth);
+  // Blends `color` over `rgba` with the accumulated coverage.
+  void Composite(uint32_t color, uint8_t *rgba) const;
+
+ private:
+  void AddLine(PixelPoint from, PixelPoint to);
+  void AccumulateLine(double x0, double y0, double x1, double y1);
+
+  int width_;
+  int height_;
+  // Two extra cells per row take the contributions of edges on the right border.
+  int stride_;
+  std::vector<float> accumulation_;
+};
+
+}  // namespace navsdk
+
+#endif /* NavThumbnailRasterizer_h */
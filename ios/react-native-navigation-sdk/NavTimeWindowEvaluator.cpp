@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NavTimeWindowEvaluator.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace navsdk {
+
+namespace {
+
+const double kEarthRadiusMeters = 6371009;
+
+double DistanceMeters(GeoPoint a, GeoPoint b) {
+  const double toRadians = M_PI / 180;
+  double dLat = (b.lat - a.lat) * toRadians;
+  double dLng = (b.lng - a.lng) * toRadians;
+  double h = std::sin(dLat / 2) * std::sin(dLat / 2) +
+             std::cos(a.lat * toRadians) * std::cos(b.lat * toRadians) * std::sin(dLng / 2) *
+                 std::sin(dLng / 2);
+  return 2 * kEarthRadiusMeters * std::asin(std::min(1.0, std::sqrt(h)));
+}
+
+}  // namespace
+
+TimeWindowEvaluator::TimeWindowEvaluator(const TimeWindowOptions &options) : options_(options) {}
+
+void TimeWindowEvaluator::SetOrigin(GeoPoint origin, double departureTime) {
+  origin_ = origin;
+  departureTime_ = departureTime;
+  Invalidate(0);
+}
+
+void TimeWindowEvaluator::SetRouteLegs(std::vector<RouteLegTime> legs) {
+  legs_ = std::move(legs);
+  for (size_t i = 0; i < stops_.size(); i++) {
+    stopLegs_[i] = MatchLeg(stops_[i].position);
+  }
+  Invalidate(0);
+}
+
+void TimeWindowEvaluator::SetStops(std::vector<TimeWindowStop> stops) {
+  stops_ = std::move(stops);
+  stopLegs_.resize(stops_.size());
+  for (size_t i = 0; i < stops_.size(); i++) {
+    stopLegs_[i] = MatchLeg(stops_[i].position);
+  }
+  schedules_.resize(stops_.size());
+  Invalidate(0);
+}
+
+void TimeWindowEvaluator::ReplaceStop(size_t index, const TimeWindowStop &stop) {
+  stops_[index] = stop;
+  stopLegs_[index] = MatchLeg(stop.position);
+  Invalidate(index);
+}
+
+void TimeWindowEvaluator::InsertStop(size_t index, const TimeWindowStop &stop) {
+  stops_.insert(stops_.begin() + static_cast<std::ptrdiff_t>(index), stop);
+  stopLegs_.insert(stopLegs_.begin() + static_cast<std::ptrdiff_t>(index), MatchLeg(stop.position));
+  schedules_.insert(schedules_.begin() + static_cast<std::ptrdiff_t>(index), StopSchedule{});
+  Invalidate(index);
+}
+
+void TimeWindowEvaluator::RemoveStop(size_t index) {
+  stops_.erase(stops_.begin() + static_cast<std::ptrdiff_t>(index));
+  stopLegs_.erase(stopLegs_.begin() + static_cast<std::ptrdiff_t>(index));
+  schedules_.erase(schedules_.begin() + static_cast<std::ptrdiff_t>(index));
+  Invalidate(index);
+}
+
+void TimeWindowEvaluator::MoveStop(size_t from, size_t to) {
+  if (from == to) {
+    return;
+  }
+  // Rotating the range between the two indices moves the stop and keeps the others in order.
+  auto move = [from, to](auto &values) {
+    auto begin = values.begin();
+    if (from < to) {
+      std::rotate(begin + static_cast<std::ptrdiff_t>(from),
+                  begin + static_cast<std::ptrdiff_t>(from + 1),
+                  begin + static_cast<std::ptrdiff_t>(to + 1));
+    } else {
+      std::rotate(begin + static_cast<std::ptrdiff_t>(to),
+                  begin + static_cast<std::ptrdiff_t>(from),
+                  begin + static_cast<std::ptrdiff_t>(from + 1));
+    }
+  };
+  move(stops_);
+  move(stopLegs_);
+  Invalidate(std::min(from, to));
+}
+
+size_t TimeWindowEvaluator::Evaluate() {
+  size_t first = std::min(firstStale_, stops_.size());
+  double departure = departureTime_;
+  if (first > 0) {
+    const StopSchedule &previous = schedules_[first - 1];
+    departure = previous.arrival + previous.wait + stops_[first - 1].serviceSeconds;
+  }
+  for (size_t i = first; i < stops_.size(); i++) {
+    const TimeWindowStop &stop = stops_[i];
+    StopSchedule &schedule = schedules_[i];
+    schedule.arrival = departure + TravelSeconds(i, &schedule.routed);
+    schedule.wait = std::max(0.0, stop.windowStart - schedule.arrival);
+    double start = schedule.arrival + schedule.wait;
+    schedule.slack = stop.windowEnd - start;
+    departure = start + stop.serviceSeconds;
+  }
+  firstStale_ = stops_.size();
+  return first;
+}
+
+int TimeWindowEvaluator::MatchLeg(GeoPoint position) const {
+  int match = -1;
+  double best = options_.matchRadiusMeters;
+  for (size_t i = 0; i < legs_.size(); i++) {
+    double distance = DistanceMeters(position, legs_[i].destination);
+    if (distance <= best) {
+      best = distance;
+      match = static_cast<int>(i);
+    }
+  }
+  return match;
+}
+
+double TimeWindowEvaluator::TravelSeconds(size_t index, bool *routed) const {
+  // The route has this leg if it continues from the leg ending at the previous stop, or, for the
+  // first stop, if it is the first leg of the route.
+  int leg = stopLegs_[index];
+  int previousLeg = index == 0 ? -1 : stopLegs_[index - 1];
+  bool onRoute = leg >= 0 && (index == 0 ? leg == 0 : previousLeg >= 0 && leg == previousLeg + 1);
+  if (onRoute && !std::isnan(legs_[static_cast<size_t>(leg)].seconds)) {
+    *routed = true;
+    return legs_[static_cast<size_t>(leg)].seconds;
+  }
+  *routed = false;
+  GeoPoint from = index == 0 ? origin_ : stops_[index - 1].position;
+  return DistanceMeters(from, stops_[index].position) * options_.detourFactor /
+         options_.speedMetersPerSecond;
+}
+
+void TimeWindowEvaluator::Invalidate(size_t index) { firstStale_ = std::min(firstStale_, index); }
+
+}  // namespace navsdk
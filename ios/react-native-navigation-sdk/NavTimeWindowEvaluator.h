@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavTimeWindowEvaluator_h
+#define NavTimeWindowEvaluator_h
+
+// Portable C++ core of the time-window feasibility check of stop sequences. It has no platform
+// dependencies, so that it can be built and checked on any host.
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "NavGeometry.h"
+
+namespace navsdk {
+
+struct TimeWindowStop {
+  GeoPoint position;
+  // Seconds since the epoch. Open ends are infinite.
+  double windowStart = -INFINITY;
+  double windowEnd = INFINITY;
+  double serviceSeconds = 0;
+};
+
+// A leg of the current route, with its travel time from the destination of the previous leg, or
+// from the current location for the first leg. The time is NaN when unknown.
+struct RouteLegTime {
+  GeoPoint destination;
+  double seconds;
+};
+
+struct StopSchedule {
+  // Seconds since the epoch.
+  double arrival;
+  // Seconds waiting for the window to open.
+  double wait;
+  // Seconds between the start of service and the end of the window, negative when late and
+  // infinite for open windows.
+  double slack;
+  // Whether the travel time to the stop came from the current route rather than an estimate.
+  bool routed;
+};
+
+struct TimeWindowOptions {
+  // Travel times of legs not on the current route are estimated from the great-circle distance,
+  // scaled by detourFactor, at this speed.
+  double speedMetersPerSecond = 11;
+  double detourFactor = 1.3;
+  // Stops within this distance of the destination of a route leg are on that leg.
+  double matchRadiusMeters = 50;
+};
+
+// Schedules an ordered list of stops with time windows and service times. A leg between two
+// consecutive stops uses the travel time of the current route when the route has the same leg,
+// and an estimate otherwise.
+//
+// Changes only invalidate the schedule from the first stop they affect, and Evaluate() recomputes
+// that suffix, so a single-stop edit costs time proportional to the stops after it.
+class TimeWindowEvaluator {
+ public:
+  explicit TimeWindowEvaluator(const TimeWindowOptions &options);
+
+  // Where and when the sequence starts, usually the current location and time.
+  void SetOrigin(GeoPoint origin, double departureTime);
+  void SetRouteLegs(std::vector<RouteLegTime> legs);
+  void SetStops(std::vector<TimeWindowStop> stops);
+
+  // Edits of single stops. Indices must be valid; an insert index may equal the stop count.
+  void ReplaceStop(size_t index, const TimeWindowStop &stop);
+  void InsertStop(size_t index, const TimeWindowStop &stop);
+  void RemoveStop(size_t index);
+  void MoveStop(size_t from, size_t to);
+
+  // Recomputes the schedules from the first stop changed since the last evaluation and returns
+  // its index, which equals the stop count if nothing changed.
+  size_t Evaluate();
+
+  GeoPoint origin() const { return origin_; }
+  size_t stop_count() const { return stops_.size(); }
+  const std::vector<StopSchedule> &schedules() const { return schedules_; }
+
+ private:
+  int MatchLeg(GeoPoint position) const;
+  double TravelSeconds(size_t index, bool *routed) const;
+  void Invalidate(size_t index);
+
+  TimeWindowOptions options_;
+  GeoPoint origin_{0, 0};
+  double departureTime_ = 0;
+  std::vector<RouteLegTime> legs_;
+  std::vector<TimeWindowStop> stops_;
+  // Index of the route leg ending at each stop, or -1.
+  std::vector<int> stopLegs_;
+  std::vector<StopSchedule> schedules_;
+  size_t firstStale_ = 0;
+};
+
+}  // namespace navsdk
+
+#endif /* NavTimeWindowEvaluator_h */
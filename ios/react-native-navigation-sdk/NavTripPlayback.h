@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavTripPlayback_h
+#define NavTripPlayback_h
+
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class NavTripPlayback;
+
+typedef void (^NavTripProgressHandler)(NavTripPlayback *playback);
+
+/**
+ * Plays back a recorded trip on a map: a marker moves along the trace in trace time and a trail
+ * follows it. Positions are found by binary search over the timestamps, or by stepping from the
+ * previous index while playing. The trail is split into frozen chunks of fixed size and a live
+ * tail, so moving the playback position only rewrites the tail and adds or removes whole chunks.
+ */
+@interface NavTripPlayback : NSObject
+
+/**
+ * Copies the trace, or returns nil and sets `error` if it is empty, its arrays do not align or its
+ * timestamps decrease. `latLngs` is packed as [lat0, lng0, ...].
+ */
++ (nullable instancetype)playbackWithLatLngs:(const double *)latLngs
+                                 latLngCount:(NSUInteger)latLngCount
+                                  timestamps:(const double *)timestamps
+                              timestampCount:(NSUInteger)timestampCount
+                                       error:(NSError **)error;
+
+@property(nonatomic, strong, nullable) UIColor *trailColor;
+@property(nonatomic, assign) CGFloat trailWidth;
+/// A custom icon is drawn flat and rotated to the heading; nil uses the default marker.
+@property(nonatomic, strong, nullable) UIImage *markerIcon;
+/// Minimum time between progress notifications while playing.
+@property(nonatomic, assign) NSTimeInterval progressInterval;
+/**
+ * Caps the rate of rendered frames and progress reports to the intervals set by the quality
+ * governor of the view. Use 0 to leave a rate unchanged.
+ */
+- (void)setQualityFrameInterval:(NSTimeInterval)frameInterval
+               progressInterval:(NSTimeInterval)progressInterval;
+/// Called on the main thread when the playback position is reported.
+@property(nonatomic, copy, nullable) NavTripProgressHandler progressHandler;
+/// Playback speed relative to real time; zero holds the position.
+@property(nonatomic, assign) double rate;
+
+@property(nonatomic, readonly) double timeMs;
+/// Index of the last trace coordinate at or before `timeMs`.
+@property(nonatomic, readonly) NSUInteger index;
+@property(nonatomic, readonly) CLLocationCoordinate2D position;
+@property(nonatomic, readonly) CLLocationDegrees heading;
+@property(nonatomic, readonly, getter=isPlaying) BOOL playing;
+
+/// Draws the playback at its current time on `mapView`.
+- (void)showOnMapView:(GMSMapView *)mapView;
+
+/// Plays from the current time, or from the start once the end was reached.
+- (void)play;
+- (void)pause;
+/// Moves to `timeMs`, clamped to the time range of the trace.
+- (void)seekToTime:(double)timeMs;
+
+/// Stops playback without reporting progress and removes the marker and trail.
+- (void)remove;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavTripPlayback_h */
@@ -0,0 +1,314 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavTripPlayback.h"
+#import <QuartzCore/QuartzCore.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Vertices per frozen trail chunk. Adjacent chunks share their boundary vertex.
+static const NSUInteger kTrailChunkSize = 256;
+// While playing, the index is stepped forward at most this far before falling back to a search.
+static const NSUInteger kMaxIndexSteps = 8;
+
+// Forwards display link callbacks without retaining the playback.
+@interface NavTripPlaybackDisplayLinkTarget : NSObject
+@property(nonatomic, weak) NavTripPlayback *playback;
+@end
+
+@interface NavTripPlayback ()
+- (void)onDisplayLink:(CADisplayLink *)displayLink;
+@end
+
+@implementation NavTripPlaybackDisplayLinkTarget
+- (void)onDisplayLink:(CADisplayLink *)displayLink {
+  [self.playback onDisplayLink:displayLink];
+}
+@end
+
+@implementation NavTripPlayback {
+  std::vector<double> _times;
+  std::vector<CLLocationCoordinate2D> _coordinates;
+
+  __weak GMSMapView *_mapView;
+  GMSMarker *_marker;
+  NSMutableArray<GMSPolyline *> *_trailChunks;
+  GMSPolyline *_trailTail;
+
+  CADisplayLink *_displayLink;
+  CFTimeInterval _lastTimestamp;
+  CFTimeInterval _lastProgressTime;
+  // Lower bounds set by the quality governor of the view; 0 leaves the rates unchanged.
+  NSTimeInterval _minFrameInterval;
+  NSTimeInterval _minProgressInterval;
+}
+
++ (instancetype)playbackWithLatLngs:(const double *)latLngs
+                        latLngCount:(NSUInteger)latLngCount
+                         timestamps:(const double *)timestamps
+                     timestampCount:(NSUInteger)count
+                              error:(NSError **)error {
+  NSString *message = nil;
+  if (count == 0) {
+    message = @"A trace needs at least one coordinate";
+  } else if (latLngCount != count * 2) {
+    message = @"A trace needs one timestamp per coordinate";
+  }
+
+  NavTripPlayback *playback = [[NavTripPlayback alloc] init];
+  if (message == nil) {
+    playback->_times.reserve(count);
+    playback->_coordinates.reserve(count);
+    for (NSUInteger i = 0; i < count; i++) {
+      double time = timestamps[i];
+      if (!std::isfinite(time) || (i > 0 && time < playback->_times.back())) {
+        message = @"Trace timestamps must be finite and non-decreasing";
+        break;
+      }
+      playback->_times.push_back(time);
+      playback->_coordinates.push_back(
+          CLLocationCoordinate2DMake(latLngs[2 * i], latLngs[2 * i + 1]));
+    }
+  }
+
+  if (message != nil) {
+    if (error != NULL) {
+      *error = [NSError errorWithDomain:@"NavTripPlayback"
+                                   code:0
+                               userInfo:@{NSLocalizedDescriptionKey : message}];
+    }
+    return nil;
+  }
+  playback->_timeMs = playback->_times.front();
+  playback->_position = playback->_coordinates.front();
+  return playback;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _trailWidth = 6;
+    _progressInterval = 0.25;
+    _rate = 1;
+    _trailChunks = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [_displayLink invalidate];
+}
+
+- (void)setRate:(double)rate {
+  _rate = std::isfinite(rate) ? MAX(rate, 0) : 0;
+}
+
+- (void)showOnMapView:(GMSMapView *)mapView {
+  [self removeOverlays];
+  _mapView = mapView;
+
+  _trailTail = [GMSPolyline polylineWithPath:[GMSPath path]];
+  _trailTail.strokeWidth = _trailWidth;
+  if (_trailColor) {
+    _trailTail.strokeColor = _trailColor;
+  }
+  _trailTail.map = mapView;
+
+  _marker = [GMSMarker markerWithPosition:_position];
+  _marker.zIndex = 1;
+  if (_markerIcon) {
+    _marker.icon = _markerIcon;
+    _marker.flat = YES;
+    _marker.groundAnchor = CGPointMake(0.5, 0.5);
+  }
+  _marker.map = mapView;
+
+  [self renderAtTime:_timeMs];
+}
+
+- (void)play {
+  if (_playing) {
+    return;
+  }
+  if (_timeMs >= _times.back()) {
+    [self renderAtTime:_times.front()];
+  }
+  _playing = YES;
+  _lastTimestamp = 0;
+
+  NavTripPlaybackDisplayLinkTarget *target = [[NavTripPlaybackDisplayLinkTarget alloc] init];
+  target.playback = self;
+  _displayLink = [CADisplayLink displayLinkWithTarget:target selector:@selector(onDisplayLink:)];
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+  [self reportProgress];
+}
+
+- (void)pause {
+  if (!_playing) {
+    return;
+  }
+  [self stopDisplayLink];
+  [self reportProgress];
+}
+
+- (void)seekToTime:(double)timeMs {
+  if (!std::isfinite(timeMs)) {
+    return;
+  }
+  [self renderAtTime:std::clamp(timeMs, _times.front(), _times.back())];
+  [self reportProgress];
+}
+
+- (void)remove {
+  [self stopDisplayLink];
+  [self removeOverlays];
+}
+
+#pragma mark - Private
+
+- (void)stopDisplayLink {
+  _playing = NO;
+  [_displayLink invalidate];
+  _displayLink = nil;
+}
+
+- (void)removeOverlays {
+  for (GMSPolyline *chunk in _trailChunks) {
+    chunk.map = nil;
+  }
+  [_trailChunks removeAllObjects];
+  _trailTail.map = nil;
+  _trailTail = nil;
+  _marker.map = nil;
+  _marker = nil;
+  _mapView = nil;
+}
+
+- (void)setQualityFrameInterval:(NSTimeInterval)frameInterval
+               progressInterval:(NSTimeInterval)progressInterval {
+  _minFrameInterval = frameInterval;
+  _minProgressInterval = progressInterval;
+}
+
+- (void)onDisplayLink:(CADisplayLink *)displayLink {
+  CFTimeInterval timestamp = displayLink.timestamp;
+  if (_lastTimestamp > 0) {
+    if (timestamp - _lastTimestamp < _minFrameInterval) {
+      // Skipped frames are caught up by the next rendered one.
+      return;
+    }
+    double timeMs = _timeMs + (timestamp - _lastTimestamp) * 1000.0 * _rate;
+    if (timeMs >= _times.back()) {
+      [self renderAtTime:_times.back()];
+      [self stopDisplayLink];
+      [self reportProgress];
+      return;
+    }
+    [self renderAtTime:timeMs];
+    if (timestamp - _lastProgressTime >= MAX(_progressInterval, _minProgressInterval)) {
+      [self reportProgress];
+    }
+  }
+  _lastTimestamp = timestamp;
+}
+
+- (void)reportProgress {
+  _lastProgressTime = CACurrentMediaTime();
+  if (_progressHandler) {
+    _progressHandler(self);
+  }
+}
+
+- (NSUInteger)indexForTime:(double)timeMs {
+  NSUInteger count = _times.size();
+  // Playback moves forward a few samples per frame; step instead of searching.
+  if (_times[_index] <= timeMs) {
+    NSUInteger index = _index;
+    for (NSUInteger step = 0; step < kMaxIndexSteps; step++) {
+      if (index + 1 >= count || _times[index + 1] > timeMs) {
+        return index;
+      }
+      index++;
+    }
+  }
+  auto next = std::upper_bound(_times.begin(), _times.end(), timeMs);
+  return next == _times.begin() ? 0 : (NSUInteger)(next - _times.begin()) - 1;
+}
+
+- (void)renderAtTime:(double)timeMs {
+  _timeMs = timeMs;
+  _index = [self indexForTime:timeMs];
+
+  CLLocationCoordinate2D from = _coordinates[_index];
+  _position = from;
+  if (_index + 1 < _coordinates.size()) {
+    CLLocationCoordinate2D to = _coordinates[_index + 1];
+    double duration = _times[_index + 1] - _times[_index];
+    if (duration > 0) {
+      double fraction = (timeMs - _times[_index]) / duration;
+      _position =
+          CLLocationCoordinate2DMake(from.latitude + (to.latitude - from.latitude) * fraction,
+                                     from.longitude + (to.longitude - from.longitude) * fraction);
+    }
+    if (from.latitude != to.latitude || from.longitude != to.longitude) {
+      _heading = GMSGeometryHeading(from, to);
+    }
+  }
+
+  if (_mapView == nil) {
+    return;
+  }
+  _marker.position = _position;
+  if (_markerIcon) {
+    _marker.rotation = _heading;
+  }
+  [self updateTrail];
+}
+
+- (void)updateTrail {
+  // Chunk k spans vertices [k * size, (k + 1) * size] and is complete once the index reaches its
+  // end.
+  NSUInteger completeChunks = _index / kTrailChunkSize;
+  while (_trailChunks.count > completeChunks) {
+    _trailChunks.lastObject.map = nil;
+    [_trailChunks removeLastObject];
+  }
+  while (_trailChunks.count < completeChunks) {
+    NSUInteger start = _trailChunks.count * kTrailChunkSize;
+    GMSMutablePath *path = [GMSMutablePath path];
+    for (NSUInteger i = start; i <= start + kTrailChunkSize; i++) {
+      [path addCoordinate:_coordinates[i]];
+    }
+    GMSPolyline *chunk = [GMSPolyline polylineWithPath:path];
+    chunk.strokeWidth = _trailWidth;
+    if (_trailColor) {
+      chunk.strokeColor = _trailColor;
+    }
+    chunk.map = _mapView;
+    [_trailChunks addObject:chunk];
+  }
+
+  GMSMutablePath *tail = [GMSMutablePath path];
+  for (NSUInteger i = completeChunks * kTrailChunkSize; i <= _index; i++) {
+    [tail addCoordinate:_coordinates[i]];
+  }
+  [tail addCoordinate:_position];
+  _trailTail.path = tail;
+}
+
+@end
@@ -14,6 +14,7 @@
 
 #import "NavView.h"
 #import "FabricObjectTranslationUtil.h"
+#import "NavAnchorLayer.h"
 #import "NavModule.h"
 #import "NavViewController.h"
 #import "NavViewModule.h"
@@ -38,13 +39,18 @@ static const std::shared_ptr<const NavViewProps> kDefaultNavViewProps =
 
 @end
 
-@implementation NavView
+@implementation NavView {
+  // Hosts the React children above the map, so they never interleave with the map view.
+  NavAnchorLayer *_anchorLayer;
+}
 
 - (instancetype)initWithFrame:(CGRect)frame {
   if (self = [super initWithFrame:frame]) {
     _props = kDefaultNavViewProps;
     _initialized = NO;
     _viewController = nil;  // Will be created when mapOptions are received
+    _anchorLayer = [[NavAnchorLayer alloc] initWithFrame:self.bounds];
+    [self addSubview:_anchorLayer];
   }
   return self;
 }
@@ -121,7 +127,7 @@ static const std::shared_ptr<const NavViewProps> kDefaultNavViewProps =
 
     // Load the view (this calls loadView internally which uses all set properties)
     [_viewController setNavigationViewCallbacks:self];
-    [self addSubview:_viewController.view];
+    [self insertSubview:_viewController.view belowSubview:_anchorLayer];
 
     // Set up constraints for proper layout
     _viewController.view.translatesAutoresizingMaskIntoConstraints = NO;
@@ -136,6 +142,9 @@ static const std::shared_ptr<const NavViewProps> kDefaultNavViewProps =
     NSString *nativeIDString = [NSString stringWithUTF8String:newViewProps.nativeID.c_str()];
     [NavViewModule viewControllersRegistry][nativeIDString] = _viewController;
 
+    // Children may already be mounted; the controller positions them from now on.
+    [_viewController setAnchorLayer:_anchorLayer];
+
     // If navigation session is already initialized, trigger attachment check
     NavModule *navModule = [NavModule sharedInstance];
     if (navModule && [navModule hasSession]) {
@@ -302,6 +311,18 @@ static const std::shared_ptr<const NavViewProps> kDefaultNavViewProps =
 - (void)layoutSubviews {
   [super layoutSubviews];
   _viewController.view.frame = self.bounds;
+  _anchorLayer.frame = self.bounds;
+}
+
+// React children are mounted into the anchor layer instead of this view, which also hosts the map.
+- (void)mountChildComponentView:(UIView<RCTComponentViewProtocol> *)childComponentView
+                          index:(NSInteger)index {
+  [_anchorLayer insertSubview:childComponentView atIndex:index];
+}
+
+- (void)unmountChildComponentView:(UIView<RCTComponentViewProtocol> *)childComponentView
+                            index:(NSInteger)index {
+  [childComponentView removeFromSuperview];
 }
 
 // Event handler implementations using Fabric EventEmitter
@@ -19,17 +19,33 @@
 #import "CustomTypes.h"
 #import "INavigationViewCallback.h"
 #import "INavigationViewStateDelegate.h"
+#import "NavAnchorLayer.h"
+#import "NavAttributeIndex.h"
+#import "NavMarkerDeclutter.h"
+#import "NavMarkerStyle.h"
+#import "NavQualityGovernor.h"
+#import "NavRenderMetrics.h"
+#import "NavRoutePrefetcher.h"
+#import "NavTripPlayback.h"
+#import "NavViewportWatch.h"
+#import "NavWorkerPool.h"
 #import "ObjectTranslationUtil.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface NavViewController : UIViewController <GMSMapViewNavigationUIDelegate, GMSMapViewDelegate>
+@interface NavViewController
+    : UIViewController <GMSMapViewNavigationUIDelegate, GMSMapViewDelegate, NavAnchorLayerDelegate>
 
 typedef void (^RouteStatusCallback)(GMSRouteStatus routeStatus);
+typedef void (^NavViewportWatchHandler)(NSArray<NSString *> *entered, NSArray<NSString *> *left);
+typedef void (^NavRoutePrefetchChangeHandler)(NSArray<NSString *> *staged,
+                                              NSArray<NSString *> *evicted);
 typedef void (^OnStringResult)(NSString *result);
 typedef void (^OnBooleanResult)(BOOL result);
 typedef void (^OnDictionaryResult)(NSDictionary *_Nullable result);
 typedef void (^OnArrayResult)(NSArray *_Nullable result);
+/// Called on every camera change, and once more with `idle` set when the camera settles.
+typedef void (^NavCameraObserver)(GMSMapView *mapView, BOOL idle);
 - (void)setMapViewType:(MapViewType)mapViewType;
 - (void)setMapId:(NSString *)mapId;
 - (void)setColorScheme:(NSNumber *)colorScheme;
@@ -81,6 +97,10 @@ typedef void (^OnArrayResult)(NSArray *_Nullable result);
 - (void)addMarker:(GMSMarker *)marker
           visible:(BOOL)visible
            result:(OnDictionaryResult)completionBlock;
+- (void)addMarker:(GMSMarker *)marker
+          visible:(BOOL)visible
+       attributes:(nullable NSDictionary<NSString *, id> *)attributes
+           result:(OnDictionaryResult)completionBlock;
 - (void)addPolygon:(GMSPolygon *)polygon
            visible:(BOOL)visible
             result:(OnDictionaryResult)completionBlock;
@@ -101,6 +121,7 @@ typedef void (^OnArrayResult)(NSArray *_Nullable result);
 - (NSArray<NSDictionary *> *)getCircles;
 - (NSArray<NSDictionary *> *)getPolylines;
 - (NSArray<NSDictionary *> *)getPolygons;
+- (nullable GMSPolygon *)polygonWithId:(NSString *)polygonId;
 - (NSArray<NSDictionary *> *)getGroundOverlays;
 - (BOOL)attachToNavigationSessionIfNeeded;
 - (void)onNavigationSessionReady;
@@ -110,6 +131,17 @@ typedef void (^OnArrayResult)(NSArray *_Nullable result);
 - (void)setPadding:(UIEdgeInsets)insets;
 - (void)setMinZoomLevel:(float)minLevel maxZoom:(float)maxLevel;
 - (void)animateCamera:(GMSCameraUpdate *)update result:(OnBooleanResult)completionBlock;
+
+/**
+ * Animates the camera once to fit the overlays with the given `ids`, the markers whose "group"
+ * attribute equals `group`, or every overlay when both are nil. The camera is untilted and faces
+ * `bearing`, or north. Returns NO, without moving the camera, if no overlay was selected.
+ */
+- (BOOL)fitCameraToOverlaysWithIds:(nullable NSArray<NSString *> *)ids
+                             group:(nullable NSString *)group
+                           padding:(UIEdgeInsets)padding
+                           maxZoom:(nullable NSNumber *)maxZoom
+                           bearing:(nullable NSNumber *)bearing;
 @property(nonatomic, assign) BOOL isNavigationView;
 
 /**
@@ -118,6 +150,115 @@ typedef void (^OnArrayResult)(NSArray *_Nullable result);
  */
 @property(nonatomic, weak, nullable) id<INavigationViewStateDelegate> stateDelegate;
 
+/**
+ * Token cancelled when this view controller is cleaned up. Use it for NavWorkerPool tasks whose
+ * result is only meaningful while the view exists.
+ */
+@property(nonatomic, readonly) NavCancellationToken *viewLifetimeToken;
+
+/**
+ * Returns a token for the current camera generation. It is cancelled as soon as the camera moves
+ * or the view is cleaned up, so work computed for a stale viewport is dropped.
+ */
+- (NavCancellationToken *)cameraGenerationToken;
+
+/**
+ * Adaptive quality governor of this view, or nil when disabled. Features with quality knobs read
+ * their current values from `qualityGovernor.settings`. Replacing the governor stops the old one.
+ */
+@property(nonatomic, strong, nullable) NavQualityGovernor *qualityGovernor;
+
+/**
+ * Applies the current knob values of `qualityGovernor` to the features they control. Called when
+ * the governor is replaced and after each of its adjustments.
+ */
+- (void)applyQualitySettings;
+
+/// Minimum interval between high-frequency view events set by the quality governor, or 0.
+- (NSTimeInterval)qualityEventInterval;
+
+/// Frame sampler shared by the governor and render metrics of this view.
+@property(nonatomic, readonly) NavFrameSampler *frameSampler;
+
+/// Render metrics of this view, or nil when disabled. Replacing the metrics stops the old ones.
+@property(nonatomic, strong, nullable) NavRenderMetrics *renderMetrics;
+
+/// Current number of overlays per type (markers, polylines, polygons, circles, groundOverlays).
+- (NSDictionary<NSString *, NSNumber *> *)overlayCounts;
+
+/// Registers a camera observer under `key`, replacing the previous one. Pass nil to remove it.
+- (void)setCameraObserver:(nullable NavCameraObserver)observer forKey:(NSString *)key;
+
+/// Projects packed [lat, lng, ...] coordinates to packed [x, y, ...] view points in one pass.
+- (NSArray<NSNumber *> *)screenPointsForCoordinates:(NSArray<NSNumber *> *)latLngs;
+
+/// Converts packed [x, y, ...] view points to packed [lat, lng, ...] coordinates in one pass.
+- (NSArray<NSNumber *> *)coordinatesForScreenPoints:(NSArray<NSNumber *> *)points;
+
+/**
+ * Data-driven style evaluated against the attribute record of every marker, or nil to restore the
+ * option values of styled markers. Zoom-dependent styles are re-evaluated when the camera settles.
+ */
+- (void)setMarkerStyle:(nullable NavMarkerStyle *)style;
+
+/**
+ * Sets attribute `key` of the given markers to the aligned `values`; NSNull removes it. Only
+ * markers whose style reads `key` are restyled. Returns the number of markers found.
+ */
+- (NSInteger)setMarkerAttribute:(NSString *)key
+                         values:(NSArray *)values
+                   forMarkerIds:(NSArray<NSString *> *)markerIds;
+
+/**
+ * Returns the ids of the markers whose attributes satisfy `predicate`. Equality, range and "has"
+ * terms are resolved through attribute indexes, built on first use and then kept up to date.
+ */
+- (NSArray<NSString *> *)markerIdsWhere:(NavStyleExpression *)predicate;
+
+/**
+ * Applies `patch` to every marker matching `predicate` in one pass and returns their number. The
+ * patch may set the visible, alpha, zIndex and rotation option values and merge `attributes`, in
+ * which NSNull removes a key. Styled properties keep following the style.
+ */
+- (NSInteger)updateMarkersWhere:(NavStyleExpression *)predicate
+                          patch:(NSDictionary<NSString *, id> *)patch;
+
+/**
+ * Hides markers whose screen boxes overlap a higher-priority marker, or pass nil to show them all
+ * again. Runs when the camera settles, at a reduced rate while it moves, and after marker changes.
+ */
+- (void)setMarkerDeclutter:(nullable NavMarkerDeclutter *)declutter;
+
+/**
+ * Reports when the given overlays enter or leave the visible region. Membership is evaluated when
+ * the camera settles and after watched overlays change, and the handler only receives changes,
+ * starting with the overlays visible now. Pass an empty array to stop watching.
+ */
+- (void)setViewportWatchIds:(NSArray<NSString *> *)overlayIds
+                    handler:(nullable NavViewportWatchHandler)handler;
+
+/**
+ * Stages the features loaded by `prefetcher` as hidden markers along the route of the navigation
+ * session, replacing the previous prefetcher and removing the markers it staged. The handler
+ * receives the ids of the markers added and removed. Pass nil to stop prefetching.
+ */
+- (void)setRoutePrefetcher:(nullable NavRoutePrefetcher *)prefetcher
+                   handler:(nullable NavRoutePrefetchChangeHandler)handler;
+- (void)onRouteChanged:(nullable NSArray<GMSRouteLeg *> *)routeLegs;
+- (void)onRoadSnappedLocation:(CLLocation *)location;
+
+/**
+ * Recorded-trip playback shown on this map, or nil. Setting a playback draws it; replacing or
+ * clearing it removes the previous one from the map.
+ */
+@property(nonatomic, strong, nullable) NavTripPlayback *tripPlayback;
+
+/**
+ * Layer hosting the anchored React children of this view. Its anchored views are repositioned from
+ * the map projection on every camera frame, and hidden while their coordinate is off-screen.
+ */
+@property(nonatomic, strong, nullable) NavAnchorLayer *anchorLayer;
+
 @end
 
 NS_ASSUME_NONNULL_END
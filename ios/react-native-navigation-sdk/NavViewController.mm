@@ -16,18 +16,97 @@
 
 #import "NavViewController.h"
 #import <GoogleNavigation/GoogleNavigation.h>
+#import <QuartzCore/QuartzCore.h>
 #import <React/RCTLog.h>
 #import <UserNotifications/UserNotifications.h>
 #import "CustomTypes.h"
+#import "NavAnchorView.h"
 #import "NavModule.h"
 #import "ObjectTranslationUtil.h"
 
+#include "NavPolylineSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+static NSString *const kAnchoredViewsObserverKey = @"anchoredViews";
+static NSString *const kMarkerStyleObserverKey = @"markerStyle";
+static NSString *const kMarkerDeclutterObserverKey = @"markerDeclutter";
+static NSString *const kViewportWatchObserverKey = @"viewportWatch";
+
+namespace {
+
+// Path drawn for `path` at the given simplification tolerance; the path itself when not positive.
+GMSPath *SimplifiedPath(GMSPath *path, double toleranceMeters) {
+  if (path == nil || toleranceMeters <= 0) {
+    return path;
+  }
+  std::vector<navsdk::GeoPoint> points;
+  points.reserve(path.count);
+  for (NSUInteger i = 0; i < path.count; i++) {
+    CLLocationCoordinate2D coordinate = [path coordinateAtIndex:i];
+    points.push_back({coordinate.latitude, coordinate.longitude});
+  }
+  std::vector<navsdk::GeoPoint> simplified = navsdk::SimplifyPolyline(points, toleranceMeters);
+  if (simplified.size() == points.size()) {
+    return path;
+  }
+  GMSMutablePath *result = [GMSMutablePath path];
+  for (const navsdk::GeoPoint &point : simplified) {
+    [result addCoordinate:CLLocationCoordinate2DMake(point.lat, point.lng)];
+  }
+  return result;
+}
+
+// Geographic extent of a set of overlays, grown one coordinate at a time.
+struct NavCoordinateExtent {
+  double minLat = INFINITY;
+  double minLng = INFINITY;
+  double maxLat = -INFINITY;
+  double maxLng = -INFINITY;
+
+  bool IsEmpty() const { return minLat > maxLat; }
+
+  void Include(double lat, double lng) {
+    minLat = std::min(minLat, lat);
+    maxLat = std::max(maxLat, lat);
+    minLng = std::min(minLng, lng);
+    maxLng = std::max(maxLng, lng);
+  }
+
+  void Include(const NavCoordinateExtent &other) {
+    if (!other.IsEmpty()) {
+      Include(other.minLat, other.minLng);
+      Include(other.maxLat, other.maxLng);
+    }
+  }
+};
+
+// Normalized Web Mercator coordinates, in [0, 1] from the north-west corner.
+double MercatorX(double lng) { return (lng + 180.0) / 360.0; }
+
+double MercatorY(double lat) {
+  double sinLat = std::sin(std::max(-85.05112878, std::min(85.05112878, lat)) * M_PI / 180.0);
+  return 0.5 - std::log((1 + sinLat) / (1 - sinLat)) / (4 * M_PI);
+}
+
+double LatitudeFromMercatorY(double y) {
+  return 90.0 - 360.0 * std::atan(std::exp((y - 0.5) * 2 * M_PI)) / M_PI;
+}
+
+}  // namespace
+
 @implementation NavViewController {
   GMSMapView *_mapView;
   GMSMutableCameraPosition *_camera;
   GMSCameraPosition *_initialCameraPosition;
   NSMutableDictionary<NSString *, GMSMarker *> *_markerMap;
   NSMutableDictionary<NSString *, GMSPolyline *> *_polylineMap;
+  // Full-resolution path of each polyline, drawn simplified by the quality governor's tolerance.
+  NSMutableDictionary<NSString *, GMSPath *> *_polylineSourcePaths;
+  double _appliedPolylineTolerance;
   NSMutableDictionary<NSString *, GMSPolygon *> *_polygonMap;
   NSMutableDictionary<NSString *, GMSCircle *> *_circleMap;
   NSMutableDictionary<NSString *, GMSGroundOverlay *> *_groundOverlayMap;
@@ -41,6 +120,30 @@
   NSNumber *_navigationUIEnabledPreference;  // 0=AUTOMATIC, 1=DISABLED
   NSNumber *_navigationLightingMode;
   NSNumber *_trafficPromptsEnabled;
+  NavCancellationToken *_cameraGenerationToken;
+  NavFrameSampler *_frameSampler;
+  NSMutableDictionary<NSString *, NavCameraObserver> *_cameraObservers;
+  NSMutableDictionary<NSString *, NSDictionary<NSString *, id> *> *_markerAttributes;
+  // Built on the first attribute query, then updated with every attribute change.
+  NavAttributeIndex *_markerAttributeIndex;
+  // A marker is shown only when neither its options, the style filter nor decluttering hide it.
+  NSMutableSet<NSString *> *_markersHiddenByOptions;
+  NSMutableSet<NSString *> *_markersHiddenByStyle;
+  NSMutableSet<NSString *> *_markersHiddenByDeclutter;
+  // Option values of styled markers, restored when the style is removed.
+  NSMutableDictionary<NSString *, NSDictionary<NSString *, id> *> *_markerBaseStyles;
+  NSMutableDictionary<NSNumber *, UIImage *> *_markerColorIcons;
+  NavMarkerStyle *_markerStyle;
+  float _markerStyleZoom;
+  NavMarkerDeclutter *_markerDeclutter;
+  // Extent of every polyline and polygon path, dropped together with the path.
+  NSMapTable<GMSPath *, NSData *> *_pathExtents;
+  CFTimeInterval _lastDeclutterTime;
+  BOOL _declutterScheduled;
+  NavViewportWatch *_viewportWatch;
+  NavViewportWatchHandler _viewportWatchHandler;
+  BOOL _viewportWatchScheduled;
+  NavRoutePrefetcher *_routePrefetcher;
 }
 
 - (instancetype)init {
@@ -48,6 +151,7 @@
   if (self) {
     _mapViewType = NULL;  // Must be set before loadView
     _navigationLightingMode = nil;
+    _viewLifetimeToken = [[NavCancellationToken alloc] init];
   }
   return self;
 }
@@ -73,6 +177,7 @@
 
   _markerMap = [[NSMutableDictionary alloc] init];
   _polylineMap = [[NSMutableDictionary alloc] init];
+  _polylineSourcePaths = [[NSMutableDictionary alloc] init];
   _polygonMap = [[NSMutableDictionary alloc] init];
   _circleMap = [[NSMutableDictionary alloc] init];
   _groundOverlayMap = [[NSMutableDictionary alloc] init];
@@ -226,6 +331,22 @@
 - (void)cleanup {
   _isSessionAttached = NO;
 
+  // Drop any background work still queued for this view.
+  [_viewLifetimeToken cancel];
+  _cameraGenerationToken = nil;
+  [_cameraObservers removeAllObjects];
+  _anchorLayer.delegate = nil;
+  _anchorLayer = nil;
+
+  [_qualityGovernor stop];
+  _qualityGovernor = nil;
+  [_renderMetrics stop];
+  _renderMetrics = nil;
+  [_tripPlayback remove];
+  _tripPlayback = nil;
+  [_routePrefetcher cancel];
+  _routePrefetcher = nil;
+
   // Remove all delegates to break retain cycles
   if (_mapView) {
     _mapView.delegate = nil;
@@ -239,13 +360,20 @@
 
   // Clear local dictionaries and set to nil
   [_markerMap removeAllObjects];
+  [self clearMarkerStyleState];
+  _markerStyle = nil;
+  _markerDeclutter = nil;
+  _viewportWatch = nil;
+  _viewportWatchHandler = nil;
   [_polylineMap removeAllObjects];
+  [_polylineSourcePaths removeAllObjects];
   [_polygonMap removeAllObjects];
   [_circleMap removeAllObjects];
   [_groundOverlayMap removeAllObjects];
 
   _markerMap = nil;
   _polylineMap = nil;
+  _polylineSourcePaths = nil;
   _polygonMap = nil;
   _circleMap = nil;
   _groundOverlayMap = nil;
@@ -286,6 +414,269 @@
   return FALSE;
 }
 
+- (void)mapView:(GMSMapView *)mapView didChangeCameraPosition:(GMSCameraPosition *)position {
+  [self advanceCameraGeneration];
+  [self notifyCameraObservers:NO];
+}
+
+- (void)mapView:(GMSMapView *)mapView idleAtCameraPosition:(GMSCameraPosition *)position {
+  [self notifyCameraObservers:YES];
+}
+
+- (void)setCameraObserver:(NavCameraObserver)observer forKey:(NSString *)key {
+  if (_cameraObservers == nil) {
+    _cameraObservers = [NSMutableDictionary dictionary];
+  }
+  _cameraObservers[key] = observer;
+}
+
+- (void)notifyCameraObservers:(BOOL)idle {
+  if (_cameraObservers.count == 0 || _mapView == nil) {
+    return;
+  }
+  // Observers may unregister themselves while being notified.
+  for (NavCameraObserver observer in [_cameraObservers allValues]) {
+    observer(_mapView, idle);
+  }
+}
+
+- (void)setAnchorLayer:(NavAnchorLayer *)anchorLayer {
+  if (_anchorLayer.delegate == self) {
+    _anchorLayer.delegate = nil;
+  }
+  _anchorLayer = anchorLayer;
+  if (anchorLayer == nil) {
+    [self setCameraObserver:nil forKey:kAnchoredViewsObserverKey];
+    return;
+  }
+
+  anchorLayer.delegate = self;
+  __weak NavViewController *weakSelf = self;
+  NavCameraObserver observer = ^(GMSMapView *mapView, BOOL idle) {
+    NavAnchorLayer *layer = weakSelf.anchorLayer;
+    NSArray<NavAnchorView *> *views = layer.anchoredViews;
+    if (views.count > 0) {
+      [weakSelf anchorLayer:layer layoutAnchoredViews:views];
+    }
+  };
+  [self setCameraObserver:observer forKey:kAnchoredViewsObserverKey];
+  [self anchorLayer:anchorLayer layoutAnchoredViews:anchorLayer.anchoredViews];
+}
+
+- (void)anchorLayer:(NavAnchorLayer *)layer layoutAnchoredViews:(NSArray<NavAnchorView *> *)views {
+  if (_mapView == nil || views.count == 0) {
+    return;
+  }
+  GMSProjection *projection = _mapView.projection;
+  CGRect bounds = layer.bounds;
+  // Views within the virtualization margin around the layer stay materialized.
+  double margin = std::max(0.0, _qualityGovernor.settings.virtualizationMargin);
+  CGFloat marginX = (CGFloat)(margin * bounds.size.width);
+  CGFloat marginY = (CGFloat)(margin * bounds.size.height);
+  for (NavAnchorView *view in views) {
+    if (!CLLocationCoordinate2DIsValid(view.coordinate)) {
+      [view placeAtPoint:CGPointZero visible:NO];
+      continue;
+    }
+    CGPoint point = [_mapView convertPoint:[projection pointForCoordinate:view.coordinate]
+                                    toView:layer];
+    // Cull once the view can no longer overlap the layer, whatever its anchor point is.
+    CGSize size = view.bounds.size;
+    CGRect area = CGRectInset(bounds, -MAX(size.width, marginX), -MAX(size.height, marginY));
+    BOOL visible = CGRectContainsPoint(area, point);
+    [view placeAtPoint:point visible:visible];
+  }
+}
+
+- (NSArray<NSNumber *> *)screenPointsForCoordinates:(NSArray<NSNumber *> *)latLngs {
+  NSUInteger count = latLngs.count / 2;
+  NSMutableArray<NSNumber *> *result = [NSMutableArray arrayWithCapacity:count * 2];
+  GMSProjection *projection = _mapView.projection;
+  for (NSUInteger i = 0; i < count; i++) {
+    CLLocationCoordinate2D coordinate = CLLocationCoordinate2DMake(
+        latLngs[2 * i].doubleValue, latLngs[2 * i + 1].doubleValue);
+    CGPoint point = [projection pointForCoordinate:coordinate];
+    [result addObject:@(point.x)];
+    [result addObject:@(point.y)];
+  }
+  return result;
+}
+
+- (NSArray<NSNumber *> *)coordinatesForScreenPoints:(NSArray<NSNumber *> *)points {
+  NSUInteger count = points.count / 2;
+  NSMutableArray<NSNumber *> *result = [NSMutableArray arrayWithCapacity:count * 2];
+  GMSProjection *projection = _mapView.projection;
+  for (NSUInteger i = 0; i < count; i++) {
+    CGPoint point = CGPointMake(points[2 * i].doubleValue, points[2 * i + 1].doubleValue);
+    CLLocationCoordinate2D coordinate = [projection coordinateForPoint:point];
+    [result addObject:@(coordinate.latitude)];
+    [result addObject:@(coordinate.longitude)];
+  }
+  return result;
+}
+
+- (NavCancellationToken *)cameraGenerationToken {
+  if (_cameraGenerationToken == nil) {
+    _cameraGenerationToken = [[NavCancellationToken alloc] initWithParent:_viewLifetimeToken];
+  }
+  return _cameraGenerationToken;
+}
+
+- (void)setQualityGovernor:(NavQualityGovernor *)qualityGovernor {
+  if (_qualityGovernor != qualityGovernor) {
+    [_qualityGovernor stop];
+  }
+  _qualityGovernor = qualityGovernor;
+  [self applyQualitySettings];
+}
+
+- (void)applyQualitySettings {
+  double tolerance = _qualityGovernor.settings.polylineTolerance;
+  if (tolerance != _appliedPolylineTolerance) {
+    _appliedPolylineTolerance = tolerance;
+    for (NSString *polylineId in _polylineSourcePaths) {
+      _polylineMap[polylineId].path = SimplifiedPath(_polylineSourcePaths[polylineId], tolerance);
+    }
+  }
+  [_tripPlayback setQualityFrameInterval:[self qualityAnimationInterval]
+                        progressInterval:[self qualityEventInterval]];
+  // Cluster radius and virtualization margin take effect on the next pass.
+  [self setNeedsDeclutter];
+  if (_anchorLayer != nil) {
+    [self anchorLayer:_anchorLayer layoutAnchoredViews:_anchorLayer.anchoredViews];
+  }
+}
+
+- (NSTimeInterval)qualityEventInterval {
+  double rate = _qualityGovernor.settings.eventRate;
+  return rate > 0 ? 1.0 / rate : 0;
+}
+
+- (NSTimeInterval)qualityAnimationInterval {
+  double rate = _qualityGovernor.settings.animationFrameRate;
+  return rate > 0 ? 1.0 / rate : 0;
+}
+
+- (void)setRoutePrefetcher:(NavRoutePrefetcher *)prefetcher
+                   handler:(NavRoutePrefetchChangeHandler)handler {
+  NavRoutePrefetcher *previous = _routePrefetcher;
+  _routePrefetcher = nil;
+  [previous cancel];
+  for (NSString *featureId in previous.stagedIds) {
+    [self removeMarker:featureId];
+  }
+  if (prefetcher == nil) {
+    return;
+  }
+
+  _routePrefetcher = prefetcher;
+  __weak NavViewController *weakSelf = self;
+  prefetcher.handler = ^(NSArray<NSDictionary<NSString *, id> *> *staged,
+                         NSArray<NSString *> *evicted) {
+    NSArray<NSString *> *stagedIds = [weakSelf stagePrefetchedFeatures:staged evicted:evicted];
+    if (handler != nil) {
+      handler(stagedIds, evicted);
+    }
+  };
+  GMSNavigationSession *session = [[NavModule sharedInstance] getSession];
+  [prefetcher setRouteLegs:session.navigator.routeLegs];
+  // Navigation map views report the road-snapped location, if any, until the next update arrives.
+  CLLocation *location = _mapView.myLocation;
+  if (location != nil) {
+    [prefetcher updateWithLocation:location.coordinate];
+  }
+}
+
+// Adds the staged features as hidden markers and removes the evicted ones. Returns the ids of the
+// markers added.
+- (NSArray<NSString *> *)stagePrefetchedFeatures:(NSArray<NSDictionary<NSString *, id> *> *)staged
+                                         evicted:(NSArray<NSString *> *)evicted {
+  for (NSString *featureId in evicted) {
+    [self removeMarker:featureId];
+  }
+  NSMutableArray<NSString *> *stagedIds = [NSMutableArray arrayWithCapacity:staged.count];
+  for (NSDictionary<NSString *, id> *feature in staged) {
+    NSString *featureId = feature[@"id"];
+    NSString *title = feature[@"title"];
+    NSString *snippet = feature[@"snippet"];
+    NSString *imgPath = feature[@"imgPath"];
+    NSNumber *zIndex = feature[@"zIndex"];
+    NSDictionary<NSString *, id> *attributes = feature[@"attributes"];
+    UIImage *icon = [imgPath isKindOfClass:[NSString class]] ? [UIImage imageNamed:imgPath] : nil;
+    GMSMarker *marker = [ObjectTranslationUtil
+        createMarker:CLLocationCoordinate2DMake([feature[@"lat"] doubleValue],
+                                                [feature[@"lng"] doubleValue])
+               title:[title isKindOfClass:[NSString class]] ? title : nil
+             snippet:[snippet isKindOfClass:[NSString class]] ? snippet : nil
+               alpha:1
+            rotation:0
+                flat:NO
+           draggable:NO
+                icon:icon
+              zIndex:[zIndex isKindOfClass:[NSNumber class]] ? zIndex : nil
+          identifier:featureId];
+    [self addMarker:marker
+            visible:NO
+         attributes:[attributes isKindOfClass:[NSDictionary class]] ? attributes : nil
+             result:^(NSDictionary *result) {
+               [stagedIds addObject:featureId];
+             }];
+  }
+  return stagedIds;
+}
+
+- (void)onRouteChanged:(NSArray<GMSRouteLeg *> *)routeLegs {
+  [_routePrefetcher setRouteLegs:routeLegs];
+}
+
+- (void)onRoadSnappedLocation:(CLLocation *)location {
+  [_routePrefetcher updateWithLocation:location.coordinate];
+}
+
+- (void)setTripPlayback:(NavTripPlayback *)tripPlayback {
+  if (_tripPlayback == tripPlayback) {
+    return;
+  }
+  [_tripPlayback remove];
+  _tripPlayback = tripPlayback;
+  [tripPlayback setQualityFrameInterval:[self qualityAnimationInterval]
+                       progressInterval:[self qualityEventInterval]];
+  if (tripPlayback && _mapView) {
+    [tripPlayback showOnMapView:_mapView];
+  }
+}
+
+- (NavFrameSampler *)frameSampler {
+  if (_frameSampler == nil) {
+    _frameSampler = [[NavFrameSampler alloc] init];
+  }
+  return _frameSampler;
+}
+
+- (void)setRenderMetrics:(NavRenderMetrics *)renderMetrics {
+  if (_renderMetrics != renderMetrics) {
+    [_renderMetrics stop];
+  }
+  _renderMetrics = renderMetrics;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)overlayCounts {
+  return @{
+    @"markers" : @(_markerMap.count),
+    @"polylines" : @(_polylineMap.count),
+    @"polygons" : @(_polygonMap.count),
+    @"circles" : @(_circleMap.count),
+    @"groundOverlays" : @(_groundOverlayMap.count),
+  };
+}
+
+- (void)advanceCameraGeneration {
+  if (_cameraGenerationToken != nil) {
+    [_cameraGenerationToken cancel];
+    _cameraGenerationToken = nil;
+  }
+}
+
 - (void)mapView:(GMSMapView *)mapView didTapOverlay:(GMSOverlay *)overlay {
   if ([overlay isKindOfClass:[GMSPolyline class]]) {
     GMSPolyline *polyline = (GMSPolyline *)overlay;
@@ -685,12 +1076,17 @@
 }
 
 - (void)clearMapView {
+  self.tripPlayback = nil;
   [_mapView clear];
   [_markerMap removeAllObjects];
+  [self clearMarkerStyleState];
   [_polylineMap removeAllObjects];
+  [_polylineSourcePaths removeAllObjects];
   [_polygonMap removeAllObjects];
   [_circleMap removeAllObjects];
   [_groundOverlayMap removeAllObjects];
+  [self setNeedsViewportWatchUpdate];
+  [_routePrefetcher forgetAllFeatures];
 }
 
 - (NSString *)getEffectiveIdFromUserData:(id)userData {
@@ -717,6 +1113,7 @@
                               clickable:circle.tappable
                                  zIndex:@(circle.zIndex)];
     existingCircle.map = visible ? _mapView : nil;
+    [self watchedOverlayDidChange:effectiveId];
     completionBlock([ObjectTranslationUtil transformCircleToDictionary:existingCircle]);
     return;
   }
@@ -732,17 +1129,30 @@
   }
 
   _circleMap[effectiveId] = circle;
+  [self watchedOverlayDidChange:effectiveId];
   completionBlock([ObjectTranslationUtil transformCircleToDictionary:circle]);
 }
 
 - (void)addMarker:(GMSMarker *)marker
           visible:(BOOL)visible
            result:(OnDictionaryResult)completionBlock {
+  [self addMarker:marker visible:visible attributes:nil result:completionBlock];
+}
+
+- (void)addMarker:(GMSMarker *)marker
+          visible:(BOOL)visible
+       attributes:(NSDictionary<NSString *, id> *)attributes
+           result:(OnDictionaryResult)completionBlock {
   NSString *effectiveId = [self getEffectiveIdFromUserData:marker.userData];
 
   // If ID provided and object exists, update it instead of creating new
   if (effectiveId && _markerMap[effectiveId]) {
     GMSMarker *existingMarker = _markerMap[effectiveId];
+    // Drop a style tint, which updateMarker would otherwise keep as if it were a custom image.
+    NSDictionary<NSString *, id> *base = _markerBaseStyles[effectiveId];
+    if (base != nil && marker.icon == nil) {
+      [self restoreMarker:existingMarker fromBaseStyle:base];
+    }
     [ObjectTranslationUtil updateMarker:existingMarker
                                   title:marker.title
                                 snippet:marker.snippet
@@ -753,13 +1163,15 @@
                                    icon:marker.icon
                                  zIndex:@(marker.zIndex)
                                position:marker.position];
-    existingMarker.map = visible ? _mapView : nil;
+    [self setStyleStateForMarker:existingMarker
+                        markerId:effectiveId
+                         visible:visible
+                      attributes:attributes];
     completionBlock([ObjectTranslationUtil transformMarkerToDictionary:existingMarker]);
     return;
   }
 
   // Create new marker
-  marker.map = visible ? _mapView : nil;
   marker.tappable = YES;
 
   // Generate ID if not provided
@@ -769,9 +1181,459 @@
   }
 
   _markerMap[effectiveId] = marker;
+  [self setStyleStateForMarker:marker markerId:effectiveId visible:visible attributes:attributes];
   completionBlock([ObjectTranslationUtil transformMarkerToDictionary:marker]);
 }
 
+// Records the option visibility and attributes of a freshly added or replaced marker, then applies
+// the current style on top of its option values.
+- (void)setStyleStateForMarker:(GMSMarker *)marker
+                      markerId:(NSString *)markerId
+                       visible:(BOOL)visible
+                    attributes:(NSDictionary<NSString *, id> *)attributes {
+  if (_markersHiddenByOptions == nil) {
+    _markersHiddenByOptions = [NSMutableSet set];
+    _markersHiddenByStyle = [NSMutableSet set];
+    _markerAttributes = [NSMutableDictionary dictionary];
+    _markerBaseStyles = [NSMutableDictionary dictionary];
+  }
+  if (visible) {
+    [_markersHiddenByOptions removeObject:markerId];
+  } else {
+    [_markersHiddenByOptions addObject:markerId];
+  }
+  [self setAttributes:[attributes copy] forMarkerId:markerId];
+  [_markerBaseStyles removeObjectForKey:markerId];
+
+  if (_markerStyle != nil) {
+    [self applyMarkerStyleToMarker:marker markerId:markerId];
+  } else {
+    [self updateVisibilityOfMarker:marker markerId:markerId];
+  }
+  [self setNeedsDeclutter];
+  [self watchedOverlayDidChange:markerId];
+}
+
+- (void)updateVisibilityOfMarker:(GMSMarker *)marker markerId:(NSString *)markerId {
+  BOOL visible = ![_markersHiddenByOptions containsObject:markerId] &&
+                 ![_markersHiddenByStyle containsObject:markerId] &&
+                 ![_markersHiddenByDeclutter containsObject:markerId];
+  GMSMapView *map = visible ? _mapView : nil;
+  if (marker.map != map) {
+    marker.map = map;
+  }
+}
+
+- (void)setMarkerStyle:(NavMarkerStyle *)style {
+  _markerStyle = style;
+  _markerStyleZoom = _mapView.camera.zoom;
+
+  if (style == nil) {
+    // Restore the option values of every styled marker.
+    [_markerBaseStyles enumerateKeysAndObjectsUsingBlock:^(
+                           NSString *markerId, NSDictionary<NSString *, id> *base, BOOL *stop) {
+      GMSMarker *marker = self->_markerMap[markerId];
+      if (marker != nil) {
+        [self restoreMarker:marker fromBaseStyle:base];
+      }
+    }];
+    [_markerBaseStyles removeAllObjects];
+    NSSet<NSString *> *hidden = [_markersHiddenByStyle copy];
+    [_markersHiddenByStyle removeAllObjects];
+    for (NSString *markerId in hidden) {
+      GMSMarker *marker = _markerMap[markerId];
+      if (marker != nil) {
+        [self updateVisibilityOfMarker:marker markerId:markerId];
+      }
+    }
+  } else {
+    [_markerMap enumerateKeysAndObjectsUsingBlock:^(NSString *markerId, GMSMarker *marker,
+                                                    BOOL *stop) {
+      [self applyMarkerStyleToMarker:marker markerId:markerId];
+    }];
+  }
+
+  if (style.usesZoom) {
+    __weak NavViewController *weakSelf = self;
+    NavCameraObserver observer = ^(GMSMapView *mapView, BOOL idle) {
+      if (idle) {
+        [weakSelf restyleMarkersForZoom:mapView.camera.zoom];
+      }
+    };
+    [self setCameraObserver:observer forKey:kMarkerStyleObserverKey];
+  } else {
+    [self setCameraObserver:nil forKey:kMarkerStyleObserverKey];
+  }
+  [self setNeedsDeclutter];
+}
+
+- (void)restyleMarkersForZoom:(float)zoom {
+  if (_markerStyle == nil || zoom == _markerStyleZoom) {
+    return;
+  }
+  _markerStyleZoom = zoom;
+  [_markerMap enumerateKeysAndObjectsUsingBlock:^(NSString *markerId, GMSMarker *marker,
+                                                  BOOL *stop) {
+    [self applyMarkerStyleToMarker:marker markerId:markerId];
+  }];
+}
+
+- (NSInteger)setMarkerAttribute:(NSString *)key
+                         values:(NSArray *)values
+                   forMarkerIds:(NSArray<NSString *> *)markerIds {
+  if (_markerAttributes == nil) {
+    _markerAttributes = [NSMutableDictionary dictionary];
+  }
+  BOOL restyle = [_markerStyle dependsOnAttribute:key];
+  BOOL redeclutter = restyle || [_markerDeclutter.priority.attributeKeys containsObject:key];
+  NSInteger found = 0;
+  NSUInteger count = MIN(markerIds.count, values.count);
+  for (NSUInteger i = 0; i < count; i++) {
+    NSString *markerId = markerIds[i];
+    GMSMarker *marker = _markerMap[markerId];
+    if (marker == nil) {
+      continue;
+    }
+    found++;
+
+    NSMutableDictionary<NSString *, id> *attributes =
+        [_markerAttributes[markerId] mutableCopy] ?: [NSMutableDictionary dictionary];
+    id value = values[i];
+    if ([value isKindOfClass:[NSNull class]]) {
+      [attributes removeObjectForKey:key];
+    } else {
+      attributes[key] = value;
+    }
+    [self setAttributes:attributes forMarkerId:markerId];
+
+    if (restyle) {
+      [self applyMarkerStyleToMarker:marker markerId:markerId];
+    }
+  }
+  if (redeclutter && found > 0) {
+    [self setNeedsDeclutter];
+  }
+  return found;
+}
+
+// Stores the attribute record of a marker, keeping the attribute index in sync once it is built.
+- (void)setAttributes:(NSDictionary<NSString *, id> *)attributes forMarkerId:(NSString *)markerId {
+  NSDictionary<NSString *, id> *stored = attributes.count > 0 ? attributes : nil;
+  [_markerAttributeIndex updateOverlayId:markerId
+                          fromAttributes:_markerAttributes[markerId]
+                            toAttributes:stored];
+  _markerAttributes[markerId] = stored;
+}
+
+- (NSArray<NSString *> *)markerIdsWhere:(NavStyleExpression *)predicate {
+  if (_markerAttributeIndex == nil) {
+    _markerAttributeIndex = [[NavAttributeIndex alloc] init];
+    for (NSString *markerId in _markerAttributes) {
+      [_markerAttributeIndex updateOverlayId:markerId
+                              fromAttributes:nil
+                                toAttributes:_markerAttributes[markerId]];
+    }
+  }
+
+  // Candidates from the index are a superset of the matches; confirm each one.
+  id<NSFastEnumeration> candidates =
+      [_markerAttributeIndex candidatesForPredicate:predicate] ?: _markerMap.allKeys;
+  double zoom = _mapView.camera.zoom;
+  NSMutableArray<NSString *> *markerIds = [NSMutableArray array];
+  for (NSString *markerId in candidates) {
+    if (_markerMap[markerId] != nil &&
+        [predicate evaluateBoolWithAttributes:_markerAttributes[markerId] zoom:zoom]) {
+      [markerIds addObject:markerId];
+    }
+  }
+  return markerIds;
+}
+
+- (NSInteger)updateMarkersWhere:(NavStyleExpression *)predicate
+                          patch:(NSDictionary<NSString *, id> *)patch {
+  NSArray<NSString *> *markerIds = [self markerIdsWhere:predicate];
+  NSDictionary<NSString *, id> *attributePatch = patch[@"attributes"];
+  NSNumber *visible = patch[@"visible"];
+  NSMutableDictionary<NSString *, NSNumber *> *options = [NSMutableDictionary dictionary];
+  for (NSString *key in @[ @"alpha", @"zIndex", @"rotation" ]) {
+    options[key] = patch[key];
+  }
+
+  BOOL restyle = _markerStyle != nil && options.count > 0;
+  BOOL redeclutter = visible != nil || options[@"zIndex"] != nil;
+  for (NSString *key in attributePatch) {
+    restyle = restyle || [_markerStyle dependsOnAttribute:key];
+    redeclutter = redeclutter || [_markerDeclutter.priority.attributeKeys containsObject:key];
+  }
+  redeclutter = redeclutter || restyle;
+
+  for (NSString *markerId in markerIds) {
+    GMSMarker *marker = _markerMap[markerId];
+    if (attributePatch.count > 0) {
+      NSMutableDictionary<NSString *, id> *attributes =
+          [_markerAttributes[markerId] mutableCopy] ?: [NSMutableDictionary dictionary];
+      [attributePatch enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+        if ([value isKindOfClass:[NSNull class]]) {
+          [attributes removeObjectForKey:key];
+        } else {
+          attributes[key] = value;
+        }
+      }];
+      [self setAttributes:attributes forMarkerId:markerId];
+    }
+
+    if (options.count > 0) {
+      // Styled markers restore their option values from the base style.
+      NSDictionary<NSString *, id> *base = _markerBaseStyles[markerId];
+      if (base != nil) {
+        NSMutableDictionary<NSString *, id> *updated = [base mutableCopy];
+        [updated addEntriesFromDictionary:options];
+        _markerBaseStyles[markerId] = updated;
+      }
+      if (options[@"alpha"] != nil) {
+        marker.opacity = options[@"alpha"].floatValue;
+      }
+      if (options[@"zIndex"] != nil) {
+        marker.zIndex = options[@"zIndex"].intValue;
+      }
+      if (options[@"rotation"] != nil) {
+        marker.rotation = options[@"rotation"].doubleValue;
+      }
+    }
+
+    if (visible != nil) {
+      if (visible.boolValue) {
+        [_markersHiddenByOptions removeObject:markerId];
+      } else {
+        [_markersHiddenByOptions addObject:markerId];
+      }
+    }
+
+    if (restyle) {
+      [self applyMarkerStyleToMarker:marker markerId:markerId];
+    } else if (visible != nil) {
+      [self updateVisibilityOfMarker:marker markerId:markerId];
+    }
+  }
+
+  if (redeclutter && markerIds.count > 0) {
+    [self setNeedsDeclutter];
+  }
+  return (NSInteger)markerIds.count;
+}
+
+- (void)setMarkerDeclutter:(NavMarkerDeclutter *)declutter {
+  _markerDeclutter = declutter;
+  if (declutter == nil) {
+    [self setCameraObserver:nil forKey:kMarkerDeclutterObserverKey];
+    NSSet<NSString *> *hidden = _markersHiddenByDeclutter;
+    _markersHiddenByDeclutter = nil;
+    for (NSString *markerId in hidden) {
+      GMSMarker *marker = _markerMap[markerId];
+      if (marker != nil) {
+        [self updateVisibilityOfMarker:marker markerId:markerId];
+      }
+    }
+    return;
+  }
+
+  __weak NavViewController *weakSelf = self;
+  NavCameraObserver observer = ^(GMSMapView *mapView, BOOL idle) {
+    [weakSelf declutterMarkersForCameraChange:idle];
+  };
+  [self setCameraObserver:observer forKey:kMarkerDeclutterObserverKey];
+  [self declutterMarkers];
+}
+
+- (void)declutterMarkersForCameraChange:(BOOL)idle {
+  NavMarkerDeclutter *declutter = _markerDeclutter;
+  if (declutter == nil) {
+    return;
+  }
+  // The governor's animation frame rate may further lower the rate of passes while moving.
+  NSTimeInterval interval = MAX(declutter.animationInterval, [self qualityAnimationInterval]);
+  if (!idle && (declutter.animationInterval <= 0 ||
+                CACurrentMediaTime() - _lastDeclutterTime < interval)) {
+    return;
+  }
+  [self declutterMarkers];
+}
+
+// Coalesces the passes requested by marker changes within one run loop turn.
+- (void)setNeedsDeclutter {
+  if (_markerDeclutter == nil || _declutterScheduled) {
+    return;
+  }
+  _declutterScheduled = YES;
+  __weak NavViewController *weakSelf = self;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    NavViewController *strongSelf = weakSelf;
+    if (strongSelf != nil) {
+      strongSelf->_declutterScheduled = NO;
+      [strongSelf declutterMarkers];
+    }
+  });
+}
+
+- (void)declutterMarkers {
+  NavMarkerDeclutter *declutter = _markerDeclutter;
+  if (declutter == nil || _mapView == nil) {
+    return;
+  }
+  _lastDeclutterTime = CACurrentMediaTime();
+
+  // Only markers that would otherwise be shown on screen compete for space.
+  GMSProjection *projection = _mapView.projection;
+  CGRect bounds = _mapView.bounds;
+  double zoom = _mapView.camera.zoom;
+  // Markers closer than the governor's cluster radius collide, so fewer are shown when degraded.
+  CGFloat clusterSpacing = (CGFloat)(std::max(0.0, _qualityGovernor.settings.clusterRadius) / 2);
+  NSMutableArray<NSString *> *markerIds = [NSMutableArray array];
+  std::vector<CGRect> boxes;
+  std::vector<double> priorities;
+  for (NSString *markerId in _markerMap) {
+    if ([_markersHiddenByOptions containsObject:markerId] ||
+        [_markersHiddenByStyle containsObject:markerId]) {
+      continue;
+    }
+    GMSMarker *marker = _markerMap[markerId];
+    CGRect box = CGRectInset([declutter boxAtPoint:[projection pointForCoordinate:marker.position]],
+                             -clusterSpacing, -clusterSpacing);
+    if (!CGRectIntersectsRect(box, bounds)) {
+      continue;
+    }
+    id priority = [declutter.priority evaluateWithAttributes:_markerAttributes[markerId]
+                                                        zoom:zoom];
+    [markerIds addObject:markerId];
+    boxes.push_back(box);
+    priorities.push_back([priority isKindOfClass:[NSNumber class]] ? [priority doubleValue]
+                                                                   : marker.zIndex);
+  }
+
+  // Ties are broken by id so equal-priority markers do not flicker between passes.
+  NSUInteger count = markerIds.count;
+  std::vector<NSUInteger> order(count);
+  for (NSUInteger i = 0; i < count; i++) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](NSUInteger a, NSUInteger b) {
+    if (priorities[a] != priorities[b]) {
+      return priorities[a] > priorities[b];
+    }
+    return [markerIds[a] compare:markerIds[b]] == NSOrderedAscending;
+  });
+  std::unique_ptr<BOOL[]> placed(new BOOL[count]);
+  [declutter resolveBoxes:boxes.data() order:order.data() count:count placed:placed.get()];
+
+  NSMutableSet<NSString *> *hidden = [NSMutableSet set];
+  for (NSUInteger i = 0; i < count; i++) {
+    if (!placed[i]) {
+      [hidden addObject:markerIds[i]];
+    }
+  }
+
+  // Toggle only the markers whose declutter state changed.
+  NSMutableSet<NSString *> *changed = [hidden mutableCopy];
+  [changed minusSet:_markersHiddenByDeclutter ?: [NSSet set]];
+  NSMutableSet<NSString *> *shown = [_markersHiddenByDeclutter mutableCopy];
+  [shown minusSet:hidden];
+  [changed unionSet:shown ?: [NSSet set]];
+  _markersHiddenByDeclutter = hidden;
+  for (NSString *markerId in changed) {
+    GMSMarker *marker = _markerMap[markerId];
+    if (marker != nil) {
+      [self updateVisibilityOfMarker:marker markerId:markerId];
+    }
+  }
+}
+
+- (void)applyMarkerStyleToMarker:(GMSMarker *)marker markerId:(NSString *)markerId {
+  NavMarkerStyle *style = _markerStyle;
+  NSDictionary<NSString *, id> *attributes = _markerAttributes[markerId];
+  double zoom = _markerStyleZoom;
+
+  NSDictionary<NSString *, id> *base = _markerBaseStyles[markerId];
+  if (base == nil) {
+    base = @{
+      @"alpha" : @(marker.opacity),
+      @"zIndex" : @(marker.zIndex),
+      @"rotation" : @(marker.rotation),
+      @"icon" : marker.icon ?: [NSNull null],
+    };
+    _markerBaseStyles[markerId] = base;
+  }
+
+  if (style.alpha != nil) {
+    id value = [style.alpha evaluateWithAttributes:attributes zoom:zoom];
+    float alpha = [value isKindOfClass:[NSNumber class]] ? [value floatValue]
+                                                         : [base[@"alpha"] floatValue];
+    if (marker.opacity != alpha) {
+      marker.opacity = alpha;
+    }
+  }
+  if (style.zIndex != nil) {
+    id value = [style.zIndex evaluateWithAttributes:attributes zoom:zoom];
+    int zIndex =
+        [value isKindOfClass:[NSNumber class]] ? [value intValue] : [base[@"zIndex"] intValue];
+    if (marker.zIndex != zIndex) {
+      marker.zIndex = zIndex;
+    }
+  }
+  if (style.rotation != nil) {
+    id value = [style.rotation evaluateWithAttributes:attributes zoom:zoom];
+    double rotation = [value isKindOfClass:[NSNumber class]] ? [value doubleValue]
+                                                             : [base[@"rotation"] doubleValue];
+    if (marker.rotation != rotation) {
+      marker.rotation = rotation;
+    }
+  }
+  // Custom images are never tinted.
+  if (style.color != nil && [base[@"icon"] isKindOfClass:[NSNull class]]) {
+    id color = [style.color evaluateWithAttributes:attributes zoom:zoom];
+    NSNumber *colorInt = [NavMarkerStyle colorIntFromValue:color];
+    UIImage *icon = colorInt != nil ? [self markerIconForColorInt:colorInt] : nil;
+    if (marker.icon != icon) {
+      marker.icon = icon;
+    }
+  }
+
+  if (style.filter != nil && ![style.filter evaluateBoolWithAttributes:attributes zoom:zoom]) {
+    [_markersHiddenByStyle addObject:markerId];
+  } else {
+    [_markersHiddenByStyle removeObject:markerId];
+  }
+  [self updateVisibilityOfMarker:marker markerId:markerId];
+}
+
+- (UIImage *)markerIconForColorInt:(NSNumber *)colorInt {
+  if (_markerColorIcons == nil) {
+    _markerColorIcons = [NSMutableDictionary dictionary];
+  }
+  UIImage *icon = _markerColorIcons[colorInt];
+  if (icon == nil) {
+    icon = [GMSMarker markerImageWithColor:[UIColor colorWithColorInt:colorInt]];
+    _markerColorIcons[colorInt] = icon;
+  }
+  return icon;
+}
+
+- (void)restoreMarker:(GMSMarker *)marker fromBaseStyle:(NSDictionary<NSString *, id> *)base {
+  marker.opacity = [base[@"alpha"] floatValue];
+  marker.zIndex = [base[@"zIndex"] intValue];
+  marker.rotation = [base[@"rotation"] doubleValue];
+  id icon = base[@"icon"];
+  marker.icon = [icon isKindOfClass:[UIImage class]] ? icon : nil;
+}
+
+- (void)clearMarkerStyleState {
+  [_markerAttributes removeAllObjects];
+  [_markerAttributeIndex removeAllOverlays];
+  [_markersHiddenByOptions removeAllObjects];
+  [_markersHiddenByStyle removeAllObjects];
+  [_markersHiddenByDeclutter removeAllObjects];
+  [_markerBaseStyles removeAllObjects];
+}
+
 - (void)addPolygon:(GMSPolygon *)polygon
            visible:(BOOL)visible
             result:(OnDictionaryResult)completionBlock {
@@ -790,6 +1652,7 @@
                                clickable:polygon.tappable
                                   zIndex:@(polygon.zIndex)];
     existingPolygon.map = visible ? _mapView : nil;
+    [self watchedOverlayDidChange:effectiveId];
     completionBlock([ObjectTranslationUtil transformPolygonToDictionary:existingPolygon]);
     return;
   }
@@ -805,6 +1668,7 @@
   }
 
   _polygonMap[effectiveId] = polygon;
+  [self watchedOverlayDidChange:effectiveId];
   completionBlock([ObjectTranslationUtil transformPolygonToDictionary:polygon]);
 }
 
@@ -816,18 +1680,24 @@
   // If ID provided and object exists, update it instead of creating new
   if (effectiveId && _polylineMap[effectiveId]) {
     GMSPolyline *existingPolyline = _polylineMap[effectiveId];
+    if (polyline.path) {
+      _polylineSourcePaths[effectiveId] = polyline.path;
+    }
     [ObjectTranslationUtil updatePolyline:existingPolyline
-                                     path:polyline.path
+                                     path:SimplifiedPath(polyline.path, _appliedPolylineTolerance)
                                     width:polyline.strokeWidth
                                     color:polyline.strokeColor
                                 clickable:polyline.tappable
                                    zIndex:@(polyline.zIndex)];
     existingPolyline.map = visible ? _mapView : nil;
+    [self watchedOverlayDidChange:effectiveId];
     completionBlock([ObjectTranslationUtil transformPolylineToDictionary:existingPolyline]);
     return;
   }
 
   // Create new polyline
+  GMSPath *sourcePath = polyline.path;
+  polyline.path = SimplifiedPath(sourcePath, _appliedPolylineTolerance);
   polyline.map = visible ? _mapView : nil;
   polyline.tappable = YES;
 
@@ -838,6 +1708,10 @@
   }
 
   _polylineMap[effectiveId] = polyline;
+  if (sourcePath) {
+    _polylineSourcePaths[effectiveId] = sourcePath;
+  }
+  [self watchedOverlayDidChange:effectiveId];
   completionBlock([ObjectTranslationUtil transformPolylineToDictionary:polyline]);
 }
 
@@ -874,6 +1748,7 @@
       groundOverlay.map = visible ? _mapView : nil;
       groundOverlay.tappable = YES;
       _groundOverlayMap[effectiveId] = groundOverlay;
+      [self watchedOverlayDidChange:effectiveId];
       completionBlock([ObjectTranslationUtil transformGroundOverlayToDictionary:groundOverlay]);
     } else {
       // Update mutable properties only
@@ -899,6 +1774,7 @@
   }
 
   _groundOverlayMap[effectiveId] = groundOverlay;
+  [self watchedOverlayDidChange:effectiveId];
   completionBlock([ObjectTranslationUtil transformGroundOverlayToDictionary:groundOverlay]);
 }
 
@@ -907,6 +1783,14 @@
   if (marker) {
     marker.map = nil;
     [_markerMap removeObjectForKey:markerId];
+    [self setAttributes:nil forMarkerId:markerId];
+    [_markersHiddenByOptions removeObject:markerId];
+    [_markersHiddenByStyle removeObject:markerId];
+    [_markersHiddenByDeclutter removeObject:markerId];
+    [_markerBaseStyles removeObjectForKey:markerId];
+    [self setNeedsDeclutter];
+    [self watchedOverlayDidChange:markerId];
+    [_routePrefetcher forgetFeatureId:markerId];
   }
 }
 
@@ -915,6 +1799,8 @@
   if (polyline) {
     polyline.map = nil;
     [_polylineMap removeObjectForKey:polylineId];
+    [_polylineSourcePaths removeObjectForKey:polylineId];
+    [self watchedOverlayDidChange:polylineId];
   }
 }
 
@@ -923,6 +1809,7 @@
   if (polygon) {
     polygon.map = nil;
     [_polygonMap removeObjectForKey:polygonId];
+    [self watchedOverlayDidChange:polygonId];
   }
 }
 
@@ -931,6 +1818,7 @@
   if (circle) {
     circle.map = nil;
     [_circleMap removeObjectForKey:circleId];
+    [self watchedOverlayDidChange:circleId];
   }
 }
 
@@ -939,6 +1827,7 @@
   if (overlay) {
     overlay.map = nil;
     [_groundOverlayMap removeObjectForKey:overlayId];
+    [self watchedOverlayDidChange:overlayId];
   }
 }
 
@@ -960,6 +1849,229 @@
   }
 }
 
+- (void)setViewportWatchIds:(NSArray<NSString *> *)overlayIds
+                    handler:(NavViewportWatchHandler)handler {
+  if (overlayIds.count == 0 || handler == nil) {
+    _viewportWatch = nil;
+    _viewportWatchHandler = nil;
+    [self setCameraObserver:nil forKey:kViewportWatchObserverKey];
+    return;
+  }
+  _viewportWatch = [[NavViewportWatch alloc] initWithOverlayIds:overlayIds];
+  _viewportWatchHandler = [handler copy];
+  __weak NavViewController *weakSelf = self;
+  NavCameraObserver observer = ^(GMSMapView *mapView, BOOL idle) {
+    if (idle) {
+      [weakSelf updateViewportWatch];
+    }
+  };
+  [self setCameraObserver:observer forKey:kViewportWatchObserverKey];
+  // Report the overlays that are visible right away; the camera may not move for a while.
+  [self updateViewportWatch];
+}
+
+- (void)watchedOverlayDidChange:(NSString *)overlayId {
+  if ([_viewportWatch.overlayIds containsObject:overlayId]) {
+    [self setNeedsViewportWatchUpdate];
+  }
+}
+
+// Re-indexes the watched overlays and re-evaluates membership once the current batch of overlay
+// changes is done.
+- (void)setNeedsViewportWatchUpdate {
+  if (_viewportWatch == nil) {
+    return;
+  }
+  _viewportWatch.needsIndex = YES;
+  if (_viewportWatchScheduled) {
+    return;
+  }
+  _viewportWatchScheduled = YES;
+  __weak NavViewController *weakSelf = self;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    NavViewController *strongSelf = weakSelf;
+    if (strongSelf == nil) {
+      return;
+    }
+    strongSelf->_viewportWatchScheduled = NO;
+    [strongSelf updateViewportWatch];
+  });
+}
+
+- (void)updateViewportWatch {
+  NavViewportWatch *watch = _viewportWatch;
+  if (watch == nil || _mapView == nil) {
+    return;
+  }
+  if (watch.needsIndex) {
+    NSArray<NSDictionary<NSString *, GMSOverlay *> *> *overlayMaps =
+        @[ _markerMap, _polylineMap, _polygonMap, _circleMap, _groundOverlayMap ];
+    [watch beginIndex];
+    for (NSString *overlayId in watch.overlayIds) {
+      NavCoordinateExtent extent;
+      for (NSDictionary<NSString *, GMSOverlay *> *overlays in overlayMaps) {
+        GMSOverlay *overlay = overlays[overlayId];
+        if (overlay != nil) {
+          [self includeOverlay:overlay inExtent:&extent];
+        }
+      }
+      if (!extent.IsEmpty()) {
+        [watch indexOverlayId:overlayId
+                        south:extent.minLat
+                         west:extent.minLng
+                        north:extent.maxLat
+                         east:extent.maxLng];
+      }
+    }
+    [watch endIndex];
+  }
+
+  NSArray<NSString *> *entered = nil;
+  NSArray<NSString *> *left = nil;
+  if ([watch updateWithVisibleRegion:_mapView.projection.visibleRegion
+                             entered:&entered
+                                left:&left]) {
+    _viewportWatchHandler(entered, left);
+  }
+}
+
+- (BOOL)fitCameraToOverlaysWithIds:(NSArray<NSString *> *)ids
+                             group:(NSString *)group
+                           padding:(UIEdgeInsets)padding
+                           maxZoom:(NSNumber *)maxZoom
+                           bearing:(NSNumber *)bearing {
+  if (_mapView == nil) {
+    return NO;
+  }
+
+  NavCoordinateExtent extent;
+  NSArray<NSDictionary<NSString *, GMSOverlay *> *> *overlayMaps =
+      @[ _markerMap, _polylineMap, _polygonMap, _circleMap, _groundOverlayMap ];
+  if (ids != nil) {
+    for (NSString *overlayId in ids) {
+      for (NSDictionary<NSString *, GMSOverlay *> *overlays in overlayMaps) {
+        GMSOverlay *overlay = overlays[overlayId];
+        if (overlay != nil) {
+          [self includeOverlay:overlay inExtent:&extent];
+        }
+      }
+    }
+  } else if (group != nil) {
+    for (NSString *markerId in _markerMap) {
+      if ([_markerAttributes[markerId][@"group"] isEqual:group]) {
+        CLLocationCoordinate2D position = _markerMap[markerId].position;
+        extent.Include(position.latitude, position.longitude);
+      }
+    }
+  } else {
+    for (NSDictionary<NSString *, GMSOverlay *> *overlays in overlayMaps) {
+      for (NSString *overlayId in overlays) {
+        [self includeOverlay:overlays[overlayId] inExtent:&extent];
+      }
+    }
+  }
+  if (extent.IsEmpty()) {
+    return NO;
+  }
+
+  // Fit the extent, rotated by the bearing, in the padded part of the view.
+  double x0 = MercatorX(extent.minLng);
+  double x1 = MercatorX(extent.maxLng);
+  double y0 = MercatorY(extent.maxLat);
+  double y1 = MercatorY(extent.minLat);
+  double angle = (bearing != nil ? bearing.doubleValue : 0) * M_PI / 180.0;
+  double cosAngle = std::cos(angle);
+  double sinAngle = std::sin(angle);
+  double width = (x1 - x0) * std::abs(cosAngle) + (y1 - y0) * std::abs(sinAngle);
+  double height = (x1 - x0) * std::abs(sinAngle) + (y1 - y0) * std::abs(cosAngle);
+
+  CGSize size = _mapView.bounds.size;
+  double availableWidth = std::max(1.0, size.width - padding.left - padding.right);
+  double availableHeight = std::max(1.0, size.height - padding.top - padding.bottom);
+  double zoom = maxZoom != nil ? std::min(maxZoom.doubleValue, (double)_mapView.maxZoom)
+                               : _mapView.maxZoom;
+  if (width > 0) {
+    zoom = std::min(zoom, std::log2(availableWidth / (width * 256)));
+  }
+  if (height > 0) {
+    zoom = std::min(zoom, std::log2(availableHeight / (height * 256)));
+  }
+  zoom = std::max(zoom, (double)_mapView.minZoom);
+
+  // The camera target is the view center, offset from the center of the padded area.
+  double scale = 256 * std::exp2(zoom);
+  double offsetX = (padding.right - padding.left) / 2 / scale;
+  double offsetY = (padding.bottom - padding.top) / 2 / scale;
+  double targetX = (x0 + x1) / 2 + offsetX * cosAngle - offsetY * sinAngle;
+  double targetY = (y0 + y1) / 2 + offsetX * sinAngle + offsetY * cosAngle;
+
+  GMSCameraPosition *camera = [GMSCameraPosition
+      cameraWithTarget:CLLocationCoordinate2DMake(LatitudeFromMercatorY(targetY),
+                                                  targetX * 360.0 - 180.0)
+                  zoom:zoom
+               bearing:bearing != nil ? bearing.doubleValue : 0
+          viewingAngle:0];
+  [_mapView animateToCameraPosition:camera];
+  return YES;
+}
+
+- (void)includeOverlay:(GMSOverlay *)overlay inExtent:(NavCoordinateExtent *)extent {
+  if ([overlay isKindOfClass:[GMSMarker class]]) {
+    CLLocationCoordinate2D position = ((GMSMarker *)overlay).position;
+    extent->Include(position.latitude, position.longitude);
+  } else if ([overlay isKindOfClass:[GMSPolyline class]]) {
+    extent->Include([self extentOfPath:((GMSPolyline *)overlay).path]);
+  } else if ([overlay isKindOfClass:[GMSPolygon class]]) {
+    // Holes lie inside the outer path.
+    extent->Include([self extentOfPath:((GMSPolygon *)overlay).path]);
+  } else if ([overlay isKindOfClass:[GMSCircle class]]) {
+    GMSCircle *circle = (GMSCircle *)overlay;
+    double latDelta = circle.radius / 6371009.0 * 180.0 / M_PI;
+    double lngDelta = latDelta / std::max(0.01, std::cos(circle.position.latitude * M_PI / 180.0));
+    extent->Include(circle.position.latitude - latDelta, circle.position.longitude - lngDelta);
+    extent->Include(circle.position.latitude + latDelta, circle.position.longitude + lngDelta);
+  } else if ([overlay isKindOfClass:[GMSGroundOverlay class]]) {
+    GMSCoordinateBounds *bounds = ((GMSGroundOverlay *)overlay).bounds;
+    if (bounds != nil && bounds.isValid) {
+      extent->Include(bounds.southWest.latitude, bounds.southWest.longitude);
+      extent->Include(bounds.northEast.latitude, bounds.northEast.longitude);
+    } else {
+      CLLocationCoordinate2D position = ((GMSGroundOverlay *)overlay).position;
+      extent->Include(position.latitude, position.longitude);
+    }
+  }
+}
+
+- (NavCoordinateExtent)extentOfPath:(GMSPath *)path {
+  NavCoordinateExtent extent;
+  if (path == nil) {
+    return extent;
+  }
+  if (_pathExtents == nil) {
+    _pathExtents = [NSMapTable weakToStrongObjectsMapTable];
+  }
+  NSData *cached = [_pathExtents objectForKey:path];
+  if (cached != nil) {
+    [cached getBytes:&extent length:sizeof(extent)];
+    return extent;
+  }
+
+  // Separate min/max accumulators keep the loop free of branches, so it vectorizes.
+  NSUInteger count = path.count;
+  std::vector<CLLocationCoordinate2D> coordinates(count);
+  for (NSUInteger i = 0; i < count; i++) {
+    coordinates[i] = [path coordinateAtIndex:i];
+  }
+  for (const CLLocationCoordinate2D &coordinate : coordinates) {
+    extent.minLat = std::min(extent.minLat, coordinate.latitude);
+    extent.maxLat = std::max(extent.maxLat, coordinate.latitude);
+    extent.minLng = std::min(extent.minLng, coordinate.longitude);
+    extent.maxLng = std::max(extent.maxLng, coordinate.longitude);
+  }
+  [_pathExtents setObject:[NSData dataWithBytes:&extent length:sizeof(extent)] forKey:path];
+  return extent;
+}
+
 - (NSArray<NSDictionary *> *)getMarkers {
   NSMutableArray<NSDictionary *> *result = [[NSMutableArray alloc] init];
   for (NSString *key in _markerMap) {
@@ -992,6 +2104,10 @@
   return result;
 }
 
+- (nullable GMSPolygon *)polygonWithId:(NSString *)polygonId {
+  return _polygonMap[polygonId];
+}
+
 - (NSArray<NSDictionary *> *)getGroundOverlays {
   NSMutableArray<NSDictionary *> *result = [[NSMutableArray alloc] init];
   for (NSString *key in _groundOverlayMap) {
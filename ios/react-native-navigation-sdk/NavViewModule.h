@@ -26,6 +26,8 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)navigationSessionDestroyed;
 - (void)informPromptVisibilityChange:(BOOL)visible;
 - (void)setTravelMode:(GMSNavigationTravelMode)travelMode;
+- (void)informRouteChanged:(nullable NSArray<GMSRouteLeg *> *)routeLegs;
+- (void)informRoadSnappedLocation:(CLLocation *)location;
 
 // Class method to access the singleton instance
 + (instancetype)sharedInstance;
@@ -15,9 +15,17 @@
  */
 
 #import "NavViewModule.h"
+#import <QuartzCore/QuartzCore.h>
+#import "NavRouteThumbnailRenderer.h"
 #import "NavView.h"
 #import "ObjectTranslationUtil.h"
 
+#include <memory>
+#include <vector>
+
+#include "NavPolygonClipper.h"
+#include "NavZoneIndex.h"
+
 using namespace JS::NativeNavViewModule;
 
 // Static registry for viewControllers (string-based nativeID)
@@ -30,6 +38,119 @@ static NSMutableDictionary<NSString *, NavViewController *> *NavViewControllersR
   return dict;
 }
 
+// Unpacks polygons packed as [lat0, lng0, ...] with the vertex count of each ring and the ring
+// count of each polygon, outer ring first. Returns NO if the counts do not match the coordinates.
+static BOOL UnpackPolygons(PackedPolygonsSpec &packed, std::vector<navsdk::GeoPolygon> *polygons) {
+  std::vector<double> latLngs;
+  for (double value : packed.latLngs()) {
+    latLngs.push_back(value);
+  }
+  std::vector<double> ringSizes;
+  for (double value : packed.ringSizes()) {
+    ringSizes.push_back(value);
+  }
+  size_t ring = 0;
+  size_t vertex = 0;
+  for (double ringCount : packed.ringCounts()) {
+    navsdk::GeoPolygon polygon;
+    for (size_t i = 0; i < static_cast<size_t>(ringCount); i++, ring++) {
+      if (ring >= ringSizes.size()) {
+        return NO;
+      }
+      size_t size = static_cast<size_t>(ringSizes[ring]);
+      if ((vertex + size) * 2 > latLngs.size()) {
+        return NO;
+      }
+      std::vector<navsdk::GeoPoint> points;
+      points.reserve(size);
+      for (size_t k = vertex; k < vertex + size; k++) {
+        points.push_back({latLngs[2 * k], latLngs[2 * k + 1]});
+      }
+      vertex += size;
+      if (i == 0) {
+        polygon.outer = std::move(points);
+      } else {
+        polygon.holes.push_back(std::move(points));
+      }
+    }
+    polygons->push_back(std::move(polygon));
+  }
+  return YES;
+}
+
+static NSDictionary *PackPolygons(const std::vector<navsdk::GeoPolygon> &polygons) {
+  NSMutableArray<NSNumber *> *latLngs = [NSMutableArray array];
+  NSMutableArray<NSNumber *> *ringSizes = [NSMutableArray array];
+  NSMutableArray<NSNumber *> *ringCounts = [NSMutableArray array];
+  auto addRing = [&](const std::vector<navsdk::GeoPoint> &ring) {
+    for (const navsdk::GeoPoint &point : ring) {
+      [latLngs addObject:@(point.lat)];
+      [latLngs addObject:@(point.lng)];
+    }
+    [ringSizes addObject:@(ring.size())];
+  };
+  for (const navsdk::GeoPolygon &polygon : polygons) {
+    addRing(polygon.outer);
+    for (const std::vector<navsdk::GeoPoint> &hole : polygon.holes) {
+      addRing(hole);
+    }
+    [ringCounts addObject:@(polygon.holes.size() + 1)];
+  }
+  return @{@"latLngs" : latLngs, @"ringSizes" : ringSizes, @"ringCounts" : ringCounts};
+}
+
+static GMSPath *PathFromRing(const std::vector<navsdk::GeoPoint> &ring) {
+  GMSMutablePath *path = [GMSMutablePath path];
+  for (const navsdk::GeoPoint &point : ring) {
+    [path addCoordinate:CLLocationCoordinate2DMake(point.lat, point.lng)];
+  }
+  return path;
+}
+
+static std::vector<navsdk::GeoPoint> RingFromPath(GMSPath *path) {
+  std::vector<navsdk::GeoPoint> ring;
+  ring.reserve(path.count);
+  for (NSUInteger i = 0; i < path.count; i++) {
+    CLLocationCoordinate2D coordinate = [path coordinateAtIndex:i];
+    ring.push_back({coordinate.latitude, coordinate.longitude});
+  }
+  return ring;
+}
+
+// Points classified per pool task: large enough to amortize the task overhead, small enough to
+// spread a batch of a few thousand stops over all workers.
+static const size_t kClassifyChunkSize = 1024;
+
+// Classifies the points, packed as [lat0, lng0, ...], on the worker pool and resolves with the
+// index of the first zone containing each point, or -1.
+static void ClassifyPoints(std::shared_ptr<const std::vector<double>> latLngs,
+                           std::shared_ptr<const std::vector<navsdk::GeoPolygon>> zones,
+                           RCTPromiseResolveBlock resolve) {
+  NavWorkerPool *pool = [NavWorkerPool sharedPool];
+  [pool submitWithPriority:NavTaskPriorityInteractive
+                     token:nil
+                     block:^{
+                       auto index = std::make_shared<const navsdk::ZoneIndex>(*zones);
+                       size_t count = latLngs->size() / 2;
+                       auto result = std::make_shared<std::vector<int32_t>>(count);
+                       [pool applyWithPriority:NavTaskPriorityInteractive
+                           count:(count + kClassifyChunkSize - 1) / kClassifyChunkSize
+                           block:^(NSUInteger chunk) {
+                             size_t begin = chunk * kClassifyChunkSize;
+                             size_t end = std::min(count, begin + kClassifyChunkSize);
+                             index->ClassifyRange(latLngs->data(), begin, end, result->data());
+                           }
+                           completion:^{
+                             NSMutableArray<NSNumber *> *zoneIndices =
+                                 [NSMutableArray arrayWithCapacity:count];
+                             for (int32_t zone : *result) {
+                               [zoneIndices addObject:@(zone)];
+                             }
+                             resolve(zoneIndices);
+                           }];
+                     }];
+}
+
 @implementation NavViewModule
 
 RCT_EXPORT_MODULE();
@@ -64,6 +185,21 @@ static NavViewModule *sharedInstance = nil;
   return viewController;
 }
 
+// Looks up the view controller for a module command and records the command in its render
+// metrics, if enabled, so that hitches can be attributed to recent commands. Render metrics are
+// replaced on the main thread, so they are read there too, ahead of the command's own main-thread
+// work.
+- (NavViewController *)getViewControllerForNativeID:(NSString *)nativeID command:(SEL)command {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  if (viewController) {
+    NSString *name = [NSStringFromSelector(command) componentsSeparatedByString:@":"].firstObject;
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [viewController.renderMetrics recordCommand:name];
+    });
+  }
+  return viewController;
+}
+
 - (void)notifyNavigationSessionReady {
   // Notify all views that navigation session is ready
   for (NavViewController *viewController in [NavViewModule viewControllersRegistry].allValues) {
@@ -89,13 +225,25 @@ static NavViewModule *sharedInstance = nil;
   }
 }
 
+- (void)informRouteChanged:(NSArray<GMSRouteLeg *> *)routeLegs {
+  for (NavViewController *viewController in [NavViewModule viewControllersRegistry].allValues) {
+    [viewController onRouteChanged:routeLegs];
+  }
+}
+
+- (void)informRoadSnappedLocation:(CLLocation *)location {
+  for (NavViewController *viewController in [NavViewModule viewControllersRegistry].allValues) {
+    [viewController onRoadSnappedLocation:location];
+  }
+}
+
 // TurboModule method implementations
 
 - (void)addCircle:(NSString *)nativeID
           options:(CircleOptionsSpec &)options
           resolve:(RCTPromiseResolveBlock)resolve
            reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   CircleOptionsSpec optionsCopy(options);
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -139,7 +287,7 @@ static NavViewModule *sharedInstance = nil;
           options:(MarkerOptionsSpec &)options
           resolve:(RCTPromiseResolveBlock)resolve
            reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   MarkerOptionsSpec optionsCopy(options);
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -167,8 +315,19 @@ static NavViewModule *sharedInstance = nil;
                 zIndex:optionsCopy.zIndex().has_value() ? @(optionsCopy.zIndex().value()) : nil
             identifier:optionsCopy.id_()];
 
+      NSDictionary *attributes = nil;
+      NSString *attributesJson = optionsCopy.attributes();
+      if ([attributesJson isKindOfClass:[NSString class]] && attributesJson.length > 0) {
+        attributes = [NavViewModule objectFromJSONString:attributesJson];
+        if (![attributes isKindOfClass:[NSDictionary class]]) {
+          reject(@"INVALID_ATTRIBUTES", @"Marker attributes must be a JSON object", nil);
+          return;
+        }
+      }
+
       [viewController addMarker:marker
                         visible:optionsCopy.visible().value_or(YES)
+                     attributes:attributes
                          result:^(NSDictionary *result) {
                            resolve(result);
                          }];
@@ -182,7 +341,7 @@ static NavViewModule *sharedInstance = nil;
             options:(PolylineOptionsSpec &)options
             resolve:(RCTPromiseResolveBlock)resolve
              reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   PolylineOptionsSpec optionsCopy(options);
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -221,7 +380,7 @@ static NavViewModule *sharedInstance = nil;
            options:(PolygonOptionsSpec &)options
            resolve:(RCTPromiseResolveBlock)resolve
             reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   PolygonOptionsSpec optionsCopy(options);
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -282,7 +441,7 @@ static NavViewModule *sharedInstance = nil;
                  options:(GroundOverlayOptionsSpec &)options
                  resolve:(RCTPromiseResolveBlock)resolve
                   reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   GroundOverlayOptionsSpec optionsCopy(options);
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -369,7 +528,7 @@ static NavViewModule *sharedInstance = nil;
     cameraPosition:(CameraPositionSpec &)cameraPosition
            resolve:(RCTPromiseResolveBlock)resolve
             reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   CameraPositionSpec positionCopy(cameraPosition);
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -400,10 +559,47 @@ static NavViewModule *sharedInstance = nil;
   }
 }
 
+- (void)fitCameraToOverlays:(NSString *)nativeID
+                    options:(FitCameraOptionsSpec &)options
+                    resolve:(RCTPromiseResolveBlock)resolve
+                     reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+
+  NSArray<NSString *> *ids = nil;
+  if (options.ids().has_value()) {
+    facebook::react::LazyVector<NSString *> idVector = options.ids().value();
+    NSMutableArray<NSString *> *idList = [NSMutableArray arrayWithCapacity:idVector.size()];
+    for (size_t i = 0; i < idVector.size(); i++) {
+      [idList addObject:idVector[i]];
+    }
+    ids = idList;
+  }
+  NSString *group = [options.group() copy];
+  UIEdgeInsets padding = UIEdgeInsetsZero;
+  if (options.padding().has_value()) {
+    auto insets = options.padding().value();
+    padding = UIEdgeInsetsMake(insets.top(), insets.left(), insets.bottom(), insets.right());
+  }
+  NSNumber *maxZoom = options.maxZoom().has_value() ? @(options.maxZoom().value()) : nil;
+  NSNumber *bearing = options.bearing().has_value() ? @(options.bearing().value()) : nil;
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    resolve(@([viewController fitCameraToOverlaysWithIds:ids
+                                                    group:group
+                                                  padding:padding
+                                                  maxZoom:maxZoom
+                                                  bearing:bearing]));
+  });
+}
+
 - (void)getCameraPosition:(NSString *)nativeID
                   resolve:(RCTPromiseResolveBlock)resolve
                    reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController getCameraPosition:^(NSDictionary *result) {
@@ -418,7 +614,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getMyLocation:(NSString *)nativeID
               resolve:(RCTPromiseResolveBlock)resolve
                reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController getMyLocation:^(NSDictionary *result) {
@@ -433,7 +629,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getUiSettings:(NSString *)nativeID
               resolve:(RCTPromiseResolveBlock)resolve
                reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController getUiSettings:^(NSDictionary *result) {
@@ -448,7 +644,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)isMyLocationEnabled:(NSString *)nativeID
                     resolve:(RCTPromiseResolveBlock)resolve
                      reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController isMyLocationEnabled:^(BOOL result) {
@@ -464,7 +660,7 @@ static NavViewModule *sharedInstance = nil;
                        enabled:(BOOL)enabled
                        resolve:(RCTPromiseResolveBlock)resolve
                         reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController setNavigationUIEnabled:enabled];
@@ -479,7 +675,7 @@ static NavViewModule *sharedInstance = nil;
                     perspective:(double)perspective
                         resolve:(RCTPromiseResolveBlock)resolve
                          reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController setFollowingPerspective:@((NSInteger)perspective)];
@@ -493,7 +689,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)showRouteOverview:(NSString *)nativeID
                   resolve:(RCTPromiseResolveBlock)resolve
                    reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController showRouteOverview];
@@ -507,7 +703,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)clearMapView:(NSString *)nativeID
              resolve:(RCTPromiseResolveBlock)resolve
               reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController clearMapView];
@@ -522,7 +718,7 @@ static NavViewModule *sharedInstance = nil;
                   id:(NSString *)id
              resolve:(RCTPromiseResolveBlock)resolve
               reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController removeMarker:id];
@@ -537,7 +733,7 @@ static NavViewModule *sharedInstance = nil;
                     id:(NSString *)id
                resolve:(RCTPromiseResolveBlock)resolve
                 reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController removePolyline:id];
@@ -552,7 +748,7 @@ static NavViewModule *sharedInstance = nil;
                    id:(NSString *)id
               resolve:(RCTPromiseResolveBlock)resolve
                reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController removePolygon:id];
@@ -567,7 +763,7 @@ static NavViewModule *sharedInstance = nil;
                   id:(NSString *)id
              resolve:(RCTPromiseResolveBlock)resolve
               reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController removeCircle:id];
@@ -582,7 +778,7 @@ static NavViewModule *sharedInstance = nil;
                          id:(NSString *)id
                     resolve:(RCTPromiseResolveBlock)resolve
                      reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController removeGroundOverlay:id];
@@ -597,7 +793,7 @@ static NavViewModule *sharedInstance = nil;
                level:(double)level
              resolve:(RCTPromiseResolveBlock)resolve
               reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       [viewController setZoomLevel:@(level)];
@@ -611,7 +807,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getMarkers:(NSString *)nativeID
            resolve:(RCTPromiseResolveBlock)resolve
             reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       resolve([viewController getMarkers]);
@@ -624,7 +820,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getCircles:(NSString *)nativeID
            resolve:(RCTPromiseResolveBlock)resolve
             reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       resolve([viewController getCircles]);
@@ -637,7 +833,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getPolylines:(NSString *)nativeID
              resolve:(RCTPromiseResolveBlock)resolve
               reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       resolve([viewController getPolylines]);
@@ -650,7 +846,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getPolygons:(NSString *)nativeID
             resolve:(RCTPromiseResolveBlock)resolve
              reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       resolve([viewController getPolygons]);
@@ -663,7 +859,7 @@ static NavViewModule *sharedInstance = nil;
 - (void)getGroundOverlays:(NSString *)nativeID
                   resolve:(RCTPromiseResolveBlock)resolve
                    reject:(RCTPromiseRejectBlock)reject {
-  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
   if (viewController) {
     dispatch_async(dispatch_get_main_queue(), ^{
       resolve([viewController getGroundOverlays]);
@@ -673,4 +869,834 @@ static NavViewModule *sharedInstance = nil;
   }
 }
 
+- (void)setQualityGovernorConfig:(NSString *)nativeID
+                          config:(QualityGovernorConfigSpec &)config
+                         resolve:(RCTPromiseResolveBlock)resolve
+                          reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  QualityGovernorConfigSpec configCopy(config);
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      if (!configCopy.enabled()) {
+        viewController.qualityGovernor = nil;
+        resolve(nil);
+        return;
+      }
+
+      // Bounds arrive as min/max; map them to best/cheapest per knob. Higher tolerance and
+      // cluster radius are cheaper, lower event rate, frame rate and margin are cheaper.
+      NavQualityGovernorConfig *governorConfig = [[NavQualityGovernorConfig alloc] init];
+      governorConfig.targetFrameRate = configCopy.targetFrameRate();
+      governorConfig.evaluationInterval = configCopy.evaluationIntervalMs() / 1000.0;
+      governorConfig.polylineTolerance = (NavQualityBounds){
+          configCopy.polylineTolerance().min(), configCopy.polylineTolerance().max()};
+      governorConfig.clusterRadius =
+          (NavQualityBounds){configCopy.clusterRadius().min(), configCopy.clusterRadius().max()};
+      governorConfig.eventRate =
+          (NavQualityBounds){configCopy.eventRate().max(), configCopy.eventRate().min()};
+      governorConfig.animationFrameRate = (NavQualityBounds){
+          configCopy.animationFrameRate().max(), configCopy.animationFrameRate().min()};
+      governorConfig.virtualizationMargin = (NavQualityBounds){
+          configCopy.virtualizationMargin().max(), configCopy.virtualizationMargin().min()};
+
+      __weak NavViewModule *weakSelf = self;
+      __weak NavViewController *weakViewController = viewController;
+      NavQualityGovernor *governor = [[NavQualityGovernor alloc]
+          initWithConfig:governorConfig
+                 sampler:viewController.frameSampler
+            onAdjustment:^(NSDictionary *adjustment) {
+              [weakViewController applyQualitySettings];
+              NSMutableDictionary *event = [adjustment mutableCopy];
+              event[@"nativeID"] = nativeID;
+              [weakSelf emitOnQualityAdjusted:event];
+            }];
+      viewController.qualityGovernor = governor;
+      [governor start];
+      resolve(nil);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)setRenderStatsConfig:(NSString *)nativeID
+                      config:(RenderStatsConfigSpec &)config
+                     resolve:(RCTPromiseResolveBlock)resolve
+                      reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  RenderStatsConfigSpec configCopy(config);
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      if (!configCopy.enabled()) {
+        viewController.renderMetrics = nil;
+        resolve(nil);
+        return;
+      }
+
+      __weak NavViewController *weakViewController = viewController;
+      NavRenderMetrics *metrics = [[NavRenderMetrics alloc]
+                 initWithSampler:viewController.frameSampler
+          overlayCountsProvider:^NSDictionary<NSString *, NSNumber *> * {
+            NSDictionary *counts = [weakViewController overlayCounts];
+            return counts ?: @{};
+          }];
+      if (configCopy.eventIntervalMs() > 0) {
+        __weak NavViewModule *weakSelf = self;
+        metrics.reportInterval = configCopy.eventIntervalMs() / 1000.0;
+        metrics.reportHandler = ^(NSDictionary *snapshot) {
+          NSMutableDictionary *event = [snapshot mutableCopy];
+          event[@"nativeID"] = nativeID;
+          [weakSelf emitOnRenderStats:event];
+        };
+      }
+      viewController.renderMetrics = metrics;
+      [metrics start];
+      resolve(nil);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)getRenderStats:(NSString *)nativeID
+                 reset:(BOOL)reset
+               resolve:(RCTPromiseResolveBlock)resolve
+                reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID];
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      NavRenderMetrics *metrics = viewController.renderMetrics;
+      if (!metrics) {
+        reject(@"RENDER_STATS_DISABLED", @"Render stats are not enabled for this view", nil);
+        return;
+      }
+      NSMutableDictionary *stats = [[metrics snapshotAndReset:reset] mutableCopy];
+      stats[@"nativeID"] = nativeID;
+      resolve(stats);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+// Map views are laid out by UIKit, so no frame callbacks lay them out as on Android.
+- (void)getLayoutFrameCallbackCount:(NSString *)nativeID
+                            resolve:(RCTPromiseResolveBlock)resolve
+                             reject:(RCTPromiseRejectBlock)reject {
+  if ([self getViewControllerForNativeID:nativeID]) {
+    resolve(@0);
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)projectToScreen:(NSString *)nativeID
+                latLngs:(NSArray *)latLngs
+                resolve:(RCTPromiseResolveBlock)resolve
+                 reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      resolve([viewController screenPointsForCoordinates:latLngs]);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)screenToCoordinates:(NSString *)nativeID
+                     points:(NSArray *)points
+                    resolve:(RCTPromiseResolveBlock)resolve
+                     reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      resolve([viewController coordinatesForScreenPoints:points]);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)setProjectionWatch:(NSString *)nativeID
+                   latLngs:(NSArray *)latLngs
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (viewController) {
+    NSArray *watchedLatLngs = [latLngs copy];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      if (watchedLatLngs.count < 2) {
+        [viewController setCameraObserver:nil forKey:@"projectionWatch"];
+        resolve(nil);
+        return;
+      }
+
+      __weak NavViewModule *weakSelf = self;
+      __weak NavViewController *weakViewController = viewController;
+      // Time of the last event and whether a camera move was skipped since, as the governor's
+      // event rate may throttle events while the camera moves.
+      __block CFTimeInterval lastEmitTime = 0;
+      __block BOOL skipped = NO;
+      void (^emitProjection)(void) = ^{
+        lastEmitTime = CACurrentMediaTime();
+        skipped = NO;
+        NSArray *points = [weakViewController screenPointsForCoordinates:watchedLatLngs];
+        [weakSelf emitOnProjectionUpdated:@{@"nativeID" : nativeID, @"points" : points}];
+      };
+      NavCameraObserver observer = ^(GMSMapView *mapView, BOOL idle) {
+        if (idle) {
+          // Deliver the final position if the last move was throttled.
+          if (skipped) {
+            emitProjection();
+          }
+        } else if (CACurrentMediaTime() - lastEmitTime >=
+                   [weakViewController qualityEventInterval]) {
+          emitProjection();
+        } else {
+          skipped = YES;
+        }
+      };
+      [viewController setCameraObserver:observer forKey:@"projectionWatch"];
+      // Deliver the current projection right away, the camera may not move for a while.
+      emitProjection();
+      resolve(nil);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)setViewportWatch:(NSString *)nativeID
+                     ids:(NSArray *)ids
+                 resolve:(RCTPromiseResolveBlock)resolve
+                  reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (viewController) {
+    NSArray<NSString *> *watchedIds = [ids copy];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      __weak NavViewModule *weakSelf = self;
+      [viewController
+          setViewportWatchIds:watchedIds
+                      handler:^(NSArray<NSString *> *entered, NSArray<NSString *> *left) {
+                        [weakSelf emitOnViewportMembershipChanged:@{
+                          @"nativeID" : nativeID,
+                          @"entered" : entered,
+                          @"left" : left
+                        }];
+                      }];
+      resolve(nil);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)setMarkerStyle:(NSString *)nativeID
+                 style:(NSString *)style
+               resolve:(RCTPromiseResolveBlock)resolve
+                reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+
+  // Compile off the main thread; only applying the style touches the map.
+  NavMarkerStyle *markerStyle = nil;
+  if (style.length > 0) {
+    NSDictionary *json = [NavViewModule objectFromJSONString:style];
+    if (![json isKindOfClass:[NSDictionary class]]) {
+      reject(@"INVALID_EXPRESSION", @"Marker style must be a JSON object", nil);
+      return;
+    }
+    NSError *error = nil;
+    markerStyle = [NavMarkerStyle styleWithJSON:json error:&error];
+    if (markerStyle == nil) {
+      reject(@"INVALID_EXPRESSION", error.localizedDescription, error);
+      return;
+    }
+  }
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [viewController setMarkerStyle:markerStyle];
+    resolve(nil);
+  });
+}
+
+- (void)setMarkerDeclutter:(NSString *)nativeID
+                   options:(NSString *)options
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+
+  NavMarkerDeclutter *declutter = nil;
+  if (options.length > 0) {
+    NSDictionary *json = [NavViewModule objectFromJSONString:options];
+    if (![json isKindOfClass:[NSDictionary class]]) {
+      reject(@"INVALID_EXPRESSION", @"Declutter options must be a JSON object", nil);
+      return;
+    }
+    NSError *error = nil;
+    declutter = [NavMarkerDeclutter declutterWithJSON:json error:&error];
+    if (declutter == nil) {
+      reject(@"INVALID_EXPRESSION", error.localizedDescription, error);
+      return;
+    }
+  }
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [viewController setMarkerDeclutter:declutter];
+    resolve(nil);
+  });
+}
+
+- (void)setMarkerAttribute:(NSString *)nativeID
+                       ids:(NSArray *)ids
+                       key:(NSString *)key
+                    values:(NSString *)values
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+
+  id json = [NavViewModule objectFromJSONString:values];
+  if (json == nil) {
+    reject(@"INVALID_ATTRIBUTES", @"Attribute values must be valid JSON", nil);
+    return;
+  }
+  NSArray<NSString *> *markerIds = [ids copy];
+  NSArray *alignedValues = json;
+  if (![json isKindOfClass:[NSArray class]]) {
+    // A single value applies to every marker.
+    NSMutableArray *repeated = [NSMutableArray arrayWithCapacity:markerIds.count];
+    for (NSUInteger i = 0; i < markerIds.count; i++) {
+      [repeated addObject:json];
+    }
+    alignedValues = repeated;
+  } else if (alignedValues.count != markerIds.count) {
+    reject(@"INVALID_ATTRIBUTES", @"Attribute values must align with the marker ids", nil);
+    return;
+  }
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    NSInteger found = [viewController setMarkerAttribute:key
+                                                  values:alignedValues
+                                            forMarkerIds:markerIds];
+    resolve(@(found));
+  });
+}
+
+- (void)selectMarkersWhere:(NSString *)nativeID
+                 predicate:(NSString *)predicate
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+  NSError *error = nil;
+  NavStyleExpression *expression = [NavViewModule predicateFromJSONString:predicate error:&error];
+  if (expression == nil) {
+    reject(@"INVALID_EXPRESSION", error.localizedDescription, error);
+    return;
+  }
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    resolve([viewController markerIdsWhere:expression]);
+  });
+}
+
+- (void)updateMarkersWhere:(NSString *)nativeID
+                 predicate:(NSString *)predicate
+                     patch:(NSString *)patch
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+  NSError *error = nil;
+  NavStyleExpression *expression = [NavViewModule predicateFromJSONString:predicate error:&error];
+  if (expression == nil) {
+    reject(@"INVALID_EXPRESSION", error.localizedDescription, error);
+    return;
+  }
+
+  NSDictionary *json = [NavViewModule objectFromJSONString:patch];
+  if (![json isKindOfClass:[NSDictionary class]]) {
+    reject(@"INVALID_ATTRIBUTES", @"Marker patch must be a JSON object", nil);
+    return;
+  }
+  NSMutableDictionary<NSString *, id> *markerPatch = [NSMutableDictionary dictionary];
+  for (NSString *key in @[ @"visible", @"alpha", @"zIndex", @"rotation" ]) {
+    id value = json[key];
+    if (value != nil && ![value isKindOfClass:[NSNumber class]]) {
+      reject(@"INVALID_ATTRIBUTES",
+             [NSString stringWithFormat:@"Marker patch '%@' must be a number or boolean", key],
+             nil);
+      return;
+    }
+    markerPatch[key] = value;
+  }
+  id attributes = json[@"attributes"];
+  if (attributes != nil && ![attributes isKindOfClass:[NSDictionary class]]) {
+    reject(@"INVALID_ATTRIBUTES", @"Marker patch attributes must be a JSON object", nil);
+    return;
+  }
+  markerPatch[@"attributes"] = attributes;
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    resolve(@([viewController updateMarkersWhere:expression patch:markerPatch]));
+  });
+}
+
+- (void)loadTripPlayback:(NSString *)nativeID
+                    trip:(TripPlaybackSpec &)trip
+                 resolve:(RCTPromiseResolveBlock)resolve
+                  reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+
+  // Copy and validate the trace off the main thread; it may hold many samples.
+  facebook::react::LazyVector<double> latLngVector = trip.latLngs();
+  facebook::react::LazyVector<double> timestampVector = trip.timestamps();
+  std::vector<double> latLngs(latLngVector.size());
+  for (size_t i = 0; i < latLngVector.size(); i++) {
+    latLngs[i] = latLngVector[i];
+  }
+  std::vector<double> timestamps(timestampVector.size());
+  for (size_t i = 0; i < timestampVector.size(); i++) {
+    timestamps[i] = timestampVector[i];
+  }
+  NSError *error = nil;
+  NavTripPlayback *playback = [NavTripPlayback playbackWithLatLngs:latLngs.data()
+                                                       latLngCount:latLngs.size()
+                                                        timestamps:timestamps.data()
+                                                    timestampCount:timestamps.size()
+                                                             error:&error];
+  if (playback == nil) {
+    reject(@"INVALID_TRACE", error.localizedDescription, error);
+    return;
+  }
+
+  if (trip.trailColor().has_value()) {
+    playback.trailColor = [UIColor colorWithColorInt:@(trip.trailColor().value())];
+  }
+  playback.trailWidth = trip.trailWidth().value_or(6.0f);
+  NSString *markerImgPath = trip.markerImgPath();
+  if (markerImgPath.length > 0) {
+    playback.markerIcon = [UIImage imageNamed:markerImgPath];
+  }
+  playback.progressInterval = trip.progressIntervalMs().value_or(250.0) / 1000.0;
+
+  __weak NavViewModule *weakSelf = self;
+  playback.progressHandler = ^(NavTripPlayback *progress) {
+    [weakSelf emitOnTripProgress:@{
+      @"nativeID" : nativeID,
+      @"timeMs" : @(progress.timeMs),
+      @"index" : @(progress.index),
+      @"lat" : @(progress.position.latitude),
+      @"lng" : @(progress.position.longitude),
+      @"heading" : @(progress.heading),
+      @"playing" : @(progress.playing),
+    }];
+  };
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    viewController.tripPlayback = playback;
+    resolve(nil);
+  });
+}
+
+- (void)clearTripPlayback:(NSString *)nativeID
+                  resolve:(RCTPromiseResolveBlock)resolve
+                   reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      viewController.tripPlayback = nil;
+      resolve(nil);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)playTrip:(NSString *)nativeID
+         resolve:(RCTPromiseResolveBlock)resolve
+          reject:(RCTPromiseRejectBlock)reject {
+  [self withTripPlayback:nativeID
+                 command:_cmd
+                 resolve:resolve
+                  reject:reject
+                   block:^(NavTripPlayback *playback) {
+                     [playback play];
+                   }];
+}
+
+- (void)pauseTrip:(NSString *)nativeID
+          resolve:(RCTPromiseResolveBlock)resolve
+           reject:(RCTPromiseRejectBlock)reject {
+  [self withTripPlayback:nativeID
+                 command:_cmd
+                 resolve:resolve
+                  reject:reject
+                   block:^(NavTripPlayback *playback) {
+                     [playback pause];
+                   }];
+}
+
+- (void)seekTrip:(NSString *)nativeID
+          timeMs:(double)timeMs
+         resolve:(RCTPromiseResolveBlock)resolve
+          reject:(RCTPromiseRejectBlock)reject {
+  [self withTripPlayback:nativeID
+                 command:_cmd
+                 resolve:resolve
+                  reject:reject
+                   block:^(NavTripPlayback *playback) {
+                     [playback seekToTime:timeMs];
+                   }];
+}
+
+- (void)setTripPlaybackRate:(NSString *)nativeID
+                       rate:(double)rate
+                    resolve:(RCTPromiseResolveBlock)resolve
+                     reject:(RCTPromiseRejectBlock)reject {
+  [self withTripPlayback:nativeID
+                 command:_cmd
+                 resolve:resolve
+                  reject:reject
+                   block:^(NavTripPlayback *playback) {
+                     playback.rate = rate;
+                   }];
+}
+
+// Runs `block` on the main thread with the trip playback of the view, rejecting if there is none.
+- (void)withTripPlayback:(NSString *)nativeID
+                 command:(SEL)command
+                 resolve:(RCTPromiseResolveBlock)resolve
+                  reject:(RCTPromiseRejectBlock)reject
+                   block:(void (^)(NavTripPlayback *playback))block {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:command];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+  dispatch_async(dispatch_get_main_queue(), ^{
+    NavTripPlayback *playback = viewController.tripPlayback;
+    if (!playback) {
+      reject(@"NO_TRIP_PLAYBACK", @"No trip playback is loaded for this view", nil);
+      return;
+    }
+    block(playback);
+    resolve(nil);
+  });
+}
+
+- (void)startRoutePrefetch:(NSString *)nativeID
+                   options:(RoutePrefetchSpec &)options
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+
+  NSString *storePath = options.storePath();
+  BOOL isDirectory = NO;
+  if (![[NSFileManager defaultManager] fileExistsAtPath:storePath isDirectory:&isDirectory] ||
+      !isDirectory) {
+    reject(@"INVALID_DATA_SOURCE", @"The feature store must be an existing directory", nil);
+    return;
+  }
+
+  double maxFeatures = fmax(0, options.maxFeatures().value_or(2000));
+  NavRoutePrefetcher *prefetcher =
+      [[NavRoutePrefetcher alloc] initWithStorePath:storePath
+                                           tileZoom:(NSInteger)options.tileZoom().value_or(12)
+                                        aheadMeters:options.aheadMeters().value_or(20000)
+                                     corridorMeters:options.corridorMeters().value_or(500)
+                                        maxFeatures:(NSUInteger)maxFeatures
+                                      lifetimeToken:viewController.viewLifetimeToken];
+  __weak NavViewModule *weakSelf = self;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [viewController
+        setRoutePrefetcher:prefetcher
+                   handler:^(NSArray<NSString *> *staged, NSArray<NSString *> *evicted) {
+                     [weakSelf emitOnRoutePrefetchChanged:@{
+                       @"nativeID" : nativeID,
+                       @"staged" : staged,
+                       @"evicted" : evicted
+                     }];
+                   }];
+    resolve(nil);
+  });
+}
+
+- (void)stopRoutePrefetch:(NSString *)nativeID
+                  resolve:(RCTPromiseResolveBlock)resolve
+                   reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (viewController) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [viewController setRoutePrefetcher:nil handler:nil];
+      resolve(nil);
+    });
+  } else {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+  }
+}
+
+- (void)renderRouteThumbnail:(RouteThumbnailSpec &)thumbnail
+                     resolve:(RCTPromiseResolveBlock)resolve
+                      reject:(RCTPromiseRejectBlock)reject {
+  NSMutableArray<NSNumber *> *path = [NSMutableArray array];
+  for (double value : thumbnail.path()) {
+    [path addObject:@(value)];
+  }
+  NSMutableArray<NSNumber *> *stops = [NSMutableArray array];
+  for (double value : thumbnail.stops()) {
+    [stops addObject:@(value)];
+  }
+
+  NSMutableDictionary<NSString *, NSNumber *> *style = [NSMutableDictionary dictionary];
+  style[@"padding"] = @(thumbnail.padding().value_or(8));
+  style[@"strokeWidth"] = @(thumbnail.strokeWidth().value_or(3));
+  style[@"stopRadius"] = @(thumbnail.stopRadius().value_or(4));
+  style[@"stopOutlineWidth"] = @(thumbnail.stopOutlineWidth().value_or(1.5));
+  if (thumbnail.strokeColor().has_value()) {
+    style[@"strokeColor"] = @(thumbnail.strokeColor().value());
+  }
+  if (thumbnail.stopColor().has_value()) {
+    style[@"stopColor"] = @(thumbnail.stopColor().value());
+  }
+  if (thumbnail.stopOutlineColor().has_value()) {
+    style[@"stopOutlineColor"] = @(thumbnail.stopOutlineColor().value());
+  }
+  if (thumbnail.backgroundColor().has_value()) {
+    style[@"backgroundColor"] = @(thumbnail.backgroundColor().value());
+  }
+
+  [[NavRouteThumbnailRenderer sharedRenderer]
+       renderPath:path
+      encodedPath:thumbnail.encodedPath()
+            stops:stops
+             size:CGSizeMake(thumbnail.width(), thumbnail.height())
+            scale:thumbnail.scale()
+            style:style
+       completion:^(NSString *uri, NSError *error) {
+         if (uri == nil) {
+           reject(@"THUMBNAIL_FAILED", error.localizedDescription, error);
+           return;
+         }
+         resolve(uri);
+       }];
+}
+
+- (void)clipPolygons:(double)operation
+             subject:(PackedPolygonsSpec &)subject
+                clip:(PackedPolygonsSpec &)clip
+             resolve:(RCTPromiseResolveBlock)resolve
+              reject:(RCTPromiseRejectBlock)reject {
+  std::vector<navsdk::GeoPolygon> subjectPolygons;
+  std::vector<navsdk::GeoPolygon> clipPolygons;
+  if (operation < 0 || operation > 2 || !UnpackPolygons(subject, &subjectPolygons) ||
+      !UnpackPolygons(clip, &clipPolygons)) {
+    reject(@"INVALID_OPTIONS", @"Invalid polygon operation or packing", nil);
+    return;
+  }
+  auto clipOperation = static_cast<navsdk::ClipOperation>(static_cast<int>(operation));
+
+  [[NavWorkerPool sharedPool]
+      submitWithPriority:NavTaskPriorityInteractive
+                   token:nil
+                   block:^{
+                     resolve(PackPolygons(
+                         navsdk::ClipPolygons(subjectPolygons, clipPolygons, clipOperation)));
+                   }];
+}
+
+- (void)addClippedPolygons:(NSString *)nativeID
+                 operation:(double)operation
+                   subject:(PackedPolygonsSpec &)subject
+                      clip:(PackedPolygonsSpec &)clip
+                   options:(ClippedPolygonOptionsSpec &)options
+                   resolve:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+  std::vector<navsdk::GeoPolygon> subjectPolygons;
+  std::vector<navsdk::GeoPolygon> clipPolygons;
+  if (operation < 0 || operation > 2 || !UnpackPolygons(subject, &subjectPolygons) ||
+      !UnpackPolygons(clip, &clipPolygons)) {
+    reject(@"INVALID_OPTIONS", @"Invalid polygon operation or packing", nil);
+    return;
+  }
+  auto clipOperation = static_cast<navsdk::ClipOperation>(static_cast<int>(operation));
+  ClippedPolygonOptionsSpec optionsCopy(options);
+
+  __weak NavViewController *weakViewController = viewController;
+  [[NavWorkerPool sharedPool]
+      submitWithPriority:NavTaskPriorityInteractive
+                   token:nil
+                   block:^{
+                     std::vector<navsdk::GeoPolygon> polygons =
+                         navsdk::ClipPolygons(subjectPolygons, clipPolygons, clipOperation);
+                     dispatch_async(dispatch_get_main_queue(), ^{
+                       NavViewController *strongViewController = weakViewController;
+                       if (strongViewController == nil) {
+                         reject(@"NO_VIEW_CONTROLLER", @"The view was removed", nil);
+                         return;
+                       }
+                       [NavViewModule addPolygons:polygons
+                                          options:optionsCopy
+                                 toViewController:strongViewController
+                                          resolve:resolve];
+                     });
+                   }];
+}
+
+// Adds the result of a polygon operation as overlays. With an id, the polygons are identified as
+// "<id>/0", "<id>/1", ... so that running the operation again replaces them.
++ (void)addPolygons:(const std::vector<navsdk::GeoPolygon> &)polygons
+             options:(const ClippedPolygonOptionsSpec &)options
+    toViewController:(NavViewController *)viewController
+             resolve:(RCTPromiseResolveBlock)resolve {
+  UIColor *fillColor = nil;
+  if (options.fillColor().has_value()) {
+    fillColor = [UIColor colorWithColorInt:@(options.fillColor().value())];
+  }
+  UIColor *strokeColor = nil;
+  if (options.strokeColor().has_value()) {
+    strokeColor = [UIColor colorWithColorInt:@(options.strokeColor().value())];
+  }
+  NSString *baseId = options.id_();
+
+  NSMutableArray<NSDictionary *> *added = [NSMutableArray array];
+  for (size_t i = 0; i < polygons.size(); i++) {
+    NSMutableArray<GMSPath *> *holes = [NSMutableArray array];
+    for (const std::vector<navsdk::GeoPoint> &hole : polygons[i].holes) {
+      [holes addObject:PathFromRing(hole)];
+    }
+    GMSPolygon *polygon = [ObjectTranslationUtil
+        createPolygon:PathFromRing(polygons[i].outer)
+                holes:holes
+            fillColor:fillColor
+          strokeColor:strokeColor
+          strokeWidth:options.strokeWidth().value_or(1.0f)
+             geodesic:options.geodesic().value_or(NO)
+            clickable:options.clickable().value_or(YES)
+               zIndex:options.zIndex().has_value() ? @(options.zIndex().value()) : nil
+           identifier:baseId ? [NSString stringWithFormat:@"%@/%zu", baseId, i] : nil];
+    [viewController addPolygon:polygon
+                       visible:options.visible().value_or(YES)
+                        result:^(NSDictionary *result) {
+                          [added addObject:result];
+                        }];
+  }
+  resolve(added);
+}
+
+- (void)classifyPoints:(NSArray *)latLngs
+                 zones:(PackedPolygonsSpec &)zones
+               resolve:(RCTPromiseResolveBlock)resolve
+                reject:(RCTPromiseRejectBlock)reject {
+  auto zonePolygons = std::make_shared<std::vector<navsdk::GeoPolygon>>();
+  if (!UnpackPolygons(zones, zonePolygons.get())) {
+    reject(@"INVALID_OPTIONS", @"Invalid polygon packing", nil);
+    return;
+  }
+  auto points = std::make_shared<std::vector<double>>();
+  points->reserve(latLngs.count);
+  for (NSNumber *value in latLngs) {
+    points->push_back(value.doubleValue);
+  }
+  ClassifyPoints(points, zonePolygons, resolve);
+}
+
+- (void)classifyPointsInPolygons:(NSString *)nativeID
+                         latLngs:(NSArray *)latLngs
+                      polygonIds:(NSArray *)polygonIds
+                         resolve:(RCTPromiseResolveBlock)resolve
+                          reject:(RCTPromiseRejectBlock)reject {
+  NavViewController *viewController = [self getViewControllerForNativeID:nativeID command:_cmd];
+  if (!viewController) {
+    reject(@"NO_VIEW_CONTROLLER", @"No view controller found for the specified nativeID", nil);
+    return;
+  }
+  auto points = std::make_shared<std::vector<double>>();
+  points->reserve(latLngs.count);
+  for (NSNumber *value in latLngs) {
+    points->push_back(value.doubleValue);
+  }
+  NSArray<NSString *> *ids = [polygonIds copy];
+
+  // Overlays are only read on the main thread; the geometry is copied out before classifying.
+  dispatch_async(dispatch_get_main_queue(), ^{
+    auto zones = std::make_shared<std::vector<navsdk::GeoPolygon>>();
+    zones->reserve(ids.count);
+    NSMutableArray<NSString *> *missingIds = [NSMutableArray array];
+    for (NSString *polygonId in ids) {
+      GMSPolygon *polygon = [viewController polygonWithId:polygonId];
+      if (polygon == nil) {
+        [missingIds addObject:polygonId];
+        continue;
+      }
+      navsdk::GeoPolygon zone;
+      zone.outer = RingFromPath(polygon.path);
+      for (GMSPath *hole in polygon.holes) {
+        zone.holes.push_back(RingFromPath(hole));
+      }
+      zones->push_back(std::move(zone));
+    }
+    if (missingIds.count > 0) {
+      reject(@"INVALID_OPTIONS",
+             [NSString stringWithFormat:@"Unknown polygon ids: %@",
+                                        [missingIds componentsJoinedByString:@", "]],
+             nil);
+      return;
+    }
+    ClassifyPoints(points, zones, resolve);
+  });
+}
+
++ (nullable NavStyleExpression *)predicateFromJSONString:(NSString *)string
+                                                   error:(NSError **)error {
+  id json = [NavViewModule objectFromJSONString:string];
+  if (json == nil) {
+    NSDictionary *userInfo = @{NSLocalizedDescriptionKey : @"Predicate must be valid JSON"};
+    *error = [NSError errorWithDomain:@"NavViewModule" code:0 userInfo:userInfo];
+    return nil;
+  }
+  return [NavStyleExpression expressionWithJSON:json error:error];
+}
+
++ (nullable id)objectFromJSONString:(NSString *)string {
+  NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+  if (data == nil) {
+    return nil;
+  }
+  return [NSJSONSerialization JSONObjectWithData:data
+                                         options:NSJSONReadingFragmentsAllowed
+                                           error:nil];
+}
+
 @end
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavViewportWatch_h
+#define NavViewportWatch_h
+
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Tracks which overlays of a watch list are inside the visible region. The extents of the watched
+ * overlays are bucketed in a uniform grid, so an update only tests the overlays in the cells under
+ * the viewport. Updates report the ids that entered and left since the previous one.
+ */
+@interface NavViewportWatch : NSObject
+
+- (instancetype)initWithOverlayIds:(NSArray<NSString *> *)overlayIds NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+@property(nonatomic, readonly) NSSet<NSString *> *overlayIds;
+
+/// Set when a watched overlay was added, moved or removed; the index is rebuilt before the next
+/// update.
+@property(nonatomic, assign) BOOL needsIndex;
+
+/// Starts a new index. Overlays that are not indexed again count as not visible.
+- (void)beginIndex;
+/// Indexes the extent of a watched overlay. A point has equal bounds.
+- (void)indexOverlayId:(NSString *)overlayId
+                 south:(double)south
+                  west:(double)west
+                 north:(double)north
+                  east:(double)east;
+- (void)endIndex;
+
+/**
+ * Evaluates membership against `region` and returns NO if nothing changed. Points are tested
+ * against the visible quadrilateral, other extents against its bounds.
+ */
+- (BOOL)updateWithVisibleRegion:(GMSVisibleRegion)region
+                        entered:(NSArray<NSString *> *_Nullable *_Nonnull)entered
+                           left:(NSArray<NSString *> *_Nullable *_Nonnull)left;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NavViewportWatch_h */
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavViewportWatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct WatchEntry {
+  double south;
+  double west;
+  double north;
+  double east;
+
+  bool IsPoint() const { return south == north && west == east; }
+
+  bool Intersects(double s, double w, double n, double e) const {
+    return south <= n && north >= s && west <= e && east >= w;
+  }
+};
+
+// Cells are at least this large, so dense clusters do not produce a huge grid.
+const double kMinCellDegrees = 1e-4;
+// Entries spanning more cells than this are tested on every update instead.
+const long kMaxCellsPerEntry = 16;
+
+uint64_t CellKey(long row, long column) {
+  return ((uint64_t)(uint32_t)row << 32) | (uint32_t)column;
+}
+
+}  // namespace
+
+@implementation NavViewportWatch {
+  NSMutableArray<NSString *> *_indexedIds;
+  std::vector<WatchEntry> _entries;
+  std::unordered_map<uint64_t, std::vector<uint32_t>> _cells;
+  std::vector<uint32_t> _oversized;
+  double _cellSize;
+  NSSet<NSString *> *_visible;
+}
+
+- (instancetype)initWithOverlayIds:(NSArray<NSString *> *)overlayIds {
+  self = [super init];
+  if (self) {
+    _overlayIds = [NSSet setWithArray:overlayIds];
+    _indexedIds = [NSMutableArray array];
+    _visible = [NSSet set];
+    _needsIndex = YES;
+  }
+  return self;
+}
+
+- (void)beginIndex {
+  [_indexedIds removeAllObjects];
+  _entries.clear();
+  _cells.clear();
+  _oversized.clear();
+}
+
+- (void)indexOverlayId:(NSString *)overlayId
+                 south:(double)south
+                  west:(double)west
+                 north:(double)north
+                  east:(double)east {
+  [_indexedIds addObject:overlayId];
+  _entries.push_back({south, west, north, east});
+}
+
+- (void)endIndex {
+  _needsIndex = NO;
+  if (_entries.empty()) {
+    return;
+  }
+
+  // Aim for about one entry per cell over the extent of all entries.
+  WatchEntry all = _entries.front();
+  for (const WatchEntry &entry : _entries) {
+    all.south = std::min(all.south, entry.south);
+    all.west = std::min(all.west, entry.west);
+    all.north = std::max(all.north, entry.north);
+    all.east = std::max(all.east, entry.east);
+  }
+  double span = std::max(all.north - all.south, all.east - all.west);
+  _cellSize = std::max(kMinCellDegrees, span / std::ceil(std::sqrt((double)_entries.size())));
+
+  for (uint32_t i = 0; i < _entries.size(); i++) {
+    const WatchEntry &entry = _entries[i];
+    long row0 = (long)std::floor(entry.south / _cellSize);
+    long row1 = (long)std::floor(entry.north / _cellSize);
+    long column0 = (long)std::floor(entry.west / _cellSize);
+    long column1 = (long)std::floor(entry.east / _cellSize);
+    if ((row1 - row0 + 1) * (column1 - column0 + 1) > kMaxCellsPerEntry) {
+      _oversized.push_back(i);
+      continue;
+    }
+    for (long row = row0; row <= row1; row++) {
+      for (long column = column0; column <= column1; column++) {
+        _cells[CellKey(row, column)].push_back(i);
+      }
+    }
+  }
+}
+
+- (BOOL)updateWithVisibleRegion:(GMSVisibleRegion)region
+                        entered:(NSArray<NSString *> **)entered
+                           left:(NSArray<NSString *> **)left {
+  GMSCoordinateBounds *bounds = [[GMSCoordinateBounds alloc] initWithRegion:region];
+  GMSMutablePath *quad = [GMSMutablePath path];
+  [quad addCoordinate:region.nearLeft];
+  [quad addCoordinate:region.nearRight];
+  [quad addCoordinate:region.farRight];
+  [quad addCoordinate:region.farLeft];
+
+  std::vector<bool> seen(_entries.size(), false);
+  std::vector<uint32_t> candidates;
+  double south = bounds.southWest.latitude;
+  double north = bounds.northEast.latitude;
+  double west = bounds.southWest.longitude;
+  double east = bounds.northEast.longitude;
+  if (west <= east) {
+    [self collectSouth:south west:west north:north east:east into:candidates seen:seen];
+  } else {
+    // The viewport crosses the antimeridian.
+    [self collectSouth:south west:west north:north east:180 into:candidates seen:seen];
+    [self collectSouth:south west:-180 north:north east:east into:candidates seen:seen];
+  }
+
+  NSMutableSet<NSString *> *visible = [NSMutableSet setWithCapacity:candidates.size()];
+  for (uint32_t i : candidates) {
+    const WatchEntry &entry = _entries[i];
+    if (entry.IsPoint() &&
+        !GMSGeometryContainsLocation(CLLocationCoordinate2DMake(entry.south, entry.west), quad,
+                                     NO)) {
+      continue;
+    }
+    [visible addObject:_indexedIds[i]];
+  }
+
+  NSMutableSet<NSString *> *enteredIds = [visible mutableCopy];
+  [enteredIds minusSet:_visible];
+  NSMutableSet<NSString *> *leftIds = [_visible mutableCopy];
+  [leftIds minusSet:visible];
+  _visible = visible;
+  *entered = enteredIds.allObjects;
+  *left = leftIds.allObjects;
+  return enteredIds.count > 0 || leftIds.count > 0;
+}
+
+- (void)collectSouth:(double)south
+                west:(double)west
+               north:(double)north
+                east:(double)east
+                into:(std::vector<uint32_t> &)candidates
+                seen:(std::vector<bool> &)seen {
+  auto consider = [&](uint32_t i) {
+    if (!seen[i] && _entries[i].Intersects(south, west, north, east)) {
+      seen[i] = true;
+      candidates.push_back(i);
+    }
+  };
+  if (_entries.empty()) {
+    return;
+  }
+
+  long row0 = (long)std::floor(south / _cellSize);
+  long row1 = (long)std::floor(north / _cellSize);
+  long column0 = (long)std::floor(west / _cellSize);
+  long column1 = (long)std::floor(east / _cellSize);
+  double cellCount = (double)(row1 - row0 + 1) * (double)(column1 - column0 + 1);
+  if (cellCount > (double)_entries.size()) {
+    // Zoomed out past the watched area: scanning the entries is cheaper than the cells.
+    for (uint32_t i = 0; i < _entries.size(); i++) {
+      consider(i);
+    }
+    return;
+  }
+  for (long row = row0; row <= row1; row++) {
+    for (long column = column0; column <= column1; column++) {
+      auto cell = _cells.find(CellKey(row, column));
+      if (cell != _cells.end()) {
+        for (uint32_t i : cell->second) {
+          consider(i);
+        }
+      }
+    }
+  }
+  for (uint32_t i : _oversized) {
+    consider(i);
+  }
+}
+
+@end
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Priority classes of the shared worker pool. Workers always pick the highest priority task
+ * available anywhere in the pool before considering lower classes.
+ */
+typedef NS_ENUM(NSInteger, NavTaskPriority) {
+  /// Work whose result is needed for what is currently on screen.
+  NavTaskPriorityInteractive = 0,
+  /// Work that prepares content likely to be needed soon.
+  NavTaskPriorityPrefetch = 1,
+  /// Housekeeping and bulk work with no latency requirement.
+  NavTaskPriorityBackground = 2,
+};
+
+/**
+ * Cancellation token for pool tasks. A token is cancelled explicitly or when its parent is
+ * cancelled, which allows binding work to both a view's lifetime and its camera generation.
+ */
+@interface NavCancellationToken : NSObject
+
+@property(nonatomic, readonly, getter=isCancelled) BOOL cancelled;
+
+- (instancetype)init;
+- (instancetype)initWithParent:(nullable NavCancellationToken *)parent;
+- (void)cancel;
+
+@end
+
+/**
+ * Bounded, work-stealing pool for background native work such as geometry processing, image
+ * decoding and rasterization. Each worker owns a deque per priority class; idle workers steal
+ * from the others. Tasks whose token has been cancelled are dropped without running.
+ */
+@interface NavWorkerPool : NSObject
+
++ (instancetype)sharedPool;
+
+/// Number of worker threads in the pool.
+@property(nonatomic, readonly) NSUInteger workerCount;
+
+- (void)submitWithPriority:(NavTaskPriority)priority
+                     token:(nullable NavCancellationToken *)token
+                     block:(dispatch_block_t)block;
+
+/**
+ * Runs `block` once for each index in [0, count) as separate tasks, so that the iterations are
+ * spread over the workers, then runs `completion` on the worker that finishes the last one.
+ */
+- (void)applyWithPriority:(NavTaskPriority)priority
+                    count:(NSUInteger)count
+                    block:(void (^)(NSUInteger index))block
+               completion:(dispatch_block_t)completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
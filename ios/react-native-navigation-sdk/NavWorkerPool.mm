@@ -0,0 +1,231 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "NavWorkerPool.h"
+#import <pthread.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static const int kPriorityClassCount = 3;
+static const NSUInteger kMaxWorkerCount = 4;
+
+@implementation NavCancellationToken {
+  NavCancellationToken *_parent;
+  std::atomic<bool> _cancelled;
+}
+
+- (instancetype)init {
+  return [self initWithParent:nil];
+}
+
+- (instancetype)initWithParent:(nullable NavCancellationToken *)parent {
+  self = [super init];
+  if (self) {
+    _parent = parent;
+    _cancelled.store(false);
+  }
+  return self;
+}
+
+- (BOOL)isCancelled {
+  return _cancelled.load(std::memory_order_acquire) || (_parent != nil && _parent.isCancelled);
+}
+
+- (void)cancel {
+  _cancelled.store(true, std::memory_order_release);
+}
+
+@end
+
+namespace {
+
+struct PoolTask {
+  dispatch_block_t block;
+  NavCancellationToken *token;
+  int priorityClass;
+};
+
+struct Worker {
+  std::mutex mutex;
+  std::deque<PoolTask> queues[kPriorityClassCount];
+};
+
+thread_local int currentWorkerIndex = -1;
+
+}  // namespace
+
+@implementation NavWorkerPool {
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::mutex _sleepMutex;
+  std::condition_variable _wakeCondition;
+  int _pendingCount;  // Guarded by _sleepMutex.
+  std::atomic<unsigned> _nextWorker;
+}
+
++ (instancetype)sharedPool {
+  static NavWorkerPool *sharedPool = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedPool = [[NavWorkerPool alloc] init];
+  });
+  return sharedPool;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    // Leave one core to the main thread and renderer.
+    NSUInteger cores = [NSProcessInfo processInfo].activeProcessorCount;
+    _workerCount = std::max<NSUInteger>(1, std::min<NSUInteger>(kMaxWorkerCount, cores - 1));
+    _pendingCount = 0;
+    _nextWorker.store(0);
+    for (NSUInteger i = 0; i < _workerCount; i++) {
+      _workers.push_back(std::make_unique<Worker>());
+    }
+    // The pool is a process-wide singleton; worker threads are never joined.
+    for (NSUInteger i = 0; i < _workerCount; i++) {
+      int index = (int)i;
+      std::thread([self, index] { [self runWorker:index]; }).detach();
+    }
+  }
+  return self;
+}
+
+- (void)submitWithPriority:(NavTaskPriority)priority
+                     token:(nullable NavCancellationToken *)token
+                     block:(dispatch_block_t)block {
+  if (token.isCancelled) {
+    return;
+  }
+  int priorityClass = std::clamp((int)priority, 0, kPriorityClassCount - 1);
+
+  // Tasks spawned from a worker stay on that worker for locality; others are spread round robin.
+  int index = currentWorkerIndex >= 0
+                  ? currentWorkerIndex
+                  : (int)(_nextWorker.fetch_add(1, std::memory_order_relaxed) % _workers.size());
+  {
+    Worker &worker = *_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queues[priorityClass].push_back(PoolTask{[block copy], token, priorityClass});
+  }
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _pendingCount++;
+  }
+  _wakeCondition.notify_one();
+}
+
+- (void)applyWithPriority:(NavTaskPriority)priority
+                    count:(NSUInteger)count
+                    block:(void (^)(NSUInteger index))block
+               completion:(dispatch_block_t)completion {
+  if (count == 0) {
+    [self submitWithPriority:priority token:nil block:completion];
+    return;
+  }
+  auto remaining = std::make_shared<std::atomic<NSUInteger>>(count);
+  for (NSUInteger i = 0; i < count; i++) {
+    [self submitWithPriority:priority
+                       token:nil
+                       block:^{
+                         block(i);
+                         if (remaining->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                           completion();
+                         }
+                       }];
+  }
+}
+
+- (void)runWorker:(int)index {
+  currentWorkerIndex = index;
+  pthread_setname_np("com.google.navsdk.worker");
+  pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+  bool interactive = false;
+
+  while (true) {
+    // Claim one queued task before looking for it. Tasks are queued before being counted, so
+    // there are always at least as many queued tasks as claims.
+    {
+      std::unique_lock<std::mutex> lock(_sleepMutex);
+      _wakeCondition.wait(lock, [self] { return _pendingCount > 0; });
+      _pendingCount--;
+    }
+
+    // The deques are scanned one lock at a time, so a scan can miss every task while other
+    // workers take the ones it passed and new ones land in deques it already scanned. The claim
+    // is then given back so that the tasks it stands for are not left unrun.
+    PoolTask task;
+    if (![self takeTask:&task forWorker:index]) {
+      std::lock_guard<std::mutex> lock(_sleepMutex);
+      _pendingCount++;
+      continue;
+    }
+
+    if (task.token.isCancelled) {
+      continue;
+    }
+    // Interactive tasks run at user-initiated QoS so that they are not scheduled as utility work;
+    // the worker drops back once it takes a lower priority task.
+    bool taskInteractive = task.priorityClass == NavTaskPriorityInteractive;
+    if (taskInteractive != interactive) {
+      pthread_set_qos_class_self_np(taskInteractive ? QOS_CLASS_USER_INITIATED : QOS_CLASS_UTILITY,
+                                    0);
+      interactive = taskInteractive;
+    }
+    @autoreleasepool {
+      task.block();
+    }
+  }
+}
+
+/**
+ * Takes the highest priority task available, preferring the newest task of this worker's own
+ * deque and otherwise stealing the oldest task from another worker.
+ */
+- (BOOL)takeTask:(PoolTask *)task forWorker:(int)index {
+  size_t count = _workers.size();
+  for (int priorityClass = 0; priorityClass < kPriorityClassCount; priorityClass++) {
+    {
+      Worker &own = *_workers[index];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      auto &queue = own.queues[priorityClass];
+      if (!queue.empty()) {
+        *task = std::move(queue.back());
+        queue.pop_back();
+        return YES;
+      }
+    }
+    for (size_t offset = 1; offset < count; offset++) {
+      Worker &victim = *_workers[(index + offset) % count];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      auto &queue = victim.queues[priorityClass];
+      if (!queue.empty()) {
+        *task = std::move(queue.front());
+        queue.pop_front();
+        return YES;
+      }
+    }
+  }
+  return NO;
+}
+
+@end
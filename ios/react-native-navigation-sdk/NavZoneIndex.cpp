@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NavZoneIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace navsdk {
+
+namespace {
+
+// Average number of edges per band of a zone, and of zones per grid cell.
+const size_t kEdgesPerBand = 4;
+const size_t kZonesPerCell = 4;
+const int kMaxGridSize = 256;
+
+int CellIndex(double value, double origin, double size, int count) {
+  int cell = static_cast<int>((value - origin) / size);
+  return std::max(0, std::min(cell, count - 1));
+}
+
+}  // namespace
+
+ZoneIndex::Zone ZoneIndex::BuildZone(const GeoPolygon &polygon) {
+  Zone zone{INFINITY, INFINITY, -INFINITY, -INFINITY, 0, 1, {0, 0}, {}, {}, {}, {}};
+  if (polygon.outer.size() < 3) {
+    return zone;
+  }
+
+  struct Edge {
+    double x0;
+    double y0;
+    double x1;
+    double y1;
+  };
+  std::vector<Edge> edges;
+  auto addRing = [&](const std::vector<GeoPoint> &ring) {
+    for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+      // Horizontal edges never cross a horizontal ray.
+      if (ring[j].lat != ring[i].lat) {
+        edges.push_back({ring[j].lng, ring[j].lat, ring[i].lng, ring[i].lat});
+      }
+    }
+  };
+  addRing(polygon.outer);
+  for (const std::vector<GeoPoint> &hole : polygon.holes) {
+    if (hole.size() >= 3) {
+      addRing(hole);
+    }
+  }
+  for (const GeoPoint &point : polygon.outer) {
+    zone.minX = std::min(zone.minX, point.lng);
+    zone.minY = std::min(zone.minY, point.lat);
+    zone.maxX = std::max(zone.maxX, point.lng);
+    zone.maxY = std::max(zone.maxY, point.lat);
+  }
+  if (edges.empty()) {
+    return zone;
+  }
+
+  size_t bandCount = std::max<size_t>(1, edges.size() / kEdgesPerBand);
+  zone.bandMinY = zone.minY;
+  zone.bandHeight = std::max((zone.maxY - zone.minY) / static_cast<double>(bandCount), 1e-12);
+  auto band = [&](double y) {
+    return static_cast<size_t>(CellIndex(y, zone.bandMinY, zone.bandHeight,
+                                         static_cast<int>(bandCount)));
+  };
+
+  std::vector<uint32_t> offsets(bandCount + 1, 0);
+  for (const Edge &edge : edges) {
+    size_t last = band(std::max(edge.y0, edge.y1));
+    for (size_t b = band(std::min(edge.y0, edge.y1)); b <= last; b++) {
+      offsets[b + 1]++;
+    }
+  }
+  for (size_t b = 0; b < bandCount; b++) {
+    offsets[b + 1] += offsets[b];
+  }
+  size_t total = offsets[bandCount];
+  zone.y0.resize(total);
+  zone.y1.resize(total);
+  zone.x0.resize(total);
+  zone.slope.resize(total);
+  std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+  for (const Edge &edge : edges) {
+    double slope = (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+    size_t last = band(std::max(edge.y0, edge.y1));
+    for (size_t b = band(std::min(edge.y0, edge.y1)); b <= last; b++) {
+      uint32_t entry = fill[b]++;
+      zone.y0[entry] = edge.y0;
+      zone.y1[entry] = edge.y1;
+      zone.x0[entry] = edge.x0;
+      zone.slope[entry] = slope;
+    }
+  }
+  zone.bandOffsets = std::move(offsets);
+  return zone;
+}
+
+ZoneIndex::ZoneIndex(const std::vector<GeoPolygon> &zones) {
+  zones_.reserve(zones.size());
+  double minX = INFINITY;
+  double minY = INFINITY;
+  double maxX = -INFINITY;
+  double maxY = -INFINITY;
+  for (const GeoPolygon &polygon : zones) {
+    zones_.push_back(BuildZone(polygon));
+    const Zone &zone = zones_.back();
+    if (zone.minX <= zone.maxX) {
+      minX = std::min(minX, zone.minX);
+      minY = std::min(minY, zone.minY);
+      maxX = std::max(maxX, zone.maxX);
+      maxY = std::max(maxY, zone.maxY);
+    }
+  }
+  if (minX > maxX) {
+    return;
+  }
+
+  int size = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(zones.size()) /
+                                                  static_cast<double>(kZonesPerCell))));
+  columns_ = rows_ = std::max(1, std::min(size, kMaxGridSize));
+  minX_ = minX;
+  minY_ = minY;
+  cellWidth_ = std::max((maxX - minX) / columns_, 1e-12);
+  cellHeight_ = std::max((maxY - minY) / rows_, 1e-12);
+
+  std::vector<std::vector<int32_t>> cells(static_cast<size_t>(columns_ * rows_));
+  for (size_t i = 0; i < zones_.size(); i++) {
+    const Zone &zone = zones_[i];
+    if (zone.minX > zone.maxX) {
+      continue;
+    }
+    int lastColumn = CellIndex(zone.maxX, minX_, cellWidth_, columns_);
+    int lastRow = CellIndex(zone.maxY, minY_, cellHeight_, rows_);
+    for (int row = CellIndex(zone.minY, minY_, cellHeight_, rows_); row <= lastRow; row++) {
+      for (int column = CellIndex(zone.minX, minX_, cellWidth_, columns_); column <= lastColumn;
+           column++) {
+        cells[static_cast<size_t>(row * columns_ + column)].push_back(static_cast<int32_t>(i));
+      }
+    }
+  }
+  cellOffsets_.reserve(cells.size() + 1);
+  cellOffsets_.push_back(0);
+  for (const std::vector<int32_t> &cell : cells) {
+    cellZones_.insert(cellZones_.end(), cell.begin(), cell.end());
+    cellOffsets_.push_back(static_cast<uint32_t>(cellZones_.size()));
+  }
+}
+
+bool ZoneIndex::Contains(const Zone &zone, double x, double y) {
+  if (x < zone.minX || x > zone.maxX || y < zone.minY || y > zone.maxY) {
+    return false;
+  }
+  size_t band = static_cast<size_t>(CellIndex(y, zone.bandMinY, zone.bandHeight,
+                                              static_cast<int>(zone.bandOffsets.size() - 1)));
+  uint32_t begin = zone.bandOffsets[band];
+  uint32_t end = zone.bandOffsets[band + 1];
+  const double *y0 = zone.y0.data();
+  const double *y1 = zone.y1.data();
+  const double *x0 = zone.x0.data();
+  const double *slope = zone.slope.data();
+  unsigned crossings = 0;
+  for (uint32_t i = begin; i < end; i++) {
+    bool straddles = (y0[i] > y) != (y1[i] > y);
+    bool left = x < x0[i] + (y - y0[i]) * slope[i];
+    crossings += static_cast<unsigned>(straddles & left);
+  }
+  return (crossings & 1) != 0;
+}
+
+int32_t ZoneIndex::Classify(GeoPoint point) const {
+  double x = point.lng;
+  double y = point.lat;
+  // Written so that NaN coordinates are rejected too.
+  if (columns_ == 0 || !(x >= minX_ && x <= minX_ + cellWidth_ * columns_) ||
+      !(y >= minY_ && y <= minY_ + cellHeight_ * rows_)) {
+    return -1;
+  }
+  size_t cell = static_cast<size_t>(CellIndex(y, minY_, cellHeight_, rows_) * columns_ +
+                                    CellIndex(x, minX_, cellWidth_, columns_));
+  for (uint32_t i = cellOffsets_[cell]; i < cellOffsets_[cell + 1]; i++) {
+    int32_t zone = cellZones_[i];
+    if (Contains(zones_[static_cast<size_t>(zone)], x, y)) {
+      return zone;
+    }
+  }
+  return -1;
+}
+
+void ZoneIndex::ClassifyRange(const double *latLngs, size_t begin, size_t end,
+                              int32_t *zones) const {
+  for (size_t i = begin; i < end; i++) {
+    zones[i] = Classify({latLngs[2 * i], latLngs[2 * i + 1]});
+  }
+}
+
+}  // namespace navsdk
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavZoneIndex_h
+#define NavZoneIndex_h
+
+// Portable C++ core of batch point-in-zone classification. It has no platform dependencies, so
+// that it can be built and checked on any host.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "NavGeometry.h"
+
+namespace navsdk {
+
+// Spatial index over zone polygons for classifying many points. Each zone is the even-odd area of
+// its outer ring and holes. The index is immutable once built, so one index can be queried from
+// several threads at once.
+class ZoneIndex {
+ public:
+  explicit ZoneIndex(const std::vector<GeoPolygon> &zones);
+
+  // Index of the first zone containing the point, or -1 if none does.
+  int32_t Classify(GeoPoint point) const;
+
+  // Classifies points [begin, end) of `latLngs`, packed as [lat0, lng0, ...], writing the zone of
+  // point i to zones[i].
+  void ClassifyRange(const double *latLngs, size_t begin, size_t end, int32_t *zones) const;
+
+ private:
+  struct Zone {
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+    double bandMinY;
+    double bandHeight;
+    // Edges of band i are entries bandOffsets[i] to bandOffsets[i + 1] - 1 of the arrays below.
+    std::vector<uint32_t> bandOffsets;
+    // Edges as a structure of arrays with a precomputed inverse slope, so that the crossing test
+    // is a short branch-free loop the compiler can vectorize.
+    std::vector<double> y0;
+    std::vector<double> y1;
+    std::vector<double> x0;
+    std::vector<double> slope;
+  };
+
+  static Zone BuildZone(const GeoPolygon &polygon);
+  static bool Contains(const Zone &zone, double x, double y);
+
+  std::vector<Zone> zones_;
+  // Uniform grid over the bounds of all zones. Each cell lists, in ascending order, the zones
+  // whose bounds overlap it.
+  double minX_ = 0;
+  double minY_ = 0;
+  double cellWidth_ = 1;
+  double cellHeight_ = 1;
+  int columns_ = 0;
+  int rows_ = 0;
+  std::vector<uint32_t> cellOffsets_;
+  std::vector<int32_t> cellZones_;
+};
+
+}  // namespace navsdk
+
+#endif /* NavZoneIndex_h */
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of the polygon boolean operations on city-sized operands of increasing vertex count,
+// and on operands made of many small rings. Pass an iteration count to override the default.
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "NavPolygonClipper.h"
+#include "NavTestSupport.h"
+
+using navsdk::ClipOperation;
+using navsdk::GeoPoint;
+using navsdk::GeoPolygon;
+
+namespace {
+
+// A wavy zone outline of `count` vertices around (`lat`, `lng`), about 10 km across.
+GeoPolygon MakeZone(size_t count, double lat, double lng) {
+  GeoPolygon zone;
+  zone.outer.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(count);
+    double radius = 0.05 * (1 + 0.05 * std::sin(17 * angle));
+    zone.outer.push_back({lat + radius * std::sin(angle), lng + radius * std::cos(angle)});
+  }
+  return zone;
+}
+
+// A star of `count` vertices, whose spikes cross those of a star with a nearby center about
+// `count` times.
+GeoPolygon MakeStar(size_t count, double lat, double lng) {
+  GeoPolygon star;
+  star.outer.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(count);
+    double radius = 0.05 * (i % 2 == 0 ? 1 : 0.8);
+    star.outer.push_back({lat + radius * std::sin(angle), lng + radius * std::cos(angle)});
+  }
+  return star;
+}
+
+// A `side` x `side` checkerboard of squares about 100 m wide.
+std::vector<GeoPolygon> MakeBlocks(size_t side, double lat, double lng) {
+  std::vector<GeoPolygon> blocks;
+  for (size_t row = 0; row < side; row++) {
+    for (size_t column = row % 2; column < side; column += 2) {
+      double minLat = lat + 0.001 * static_cast<double>(row);
+      double minLng = lng + 0.001 * static_cast<double>(column);
+      blocks.push_back({{{minLat, minLng},
+                         {minLat, minLng + 0.001},
+                         {minLat + 0.001, minLng + 0.001},
+                         {minLat + 0.001, minLng}},
+                        {}});
+    }
+  }
+  return blocks;
+}
+
+const char *OperationName(ClipOperation operation) {
+  switch (operation) {
+    case ClipOperation::kUnion:
+      return "union";
+    case ClipOperation::kIntersection:
+      return "intersection";
+    case ClipOperation::kDifference:
+      return "difference";
+  }
+  return "";
+}
+
+void Report(const std::string &name, double microseconds) {
+  std::printf("%-48s %10.1f us/op\n", name.c_str(), microseconds);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20;
+  const ClipOperation operations[] = {ClipOperation::kUnion, ClipOperation::kIntersection,
+                                      ClipOperation::kDifference};
+
+  size_t sink = 0;
+  auto measure = [&](const std::string &name, const std::vector<GeoPolygon> &subject,
+                     const std::vector<GeoPolygon> &clip) {
+    for (ClipOperation operation : operations) {
+      double time = navsdk::test::MeasureMicroseconds(iterations, [&] {
+        sink += navsdk::ClipPolygons(subject, clip, operation).size();
+      });
+      Report(std::string(OperationName(operation)) + ", " + name, time);
+    }
+  };
+
+  for (size_t count : {1000, 10000, 100000}) {
+    measure("zones of " + std::to_string(count) + " vertices",
+            {MakeZone(count, 37.77, -122.42)}, {MakeZone(count, 37.79, -122.40)});
+  }
+  measure("stars of 1000 vertices", {MakeStar(1000, 37.77, -122.42)},
+          {MakeStar(1000, 37.79, -122.40)});
+  measure("800 blocks and a zone of 1000 vertices", MakeBlocks(40, 37.75, -122.45),
+          {MakeZone(1000, 37.77, -122.43)});
+  return sink == 0 ? 1 : 0;
+}
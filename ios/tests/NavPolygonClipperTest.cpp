@@ -0,0 +1,294 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Correctness tests of the polygon boolean operations: regular overlaps, degenerate operands,
+// operands touching along edges or at vertices, and operands whose rings overlap themselves.
+// Results are checked through their area, their ring structure and point membership, which do not
+// depend on where the result rings start.
+
+#include <cmath>
+#include <initializer_list>
+
+#include "NavPolygonClipper.h"
+#include "NavTestSupport.h"
+
+using navsdk::ClipOperation;
+using navsdk::ClipPolygons;
+using navsdk::GeoPoint;
+using navsdk::GeoPolygon;
+
+namespace {
+
+const double kAreaTolerance = 1e-9;
+
+std::vector<GeoPoint> Rect(double minLng, double minLat, double maxLng, double maxLat) {
+  return {{minLat, minLng}, {minLat, maxLng}, {maxLat, maxLng}, {maxLat, minLng}};
+}
+
+std::vector<GeoPoint> Reversed(std::vector<GeoPoint> ring) {
+  return std::vector<GeoPoint>(ring.rbegin(), ring.rend());
+}
+
+GeoPolygon Polygon(std::vector<GeoPoint> outer, std::vector<std::vector<GeoPoint>> holes = {}) {
+  return {std::move(outer), std::move(holes)};
+}
+
+// Signed area in square degrees with longitude as x, positive for counterclockwise rings.
+double RingArea(const std::vector<GeoPoint> &ring) {
+  double area = 0;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    area += ring[j].lng * ring[i].lat - ring[i].lng * ring[j].lat;
+  }
+  return area / 2;
+}
+
+// Area of a result, which must have counterclockwise outer rings and clockwise holes.
+double Area(const std::vector<GeoPolygon> &polygons) {
+  double area = 0;
+  for (const GeoPolygon &polygon : polygons) {
+    NAV_EXPECT_TRUE(RingArea(polygon.outer) > 0);
+    area += RingArea(polygon.outer);
+    for (const std::vector<GeoPoint> &hole : polygon.holes) {
+      NAV_EXPECT_TRUE(RingArea(hole) < 0);
+      area += RingArea(hole);
+    }
+  }
+  return area;
+}
+
+size_t HoleCount(const std::vector<GeoPolygon> &polygons) {
+  size_t count = 0;
+  for (const GeoPolygon &polygon : polygons) {
+    count += polygon.holes.size();
+  }
+  return count;
+}
+
+bool RingContains(const std::vector<GeoPoint> &ring, GeoPoint point) {
+  bool inside = false;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    if ((ring[i].lat > point.lat) != (ring[j].lat > point.lat) &&
+        point.lng < (ring[j].lng - ring[i].lng) * (point.lat - ring[i].lat) /
+                            (ring[j].lat - ring[i].lat) +
+                        ring[i].lng) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+// Whether `point`, which must not lie on a boundary, is in the even-odd area of the polygons.
+bool Contains(const std::vector<GeoPolygon> &polygons, double lng, double lat) {
+  bool inside = false;
+  for (const GeoPolygon &polygon : polygons) {
+    inside ^= RingContains(polygon.outer, {lat, lng});
+    for (const std::vector<GeoPoint> &hole : polygon.holes) {
+      inside ^= RingContains(hole, {lat, lng});
+    }
+  }
+  return inside;
+}
+
+// Checks the three operations at once against their expected areas.
+void ExpectAreas(const std::vector<GeoPolygon> &subject, const std::vector<GeoPolygon> &clip,
+                 double unionArea, double intersectionArea, double differenceArea) {
+  NAV_EXPECT_NEAR(Area(ClipPolygons(subject, clip, ClipOperation::kUnion)), unionArea,
+                  kAreaTolerance);
+  NAV_EXPECT_NEAR(Area(ClipPolygons(subject, clip, ClipOperation::kIntersection)),
+                  intersectionArea, kAreaTolerance);
+  NAV_EXPECT_NEAR(Area(ClipPolygons(subject, clip, ClipOperation::kDifference)), differenceArea,
+                  kAreaTolerance);
+}
+
+}  // namespace
+
+NAV_TEST(OverlappingSquares) {
+  std::vector<GeoPolygon> a = {Polygon(Rect(0, 0, 2, 2))};
+  std::vector<GeoPolygon> b = {Polygon(Rect(1, 1, 3, 3))};
+  ExpectAreas(a, b, 7, 1, 3);
+
+  std::vector<GeoPolygon> united = ClipPolygons(a, b, ClipOperation::kUnion);
+  NAV_EXPECT_EQ(united.size(), size_t{1});
+  NAV_EXPECT_EQ(united[0].outer.size(), size_t{8});
+  std::vector<GeoPolygon> difference = ClipPolygons(a, b, ClipOperation::kDifference);
+  NAV_EXPECT_TRUE(Contains(difference, 0.5, 0.5));
+  NAV_EXPECT_TRUE(!Contains(difference, 1.5, 1.5));
+}
+
+NAV_TEST(IgnoresRingOrientation) {
+  std::vector<GeoPolygon> a = {Polygon(Reversed(Rect(0, 0, 2, 2)))};
+  std::vector<GeoPolygon> b = {Polygon(Reversed(Rect(1, 1, 3, 3)))};
+  ExpectAreas(a, b, 7, 1, 3);
+  // A hole given counterclockwise is still a hole.
+  std::vector<GeoPolygon> framed = {Polygon(Rect(0, 0, 4, 4), {Rect(1, 1, 3, 3)})};
+  ExpectAreas(framed, {}, 12, 0, 12);
+}
+
+NAV_TEST(DisjointOperands) {
+  std::vector<GeoPolygon> a = {Polygon(Rect(0, 0, 1, 1))};
+  std::vector<GeoPolygon> b = {Polygon(Rect(5, 5, 6, 6))};
+  ExpectAreas(a, b, 2, 0, 1);
+  NAV_EXPECT_EQ(ClipPolygons(a, b, ClipOperation::kUnion).size(), size_t{2});
+  NAV_EXPECT_TRUE(ClipPolygons(a, b, ClipOperation::kIntersection).empty());
+}
+
+NAV_TEST(ContainedOperandMakesHole) {
+  std::vector<GeoPolygon> outer = {Polygon(Rect(0, 0, 4, 4))};
+  std::vector<GeoPolygon> inner = {Polygon(Rect(1, 1, 3, 3))};
+  ExpectAreas(outer, inner, 16, 4, 12);
+  std::vector<GeoPolygon> difference = ClipPolygons(outer, inner, ClipOperation::kDifference);
+  NAV_EXPECT_EQ(difference.size(), size_t{1});
+  NAV_EXPECT_EQ(HoleCount(difference), size_t{1});
+  // Removing the outer operand from the inner one leaves nothing.
+  NAV_EXPECT_TRUE(ClipPolygons(inner, outer, ClipOperation::kDifference).empty());
+}
+
+NAV_TEST(IdenticalOperands) {
+  std::vector<GeoPolygon> a = {Polygon(Rect(0, 0, 2, 1))};
+  ExpectAreas(a, a, 2, 2, 0);
+  std::vector<GeoPolygon> reversed = {Polygon(Reversed(Rect(0, 0, 2, 1)))};
+  ExpectAreas(a, reversed, 2, 2, 0);
+  NAV_EXPECT_EQ(ClipPolygons(a, a, ClipOperation::kUnion).size(), size_t{1});
+}
+
+NAV_TEST(DegenerateOperands) {
+  std::vector<GeoPolygon> square = {Polygon(Rect(0, 0, 1, 1))};
+  ExpectAreas({}, {}, 0, 0, 0);
+  ExpectAreas(square, {}, 1, 0, 1);
+  ExpectAreas({}, square, 1, 0, 0);
+
+  // Rings with fewer than three distinct points or without area are ignored.
+  std::vector<GeoPolygon> degenerate = {
+      Polygon({}),
+      Polygon({{0.5, 0.5}}),
+      Polygon({{0, 0}, {1, 1}}),
+      Polygon({{0, 0}, {0.5, 0.5}, {1, 1}}),
+      Polygon({{0.2, 0.2}, {0.2, 0.2}, {0.2, 0.2}, {0.2, 0.2}}),
+  };
+  ExpectAreas(square, degenerate, 1, 0, 1);
+  ExpectAreas(degenerate, square, 1, 0, 0);
+
+  // A closing point equal to the first one and repeated vertices change nothing.
+  std::vector<GeoPoint> closed = Rect(0, 0, 1, 1);
+  closed.insert(closed.begin() + 1, closed[1]);
+  closed.push_back(closed.front());
+  ExpectAreas({Polygon(closed)}, square, 1, 1, 0);
+}
+
+NAV_TEST(SnapsNearlyCoincidentVertices) {
+  // Vertices closer than the 1e-7 degree grid snap together, so the operands touch exactly.
+  std::vector<GeoPolygon> a = {Polygon(Rect(0, 0, 1, 1))};
+  std::vector<GeoPolygon> b = {Polygon(Rect(1 + 2e-8, 0, 2, 1))};
+  std::vector<GeoPolygon> united = ClipPolygons(a, b, ClipOperation::kUnion);
+  NAV_EXPECT_EQ(united.size(), size_t{1});
+  NAV_EXPECT_NEAR(Area(united), 2, 1e-6);
+}
+
+NAV_TEST(OperandsTouchingAlongEdge) {
+  std::vector<GeoPolygon> left = {Polygon(Rect(0, 0, 1, 1))};
+  std::vector<GeoPolygon> right = {Polygon(Rect(1, 0, 2, 1))};
+  ExpectAreas(left, right, 2, 0, 1);
+  std::vector<GeoPolygon> united = ClipPolygons(left, right, ClipOperation::kUnion);
+  NAV_EXPECT_EQ(united.size(), size_t{1});
+  NAV_EXPECT_EQ(united[0].outer.size(), size_t{4});
+
+  // A partially shared edge is split where the operands stop sharing it.
+  std::vector<GeoPolygon> shifted = {Polygon(Rect(1, 0.5, 2, 1.5))};
+  ExpectAreas(left, shifted, 2, 0, 1);
+  NAV_EXPECT_EQ(ClipPolygons(left, shifted, ClipOperation::kUnion).size(), size_t{1});
+}
+
+NAV_TEST(OperandsTouchingAtVertex) {
+  std::vector<GeoPolygon> a = {Polygon(Rect(0, 0, 1, 1))};
+  std::vector<GeoPolygon> b = {Polygon(Rect(1, 1, 2, 2))};
+  ExpectAreas(a, b, 2, 0, 1);
+  // Rings meeting at a single vertex stay separate rings.
+  NAV_EXPECT_EQ(ClipPolygons(a, b, ClipOperation::kUnion).size(), size_t{2});
+
+  // A vertex of one operand on an edge of the other.
+  std::vector<GeoPolygon> diamond = {Polygon({{0.5, 1}, {0, 1.5}, {0.5, 2}, {1, 1.5}})};
+  ExpectAreas(a, diamond, 1.5, 0, 1);
+}
+
+NAV_TEST(HoleTouchingOuterRing) {
+  // The hole shares an edge with the outer ring, which leaves a U shape.
+  std::vector<GeoPolygon> u = {Polygon(Rect(0, 0, 3, 3), {Rect(1, 1, 2, 3)})};
+  ExpectAreas(u, {}, 7, 0, 7);
+  std::vector<GeoPolygon> filler = {Polygon(Rect(1, 1, 2, 3))};
+  std::vector<GeoPolygon> united = ClipPolygons(u, filler, ClipOperation::kUnion);
+  NAV_EXPECT_NEAR(Area(united), 9, kAreaTolerance);
+  NAV_EXPECT_EQ(united.size(), size_t{1});
+  NAV_EXPECT_EQ(HoleCount(united), size_t{0});
+}
+
+NAV_TEST(SelfIntersectingRing) {
+  // A bowtie is the even-odd area of its two lobes, of area 1 each.
+  std::vector<GeoPolygon> bowtie = {Polygon({{0, 0}, {2, 2}, {0, 2}, {2, 0}})};
+  std::vector<GeoPolygon> united = ClipPolygons(bowtie, {}, ClipOperation::kUnion);
+  NAV_EXPECT_NEAR(Area(united), 2, kAreaTolerance);
+  NAV_EXPECT_EQ(united.size(), size_t{2});
+  NAV_EXPECT_TRUE(Contains(united, 0.5, 1));
+  NAV_EXPECT_TRUE(!Contains(united, 1, 0.5));
+
+  // Clipping with the left half keeps the left lobe only.
+  std::vector<GeoPolygon> left = {Polygon(Rect(0, 0, 1, 2))};
+  ExpectAreas(bowtie, left, 3, 1, 1);
+}
+
+NAV_TEST(OverlappingRingsOfOneOperand) {
+  // Each operand is the even-odd area of its rings: the overlap of two of its rings is outside.
+  std::vector<GeoPolygon> pair = {Polygon(Rect(0, 0, 2, 2)), Polygon(Rect(1, 1, 3, 3))};
+  std::vector<GeoPolygon> united = ClipPolygons(pair, {}, ClipOperation::kUnion);
+  NAV_EXPECT_NEAR(Area(united), 6, kAreaTolerance);
+  NAV_EXPECT_TRUE(Contains(united, 0.5, 0.5));
+  NAV_EXPECT_TRUE(!Contains(united, 1.5, 1.5));
+  NAV_EXPECT_TRUE(Contains(united, 2.5, 2.5));
+
+  // The same ring twice cancels out, three times leaves it once.
+  std::vector<GeoPolygon> square = {Polygon(Rect(0, 0, 1, 1))};
+  std::vector<GeoPolygon> twice = {square[0], Polygon(Reversed(Rect(0, 0, 1, 1)))};
+  std::vector<GeoPolygon> thrice = {square[0], square[0], square[0]};
+  NAV_EXPECT_TRUE(ClipPolygons(twice, {}, ClipOperation::kUnion).empty());
+  ExpectAreas(thrice, {}, 1, 0, 1);
+
+  // A hole reaching outside its outer ring swaps inside and outside where it does.
+  std::vector<GeoPolygon> overhang = {Polygon(Rect(0, 0, 2, 2), {Rect(1, 0.5, 3, 1.5)})};
+  ExpectAreas(overhang, {}, 4, 0, 4);
+}
+
+NAV_TEST(ResultIsIndependentOfVertexOrder) {
+  std::vector<GeoPoint> ring = {{0, 0}, {0, 3}, {1, 3}, {1, 1}, {2, 1}, {2, 3}, {3, 3}, {3, 0}};
+  std::vector<GeoPolygon> clip = {Polygon(Rect(0.5, 0.5, 2.5, 2))};
+  double expected = Area(ClipPolygons({Polygon(ring)}, clip, ClipOperation::kIntersection));
+  for (size_t shift = 1; shift < ring.size(); shift++) {
+    std::vector<GeoPoint> rotated(ring.begin() + static_cast<long>(shift), ring.end());
+    rotated.insert(rotated.end(), ring.begin(), ring.begin() + static_cast<long>(shift));
+    NAV_EXPECT_NEAR(Area(ClipPolygons({Polygon(rotated)}, clip, ClipOperation::kIntersection)),
+                    expected, kAreaTolerance);
+  }
+}
+
+NAV_TEST(LargeOperandsUseCoarserGrid) {
+  // Operands spanning more than 100 degrees are still clipped consistently.
+  std::vector<GeoPolygon> a = {Polygon(Rect(-170, -60, 10, 60))};
+  std::vector<GeoPolygon> b = {Polygon(Rect(-10, -70, 170, 70))};
+  double intersection = Area(ClipPolygons(a, b, ClipOperation::kIntersection));
+  double unionArea = Area(ClipPolygons(a, b, ClipOperation::kUnion));
+  NAV_EXPECT_NEAR(intersection, 20 * 120, 1e-3);
+  NAV_EXPECT_NEAR(unionArea, 180 * 120 + 180 * 140 - 20 * 120, 1e-3);
+}
+
+int main() { return navsdk::test::RunAllTests(); }
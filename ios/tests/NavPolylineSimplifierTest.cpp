@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks that polyline simplification keeps the end points, keeps vertices in order, and leaves
+// every removed vertex within the tolerance of the simplified line.
+
+#include <cmath>
+#include <random>
+
+#include "NavPolylineSimplifier.h"
+#include "NavTestSupport.h"
+
+using navsdk::GeoPoint;
+using navsdk::SimplifyPolyline;
+
+namespace {
+
+const double kMetersPerDegree = 6371009 * M_PI / 180;
+
+// Distance in meters from `p` to the segment from `a` to `b`, in a projection around `a`.
+double SegmentDistanceMeters(GeoPoint p, GeoPoint a, GeoPoint b) {
+  double xScale = kMetersPerDegree * std::cos(a.lat * M_PI / 180);
+  double bx = std::remainder(b.lng - a.lng, 360.0) * xScale;
+  double by = (b.lat - a.lat) * kMetersPerDegree;
+  double px = std::remainder(p.lng - a.lng, 360.0) * xScale;
+  double py = (p.lat - a.lat) * kMetersPerDegree;
+  double lengthSquared = bx * bx + by * by;
+  double t = lengthSquared > 0 ? std::fmax(0.0, std::fmin(1.0, (px * bx + py * by) / lengthSquared))
+                               : 0;
+  return std::hypot(t * bx - px, t * by - py);
+}
+
+// A random walk of `count` vertices about 10 m apart.
+std::vector<GeoPoint> RandomWalk(std::mt19937 &random, size_t count, GeoPoint start) {
+  std::normal_distribution<double> step(0, 1e-4);
+  std::vector<GeoPoint> points = {start};
+  for (size_t i = 1; i < count; i++) {
+    points.push_back({points.back().lat + step(random), points.back().lng + step(random)});
+  }
+  return points;
+}
+
+}  // namespace
+
+NAV_TEST(RemovedVerticesStayWithinTolerance) {
+  std::mt19937 random(104);
+  for (double tolerance : {1.0, 5.0, 25.0}) {
+    std::vector<GeoPoint> points = RandomWalk(random, 5000, {37.77, -122.42});
+    std::vector<GeoPoint> simplified = SimplifyPolyline(points, tolerance);
+    NAV_EXPECT_TRUE(simplified.size() < points.size());
+    NAV_EXPECT_TRUE(simplified.front().lat == points.front().lat);
+    NAV_EXPECT_TRUE(simplified.back().lat == points.back().lat);
+
+    // Walks the original line along the simplified one, which also checks the order.
+    size_t kept = 0;
+    size_t outside = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+      if (kept < simplified.size() && points[i].lat == simplified[kept].lat &&
+          points[i].lng == simplified[kept].lng) {
+        kept++;
+        continue;
+      }
+      // Slightly above the tolerance to allow for the projection around a different point.
+      double distance = SegmentDistanceMeters(points[i], simplified[kept - 1], simplified[kept]);
+      outside += distance > tolerance * 1.001 ? 1 : 0;
+    }
+    NAV_EXPECT_EQ(kept, simplified.size());
+    NAV_EXPECT_EQ(outside, size_t{0});
+  }
+}
+
+NAV_TEST(StraightLinesCollapseAcrossAntimeridian) {
+  std::vector<GeoPoint> points;
+  for (int i = 0; i <= 100; i++) {
+    double lng = 179.5 + 0.01 * i;
+    points.push_back({-17, lng > 180 ? lng - 360 : lng});
+  }
+  std::vector<GeoPoint> simplified = SimplifyPolyline(points, 1);
+  NAV_EXPECT_EQ(simplified.size(), size_t{2});
+}
+
+NAV_TEST(ShortLinesAndNonPositiveTolerancesAreUnchanged) {
+  std::vector<GeoPoint> line = {{0, 0}, {0, 0.001}};
+  NAV_EXPECT_EQ(SimplifyPolyline(line, 100).size(), size_t{2});
+  NAV_EXPECT_EQ(SimplifyPolyline({}, 100).size(), size_t{0});
+  std::vector<GeoPoint> bent = {{0, 0}, {1e-7, 0.001}, {0, 0.002}};
+  NAV_EXPECT_EQ(SimplifyPolyline(bent, 0).size(), size_t{3});
+  NAV_EXPECT_EQ(SimplifyPolyline(bent, NAN).size(), size_t{3});
+  NAV_EXPECT_EQ(SimplifyPolyline(bent, 1).size(), size_t{2});
+}
+
+int main() { return navsdk::test::RunAllTests(); }
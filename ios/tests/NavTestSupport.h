@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NavTestSupport_h
+#define NavTestSupport_h
+
+// Minimal test registry and assertions for the host tests of the portable C++ cores, so that they
+// build without third-party dependencies. A failed expectation marks the test as failed and the
+// test keeps running.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace navsdk {
+namespace test {
+
+struct TestCase {
+  const char *name;
+  void (*run)();
+};
+
+inline std::vector<TestCase> &Registry() {
+  static std::vector<TestCase> tests;
+  return tests;
+}
+
+inline bool &CurrentTestFailed() {
+  static bool failed = false;
+  return failed;
+}
+
+struct Registration {
+  Registration(const char *name, void (*run)()) { Registry().push_back({name, run}); }
+};
+
+inline void ReportFailure(const char *file, int line, const std::string &message) {
+  std::fprintf(stderr, "%s:%d: %s\n", file, line, message.c_str());
+  CurrentTestFailed() = true;
+}
+
+// Runs every registered test and returns the process exit code.
+inline int RunAllTests() {
+  int failures = 0;
+  for (const TestCase &test : Registry()) {
+    CurrentTestFailed() = false;
+    test.run();
+    std::printf("[%s] %s\n", CurrentTestFailed() ? "FAIL" : " OK ", test.name);
+    failures += CurrentTestFailed() ? 1 : 0;
+  }
+  std::printf("%zu tests, %d failed\n", Registry().size(), failures);
+  return failures == 0 ? 0 : 1;
+}
+
+// Runs `body` `iterations` times and returns the average time per run in microseconds.
+inline double MeasureMicroseconds(int iterations, const std::function<void()> &body) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    body();
+  }
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+}  // namespace test
+}  // namespace navsdk
+
+#define NAV_TEST(name)                                                          \
+  static void name();                                                           \
+  static const navsdk::test::Registration name##Registration(#name, name);      \
+  static void name()
+
+#define NAV_EXPECT_TRUE(condition)                                                  \
+  do {                                                                              \
+    if (!(condition)) {                                                             \
+      navsdk::test::ReportFailure(__FILE__, __LINE__, "expected " #condition);      \
+    }                                                                               \
+  } while (0)
+
+#define NAV_EXPECT_EQ(actual, expected)                                                     \
+  do {                                                                                      \
+    auto actualValue = (actual);                                                            \
+    auto expectedValue = (expected);                                                        \
+    if (!(actualValue == expectedValue)) {                                                  \
+      navsdk::test::ReportFailure(__FILE__, __LINE__,                                       \
+                                  "expected " #actual " == " #expected ", got " +           \
+                                      std::to_string(actualValue) + " and " +               \
+                                      std::to_string(expectedValue));                       \
+    }                                                                                       \
+  } while (0)
+
+#define NAV_EXPECT_NEAR(actual, expected, tolerance)                                        \
+  do {                                                                                      \
+    double actualValue = (actual);                                                          \
+    double expectedValue = (expected);                                                      \
+    if (!(std::fabs(actualValue - expectedValue) <= (tolerance))) {                         \
+      navsdk::test::ReportFailure(__FILE__, __LINE__,                                       \
+                                  "expected " #actual " near " #expected ", got " +         \
+                                      std::to_string(actualValue) + " and " +               \
+                                      std::to_string(expectedValue));                       \
+    }                                                                                       \
+  } while (0)
+
+#endif /* NavTestSupport_h */
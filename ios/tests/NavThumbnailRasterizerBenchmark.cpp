@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of polyline decoding and thumbnail rendering, for typical list-cell sizes and a
+// long route. Pass an iteration count to override the default.
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "NavTestSupport.h"
+#include "NavThumbnailRasterizer.h"
+
+using navsdk::GeoPoint;
+using navsdk::ThumbnailStyle;
+
+namespace {
+
+// A winding route of `count` points, about 40 m apart.
+std::vector<GeoPoint> MakeRoute(size_t count) {
+  std::vector<GeoPoint> route;
+  route.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    double t = static_cast<double>(i);
+    route.push_back({37.7 + t * 0.0003 + 0.002 * std::sin(t / 50),
+                     -122.4 + t * 0.0002 + 0.003 * std::cos(t / 70)});
+  }
+  return route;
+}
+
+// Encodes `points` in the Encoded Polyline Algorithm Format.
+std::string EncodePolyline(const std::vector<GeoPoint> &points) {
+  std::string encoded;
+  long long previousLat = 0;
+  long long previousLng = 0;
+  for (const GeoPoint &point : points) {
+    long long lat = std::llround(point.lat * 1e5);
+    long long lng = std::llround(point.lng * 1e5);
+    for (long long delta : {lat - previousLat, lng - previousLng}) {
+      unsigned long long value = static_cast<unsigned long long>(delta < 0 ? ~(delta << 1)
+                                                                           : delta << 1);
+      while (value >= 0x20) {
+        encoded.push_back(static_cast<char>((0x20 | (value & 0x1f)) + 63));
+        value >>= 5;
+      }
+      encoded.push_back(static_cast<char>(value + 63));
+    }
+    previousLat = lat;
+    previousLng = lng;
+  }
+  return encoded;
+}
+
+void Report(const char *name, double microseconds, double pixels) {
+  if (pixels > 0) {
+    std::printf("%-40s %10.1f us/op %10.1f Mpixel/s\n", name, microseconds,
+                pixels / microseconds);
+  } else {
+    std::printf("%-40s %10.1f us/op\n", name, microseconds);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200;
+  std::vector<GeoPoint> route = MakeRoute(5000);
+  std::vector<GeoPoint> stops;
+  for (size_t i = 0; i < route.size(); i += 250) {
+    stops.push_back(route[i]);
+  }
+  std::string encoded = EncodePolyline(route);
+
+  size_t sink = 0;
+  double decode = navsdk::test::MeasureMicroseconds(
+      iterations, [&] { sink += navsdk::DecodePolyline(encoded).size(); });
+  Report("decode 5000 points", decode, 0);
+
+  for (int size : {96, 256, 512}) {
+    ThumbnailStyle style;
+    style.width = size;
+    style.height = size;
+    style.padding = 8;
+    style.strokeWidth = 4;
+    style.strokeColor = 0xff1a73e8;
+    style.stopRadius = 4;
+    style.stopOutlineWidth = 2;
+    style.stopColor = 0xffea4335;
+    style.stopOutlineColor = 0xffffffff;
+    style.backgroundColor = 0xfff1f3f4;
+    double render = navsdk::test::MeasureMicroseconds(iterations, [&] {
+      sink += navsdk::RenderRouteThumbnail(route, stops, style).size();
+    });
+    std::string name = "render " + std::to_string(size) + "x" + std::to_string(size) +
+                       ", 5000 points, 20 stops";
+    Report(name.c_str(), render, static_cast<double>(size) * size);
+  }
+  return sink == 0 ? 1 : 0;
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Tests of the route thumbnail rasterizer. Rendered thumbnails are compared with the golden
+// images in golden/, stored as PAM files. Run with `<golden dir> --update` to rewrite them after
+// an intended change, and check the new images before committing them.
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "NavTestSupport.h"
+#include "NavThumbnailRasterizer.h"
+
+using navsdk::CoverageRasterizer;
+using navsdk::GeoPoint;
+using navsdk::PixelPoint;
+using navsdk::ThumbnailStyle;
+
+namespace {
+
+std::string gGoldenDir;
+bool gUpdateGolden = false;
+
+// Rounding may differ between compilers and floating-point contraction settings.
+const int kChannelTolerance = 2;
+
+ThumbnailStyle DefaultStyle(int width, int height) {
+  ThumbnailStyle style;
+  style.width = width;
+  style.height = height;
+  style.padding = 6;
+  style.strokeWidth = 3;
+  style.strokeColor = 0xff1a73e8;
+  style.stopRadius = 3;
+  style.stopOutlineWidth = 1.5;
+  style.stopColor = 0xffea4335;
+  style.stopOutlineColor = 0xffffffff;
+  style.backgroundColor = 0xfff1f3f4;
+  return style;
+}
+
+bool WritePam(const std::string &path, int width, int height, const std::vector<uint8_t> &rgba) {
+  std::ofstream file(path, std::ios::binary);
+  file << "P7\nWIDTH " << width << "\nHEIGHT " << height
+       << "\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n";
+  file.write(reinterpret_cast<const char *>(rgba.data()),
+             static_cast<std::streamsize>(rgba.size()));
+  return static_cast<bool>(file);
+}
+
+bool ReadPam(const std::string &path, int *width, int *height, std::vector<uint8_t> *rgba) {
+  std::ifstream file(path, std::ios::binary);
+  std::string line;
+  if (!std::getline(file, line) || line != "P7") {
+    return false;
+  }
+  *width = 0;
+  *height = 0;
+  while (std::getline(file, line) && line != "ENDHDR") {
+    std::istringstream fields(line);
+    std::string key;
+    fields >> key;
+    if (key == "WIDTH") {
+      fields >> *width;
+    } else if (key == "HEIGHT") {
+      fields >> *height;
+    }
+  }
+  if (*width <= 0 || *height <= 0) {
+    return false;
+  }
+  rgba->resize(static_cast<size_t>(*width) * static_cast<size_t>(*height) * 4);
+  file.read(reinterpret_cast<char *>(rgba->data()), static_cast<std::streamsize>(rgba->size()));
+  return static_cast<bool>(file);
+}
+
+// Compares a rendered thumbnail with golden/<name>.pam. On a mismatch the rendering is written
+// next to the test binary as <name>.actual.pam.
+void ExpectMatchesGolden(const std::string &name, const ThumbnailStyle &style,
+                         const std::vector<uint8_t> &rgba) {
+  std::string goldenPath = gGoldenDir + "/" + name + ".pam";
+  if (gUpdateGolden) {
+    NAV_EXPECT_TRUE(WritePam(goldenPath, style.width, style.height, rgba));
+    return;
+  }
+  int width;
+  int height;
+  std::vector<uint8_t> golden;
+  if (!ReadPam(goldenPath, &width, &height, &golden)) {
+    navsdk::test::ReportFailure(__FILE__, __LINE__, "cannot read " + goldenPath);
+    return;
+  }
+  NAV_EXPECT_EQ(width, style.width);
+  NAV_EXPECT_EQ(height, style.height);
+  if (golden.size() != rgba.size()) {
+    return;
+  }
+  size_t mismatched = 0;
+  int maxDifference = 0;
+  for (size_t i = 0; i < rgba.size(); i++) {
+    int difference = std::abs(static_cast<int>(rgba[i]) - static_cast<int>(golden[i]));
+    maxDifference = std::max(maxDifference, difference);
+    mismatched += difference > kChannelTolerance ? 1 : 0;
+  }
+  if (mismatched > 0) {
+    WritePam(name + ".actual.pam", style.width, style.height, rgba);
+    navsdk::test::ReportFailure(__FILE__, __LINE__,
+                                name + ": " + std::to_string(mismatched) +
+                                    " channels differ from the golden image, by up to " +
+                                    std::to_string(maxDifference));
+  }
+}
+
+// Alpha of pixel (x, y) after compositing opaque black with the rasterizer's coverage.
+std::vector<uint8_t> CoverageAlpha(const CoverageRasterizer &rasterizer, int width, int height) {
+  std::vector<uint8_t> rgba(static_cast<size_t>(width) * static_cast<size_t>(height) * 4, 0);
+  rasterizer.Composite(0xff000000, rgba.data());
+  std::vector<uint8_t> alpha(static_cast<size_t>(width) * static_cast<size_t>(height));
+  for (size_t i = 0; i < alpha.size(); i++) {
+    alpha[i] = rgba[i * 4 + 3];
+  }
+  return alpha;
+}
+
+}  // namespace
+
+NAV_TEST(DecodesReferencePolyline) {
+  std::vector<GeoPoint> points = navsdk::DecodePolyline("_p~iF~ps|U_ulLnnqC_mqNvxq`@");
+  NAV_EXPECT_EQ(points.size(), size_t{3});
+  if (points.size() == 3) {
+    NAV_EXPECT_NEAR(points[0].lat, 38.5, 1e-9);
+    NAV_EXPECT_NEAR(points[0].lng, -120.2, 1e-9);
+    NAV_EXPECT_NEAR(points[1].lat, 40.7, 1e-9);
+    NAV_EXPECT_NEAR(points[1].lng, -120.95, 1e-9);
+    NAV_EXPECT_NEAR(points[2].lat, 43.252, 1e-9);
+    NAV_EXPECT_NEAR(points[2].lng, -126.453, 1e-9);
+  }
+}
+
+NAV_TEST(StopsDecodingAtMalformedValue) {
+  NAV_EXPECT_EQ(navsdk::DecodePolyline("").size(), size_t{0});
+  // A character below '?' is not part of the format.
+  NAV_EXPECT_EQ(navsdk::DecodePolyline("_p~iF~ps|U_ulLnnqC !").size(), size_t{2});
+  // A truncated coordinate pair is dropped.
+  NAV_EXPECT_EQ(navsdk::DecodePolyline("_p~iF~ps|U_ulL").size(), size_t{1});
+  // So is a value whose continuation bit never ends.
+  NAV_EXPECT_EQ(navsdk::DecodePolyline("_p~iF~ps|U~~~~~~~~~~~~~~~").size(), size_t{1});
+}
+
+NAV_TEST(CoversAxisAlignedSquareExactly) {
+  CoverageRasterizer rasterizer(4, 4);
+  PixelPoint square[] = {{1, 1}, {3, 1}, {3, 3}, {1, 3}};
+  rasterizer.AddPolygon(square, 4);
+  std::vector<uint8_t> alpha = CoverageAlpha(rasterizer, 4, 4);
+  for (int y = 0; y < 4; y++) {
+    for (int x = 0; x < 4; x++) {
+      bool inside = x >= 1 && x < 3 && y >= 1 && y < 3;
+      NAV_EXPECT_EQ(static_cast<int>(alpha[static_cast<size_t>(y * 4 + x)]), inside ? 255 : 0);
+    }
+  }
+}
+
+NAV_TEST(CoversPartialPixelsByArea) {
+  CoverageRasterizer rasterizer(2, 1);
+  // Half of pixel 0 and a quarter of pixel 1, in opposite orientation.
+  PixelPoint rectangle[] = {{0.5, 0}, {0.5, 1}, {1.25, 1}, {1.25, 0}};
+  rasterizer.AddPolygon(rectangle, 4);
+  std::vector<uint8_t> alpha = CoverageAlpha(rasterizer, 2, 1);
+  NAV_EXPECT_EQ(static_cast<int>(alpha[0]), 128);
+  NAV_EXPECT_EQ(static_cast<int>(alpha[1]), 64);
+
+  // A diagonal edge covers half of each pixel it crosses.
+  rasterizer = CoverageRasterizer(2, 2);
+  PixelPoint triangle[] = {{0, 0}, {2, 2}, {0, 2}};
+  rasterizer.AddPolygon(triangle, 3);
+  alpha = CoverageAlpha(rasterizer, 2, 2);
+  NAV_EXPECT_EQ(static_cast<int>(alpha[0]), 128);
+  NAV_EXPECT_EQ(static_cast<int>(alpha[1]), 0);
+  NAV_EXPECT_EQ(static_cast<int>(alpha[2]), 255);
+  NAV_EXPECT_EQ(static_cast<int>(alpha[3]), 128);
+}
+
+NAV_TEST(DrawsOverlappingShapesAsUnion) {
+  CoverageRasterizer rasterizer(4, 1);
+  PixelPoint clockwise[] = {{0, 0}, {3, 0}, {3, 1}, {0, 1}};
+  PixelPoint counterClockwise[] = {{1, 0}, {1, 1}, {4, 1}, {4, 0}};
+  rasterizer.AddPolygon(clockwise, 4);
+  rasterizer.AddPolygon(counterClockwise, 4);
+  std::vector<uint8_t> alpha = CoverageAlpha(rasterizer, 4, 1);
+  for (uint8_t value : alpha) {
+    NAV_EXPECT_EQ(static_cast<int>(value), 255);
+  }
+}
+
+NAV_TEST(ClipsShapesToImage) {
+  CoverageRasterizer rasterizer(3, 3);
+  // Extends past every border; the covered part must be filled and nothing may leak.
+  PixelPoint square[] = {{-5, -5}, {8, -5}, {8, 2}, {-5, 2}};
+  rasterizer.AddPolygon(square, 4);
+  std::vector<uint8_t> alpha = CoverageAlpha(rasterizer, 3, 3);
+  for (int y = 0; y < 3; y++) {
+    for (int x = 0; x < 3; x++) {
+      NAV_EXPECT_EQ(static_cast<int>(alpha[static_cast<size_t>(y * 3 + x)]), y < 2 ? 255 : 0);
+    }
+  }
+}
+
+NAV_TEST(RendersAcrossAntimeridianLikeContinuousRoute) {
+  ThumbnailStyle style = DefaultStyle(48, 32);
+  std::vector<GeoPoint> wrapped = {{-16.5, 178.5}, {-17.5, -179.2}, {-18.5, -178.0}};
+  std::vector<GeoPoint> continuous = {{-16.5, 178.5}, {-17.5, 180.8}, {-18.5, 182.0}};
+  std::vector<uint8_t> a = navsdk::RenderRouteThumbnail(wrapped, {wrapped.back()}, style);
+  std::vector<uint8_t> b = navsdk::RenderRouteThumbnail(continuous, {continuous.back()}, style);
+  size_t mismatched = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    mismatched += std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i])) > 1 ? 1 : 0;
+  }
+  NAV_EXPECT_EQ(mismatched, size_t{0});
+}
+
+NAV_TEST(GoldenRouteWithStops) {
+  ThumbnailStyle style = DefaultStyle(64, 48);
+  std::vector<GeoPoint> path =
+      navsdk::DecodePolyline("_p~iF~ps|U_ulLnnqC_mqNvxq`@");
+  ExpectMatchesGolden("route_with_stops", style,
+                      navsdk::RenderRouteThumbnail(path, {path.front(), path.back()}, style));
+}
+
+NAV_TEST(GoldenThickZigzag) {
+  ThumbnailStyle style = DefaultStyle(64, 64);
+  style.strokeWidth = 7;
+  style.strokeColor = 0xc0188038;
+  std::vector<GeoPoint> path;
+  for (int i = 0; i < 7; i++) {
+    path.push_back({37.0 + 0.01 * i, -122.0 + (i % 2 == 0 ? 0 : 0.012)});
+  }
+  ExpectMatchesGolden("thick_zigzag", style, navsdk::RenderRouteThumbnail(path, {}, style));
+}
+
+NAV_TEST(GoldenSinglePoint) {
+  // A one-point route is drawn as a dot centered in the image.
+  ThumbnailStyle style = DefaultStyle(32, 32);
+  std::vector<GeoPoint> path = {{51.5, -0.12}};
+  ExpectMatchesGolden("single_point", style, navsdk::RenderRouteThumbnail(path, path, style));
+}
+
+NAV_TEST(GoldenTransparentBackground) {
+  ThumbnailStyle style = DefaultStyle(40, 24);
+  style.backgroundColor = 0;
+  std::vector<GeoPoint> path = {{48.85, 2.29}, {48.86, 2.33}, {48.853, 2.35}};
+  ExpectMatchesGolden("transparent_background", style,
+                      navsdk::RenderRouteThumbnail(path, {path[1]}, style));
+}
+
+int main(int argc, char **argv) {
+  gGoldenDir = argc > 1 ? argv[1] : "golden";
+  gUpdateGolden = argc > 2 && std::strcmp(argv[2], "--update") == 0;
+  return navsdk::test::RunAllTests();
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the time-window schedule of simple sequences, and that the schedule kept up to date
+// through random edits equals the one of a fresh evaluator of the same stops.
+
+#include <cmath>
+#include <random>
+
+#include "NavTestSupport.h"
+#include "NavTimeWindowEvaluator.h"
+
+using navsdk::GeoPoint;
+using navsdk::RouteLegTime;
+using navsdk::StopSchedule;
+using navsdk::TimeWindowEvaluator;
+using navsdk::TimeWindowOptions;
+using navsdk::TimeWindowStop;
+
+namespace {
+
+const GeoPoint kOrigin{37.77, -122.42};
+const double kDeparture = 1.8e9;
+
+// Route legs through the first `count` of `stops`, with a leg of unknown time every fifth leg.
+std::vector<RouteLegTime> MakeLegs(const std::vector<TimeWindowStop> &stops, size_t count) {
+  std::vector<RouteLegTime> legs;
+  for (size_t i = 0; i < count && i < stops.size(); i++) {
+    legs.push_back({stops[i].position, i % 5 == 4 ? NAN : 300 + 10.0 * static_cast<double>(i)});
+  }
+  return legs;
+}
+
+TimeWindowStop RandomStop(std::mt19937 &random) {
+  std::uniform_real_distribution<double> offset(-0.05, 0.05);
+  std::uniform_real_distribution<double> start(0, 4 * 3600);
+  std::uniform_real_distribution<double> width(600, 7200);
+  std::uniform_int_distribution<int> kind(0, 3);
+  TimeWindowStop stop;
+  stop.position = {kOrigin.lat + offset(random), kOrigin.lng + offset(random)};
+  stop.serviceSeconds = 60 + start(random) / 60;
+  switch (kind(random)) {
+    case 0:
+      break;
+    case 1:
+      stop.windowStart = kDeparture + start(random);
+      break;
+    default:
+      stop.windowStart = kDeparture + start(random);
+      stop.windowEnd = stop.windowStart + width(random);
+      break;
+  }
+  return stop;
+}
+
+bool SameSchedule(const StopSchedule &a, const StopSchedule &b) {
+  return a.arrival == b.arrival && a.wait == b.wait && a.slack == b.slack && a.routed == b.routed;
+}
+
+}  // namespace
+
+NAV_TEST(WaitsForWindowsAndReportsSlack) {
+  TimeWindowOptions options;
+  TimeWindowEvaluator evaluator(options);
+  evaluator.SetOrigin(kOrigin, kDeparture);
+  TimeWindowStop early{{37.78, -122.42}, kDeparture + 3600, kDeparture + 7200, 300};
+  TimeWindowStop late{{37.79, -122.42}, -INFINITY, kDeparture + 60, 0};
+  evaluator.SetStops({early, late});
+  evaluator.SetRouteLegs({{early.position, 600}});
+  NAV_EXPECT_EQ(evaluator.Evaluate(), size_t{0});
+
+  const std::vector<StopSchedule> &schedules = evaluator.schedules();
+  NAV_EXPECT_TRUE(schedules[0].routed);
+  NAV_EXPECT_NEAR(schedules[0].arrival, kDeparture + 600, 1e-6);
+  NAV_EXPECT_NEAR(schedules[0].wait, 3000, 1e-6);
+  NAV_EXPECT_NEAR(schedules[0].slack, 3600, 1e-6);
+  // About 1.1 km estimated at 11 m/s with a 1.3 detour factor after 300 s of service.
+  NAV_EXPECT_TRUE(!schedules[1].routed);
+  NAV_EXPECT_NEAR(schedules[1].arrival, kDeparture + 3600 + 300 + 1111.95 * 1.3 / 11, 0.5);
+  NAV_EXPECT_NEAR(schedules[1].wait, 0, 0);
+  NAV_EXPECT_TRUE(schedules[1].slack < 0);
+  NAV_EXPECT_EQ(evaluator.Evaluate(), size_t{2});
+}
+
+NAV_TEST(SetOriginRestartsTheSequence) {
+  TimeWindowOptions options;
+  TimeWindowEvaluator evaluator(options);
+  evaluator.SetOrigin(kOrigin, kDeparture);
+  evaluator.SetStops({{{37.78, -122.42}, -INFINITY, INFINITY, 0}});
+  evaluator.Evaluate();
+  double before = evaluator.schedules()[0].arrival;
+
+  GeoPoint snapped{37.775, -122.42};
+  evaluator.SetOrigin(snapped, kDeparture + 120);
+  NAV_EXPECT_EQ(evaluator.Evaluate(), size_t{0});
+  NAV_EXPECT_NEAR(evaluator.origin().lat, snapped.lat, 0);
+  NAV_EXPECT_NEAR(evaluator.schedules()[0].arrival, before + 120 - 555.97 * 1.3 / 11, 0.5);
+}
+
+NAV_TEST(IncrementalScheduleMatchesFreshEvaluation) {
+  std::mt19937 random(125);
+  TimeWindowOptions options;
+  TimeWindowEvaluator evaluator(options);
+  std::vector<TimeWindowStop> stops;
+  for (int i = 0; i < 40; i++) {
+    stops.push_back(RandomStop(random));
+  }
+  // The route covers the leading stops, so that edits move stops on and off it.
+  std::vector<RouteLegTime> legs = MakeLegs(stops, 20);
+  evaluator.SetOrigin(kOrigin, kDeparture);
+  evaluator.SetStops(stops);
+  evaluator.SetRouteLegs(legs);
+  evaluator.Evaluate();
+
+  size_t mismatches = 0;
+  size_t partial = 0;
+  for (int edit = 0; edit < 2000; edit++) {
+    std::uniform_int_distribution<size_t> any(0, stops.size() - 1);
+    size_t index = any(random);
+    size_t expectedFirst = index;
+    switch (std::uniform_int_distribution<int>(0, 5)(random)) {
+      case 0: {
+        TimeWindowStop stop = RandomStop(random);
+        stops[index] = stop;
+        evaluator.ReplaceStop(index, stop);
+        break;
+      }
+      case 1: {
+        // Reuses a route leg destination, so that the stop may join the route.
+        TimeWindowStop stop = RandomStop(random);
+        stop.position = legs[index % legs.size()].destination;
+        index = std::uniform_int_distribution<size_t>(0, stops.size())(random);
+        expectedFirst = index;
+        stops.insert(stops.begin() + static_cast<std::ptrdiff_t>(index), stop);
+        evaluator.InsertStop(index, stop);
+        break;
+      }
+      case 2:
+        // Keeps enough stops for the edits to land at varied depths.
+        if (stops.size() > 10) {
+          stops.erase(stops.begin() + static_cast<std::ptrdiff_t>(index));
+          evaluator.RemoveStop(index);
+        } else {
+          expectedFirst = stops.size();
+        }
+        break;
+      case 3: {
+        size_t to = any(random);
+        TimeWindowStop stop = stops[index];
+        stops.erase(stops.begin() + static_cast<std::ptrdiff_t>(index));
+        stops.insert(stops.begin() + static_cast<std::ptrdiff_t>(to), stop);
+        evaluator.MoveStop(index, to);
+        expectedFirst = index == to ? stops.size() : std::min(index, to);
+        break;
+      }
+      case 4: {
+        // Several edits between evaluations recompute from the earliest one.
+        size_t other = any(random);
+        stops[index].serviceSeconds += 30;
+        stops[other].windowEnd -= 30;
+        evaluator.ReplaceStop(index, stops[index]);
+        evaluator.ReplaceStop(other, stops[other]);
+        expectedFirst = std::min(index, other);
+        break;
+      }
+      default:
+        evaluator.ReplaceStop(index, stops[index]);
+        break;
+    }
+    if (expectedFirst > stops.size()) {
+      expectedFirst = stops.size();
+    }
+    size_t first = evaluator.Evaluate();
+    mismatches += first != expectedFirst ? 1 : 0;
+    partial += first > 0 ? 1 : 0;
+
+    TimeWindowEvaluator fresh(options);
+    fresh.SetOrigin(kOrigin, kDeparture);
+    fresh.SetStops(stops);
+    fresh.SetRouteLegs(legs);
+    fresh.Evaluate();
+    NAV_EXPECT_EQ(evaluator.stop_count(), stops.size());
+    for (size_t i = 0; i < stops.size(); i++) {
+      mismatches += SameSchedule(evaluator.schedules()[i], fresh.schedules()[i]) ? 0 : 1;
+    }
+  }
+  NAV_EXPECT_EQ(mismatches, size_t{0});
+  // Most edits must reuse a prefix of the schedule, or the check says little about reuse.
+  NAV_EXPECT_TRUE(partial > 1000);
+}
+
+int main() { return navsdk::test::RunAllTests(); }
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the zone index against a brute-force even-odd test of every zone, on random zones with
+// holes, on zones given across the antimeridian, and on edge cases of the input.
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "NavTestSupport.h"
+#include "NavZoneIndex.h"
+
+using navsdk::GeoPoint;
+using navsdk::GeoPolygon;
+using navsdk::ZoneIndex;
+
+namespace {
+
+// Same crossing test as the index, edge by edge, so that results match exactly.
+bool RingContains(const std::vector<GeoPoint> &ring, double x, double y) {
+  bool inside = false;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    if (ring[j].lat == ring[i].lat || (ring[j].lat > y) == (ring[i].lat > y)) {
+      continue;
+    }
+    double slope = (ring[i].lng - ring[j].lng) / (ring[i].lat - ring[j].lat);
+    if (x < ring[j].lng + (y - ring[j].lat) * slope) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+int32_t BruteForceClassify(const std::vector<GeoPolygon> &zones, GeoPoint point) {
+  for (size_t i = 0; i < zones.size(); i++) {
+    const GeoPolygon &zone = zones[i];
+    if (zone.outer.size() < 3) {
+      continue;
+    }
+    bool inside = RingContains(zone.outer, point.lng, point.lat);
+    for (const std::vector<GeoPoint> &hole : zone.holes) {
+      if (hole.size() >= 3 && RingContains(hole, point.lng, point.lat)) {
+        inside = !inside;
+      }
+    }
+    if (inside) {
+      return static_cast<int32_t>(i);
+    }
+  }
+  return -1;
+}
+
+// A star-shaped ring of `count` vertices with radii between `minRadius` and `maxRadius` degrees.
+std::vector<GeoPoint> RandomRing(std::mt19937 &random, GeoPoint center, size_t count,
+                                 double minRadius, double maxRadius) {
+  std::uniform_real_distribution<double> radius(minRadius, maxRadius);
+  std::vector<GeoPoint> ring;
+  ring.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(count);
+    double r = radius(random);
+    ring.push_back({center.lat + r * std::sin(angle), center.lng + r * std::cos(angle)});
+  }
+  return ring;
+}
+
+// Classifies `count` random points in the given bounds with the index, one at a time and in a
+// batch, and expects the brute-force result.
+void ExpectMatchesBruteForce(const std::vector<GeoPolygon> &zones, std::mt19937 &random,
+                             size_t count, double minLat, double minLng, double maxLat,
+                             double maxLng) {
+  ZoneIndex index(zones);
+  std::uniform_real_distribution<double> lat(minLat, maxLat);
+  std::uniform_real_distribution<double> lng(minLng, maxLng);
+  std::vector<double> latLngs;
+  latLngs.reserve(2 * count);
+  for (size_t i = 0; i < count; i++) {
+    latLngs.push_back(lat(random));
+    latLngs.push_back(lng(random));
+  }
+  std::vector<int32_t> batch(count);
+  index.ClassifyRange(latLngs.data(), 0, count, batch.data());
+
+  size_t mismatches = 0;
+  size_t inside = 0;
+  for (size_t i = 0; i < count; i++) {
+    GeoPoint point{latLngs[2 * i], latLngs[2 * i + 1]};
+    int32_t expected = BruteForceClassify(zones, point);
+    mismatches += index.Classify(point) != expected || batch[i] != expected ? 1 : 0;
+    inside += expected >= 0 ? 1 : 0;
+  }
+  NAV_EXPECT_EQ(mismatches, size_t{0});
+  // Guards against a setup where every point trivially falls outside.
+  NAV_EXPECT_TRUE(inside > count / 10);
+}
+
+}  // namespace
+
+NAV_TEST(MatchesBruteForceOnRandomZonesWithHoles) {
+  std::mt19937 random(124);
+  std::uniform_real_distribution<double> coordinate(-1, 1);
+  std::vector<GeoPolygon> zones;
+  for (int i = 0; i < 200; i++) {
+    GeoPoint center{37.7 + coordinate(random), -122.4 + coordinate(random)};
+    GeoPolygon zone;
+    zone.outer = RandomRing(random, center, 300, 0.05, 0.2);
+    if (i % 2 == 0) {
+      zone.holes.push_back(RandomRing(random, center, 40, 0.01, 0.04));
+    }
+    zones.push_back(std::move(zone));
+  }
+  ExpectMatchesBruteForce(zones, random, 20000, 36.5, -123.6, 38.9, -121.2);
+}
+
+NAV_TEST(FirstOverlappingZoneWins) {
+  GeoPolygon large{{{0, 0}, {0, 4}, {4, 4}, {4, 0}}, {}};
+  GeoPolygon small{{{1, 1}, {1, 2}, {2, 2}, {2, 1}}, {}};
+  NAV_EXPECT_EQ(ZoneIndex({large, small}).Classify({1.5, 1.5}), 0);
+  NAV_EXPECT_EQ(ZoneIndex({small, large}).Classify({1.5, 1.5}), 0);
+  NAV_EXPECT_EQ(ZoneIndex({small, large}).Classify({3, 3}), 1);
+}
+
+NAV_TEST(HolesExcludePoints) {
+  GeoPolygon framed{{{0, 0}, {0, 4}, {4, 4}, {4, 0}}, {{{1, 1}, {1, 3}, {3, 3}, {3, 1}}}};
+  ZoneIndex index({framed});
+  NAV_EXPECT_EQ(index.Classify({0.5, 0.5}), 0);
+  NAV_EXPECT_EQ(index.Classify({2, 2}), -1);
+  // A zone inside the hole of an earlier one is found.
+  GeoPolygon island{{{1.5, 1.5}, {1.5, 2.5}, {2.5, 2.5}, {2.5, 1.5}}, {}};
+  NAV_EXPECT_EQ(ZoneIndex({framed, island}).Classify({2, 2}), 1);
+}
+
+NAV_TEST(MatchesBruteForceAcrossAntimeridian) {
+  // Zones given with longitudes beyond 180 and zones given with wrapped longitudes are both
+  // classified as planar polygons in the coordinates they are given in, like the brute force.
+  std::mt19937 random(180);
+  std::vector<GeoPolygon> zones;
+  for (int i = 0; i < 40; i++) {
+    GeoPoint center{-17 + 0.5 * (i % 8), 176 + 1.0 * (i / 8)};
+    GeoPolygon zone;
+    zone.outer = RandomRing(random, center, 120, 0.3, 1.2);
+    zone.holes.push_back(RandomRing(random, center, 16, 0.05, 0.2));
+    if (i % 2 == 1) {
+      for (std::vector<GeoPoint> *ring : {&zone.outer, &zone.holes[0]}) {
+        for (GeoPoint &point : *ring) {
+          point.lng = std::remainder(point.lng, 360.0);
+        }
+      }
+    }
+    zones.push_back(std::move(zone));
+  }
+  ExpectMatchesBruteForce(zones, random, 10000, -19, 174, -12, 182);
+  ExpectMatchesBruteForce(zones, random, 10000, -19, -180, -12, 180);
+}
+
+NAV_TEST(DegenerateInput) {
+  NAV_EXPECT_EQ(ZoneIndex({}).Classify({0, 0}), -1);
+  GeoPolygon square{{{0, 0}, {0, 1}, {1, 1}, {1, 0}}, {}};
+  GeoPolygon line{{{0, 0}, {1, 1}}, {}};
+  GeoPolygon flat{{{0.5, 0}, {0.5, 1}, {0.5, 2}}, {}};
+  ZoneIndex index({line, flat, {}, square});
+  NAV_EXPECT_EQ(index.Classify({0.5, 0.5}), 3);
+  NAV_EXPECT_EQ(index.Classify({NAN, 0.5}), -1);
+  NAV_EXPECT_EQ(index.Classify({0.5, NAN}), -1);
+  NAV_EXPECT_EQ(index.Classify({5, 5}), -1);
+}
+
+int main() { return navsdk::test::RunAllTests(); }
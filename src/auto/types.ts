@@ -47,7 +47,31 @@ export interface CustomNavigationAutoEvent {
   data?: Record<string, unknown>;
 }
 
-export interface MapViewAutoController extends MapViewController {
+/**
+ * MapViewController methods that are only available on map views rendered in
+ * the React Native hierarchy.
+ */
+type MapViewOnlyMethods =
+  | 'setQualityGovernorConfig'
+  | 'addQualityAdjustedListener'
+  | 'setRenderStatsConfig'
+  | 'getRenderStats'
+  | 'getLayoutFrameCallbackCount'
+  | 'addRenderStatsListener'
+  | 'projectToScreen'
+  | 'screenToCoordinates'
+  | 'watchProjection'
+  | 'watchViewport'
+  | 'setMarkerStyle'
+  | 'setMarkerAttribute'
+  | 'setMarkerDeclutter'
+  | 'selectMarkersWhere'
+  | 'updateMarkersWhere'
+  | 'loadTripPlayback'
+  | 'startRoutePrefetch';
+
+export interface MapViewAutoController
+  extends Omit<MapViewController, MapViewOnlyMethods> {
   /**
    * Cleans up the navigation module, releasing any resources that were allocated.
    */
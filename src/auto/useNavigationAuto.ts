@@ -33,6 +33,8 @@ import type {
   PolygonOptions,
   Polygon,
   CameraPosition,
+  FitCameraOptions,
+  OverlaySelection,
   UISettings,
   Padding,
   GroundOverlay,
@@ -42,6 +44,7 @@ import type {
   MapColorScheme,
 } from '../maps';
 import type { NavigationNightMode } from '../navigation';
+import { toFitCameraOptionsSpec } from '../maps/mapView/fitCameraOptions';
 import { useMemo, useCallback, useRef } from 'react';
 
 const { NavAutoModule } = NativeModules;
@@ -364,6 +367,15 @@ export const useNavigationAuto = (): UseNavigationAutoResult => {
         return NavAutoModule.moveCamera(cameraPosition);
       },
 
+      fitCameraToOverlays: (
+        selection: OverlaySelection,
+        options?: FitCameraOptions
+      ) => {
+        return NavAutoModule.fitCameraToOverlays(
+          toFitCameraOptionsSpec(selection, options)
+        );
+      },
+
       setPadding: (padding: Padding) => {
         const { top = 0, left = 0, bottom = 0, right = 0 } = padding;
         return NavAutoModule.setMapPadding(top, left, bottom, right);
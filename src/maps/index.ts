@@ -15,4 +15,7 @@
  */
 
 export * from './mapView';
+export * from './mapAnchor';
+export * from './routeThumbnail';
+export * from './polygonOperations';
 export * from './types';
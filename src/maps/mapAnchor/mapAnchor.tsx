@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import React from 'react';
+import { StyleSheet } from 'react-native';
+import NavAnchorView from '../../native/NativeNavAnchorViewComponent';
+import type { MapAnchorProps } from './types';
+
+/**
+ * A React Native view pinned to a map coordinate. Render it as a child of
+ * `MapView` or `NavigationView`.
+ *
+ * The view is positioned natively from the map projection on every camera
+ * frame, so it tracks pans and camera animations without any JS work, and it
+ * is hidden while its coordinate is off-screen.
+ */
+export const MapAnchor = (props: MapAnchorProps): React.JSX.Element => {
+  return (
+    <NavAnchorView
+      style={[props.style, styles.anchor]}
+      latitude={props.coordinate.lat}
+      longitude={props.coordinate.lng}
+      anchorX={props.anchor?.x ?? 0.5}
+      anchorY={props.anchor?.y ?? 1.0}
+      collapsable={false}
+    >
+      {props.children}
+    </NavAnchorView>
+  );
+};
+
+const styles = StyleSheet.create({
+  anchor: {
+    position: 'absolute',
+    left: 0,
+    top: 0,
+  },
+});
+
+export default MapAnchor;
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { ReactNode } from 'react';
+import type { StyleProp, ViewStyle } from 'react-native';
+import type { LatLng } from '../../shared/types';
+
+/**
+ * Defines the point of an anchored view that is placed on its coordinate,
+ * as fractions of the view's width and height.
+ */
+export interface MapAnchorPoint {
+  /** 0 is the left edge, 1 the right edge. Defaults to 0.5. */
+  x: number;
+  /** 0 is the top edge, 1 the bottom edge. Defaults to 1. */
+  y: number;
+}
+
+/**
+ * Props for `MapAnchor`, a React Native view pinned to a map coordinate.
+ */
+export interface MapAnchorProps {
+  /** The map coordinate the view is pinned to. */
+  coordinate: LatLng;
+
+  /**
+   * The point of the view placed on `coordinate`. Defaults to the bottom
+   * center, which suits callouts and pins.
+   */
+  anchor?: MapAnchorPoint;
+
+  /**
+   * Style of the anchored view. Position is managed natively, so `top`,
+   * `left` and `transform` are ignored.
+   */
+  style?: StyleProp<ViewStyle>;
+
+  children?: ReactNode;
+}
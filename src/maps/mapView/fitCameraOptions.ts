@@ -0,0 +1,41 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { FitCameraOptions, OverlaySelection } from './types';
+
+/**
+ * Flattens a selection and fit options into the options object of the
+ * native `fitCameraToOverlays` methods.
+ */
+export const toFitCameraOptionsSpec = (
+  selection: OverlaySelection,
+  options: FitCameraOptions = {}
+) => {
+  const { top = 0, left = 0, bottom = 0, right = 0 } = options.padding ?? {};
+  return {
+    ids:
+      typeof selection === 'object' && 'ids' in selection
+        ? selection.ids
+        : null,
+    group:
+      typeof selection === 'object' && 'group' in selection
+        ? selection.group
+        : null,
+    padding: { top, left, bottom, right },
+    maxZoom: options.maxZoom ?? null,
+    bearing: options.bearing ?? null,
+  };
+};
@@ -118,7 +118,9 @@ export const MapView = (props: MapViewProps): React.JSX.Element => {
       onCircleClick={onCircleClick}
       onGroundOverlayClick={onGroundOverlayClick}
       onMarkerInfoWindowTapped={onMarkerInfoWindowTapped}
-    />
+    >
+      {props.children}
+    </NavView>
   );
 };
 
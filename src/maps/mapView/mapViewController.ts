@@ -16,7 +16,7 @@
 
 import NavViewModule from '../../native/NativeNavViewModule';
 import { processColorValue, colorIntToRGBA } from '../../shared';
-import type { Location } from '../../shared/types';
+import type { LatLng, Location } from '../../shared/types';
 import type {
   CameraPosition,
   Circle,
@@ -26,17 +26,50 @@ import type {
   Polyline,
   UISettings,
 } from '../types';
+import { packPoints } from '../polygonOperations/classifyPoints';
+import { packPolygons } from '../polygonOperations/polygonOperations';
+import type {
+  PolygonGeometry,
+  PolygonOperation,
+} from '../polygonOperations/types';
+import { toFitCameraOptionsSpec } from './fitCameraOptions';
 import type {
   CircleOptions,
+  FitCameraOptions,
   GroundOverlayBoundsOptions,
   GroundOverlayOptions,
   GroundOverlayPositionOptions,
   MapViewController,
+  MarkerDeclutterOptions,
   MarkerOptions,
+  MarkerPatch,
+  MarkerStyle,
+  OverlayAttributeValue,
+  OverlaySelection,
   PolygonOptions,
   PolylineOptions,
+  QualityAdjustment,
+  QualityGovernorConfig,
+  RenderStats,
+  RenderStatsConfig,
+  RoutePrefetch,
+  RoutePrefetchOptions,
+  StyleExpression,
+  TripPlayback,
+  TripPlaybackOptions,
+  TripTrace,
 } from './types';
 
+const defaultQualityGovernorConfig = {
+  targetFrameRate: 0,
+  evaluationIntervalMs: 1000,
+  polylineTolerance: { min: 0, max: 10 },
+  clusterRadius: { min: 40, max: 120 },
+  eventRate: { min: 5, max: 30 },
+  animationFrameRate: { min: 30, max: 60 },
+  virtualizationMargin: { min: 0, max: 0.5 },
+};
+
 /**
  * Creates a MapViewController for a specific view instance.
  *
@@ -68,7 +101,12 @@ export const getMapViewController = (nativeID: string): MapViewController => {
     },
 
     addMarker: async (markerOptions: MarkerOptions): Promise<Marker> => {
-      return await NavViewModule.addMarker(nativeID, markerOptions);
+      return await NavViewModule.addMarker(nativeID, {
+        ...markerOptions,
+        attributes: markerOptions.attributes
+          ? JSON.stringify(markerOptions.attributes)
+          : undefined,
+      });
     },
 
     addPolyline: async (
@@ -106,6 +144,47 @@ export const getMapViewController = (nativeID: string): MapViewController => {
       };
     },
 
+    addClippedPolygons: async (
+      operation: PolygonOperation,
+      subject: PolygonGeometry | PolygonGeometry[],
+      clip: PolygonGeometry | PolygonGeometry[],
+      polygonOptions: Omit<PolygonOptions, 'points' | 'holes'> = {}
+    ): Promise<Polygon[]> => {
+      const polygons = await NavViewModule.addClippedPolygons(
+        nativeID,
+        operation,
+        packPolygons(subject),
+        packPolygons(clip),
+        {
+          ...polygonOptions,
+          strokeColor:
+            processColorValue(polygonOptions.strokeColor) ?? undefined,
+          fillColor: processColorValue(polygonOptions.fillColor) ?? undefined,
+        }
+      );
+      return polygons.map(polygon => ({
+        ...polygon,
+        fillColor: polygon.fillColor
+          ? colorIntToRGBA(polygon.fillColor as unknown as number)
+          : undefined,
+        strokeColor: polygon.strokeColor
+          ? colorIntToRGBA(polygon.strokeColor as unknown as number)
+          : undefined,
+      }));
+    },
+
+    classifyPoints: async (
+      points: Float64Array | readonly number[] | readonly LatLng[],
+      polygonIds: string[]
+    ): Promise<Int32Array> => {
+      const zoneIndices = await NavViewModule.classifyPointsInPolygons(
+        nativeID,
+        packPoints(points),
+        polygonIds
+      );
+      return Int32Array.from(zoneIndices);
+    },
+
     addGroundOverlay: async (
       groundOverlayOptions: GroundOverlayOptions
     ): Promise<GroundOverlay> => {
@@ -195,6 +274,16 @@ export const getMapViewController = (nativeID: string): MapViewController => {
       return await NavViewModule.moveCamera(nativeID, cameraPosition);
     },
 
+    fitCameraToOverlays: async (
+      selection: OverlaySelection,
+      options?: FitCameraOptions
+    ): Promise<boolean> => {
+      return await NavViewModule.fitCameraToOverlays(
+        nativeID,
+        toFitCameraOptionsSpec(selection, options)
+      );
+    },
+
     setPadding: async _padding => {
       console.warn('setPadding should be set via props in new architecture');
     },
@@ -242,5 +331,218 @@ export const getMapViewController = (nativeID: string): MapViewController => {
     getGroundOverlays: async (): Promise<GroundOverlay[]> => {
       return await NavViewModule.getGroundOverlays(nativeID);
     },
+
+    setQualityGovernorConfig: async (config: QualityGovernorConfig) => {
+      return await NavViewModule.setQualityGovernorConfig(nativeID, {
+        ...defaultQualityGovernorConfig,
+        ...config,
+      });
+    },
+
+    addQualityAdjustedListener: (
+      listener: (adjustment: QualityAdjustment) => void
+    ) => {
+      return NavViewModule.onQualityAdjusted(payload => {
+        if (payload.nativeID === nativeID) {
+          listener(payload as QualityAdjustment);
+        }
+      });
+    },
+
+    setRenderStatsConfig: async (config: RenderStatsConfig) => {
+      return await NavViewModule.setRenderStatsConfig(nativeID, {
+        enabled: config.enabled,
+        eventIntervalMs: config.eventIntervalMs ?? 0,
+      });
+    },
+
+    getRenderStats: async (reset: boolean = false): Promise<RenderStats> => {
+      const stats = await NavViewModule.getRenderStats(nativeID, reset);
+      return stats as unknown as RenderStats;
+    },
+
+    getLayoutFrameCallbackCount: async (): Promise<number> => {
+      return await NavViewModule.getLayoutFrameCallbackCount(nativeID);
+    },
+
+    addRenderStatsListener: (listener: (stats: RenderStats) => void) => {
+      return NavViewModule.onRenderStats(payload => {
+        if (payload.nativeID === nativeID) {
+          listener(payload as unknown as RenderStats);
+        }
+      });
+    },
+
+    projectToScreen: async (
+      latLngs: Float64Array | number[]
+    ): Promise<Float32Array> => {
+      const points = await NavViewModule.projectToScreen(
+        nativeID,
+        Array.from(latLngs)
+      );
+      return Float32Array.from(points);
+    },
+
+    screenToCoordinates: async (
+      points: Float32Array | Float64Array | number[]
+    ): Promise<Float64Array> => {
+      const latLngs = await NavViewModule.screenToCoordinates(
+        nativeID,
+        Array.from(points)
+      );
+      return Float64Array.from(latLngs);
+    },
+
+    watchProjection: (
+      latLngs: Float64Array | number[],
+      listener: (points: Float32Array) => void
+    ) => {
+      const buffer = new Float32Array(latLngs.length - (latLngs.length % 2));
+      const subscription = NavViewModule.onProjectionUpdated(payload => {
+        if (payload.nativeID === nativeID) {
+          buffer.set(payload.points);
+          listener(buffer);
+        }
+      });
+      // Without a view there is nothing to watch.
+      NavViewModule.setProjectionWatch(nativeID, Array.from(latLngs)).catch(
+        () => subscription.remove()
+      );
+      return {
+        remove: () => {
+          subscription.remove();
+          // The view may already be gone, in which case the watch went with it.
+          NavViewModule.setProjectionWatch(nativeID, []).catch(() => {});
+        },
+      };
+    },
+
+    watchViewport: (
+      ids: string[],
+      listener: (entered: string[], left: string[]) => void
+    ) => {
+      const subscription = NavViewModule.onViewportMembershipChanged(
+        payload => {
+          if (payload.nativeID === nativeID) {
+            listener(Array.from(payload.entered), Array.from(payload.left));
+          }
+        }
+      );
+      // Without a view there is nothing to watch.
+      NavViewModule.setViewportWatch(nativeID, ids).catch(() =>
+        subscription.remove()
+      );
+      return {
+        remove: () => {
+          subscription.remove();
+          // The view may already be gone, in which case the watch went with it.
+          NavViewModule.setViewportWatch(nativeID, []).catch(() => {});
+        },
+      };
+    },
+
+    setMarkerStyle: async (style: MarkerStyle | null): Promise<void> => {
+      await NavViewModule.setMarkerStyle(
+        nativeID,
+        style ? JSON.stringify(style) : ''
+      );
+    },
+
+    setMarkerAttribute: async (
+      ids: string[],
+      key: string,
+      values: OverlayAttributeValue | OverlayAttributeValue[]
+    ): Promise<number> => {
+      return await NavViewModule.setMarkerAttribute(
+        nativeID,
+        ids,
+        key,
+        JSON.stringify(values)
+      );
+    },
+
+    setMarkerDeclutter: async (
+      options: MarkerDeclutterOptions | null
+    ): Promise<void> => {
+      await NavViewModule.setMarkerDeclutter(
+        nativeID,
+        options ? JSON.stringify(options) : ''
+      );
+    },
+
+    selectMarkersWhere: async (
+      predicate: StyleExpression
+    ): Promise<string[]> => {
+      return await NavViewModule.selectMarkersWhere(
+        nativeID,
+        JSON.stringify(predicate)
+      );
+    },
+
+    updateMarkersWhere: async (
+      predicate: StyleExpression,
+      patch: MarkerPatch
+    ): Promise<number> => {
+      return await NavViewModule.updateMarkersWhere(
+        nativeID,
+        JSON.stringify(predicate),
+        JSON.stringify(patch)
+      );
+    },
+
+    loadTripPlayback: async (
+      trace: TripTrace,
+      options: TripPlaybackOptions = {}
+    ): Promise<TripPlayback> => {
+      await NavViewModule.loadTripPlayback(nativeID, {
+        latLngs: Array.from(trace.latLngs),
+        timestamps: Array.from(trace.timestamps),
+        trailColor: processColorValue(options.trailColor) ?? undefined,
+        trailWidth: options.trailWidth,
+        markerImgPath: options.markerImgPath,
+        progressIntervalMs: options.progressIntervalMs,
+      });
+      return {
+        play: () => NavViewModule.playTrip(nativeID),
+        pause: () => NavViewModule.pauseTrip(nativeID),
+        seek: (timeMs: number) => NavViewModule.seekTrip(nativeID, timeMs),
+        setRate: (rate: number) =>
+          NavViewModule.setTripPlaybackRate(nativeID, rate),
+        addProgressListener: listener =>
+          NavViewModule.onTripProgress(payload => {
+            if (payload.nativeID === nativeID) {
+              listener({
+                timeMs: payload.timeMs,
+                index: payload.index,
+                position: { lat: payload.lat, lng: payload.lng },
+                heading: payload.heading,
+                playing: payload.playing,
+              });
+            }
+          }),
+        remove: () => NavViewModule.clearTripPlayback(nativeID),
+      };
+    },
+
+    startRoutePrefetch: async (
+      options: RoutePrefetchOptions
+    ): Promise<RoutePrefetch> => {
+      await NavViewModule.startRoutePrefetch(nativeID, {
+        storePath: options.storePath,
+        tileZoom: options.tileZoom,
+        aheadMeters: options.aheadMeters,
+        corridorMeters: options.corridorMeters,
+        maxFeatures: options.maxFeatures,
+      });
+      return {
+        addListener: listener =>
+          NavViewModule.onRoutePrefetchChanged(payload => {
+            if (payload.nativeID === nativeID) {
+              listener(Array.from(payload.staged), Array.from(payload.evicted));
+            }
+          }),
+        remove: () => NavViewModule.stopRoutePrefetch(nativeID),
+      };
+    },
   };
 };
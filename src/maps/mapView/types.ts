@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-import type { ColorValue } from 'react-native';
+import type { ColorValue, EventSubscription } from 'react-native';
 import type { LatLng, Location } from '../../shared/types';
 import type {
   CameraPosition,
@@ -25,6 +25,10 @@ import type {
   Polyline,
   UISettings,
 } from '../types';
+import type {
+  PolygonGeometry,
+  PolygonOperation,
+} from '../polygonOperations/types';
 
 /**
  * Defines options for a Circle.
@@ -72,6 +76,100 @@ export interface MarkerOptions {
   flat?: boolean;
   /** Indicates the visibility of the polygon. True by default. */
   visible?: boolean;
+  /**
+   * Attribute record evaluated by the marker style set with
+   * `setMarkerStyle`. Ignored on Android Auto and CarPlay.
+   */
+  attributes?: OverlayAttributes;
+}
+
+/** A single overlay attribute value. */
+export type OverlayAttributeValue = number | string | boolean | null;
+
+/**
+ * A small record of attributes attached to an overlay, e.g.
+ * `{ status: 'late', priority: 2 }`.
+ */
+export type OverlayAttributes = Readonly<Record<string, OverlayAttributeValue>>;
+
+/**
+ * A style expression, evaluated natively against the attributes of each
+ * overlay and the camera zoom. Literals are numbers, strings, booleans and
+ * null; anything else is an array whose first element is the operator:
+ *
+ * - `['get', key]`, `['has', key]`, `['zoom']`
+ * - `['==' | '!=' | '<' | '<=' | '>' | '>=', a, b]`, `['!', a]`,
+ *   `['all', ...]`, `['any', ...]`
+ * - `['+' | '-' | '*' | '/', a, b]`
+ * - `['case', condition, output, ..., fallback]`
+ * - `['match', input, label | labels[], output, ..., fallback]`
+ * - `['interpolate', ['linear'] | ['exponential', base], input, stop, output, ...]`
+ * - `['step', input, output, stop, output, ...]`
+ */
+export type StyleExpression =
+  | OverlayAttributeValue
+  | readonly [string, ...unknown[]];
+
+/**
+ * Data-driven marker style. Each property is an expression; properties that
+ * are left out keep the values from the marker options.
+ */
+export interface MarkerStyle {
+  /** Markers for which the filter evaluates to false are hidden. */
+  filter?: StyleExpression;
+  alpha?: StyleExpression;
+  zIndex?: StyleExpression;
+  rotation?: StyleExpression;
+  /**
+   * Tints the default marker icon; markers with `imgPath` are not tinted.
+   * Must evaluate to a `'#RRGGBB'` or `'#RRGGBBAA'` string. Android only
+   * uses the hue.
+   */
+  color?: StyleExpression;
+}
+
+/**
+ * Changes applied to every marker selected by `updateMarkersWhere`. Option
+ * values of styled properties are restored when the style is removed.
+ */
+export interface MarkerPatch {
+  visible?: boolean;
+  alpha?: number;
+  zIndex?: number;
+  rotation?: number;
+  /** Merged into the attributes of each marker; `null` removes a key. */
+  attributes?: OverlayAttributes;
+}
+
+/**
+ * Screen-space declutter options. Markers are placed from the highest
+ * priority to the lowest, and a marker whose collision box overlaps an
+ * already placed one is hidden until there is room for it again.
+ */
+export interface MarkerDeclutterOptions {
+  /**
+   * Evaluated against the attributes of each marker; higher values win.
+   * Defaults to the marker zIndex.
+   */
+  priority?: StyleExpression;
+  /**
+   * Collision box of every marker, in density-independent pixels. Defaults
+   * to the size of the default marker pin, 26 by 40.
+   */
+  boxSize?: { width: number; height: number };
+  /**
+   * Position of the marker coordinate within its box, as a fraction of the
+   * box size. Defaults to the bottom center, `{ x: 0.5, y: 1 }`.
+   */
+  anchor?: { x: number; y: number };
+  /** Extra spacing kept between boxes. Defaults to 0. */
+  padding?: number;
+  /**
+   * Minimum interval between passes while the camera is moving. A pass
+   * always runs once the camera settles; 0 only declutters then. Defaults
+   * to 250.
+   */
+  animationIntervalMs?: number;
 }
 
 /**
@@ -221,6 +319,136 @@ export interface Padding {
   right?: number;
 }
 
+/**
+ * Selects overlays by id, markers by their `group` attribute, or every
+ * overlay of the map.
+ */
+export type OverlaySelection = { ids: string[] } | { group: string } | 'all';
+
+/**
+ * Defines how the camera frames overlays in `fitCameraToOverlays`.
+ */
+export interface FitCameraOptions {
+  /** Space kept free around the overlays, in the units of `setPadding`. */
+  padding?: Padding;
+  /** Upper bound for the zoom, e.g. when a single marker is selected. */
+  maxZoom?: number;
+  /** Bearing of the camera in degrees. Defaults to north up. */
+  bearing?: number;
+}
+
+/**
+ * A recorded trip: one timestamp per coordinate.
+ */
+export interface TripTrace {
+  /** Coordinates packed as `[lat0, lng0, lat1, lng1, ...]`. */
+  latLngs: Float64Array | number[];
+  /** Non-decreasing timestamps in milliseconds, one per coordinate. */
+  timestamps: Float64Array | number[];
+}
+
+/**
+ * Defines how a recorded trip is drawn during playback.
+ */
+export interface TripPlaybackOptions {
+  /** Color of the trail behind the playback position. */
+  trailColor?: ColorValue;
+  /** Width of the trail. Defaults to 6. */
+  trailWidth?: number;
+  /**
+   * Icon of the playback marker. A custom icon is drawn flat and rotated
+   * to the heading of the trip; the default marker pin is not rotated.
+   */
+  markerImgPath?: string;
+  /**
+   * Minimum interval between progress events while playing. Play, pause,
+   * seek and reaching the end always report progress. Defaults to 250.
+   */
+  progressIntervalMs?: number;
+}
+
+/**
+ * Position of a trip playback.
+ */
+export interface TripProgress {
+  /** Current time, in the units of the trace timestamps. */
+  timeMs: number;
+  /** Index of the last trace coordinate at or before `timeMs`. */
+  index: number;
+  /** Interpolated position at `timeMs`. */
+  position: LatLng;
+  /** Heading of the current trace segment in degrees. */
+  heading: number;
+  playing: boolean;
+}
+
+/**
+ * Controls a recorded trip loaded with `loadTripPlayback`.
+ */
+export interface TripPlayback {
+  /** Plays from the current time. Playing at the end restarts the trip. */
+  play(): Promise<void>;
+  pause(): Promise<void>;
+  /** Moves to `timeMs`, clamped to the time range of the trace. */
+  seek(timeMs: number): Promise<void>;
+  /** Sets the playback speed relative to real time. Defaults to 1. */
+  setRate(rate: number): Promise<void>;
+  /**
+   * Subscribes to the progress of this playback.
+   *
+   * @returns A subscription; call `remove()` to unsubscribe.
+   */
+  addProgressListener(
+    listener: (progress: TripProgress) => void
+  ): EventSubscription;
+  /** Stops playback and removes the trail and marker from the map. */
+  remove(): Promise<void>;
+}
+
+/**
+ * Defines where `startRoutePrefetch` loads features from and how far ahead.
+ */
+export interface RoutePrefetchOptions {
+  /**
+   * Directory of the feature store, laid out as `{z}/{x}/{y}.json` map
+   * tiles. Each file holds a JSON array of point features:
+   * `{ id, lat, lng, title?, snippet?, imgPath?, zIndex?, attributes? }`.
+   * Tiles without features may be omitted. Feature ids are used as marker
+   * ids and must not collide with other markers of the view.
+   */
+  storePath: string;
+  /** Zoom level of the store's tiles. Defaults to 12. */
+  tileZoom?: number;
+  /** Length of the route ahead of the car to cover. Defaults to 20000. */
+  aheadMeters?: number;
+  /**
+   * Distance from the route within which features are loaded. Defaults to
+   * 500.
+   */
+  corridorMeters?: number;
+  /**
+   * Most features staged at once. Beyond it, the features the car has
+   * passed are evicted first. Defaults to 2000.
+   */
+  maxFeatures?: number;
+}
+
+/**
+ * Controls a prefetch started with `startRoutePrefetch`.
+ */
+export interface RoutePrefetch {
+  /**
+   * Subscribes to the markers staged and evicted by this prefetch.
+   *
+   * @returns A subscription; call `remove()` to unsubscribe.
+   */
+  addListener(
+    listener: (staged: string[], evicted: string[]) => void
+  ): EventSubscription;
+  /** Stops prefetching and removes the markers staged by it. */
+  remove(): Promise<void>;
+}
+
 /**
  * Defines the type of the map view.
  */
@@ -231,6 +459,118 @@ export enum MapViewType {
   NAVIGATION = 1,
 }
 
+/**
+ * Range a quality knob may be adjusted within by the quality governor.
+ */
+export interface QualityBounds {
+  min: number;
+  max: number;
+}
+
+/**
+ * Quality knobs adjusted by the quality governor.
+ */
+export type QualityKnob =
+  | 'polylineTolerance'
+  | 'clusterRadius'
+  | 'eventRate'
+  | 'animationFrameRate'
+  | 'virtualizationMargin';
+
+/**
+ * Defines the configuration of the adaptive quality governor of a map view.
+ * Every knob moves between its bounds: toward the cheaper end while frames are
+ * late, hitching or the main thread is saturated, and back toward full quality
+ * when there is sustained headroom.
+ */
+export interface QualityGovernorConfig {
+  /** Whether the governor is active. When disabled, features use their defaults. */
+  enabled: boolean;
+  /** Frame rate to hold. Defaults to the display refresh rate. */
+  targetFrameRate?: number;
+  /** Length of each measurement window in milliseconds. Defaults to 1000. */
+  evaluationIntervalMs?: number;
+  /** Polyline simplification tolerance in meters. Defaults to 0–10. */
+  polylineTolerance?: QualityBounds;
+  /** Marker clustering radius in points. Defaults to 40–120. */
+  clusterRadius?: QualityBounds;
+  /** Maximum rate of high-frequency view events in Hz. Defaults to 5–30. */
+  eventRate?: QualityBounds;
+  /** Frame rate of natively driven animations. Defaults to 30–60. */
+  animationFrameRate?: QualityBounds;
+  /** Area kept materialized around the viewport, as a fraction of its size. Defaults to 0–0.5. */
+  virtualizationMargin?: QualityBounds;
+}
+
+/**
+ * Describes a single knob change made by the quality governor, together with
+ * the measurements that triggered it.
+ */
+export interface QualityAdjustment {
+  knob: QualityKnob;
+  previousValue: number;
+  value: number;
+  /** 0 for full quality, 1 for the cheapest configured settings. */
+  qualityLevel: number;
+  reason: 'frameTime' | 'hitches' | 'mainThreadLoad' | 'headroom';
+  averageFrameMs: number;
+  /** Fraction of frames in the window that took over 1.5 frame intervals. */
+  hitchRatio: number;
+  /** Fraction of the window the main thread was busy (estimated on Android). */
+  mainThreadLoad: number;
+}
+
+/**
+ * Defines how render statistics are collected for a map view.
+ */
+export interface RenderStatsConfig {
+  /** Whether frame timing is collected. Collection costs a display link callback per frame. */
+  enabled: boolean;
+  /**
+   * When set, an `onRenderStats` event is emitted at this interval with the
+   * statistics of the elapsed interval, which then start a new period.
+   */
+  eventIntervalMs?: number;
+}
+
+/**
+ * Frame pacing statistics of a map view, with the overlay load and module
+ * commands they coincided with.
+ */
+export interface RenderStats {
+  /** Length of the measured period in milliseconds. */
+  durationMs: number;
+  frameCount: number;
+  averageFrameMs: number;
+  longestFrameMs: number;
+  /** Time since the longest frame in milliseconds. */
+  longestFrameAgeMs: number;
+  /** Frames that took longer than 1.5 frame intervals. */
+  hitchCount: number;
+  /** Upper bounds of the histogram buckets; the last bucket is unbounded. */
+  histogramBucketsMs: number[];
+  /** Frame counts per bucket, one more entry than `histogramBucketsMs`. */
+  histogram: number[];
+  /** The most recent hitches, oldest first. */
+  hitches: {
+    frameMs: number;
+    ageMs: number;
+    /** Total overlays on the map when the hitch occurred. */
+    overlayCount: number;
+    /** Module commands issued during the second before the hitch. */
+    commands: string[];
+  }[];
+  /** The most recent module commands for this view, oldest first. */
+  recentCommands: { name: string; ageMs: number }[];
+  overlayCounts: {
+    markers: number;
+    polylines: number;
+    polygons: number;
+    circles: number;
+    groundOverlays: number;
+  };
+}
+
 export interface MapViewController {
   /**
    * Clear all elements from the map view.
@@ -281,6 +621,42 @@ export interface MapViewController {
    */
   addPolygon(polygonOptions: PolygonOptions): Promise<Polygon>;
 
+  /**
+   * Computes a boolean operation on polygons natively, on a background
+   * worker, and adds the result to the map without passing it through JS.
+   * With an `id`, the resulting polygons are identified as `<id>/0`,
+   * `<id>/1`, ..., so running the operation again updates them.
+   *
+   * @param operation - The operation to apply.
+   * @param subject - The polygons to operate on.
+   * @param clip - The polygons combined with, or subtracted from, the subject.
+   * @param polygonOptions - Style of the resulting polygons.
+   * @returns The created or updated polygons.
+   */
+  addClippedPolygons(
+    operation: PolygonOperation,
+    subject: PolygonGeometry | PolygonGeometry[],
+    clip: PolygonGeometry | PolygonGeometry[],
+    polygonOptions?: Omit<PolygonOptions, 'points' | 'holes'>
+  ): Promise<Polygon[]>;
+
+  /**
+   * Finds which of the given polygons of the map contains each point. The
+   * polygon geometry is read natively, so it is not sent again, and the points
+   * are classified in parallel on background workers.
+   *
+   * @param points - The points, as LatLngs or packed as [lat0, lng0, ...].
+   * @param polygonIds - Ids of the zone polygons. Where zones overlap, the
+   * first one wins.
+   * @returns The index in `polygonIds` of the zone of each point, or -1 if no
+   * zone contains it. Rejects with the ids of the map that has no polygon
+   * under them.
+   */
+  classifyPoints(
+    points: Float64Array | readonly number[] | readonly LatLng[],
+    polygonIds: string[]
+  ): Promise<Int32Array>;
+
   /**
    * Add or update a ground overlay on the map.
    * A ground overlay is an image that is fixed to a map.
@@ -378,6 +754,20 @@ export interface MapViewController {
    */
   moveCamera(cameraPosition: CameraPosition): void;
 
+  /**
+   * Animates the camera once so the selected overlays fit the view. The
+   * combined bounds are computed natively from the overlay geometry, so no
+   * coordinates need to be collected in JS. The camera is untilted.
+   *
+   * @param selection - The overlays to show.
+   * @param options - Padding, maximum zoom and bearing of the camera.
+   * @returns False, without moving the camera, if no overlay was selected.
+   */
+  fitCameraToOverlays(
+    selection: OverlaySelection,
+    options?: FitCameraOptions
+  ): Promise<boolean>;
+
   /**
    * Sets padding to the map.
    *
@@ -420,4 +810,211 @@ export interface MapViewController {
    * @returns A promise that resolves to an array of GroundOverlay objects.
    */
   getGroundOverlays(): Promise<GroundOverlay[]>;
+
+  /**
+   * Enables, reconfigures or disables the adaptive quality governor of this view.
+   *
+   * @param config - Governor configuration; omitted bounds use their defaults.
+   */
+  setQualityGovernorConfig(config: QualityGovernorConfig): Promise<void>;
+
+  /**
+   * Subscribes to quality adjustments made by the governor of this view.
+   *
+   * @param listener - Called once for every knob that changed.
+   * @returns A subscription; call `remove()` to unsubscribe.
+   */
+  addQualityAdjustedListener(
+    listener: (adjustment: QualityAdjustment) => void
+  ): EventSubscription;
+
+  /**
+   * Enables or disables render statistics collection for this view.
+   *
+   * @param config - Collection settings, including the optional event interval.
+   */
+  setRenderStatsConfig(config: RenderStatsConfig): Promise<void>;
+
+  /**
+   * Returns the render statistics collected since the last reset. Rejects if
+   * collection is not enabled.
+   *
+   * @param reset - Whether to start a new measurement period. Defaults to false.
+   */
+  getRenderStats(reset?: boolean): Promise<RenderStats>;
+
+  /**
+   * Returns the number of frame callbacks that laid out the native map of
+   * this view since it was created, to verify that idle views do no per-frame
+   * layout work. Always 0 on iOS, where UIKit lays out the map.
+   */
+  getLayoutFrameCallbackCount(): Promise<number>;
+
+  /**
+   * Subscribes to the periodic render statistics of this view.
+   *
+   * @param listener - Called every `eventIntervalMs` while collection is enabled.
+   * @returns A subscription; call `remove()` to unsubscribe.
+   */
+  addRenderStatsListener(
+    listener: (stats: RenderStats) => void
+  ): EventSubscription;
+
+  /**
+   * Projects coordinates to screen points of this view in a single pass.
+   *
+   * @param latLngs - Coordinates packed as `[lat0, lng0, lat1, lng1, ...]`.
+   * @returns Points packed as `[x0, y0, x1, y1, ...]` in density-independent
+   * pixels relative to the top-left corner of the map view. Points outside the
+   * viewport are returned as well.
+   */
+  projectToScreen(latLngs: Float64Array | number[]): Promise<Float32Array>;
+
+  /**
+   * Converts screen points of this view to coordinates in a single pass.
+   *
+   * @param points - Points packed as `[x0, y0, x1, y1, ...]` in
+   * density-independent pixels.
+   * @returns Coordinates packed as `[lat0, lng0, lat1, lng1, ...]`.
+   */
+  screenToCoordinates(
+    points: Float32Array | Float64Array | number[]
+  ): Promise<Float64Array>;
+
+  /**
+   * Keeps the screen points of the given coordinates up to date while the
+   * camera moves. The points are written into the same `Float32Array` on every
+   * change, packed as in `projectToScreen`, and the listener is called after
+   * each update, starting with the current projection.
+   *
+   * Each view has one projection watch; starting a new one replaces it.
+   *
+   * @param latLngs - Coordinates packed as `[lat0, lng0, lat1, lng1, ...]`.
+   * @param listener - Called with the shared buffer after every update.
+   * @returns A subscription; call `remove()` to stop watching.
+   */
+  watchProjection(
+    latLngs: Float64Array | number[],
+    listener: (points: Float32Array) => void
+  ): EventSubscription;
+
+  /**
+   * Reports when overlays enter or leave the visible region. Membership is
+   * evaluated natively when the camera settles and after watched overlays are
+   * added, moved or removed, and the listener only receives changes, starting
+   * with the overlays visible when the watch begins.
+   *
+   * An overlay is a member when its geometry intersects the visible region,
+   * whether or not it is currently shown. Ids that do not belong to an overlay
+   * yet are watched too, so overlays can be added after the watch starts.
+   *
+   * Each view has one viewport watch; starting a new one replaces it.
+   *
+   * @param ids - Ids of the markers, polylines, polygons, circles and ground
+   * overlays to watch.
+   * @param listener - Called with the ids that entered and left the viewport.
+   * @returns A subscription; call `remove()` to stop watching.
+   */
+  watchViewport(
+    ids: string[],
+    listener: (entered: string[], left: string[]) => void
+  ): EventSubscription;
+
+  /**
+   * Sets the data-driven style of all markers in this view. Expressions are
+   * compiled once and evaluated natively when markers are added, when their
+   * attributes change and, for zoom-dependent styles, when the camera
+   * settles.
+   *
+   * @param style - The style, or `null` to restore the option values of all
+   * markers.
+   * @throws If an expression is invalid, with code `INVALID_EXPRESSION`.
+   */
+  setMarkerStyle(style: MarkerStyle | null): Promise<void>;
+
+  /**
+   * Updates one attribute of many markers in a single call. Only markers
+   * whose style reads `key` are restyled.
+   *
+   * @param ids - Ids of the markers to update.
+   * @param key - The attribute to set.
+   * @param values - One value per id, or a single value for all of them.
+   * `null` removes the attribute.
+   * @returns The number of markers found.
+   */
+  setMarkerAttribute(
+    ids: string[],
+    key: string,
+    values: OverlayAttributeValue | OverlayAttributeValue[]
+  ): Promise<number>;
+
+  /**
+   * Hides markers that would overlap a higher-priority marker on screen.
+   * The pass runs natively when the camera settles, at a reduced rate while
+   * it moves, and after markers change; only markers whose state changed
+   * are toggled.
+   *
+   * @param options - Declutter options, or `null` to show every marker again.
+   * @throws If the priority expression is invalid, with code
+   * `INVALID_EXPRESSION`.
+   */
+  setMarkerDeclutter(options: MarkerDeclutterOptions | null): Promise<void>;
+
+  /**
+   * Returns the ids of the markers whose attributes satisfy `predicate`.
+   * Equality, comparisons against literals and `has`, alone or combined with
+   * `all` and `any`, are answered from native attribute indexes instead of
+   * evaluating every marker.
+   *
+   * @param predicate - A style expression evaluated as a boolean.
+   * @throws If the predicate is invalid, with code `INVALID_EXPRESSION`.
+   */
+  selectMarkersWhere(predicate: StyleExpression): Promise<string[]>;
+
+  /**
+   * Applies `patch` to every marker that satisfies `predicate` in a single
+   * native pass, e.g. to hide all stops of another driver or raise the
+   * zIndex of priority jobs.
+   *
+   * @param predicate - A style expression evaluated as a boolean.
+   * @param patch - The changes to apply.
+   * @returns The number of markers updated.
+   * @throws If the predicate is invalid, with code `INVALID_EXPRESSION`.
+   */
+  updateMarkersWhere(
+    predicate: StyleExpression,
+    patch: MarkerPatch
+  ): Promise<number>;
+
+  /**
+   * Loads a recorded trip for playback, replacing the trip loaded before.
+   * Playback runs natively and starts paused at the first timestamp; the
+   * trail is extended and truncated incrementally as time moves.
+   *
+   * @param trace - The recorded coordinates and their timestamps.
+   * @param options - How the trip is drawn.
+   * @throws If the trace is empty, its arrays do not match or its
+   * timestamps decrease, with code `INVALID_TRACE`.
+   */
+  loadTripPlayback(
+    trace: TripTrace,
+    options?: TripPlaybackOptions
+  ): Promise<TripPlayback>;
+
+  /**
+   * Loads features near the upcoming part of the route from a local feature
+   * store, ahead of the car, without loading the whole store. The store is
+   * read natively on a background worker as the road-snapped location
+   * advances, and the features within the corridor are staged as hidden
+   * markers carrying their attributes. Show them with `updateMarkersWhere`
+   * or a marker style once they are needed.
+   *
+   * Progress follows the road-snapped location, so location updates must be
+   * running. Each view has one prefetch; starting a new one replaces it.
+   *
+   * @param options - The store and the size of the corridor.
+   * @throws If the store directory does not exist, with code
+   * `INVALID_DATA_SOURCE`.
+   */
+  startRoutePrefetch(options: RoutePrefetchOptions): Promise<RoutePrefetch>;
 }
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+import NavViewModule from '../../native/NativeNavViewModule';
+import type { LatLng } from '../../shared/types';
+import { packPolygons } from './polygonOperations';
+import type { PolygonGeometry } from './types';
+
+/**
+ * Packs points as [lat0, lng0, ...] for the native module. Packed input is
+ * passed through as is.
+ */
+export const packPoints = (
+  points: Float64Array | readonly number[] | readonly LatLng[]
+): number[] => {
+  if (points instanceof Float64Array) {
+    return Array.from(points);
+  }
+  const packed: number[] = [];
+  for (const point of points) {
+    if (typeof point === 'number') {
+      packed.push(point);
+    } else {
+      packed.push(point.lat, point.lng);
+    }
+  }
+  return packed;
+};
+
+/**
+ * Finds the zone of many points at once, e.g. to assign the day's stops to
+ * service zones. The zones are indexed natively and the points classified in
+ * parallel on background workers.
+ *
+ * @param points - The points, as LatLngs or packed as [lat0, lng0, ...].
+ * @param zones - The zones. Where zones overlap, the first one wins.
+ * @returns The index of the zone of each point, or -1 if no zone contains it.
+ */
+export const classifyPoints = async (
+  points: Float64Array | readonly number[] | readonly LatLng[],
+  zones: PolygonGeometry[]
+): Promise<Int32Array> => {
+  const zoneIndices = await NavViewModule.classifyPoints(
+    packPoints(points),
+    packPolygons(zones)
+  );
+  return Int32Array.from(zoneIndices);
+};
@@ -0,0 +1,120 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+import NavViewModule from '../../native/NativeNavViewModule';
+import type { LatLng } from '../../shared/types';
+import { PolygonOperation } from './types';
+import type { PolygonGeometry } from './types';
+
+interface PackedPolygons {
+  latLngs: number[];
+  ringSizes: number[];
+  ringCounts: number[];
+}
+
+/**
+ * Packs polygons into flat arrays for the native module, so that large zones
+ * do not cross the bridge as one object per vertex.
+ */
+export const packPolygons = (
+  polygons: PolygonGeometry | PolygonGeometry[]
+): PackedPolygons => {
+  const packed: PackedPolygons = { latLngs: [], ringSizes: [], ringCounts: [] };
+  for (const polygon of Array.isArray(polygons) ? polygons : [polygons]) {
+    const rings = [polygon.points, ...(polygon.holes ?? [])];
+    for (const ring of rings) {
+      for (const latLng of ring) {
+        packed.latLngs.push(latLng.lat, latLng.lng);
+      }
+      packed.ringSizes.push(ring.length);
+    }
+    packed.ringCounts.push(rings.length);
+  }
+  return packed;
+};
+
+const unpackPolygons = (packed: {
+  latLngs: ReadonlyArray<number>;
+  ringSizes: ReadonlyArray<number>;
+  ringCounts: ReadonlyArray<number>;
+}): PolygonGeometry[] => {
+  const polygons: PolygonGeometry[] = [];
+  let ring = 0;
+  let offset = 0;
+  const nextRing = (): LatLng[] => {
+    const points: LatLng[] = [];
+    const end = offset + 2 * (packed.ringSizes[ring++] ?? 0);
+    for (; offset < end; offset += 2) {
+      points.push({
+        lat: packed.latLngs[offset] ?? 0,
+        lng: packed.latLngs[offset + 1] ?? 0,
+      });
+    }
+    return points;
+  };
+  for (const ringCount of packed.ringCounts) {
+    const points = nextRing();
+    const holes: LatLng[][] = [];
+    for (let i = 1; i < ringCount; i++) {
+      holes.push(nextRing());
+    }
+    polygons.push({ points, holes });
+  }
+  return polygons;
+};
+
+/**
+ * Computes a boolean operation on polygons natively, on a background worker.
+ * Coordinates are snapped to a grid of 1e-7 degrees so that the result is
+ * computed exactly, and crossings are rounded to it.
+ *
+ * @param operation - The operation to apply.
+ * @param subject - The polygons to operate on.
+ * @param clip - The polygons combined with, or subtracted from, the subject.
+ * @returns The resulting polygons, with counterclockwise outer rings and
+ * clockwise holes.
+ */
+export const clipPolygons = async (
+  operation: PolygonOperation,
+  subject: PolygonGeometry | PolygonGeometry[],
+  clip: PolygonGeometry | PolygonGeometry[]
+): Promise<PolygonGeometry[]> => {
+  const result = await NavViewModule.clipPolygons(
+    operation,
+    packPolygons(subject),
+    packPolygons(clip)
+  );
+  return unpackPolygons(result);
+};
+
+/** The area covered by either operand. */
+export const polygonUnion = (
+  a: PolygonGeometry | PolygonGeometry[],
+  b: PolygonGeometry | PolygonGeometry[]
+): Promise<PolygonGeometry[]> => clipPolygons(PolygonOperation.UNION, a, b);
+
+/** The area covered by both operands. */
+export const polygonIntersection = (
+  a: PolygonGeometry | PolygonGeometry[],
+  b: PolygonGeometry | PolygonGeometry[]
+): Promise<PolygonGeometry[]> =>
+  clipPolygons(PolygonOperation.INTERSECTION, a, b);
+
+/** The area covered by `a` but not by `b`. */
+export const polygonDifference = (
+  a: PolygonGeometry | PolygonGeometry[],
+  b: PolygonGeometry | PolygonGeometry[]
+): Promise<PolygonGeometry[]> =>
+  clipPolygons(PolygonOperation.DIFFERENCE, a, b);
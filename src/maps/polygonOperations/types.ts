@@ -0,0 +1,38 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+import type { LatLng } from '../../shared/types';
+
+/**
+ * The geometry of a polygon. Operations treat each operand as the even-odd
+ * area of all its rings, so ring orientation does not matter. Rings may cross
+ * or overlap; where an even number of them overlap, the area is outside.
+ */
+export interface PolygonGeometry {
+  /** The vertices of the outer ring. */
+  points: LatLng[];
+  /** An array of holes, where a hole is an array of LatLngs. */
+  holes?: LatLng[][];
+}
+
+/**
+ * A boolean operation on polygons.
+ */
+export enum PolygonOperation {
+  UNION = 0,
+  INTERSECTION = 1,
+  /** The area of the subject that is not in the clip polygons. */
+  DIFFERENCE = 2,
+}
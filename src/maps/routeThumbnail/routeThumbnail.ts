@@ -0,0 +1,60 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+import { PixelRatio } from 'react-native';
+import NavViewModule from '../../native/NativeNavViewModule';
+import type { LatLng } from '../../shared/types';
+import { processColorValue } from '../../shared';
+import type { RouteThumbnail, RouteThumbnailOptions } from './types';
+
+const packLatLngs = (latLngs: LatLng[] | undefined): number[] => {
+  const packed: number[] = [];
+  for (const latLng of latLngs ?? []) {
+    packed.push(latLng.lat, latLng.lng);
+  }
+  return packed;
+};
+
+/**
+ * Renders a route preview natively, without map tiles, on a background
+ * worker. Thumbnails are cached by their options, so rendering the same
+ * preview again, e.g. when a list row scrolls back into view, resolves with
+ * the cached file.
+ *
+ * @param options - The route, stops, size and style of the preview.
+ * @returns A promise that resolves with an image source of the preview.
+ */
+export const renderRouteThumbnail = async (
+  options: RouteThumbnailOptions
+): Promise<RouteThumbnail> => {
+  const scale = options.scale ?? PixelRatio.get();
+  const uri = await NavViewModule.renderRouteThumbnail({
+    path: packLatLngs(options.path),
+    encodedPath: options.encodedPath ?? null,
+    stops: packLatLngs(options.stops),
+    width: options.width,
+    height: options.height,
+    scale,
+    padding: options.padding,
+    strokeWidth: options.strokeWidth,
+    strokeColor: processColorValue(options.strokeColor) ?? undefined,
+    stopRadius: options.stopRadius,
+    stopOutlineWidth: options.stopOutlineWidth,
+    stopColor: processColorValue(options.stopColor) ?? undefined,
+    stopOutlineColor: processColorValue(options.stopOutlineColor) ?? undefined,
+    backgroundColor: processColorValue(options.backgroundColor) ?? undefined,
+  });
+  return { uri, width: options.width, height: options.height, scale };
+};
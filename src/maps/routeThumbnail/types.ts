@@ -0,0 +1,58 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+import type { ColorValue } from 'react-native';
+import type { LatLng } from '../../shared/types';
+
+/**
+ * Defines a route preview rendered without a map, e.g. for the rows of a
+ * list. Sizes are in points.
+ */
+export interface RouteThumbnailOptions {
+  /** The route. Ignored when `encodedPath` is set. */
+  path?: LatLng[];
+  /** The route in the Encoded Polyline Algorithm Format. */
+  encodedPath?: string;
+  /** Stops drawn as dots over the route. */
+  stops?: LatLng[];
+  width: number;
+  height: number;
+  /** Pixels per point. Defaults to the pixel ratio of the screen. */
+  scale?: number;
+  /** Space kept free around the route and stops. Defaults to 8. */
+  padding?: number;
+  /** Defaults to 3. */
+  strokeWidth?: number;
+  strokeColor?: ColorValue;
+  /** Defaults to 4. */
+  stopRadius?: number;
+  /** Width of the ring around each stop. Defaults to 1.5. */
+  stopOutlineWidth?: number;
+  stopColor?: ColorValue;
+  stopOutlineColor?: ColorValue;
+  /** Defaults to transparent. */
+  backgroundColor?: ColorValue;
+}
+
+/**
+ * A rendered route preview, usable as the `source` of an `Image`.
+ */
+export interface RouteThumbnail {
+  /** File URI of the cached PNG. */
+  uri: string;
+  width: number;
+  height: number;
+  scale: number;
+}
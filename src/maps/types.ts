@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+import type { ReactNode } from 'react';
 import type { StyleProp, ViewStyle, ColorValue } from 'react-native';
 import type { LatLng } from '../shared/types';
 import type { MapViewController, MapViewType, Padding } from './mapView/types';
@@ -241,6 +242,12 @@ export interface MapViewProps {
 
   readonly style?: StyleProp<ViewStyle> | undefined;
 
+  /**
+   * Views rendered on top of the map. Wrap a view in `MapAnchor` to pin it to
+   * a map coordinate.
+   */
+  readonly children?: ReactNode;
+
   /**
    * The map ID is used to associate your map with a particular style in the Google Cloud Console.
    *
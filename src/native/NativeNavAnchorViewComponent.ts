@@ -0,0 +1,36 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { HostComponent, ViewProps } from 'react-native';
+import type {
+  Double,
+  Float,
+  WithDefault,
+} from 'react-native/Libraries/Types/CodegenTypesNamespace';
+import codegenNativeComponent from 'react-native/Libraries/Utilities/codegenNativeComponent';
+
+export interface NativeNavAnchorViewProps extends ViewProps {
+  latitude: Double;
+  longitude: Double;
+  anchorX?: WithDefault<Float, 0.5>;
+  anchorY?: WithDefault<Float, 1.0>;
+}
+
+export type NativeNavAnchorViewType = HostComponent<NativeNavAnchorViewProps>;
+
+export default codegenNativeComponent<NativeNavAnchorViewProps>(
+  'NavAnchorView'
+) as NativeNavAnchorViewType;
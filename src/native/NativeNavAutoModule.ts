@@ -122,6 +122,19 @@ type GroundOverlayOptionsSpec = Readonly<{
   zIndex?: WithDefault<Float, 0>;
 }>;
 
+type FitCameraOptionsSpec = Readonly<{
+  ids?: ReadonlyArray<string> | null;
+  group?: string | null;
+  padding?: Readonly<{
+    top: Double;
+    left: Double;
+    bottom: Double;
+    right: Double;
+  }> | null;
+  maxZoom?: WithDefault<Double, null>;
+  bearing?: WithDefault<Double, null>;
+}>;
+
 type CustomNavigationAutoEventSpec = Readonly<{
   type: string;
   data?: string | null;
@@ -138,6 +151,7 @@ export interface Spec extends TurboModule {
   addPolygon(options: PolygonOptionsSpec): Promise<Polygon>;
   addGroundOverlay(options: GroundOverlayOptionsSpec): Promise<GroundOverlay>;
   moveCamera(cameraPosition: CameraPositionSpec): Promise<void>;
+  fitCameraToOverlays(options: FitCameraOptionsSpec): Promise<boolean>;
   removeMarker(id: string): Promise<boolean>;
   removePolyline(id: string): Promise<boolean>;
   removePolygon(id: string): Promise<boolean>;
@@ -62,6 +62,13 @@ type WaypointSpec = Readonly<{
   preferredHeading?: Double;
 }>;
 
+// Waypoints are sent as a typed struct array. Positions of large stop lists
+// may instead be sent packed as [lat0, lng0, lat1, lng1, ...].
+type WaypointBatchSpec = Readonly<{
+  waypoints: ReadonlyArray<WaypointSpec>;
+  packedPositions: ReadonlyArray<Double>;
+}>;
+
 type RoutingOptionsSpec = Readonly<{
   valid?: WithDefault<boolean, false>;
   travelMode?: Double;
@@ -101,6 +108,20 @@ type ArrivalEventSpec = Readonly<{
   isFinalDestination?: boolean;
 }>;
 
+type RouteLegChangeSpec = Readonly<{
+  legIndex: Double;
+  start: Double;
+  removedCount: Double;
+  latLngs: ReadonlyArray<Double>;
+}>;
+
+type RouteChangeSpec = Readonly<{
+  fullReplacement: boolean;
+  droppedLegCount: Double;
+  legCount: Double;
+  legChanges: ReadonlyArray<RouteLegChangeSpec>;
+}>;
+
 type TimeAndDistanceSpec = Readonly<{
   delaySeverity: Double;
   meters: Double;
@@ -118,6 +139,8 @@ type TurnByTurnEventSpec = Readonly<{
   timeToFinalDestinationSeconds?: Double;
   currentStep?: StepInfoSpec;
   getRemainingSteps: ReadonlyArray<StepInfoSpec>;
+  // Packed [stepNumber, lat, lng, legIndex, firstVertex, lastVertex, ...].
+  maneuverPoints?: ReadonlyArray<Double>;
 }>;
 
 type StepInfoSpec = Readonly<{
@@ -142,6 +165,43 @@ enum RouteStatusSpec {
   UNKNOWN,
 }
 
+// Times are in milliseconds since the epoch. Open window ends are omitted.
+type TimeWindowStopSpec = Readonly<{
+  lat: Double;
+  lng: Double;
+  windowStart?: Double;
+  windowEnd?: Double;
+  serviceSeconds?: Double;
+}>;
+
+type TimeWindowRequestSpec = Readonly<{
+  stops: ReadonlyArray<TimeWindowStopSpec>;
+  // Defaults to the current road-snapped location and time.
+  origin?: LatLngSpec;
+  departureTime?: Double;
+  speedMetersPerSecond?: Double;
+  detourFactor?: Double;
+}>;
+
+// type: 0 replaces, 1 inserts, 2 removes and 3 moves the stop at index.
+type TimeWindowEditSpec = Readonly<{
+  type: Double;
+  index: Double;
+  toIndex?: Double;
+  stop?: TimeWindowStopSpec;
+}>;
+
+// Schedules of stops firstIndex to stopCount - 1. Slack of open windows is
+// sent as Number.MAX_VALUE.
+type TimeWindowScheduleSpec = Readonly<{
+  firstIndex: Double;
+  stopCount: Double;
+  arrivalTimes: ReadonlyArray<Double>;
+  waitSeconds: ReadonlyArray<Double>;
+  slackSeconds: ReadonlyArray<Double>;
+  routed: ReadonlyArray<boolean>;
+}>;
+
 type TermsAndConditionsUIParamsSpec = Readonly<{
   valid?: WithDefault<boolean, false>;
   backgroundColor?: Double;
@@ -168,11 +228,14 @@ export interface Spec extends TurboModule {
     taskRemovedBehavior: Double
   ): Promise<void>;
   cleanup(): Promise<void>;
+  suspendNavigation(): Promise<void>;
+  resumeNavigation(): Promise<void>;
   setDestinations(
-    waypoints: WaypointSpec[],
+    waypoints: WaypointBatchSpec,
     routingOptions: RoutingOptionsSpec,
     displayOptions: DisplayOptionsSpec,
-    routeTokenOptions: RouteTokenOptionsSpec
+    routeTokenOptions: RouteTokenOptionsSpec,
+    debounceMs: Double
   ): Promise<RouteStatusSpec>;
   continueToNextDestination(): Promise<void>;
   clearDestinations(): Promise<void>;
@@ -187,6 +250,13 @@ export interface Spec extends TurboModule {
   getRouteSegments(): Promise<RouteSegment[]>;
   getCurrentTimeAndDistance(): Promise<TimeAndDistance>;
   getTraveledPath(): Promise<LatLng[]>;
+  getManeuverPoints(): Promise<ReadonlyArray<Double>>;
+  evaluateTimeWindows(
+    request: TimeWindowRequestSpec
+  ): Promise<TimeWindowScheduleSpec>;
+  updateTimeWindowStop(
+    edit: TimeWindowEditSpec
+  ): Promise<TimeWindowScheduleSpec>;
   getNavSDKVersion(): Promise<string>;
   stopUpdatingLocation(): Promise<void>;
   startUpdatingLocation(): Promise<void>;
@@ -204,7 +274,7 @@ export interface Spec extends TurboModule {
   onRemainingTimeOrDistanceChanged: EventEmitter<{
     timeAndDistance: TimeAndDistanceSpec;
   }>;
-  onRouteChanged: EventEmitter<void>;
+  onRouteChanged: EventEmitter<{ routeChange: RouteChangeSpec }>;
   onReroutingRequestedByOffRoute: EventEmitter<void>;
   onStartGuidance: EventEmitter<void>;
   onTurnByTurn: EventEmitter<{
@@ -28,6 +28,7 @@ import type {
   UISettings,
 } from '../maps';
 import type {
+  EventEmitter,
   Float,
   Double,
   Int32,
@@ -57,6 +58,8 @@ type MarkerOptionsSpec = Readonly<{
   title?: WithDefault<string, null>;
   visible?: WithDefault<boolean, true>;
   zIndex?: WithDefault<Double, null>;
+  // JSON object of attribute values used by data-driven marker styles.
+  attributes?: WithDefault<string, null>;
 }>;
 
 type CircleOptionsSpec = Readonly<{
@@ -120,6 +123,161 @@ type GroundOverlayOptionsSpec = Readonly<{
   zIndex?: WithDefault<Float, 0>;
 }>;
 
+type QualityBoundsSpec = Readonly<{ min: Double; max: Double }>;
+
+type QualityGovernorConfigSpec = Readonly<{
+  enabled: boolean;
+  targetFrameRate: Double;
+  evaluationIntervalMs: Double;
+  polylineTolerance: QualityBoundsSpec;
+  clusterRadius: QualityBoundsSpec;
+  eventRate: QualityBoundsSpec;
+  animationFrameRate: QualityBoundsSpec;
+  virtualizationMargin: QualityBoundsSpec;
+}>;
+
+type QualityAdjustmentSpec = Readonly<{
+  nativeID: string;
+  knob: string;
+  previousValue: Double;
+  value: Double;
+  qualityLevel: Double;
+  reason: string;
+  averageFrameMs: Double;
+  hitchRatio: Double;
+  mainThreadLoad: Double;
+}>;
+
+type RenderStatsConfigSpec = Readonly<{
+  enabled: boolean;
+  eventIntervalMs: Double;
+}>;
+
+type RenderStatsSpec = Readonly<{
+  nativeID: string;
+  durationMs: Double;
+  frameCount: Double;
+  averageFrameMs: Double;
+  longestFrameMs: Double;
+  longestFrameAgeMs: Double;
+  hitchCount: Double;
+  histogramBucketsMs: ReadonlyArray<Double>;
+  histogram: ReadonlyArray<Double>;
+  hitches: ReadonlyArray<
+    Readonly<{
+      frameMs: Double;
+      ageMs: Double;
+      overlayCount: Double;
+      commands: ReadonlyArray<string>;
+    }>
+  >;
+  recentCommands: ReadonlyArray<Readonly<{ name: string; ageMs: Double }>>;
+  overlayCounts: Readonly<{
+    markers: Double;
+    polylines: Double;
+    polygons: Double;
+    circles: Double;
+    groundOverlays: Double;
+  }>;
+}>;
+
+type FitCameraOptionsSpec = Readonly<{
+  ids?: ReadonlyArray<string> | null;
+  group?: string | null;
+  padding?: Readonly<{
+    top: Double;
+    left: Double;
+    bottom: Double;
+    right: Double;
+  }> | null;
+  maxZoom?: WithDefault<Double, null>;
+  bearing?: WithDefault<Double, null>;
+}>;
+
+type ProjectionUpdateSpec = Readonly<{
+  nativeID: string;
+  points: ReadonlyArray<Double>;
+}>;
+
+type TripPlaybackSpec = Readonly<{
+  // Packed as [lat0, lng0, ...], with one non-decreasing timestamp in
+  // milliseconds per coordinate.
+  latLngs: ReadonlyArray<Double>;
+  timestamps: ReadonlyArray<Double>;
+  trailColor?: WithDefault<Double, null>;
+  trailWidth?: WithDefault<Float, 6>;
+  markerImgPath?: string | null;
+  progressIntervalMs?: WithDefault<Double, 250>;
+}>;
+
+type TripProgressSpec = Readonly<{
+  nativeID: string;
+  timeMs: Double;
+  index: Double;
+  lat: Double;
+  lng: Double;
+  heading: Double;
+  playing: boolean;
+}>;
+
+type RoutePrefetchSpec = Readonly<{
+  storePath: string;
+  tileZoom?: WithDefault<Double, 12>;
+  aheadMeters?: WithDefault<Double, 20000>;
+  corridorMeters?: WithDefault<Double, 500>;
+  maxFeatures?: WithDefault<Double, 2000>;
+}>;
+
+type RouteThumbnailSpec = Readonly<{
+  // Packed as [lat0, lng0, ...]; ignored when encodedPath is set.
+  path: ReadonlyArray<Double>;
+  encodedPath?: string | null;
+  stops: ReadonlyArray<Double>;
+  // Size in points, rendered at scale pixels per point.
+  width: Double;
+  height: Double;
+  scale: Double;
+  padding?: WithDefault<Double, 8>;
+  strokeWidth?: WithDefault<Double, 3>;
+  strokeColor?: WithDefault<Double, null>;
+  stopRadius?: WithDefault<Double, 4>;
+  stopOutlineWidth?: WithDefault<Double, 1.5>;
+  stopColor?: WithDefault<Double, null>;
+  stopOutlineColor?: WithDefault<Double, null>;
+  backgroundColor?: WithDefault<Double, null>;
+}>;
+
+type PackedPolygonsSpec = Readonly<{
+  // All rings packed as [lat0, lng0, ...], with the vertex count of each ring
+  // and the ring count of each polygon, outer ring first.
+  latLngs: ReadonlyArray<Double>;
+  ringSizes: ReadonlyArray<Double>;
+  ringCounts: ReadonlyArray<Double>;
+}>;
+
+type ClippedPolygonOptionsSpec = Readonly<{
+  clickable?: WithDefault<boolean, true>;
+  fillColor?: WithDefault<Double, null>;
+  geodesic?: WithDefault<boolean, false>;
+  id?: WithDefault<string, null>;
+  strokeColor?: WithDefault<Double, null>;
+  strokeWidth?: WithDefault<Float, 0>;
+  visible?: WithDefault<boolean, true>;
+  zIndex?: WithDefault<Double, null>;
+}>;
+
+type RoutePrefetchChangeSpec = Readonly<{
+  nativeID: string;
+  staged: ReadonlyArray<string>;
+  evicted: ReadonlyArray<string>;
+}>;
+
+type ViewportMembershipSpec = Readonly<{
+  nativeID: string;
+  entered: ReadonlyArray<string>;
+  left: ReadonlyArray<string>;
+}>;
+
 /**
  * TurboModule for map view operations.
  *
@@ -145,6 +303,12 @@ export interface Spec extends TurboModule {
     cameraPosition: CameraPositionSpec
   ): Promise<void>;
   getCameraPosition(nativeID: string): Promise<CameraPosition>;
+  // Resolves false, without moving the camera, if no overlay was selected.
+  // Without ids or group, every overlay is selected.
+  fitCameraToOverlays(
+    nativeID: string,
+    options: FitCameraOptionsSpec
+  ): Promise<boolean>;
   getMyLocation(nativeID: string): Promise<Location>;
   getUiSettings(nativeID: string): Promise<UISettings>;
   isMyLocationEnabled(nativeID: string): Promise<boolean>;
@@ -162,6 +326,123 @@ export interface Spec extends TurboModule {
   getPolylines(nativeID: string): Promise<Polyline[]>;
   getPolygons(nativeID: string): Promise<Polygon[]>;
   getGroundOverlays(nativeID: string): Promise<GroundOverlay[]>;
+  setQualityGovernorConfig(
+    nativeID: string,
+    config: QualityGovernorConfigSpec
+  ): Promise<void>;
+
+  setRenderStatsConfig(
+    nativeID: string,
+    config: RenderStatsConfigSpec
+  ): Promise<void>;
+  getRenderStats(nativeID: string, reset: boolean): Promise<RenderStatsSpec>;
+  getLayoutFrameCallbackCount(nativeID: string): Promise<Double>;
+
+  // Coordinates are packed as [lat0, lng0, ...] and screen points as
+  // [x0, y0, ...] in density-independent pixels relative to the map view.
+  projectToScreen(
+    nativeID: string,
+    latLngs: ReadonlyArray<Double>
+  ): Promise<ReadonlyArray<Double>>;
+  screenToCoordinates(
+    nativeID: string,
+    points: ReadonlyArray<Double>
+  ): Promise<ReadonlyArray<Double>>;
+  // Re-projects the given coordinates on every camera change and emits
+  // onProjectionUpdated. An empty array stops watching.
+  setProjectionWatch(
+    nativeID: string,
+    latLngs: ReadonlyArray<Double>
+  ): Promise<void>;
+  // Evaluates which of the given overlays intersect the visible region when
+  // the camera settles and emits onViewportMembershipChanged with the
+  // overlays that entered or left it. An empty array stops watching.
+  setViewportWatch(nativeID: string, ids: ReadonlyArray<string>): Promise<void>;
+
+  // Styles and attribute values are transported as JSON, since expressions
+  // are heterogeneous arrays. An empty style removes it.
+  setMarkerStyle(nativeID: string, style: string): Promise<void>;
+  // `values` is a JSON array aligned with `ids`, or a single value for all.
+  // Resolves with the number of markers found.
+  setMarkerAttribute(
+    nativeID: string,
+    ids: ReadonlyArray<string>,
+    key: string,
+    values: string
+  ): Promise<Double>;
+  // Declutter options as JSON, since the priority is an expression. Empty
+  // options turn decluttering off.
+  setMarkerDeclutter(nativeID: string, options: string): Promise<void>;
+  // Predicates are style expressions and patches carry attribute values, so
+  // both are transported as JSON. Resolves with the matching marker ids.
+  selectMarkersWhere(nativeID: string, predicate: string): Promise<string[]>;
+  // Resolves with the number of markers updated.
+  updateMarkersWhere(
+    nativeID: string,
+    predicate: string,
+    patch: string
+  ): Promise<Double>;
+
+  // Replaces any loaded trip. Playback starts paused at the first timestamp.
+  loadTripPlayback(nativeID: string, trip: TripPlaybackSpec): Promise<void>;
+  clearTripPlayback(nativeID: string): Promise<void>;
+  playTrip(nativeID: string): Promise<void>;
+  pauseTrip(nativeID: string): Promise<void>;
+  // Clamped to the trip's time range.
+  seekTrip(nativeID: string, timeMs: Double): Promise<void>;
+  setTripPlaybackRate(nativeID: string, rate: Double): Promise<void>;
+
+  // Stages features of the store along the route of the navigation session
+  // as hidden markers and emits onRoutePrefetchChanged. Replaces the
+  // previous prefetch of the view.
+  startRoutePrefetch(
+    nativeID: string,
+    options: RoutePrefetchSpec
+  ): Promise<void>;
+  // Removes the markers staged by the prefetch.
+  stopRoutePrefetch(nativeID: string): Promise<void>;
+  // Rasterizes a route preview without map tiles on a background worker and
+  // resolves with the file URI of the cached PNG. Not tied to a view.
+  renderRouteThumbnail(thumbnail: RouteThumbnailSpec): Promise<string>;
+
+  // Union: 0, Intersection: 1, Difference: 2. Computed on a background
+  // worker. Not tied to a view.
+  clipPolygons(
+    operation: Double,
+    subject: PackedPolygonsSpec,
+    clip: PackedPolygonsSpec
+  ): Promise<PackedPolygonsSpec>;
+  // Adds the result of the operation as polygons, identified as "<id>/<i>"
+  // when an id is given.
+  addClippedPolygons(
+    nativeID: string,
+    operation: Double,
+    subject: PackedPolygonsSpec,
+    clip: PackedPolygonsSpec,
+    options: ClippedPolygonOptionsSpec
+  ): Promise<Polygon[]>;
+  // Points are packed as [lat0, lng0, ...]. Resolves with the index of the
+  // first zone containing each point, or -1. Computed on background workers.
+  // Not tied to a view.
+  classifyPoints(
+    latLngs: ReadonlyArray<Double>,
+    zones: PackedPolygonsSpec
+  ): Promise<ReadonlyArray<Double>>;
+  // Same, with the zones given by polygon ids of the view. Unknown ids match
+  // no point.
+  classifyPointsInPolygons(
+    nativeID: string,
+    latLngs: ReadonlyArray<Double>,
+    polygonIds: ReadonlyArray<string>
+  ): Promise<ReadonlyArray<Double>>;
+
+  // Events carry the nativeID of the view they originate from.
+  onQualityAdjusted: EventEmitter<QualityAdjustmentSpec>;
+  onRenderStats: EventEmitter<RenderStatsSpec>;
+  onProjectionUpdated: EventEmitter<ProjectionUpdateSpec>;
+  onTripProgress: EventEmitter<TripProgressSpec>;
+  onViewportMembershipChanged: EventEmitter<ViewportMembershipSpec>;
+  onRoutePrefetchChanged: EventEmitter<RoutePrefetchChangeSpec>;
 }
 
 export default TurboModuleRegistry.getEnforcing<Spec>('NavViewModule');
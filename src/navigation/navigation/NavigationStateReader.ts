@@ -0,0 +1,171 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { EventSubscription } from 'react-native';
+import NavModule from '../../native/NativeNavModule';
+
+// Must match NavStateBuffer on the native side.
+const HEADER_SIZE = 8;
+const SLOT_COUNT = 9;
+const MAX_READ_ATTEMPTS = 8;
+
+enum Slot {
+  LATITUDE = 0,
+  LONGITUDE,
+  SPEED,
+  BEARING,
+  ACCURACY,
+  LOCATION_TIME,
+  REMAINING_METERS,
+  REMAINING_SECONDS,
+  DELAY_SEVERITY,
+}
+
+/**
+ * Latest navigation state, as read by NavigationStateReader.
+ * Unknown values are NaN.
+ */
+export interface NavigationState {
+  /** Sequence number of the last update; changes whenever the state changes. */
+  sequence: number;
+  lat: number;
+  lng: number;
+  /** Speed in meters per second. */
+  speed: number;
+  /** Bearing in degrees. */
+  bearing: number;
+  /** Horizontal accuracy in meters. */
+  accuracy: number;
+  /** Time of the location fix in milliseconds since epoch. */
+  locationTime: number;
+  /** Meters remaining to the next destination. */
+  remainingMeters: number;
+  /** Seconds remaining to the next destination. */
+  remainingSeconds: number;
+  delaySeverity: number;
+}
+
+/**
+ * Polls the latest location and remaining time/distance without event dispatch.
+ *
+ * On iOS the state lives in a native-owned ArrayBuffer installed through JSI,
+ * which the navigation listeners update under a seqlock. Where that buffer is
+ * not available (Android), the reader keeps an equivalent buffer up to date
+ * from the location and remaining time/distance events instead.
+ *
+ * Location values are only updated while location updates are running, see
+ * `startUpdatingLocation()`.
+ */
+export class NavigationStateReader {
+  private readonly header: Uint32Array;
+  private readonly slots: Float64Array;
+  private readonly subscriptions: EventSubscription[] = [];
+
+  constructor() {
+    const nativeBuffer = (
+      globalThis as { __RNNavigationSdkStateBuffer?: ArrayBuffer }
+    ).__RNNavigationSdkStateBuffer;
+    const buffer =
+      nativeBuffer ?? new ArrayBuffer(HEADER_SIZE + SLOT_COUNT * 8);
+    this.header = new Uint32Array(buffer, 0, 2);
+    this.slots = new Float64Array(buffer, HEADER_SIZE, SLOT_COUNT);
+    if (!nativeBuffer) {
+      this.slots.fill(NaN);
+      this.subscribeToEvents();
+    }
+  }
+
+  /** Whether the state is shared directly by the native side. */
+  get isShared(): boolean {
+    return this.subscriptions.length === 0;
+  }
+
+  /**
+   * Copies the latest state into `out` without allocating.
+   *
+   * @returns false if a consistent snapshot could not be taken because the
+   * native side kept writing; `out` is left unchanged in that case.
+   */
+  read(out: NavigationState): boolean {
+    const header = this.header;
+    const slots = this.slots;
+    for (let attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+      const before = header[0] ?? 0;
+      if (before % 2 !== 0) {
+        continue;
+      }
+      const lat = slots[Slot.LATITUDE] ?? NaN;
+      const lng = slots[Slot.LONGITUDE] ?? NaN;
+      const speed = slots[Slot.SPEED] ?? NaN;
+      const bearing = slots[Slot.BEARING] ?? NaN;
+      const accuracy = slots[Slot.ACCURACY] ?? NaN;
+      const locationTime = slots[Slot.LOCATION_TIME] ?? NaN;
+      const remainingMeters = slots[Slot.REMAINING_METERS] ?? NaN;
+      const remainingSeconds = slots[Slot.REMAINING_SECONDS] ?? NaN;
+      const delaySeverity = slots[Slot.DELAY_SEVERITY] ?? NaN;
+      if (header[0] !== before) {
+        continue;
+      }
+      out.sequence = before / 2;
+      out.lat = lat;
+      out.lng = lng;
+      out.speed = speed;
+      out.bearing = bearing;
+      out.accuracy = accuracy;
+      out.locationTime = locationTime;
+      out.remainingMeters = remainingMeters;
+      out.remainingSeconds = remainingSeconds;
+      out.delaySeverity = delaySeverity;
+      return true;
+    }
+    return false;
+  }
+
+  /** Removes the event subscriptions used when the state is not shared. */
+  release(): void {
+    this.subscriptions.forEach(subscription => subscription.remove());
+    this.subscriptions.length = 0;
+  }
+
+  private subscribeToEvents(): void {
+    this.subscriptions.push(
+      NavModule.onLocationChanged(({ location }) => {
+        this.write(slots => {
+          slots[Slot.LATITUDE] = location.lat;
+          slots[Slot.LONGITUDE] = location.lng;
+          slots[Slot.SPEED] = location.speed;
+          slots[Slot.BEARING] = location.bearing ?? NaN;
+          slots[Slot.ACCURACY] = location.accuracy ?? NaN;
+          slots[Slot.LOCATION_TIME] = location.time;
+        });
+      }),
+      NavModule.onRemainingTimeOrDistanceChanged(({ timeAndDistance }) => {
+        this.write(slots => {
+          slots[Slot.REMAINING_METERS] = timeAndDistance.meters;
+          slots[Slot.REMAINING_SECONDS] = timeAndDistance.seconds;
+          slots[Slot.DELAY_SEVERITY] = timeAndDistance.delaySeverity;
+        });
+      })
+    );
+  }
+
+  private write(update: (slots: Float64Array) => void): void {
+    // Reads and writes share the JS thread here, so the sequence only needs
+    // to advance to signal a change.
+    update(this.slots);
+    this.header[0] = (this.header[0] ?? 0) + 2;
+  }
+}
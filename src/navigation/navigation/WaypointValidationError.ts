@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { WaypointError } from '../types';
+
+/**
+ * Thrown by setDestinations when one or more waypoints fail validation.
+ * No routing request is issued in that case.
+ */
+export class WaypointValidationError extends Error {
+  /** Every invalid waypoint, in index order. */
+  readonly errors: WaypointError[];
+
+  constructor(message: string, errors: WaypointError[]) {
+    super(message);
+    this.name = 'WaypointValidationError';
+    this.errors = errors;
+  }
+}
+
+/**
+ * Converts a native INVALID_WAYPOINTS rejection into a WaypointValidationError.
+ * Returns null for any other error.
+ */
+export const toWaypointValidationError = (
+  error: unknown
+): WaypointValidationError | null => {
+  if (
+    !error ||
+    typeof error !== 'object' ||
+    (error as { code?: string }).code !== 'INVALID_WAYPOINTS'
+  ) {
+    return null;
+  }
+  const { message, userInfo } = error as {
+    message: string;
+    userInfo?: { errors?: WaypointError[] };
+  };
+  return new WaypointValidationError(message, userInfo?.errors ?? []);
+};
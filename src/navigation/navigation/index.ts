@@ -17,3 +17,7 @@
 export * from './useNavigationController';
 export * from './NavigationProvider';
 export * from './types';
+export { WaypointValidationError } from './WaypointValidationError';
+export * from './NavigationStateReader';
+export { applyRouteChange } from './routeChange';
+export { unpackManeuverPoints } from './maneuverPoints';
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { ManeuverPoint } from '../types';
+
+const VALUES_PER_POINT = 6;
+
+/**
+ * Unpacks the `maneuverPoints` of a turn-by-turn event, which are packed as
+ * [stepNumber, lat, lng, legIndex, firstVertex, lastVertex, ...].
+ *
+ * @param packed - The packed maneuver points.
+ * @returns One point per step, in the order of the event's steps.
+ */
+export const unpackManeuverPoints = (
+  packed: readonly number[]
+): ManeuverPoint[] => {
+  const points: ManeuverPoint[] = [];
+  for (
+    let i = 0;
+    i + VALUES_PER_POINT <= packed.length;
+    i += VALUES_PER_POINT
+  ) {
+    points.push({
+      stepNumber: packed[i] ?? 0,
+      position: { lat: packed[i + 1] ?? 0, lng: packed[i + 2] ?? 0 },
+      legIndex: packed[i + 3] ?? 0,
+      firstVertex: packed[i + 4] ?? 0,
+      lastVertex: packed[i + 5] ?? 0,
+    });
+  }
+  return points;
+};
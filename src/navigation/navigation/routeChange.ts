@@ -0,0 +1,56 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { LatLng } from '../../shared/types';
+import type { RouteChange } from '../types';
+
+/**
+ * Applies a route change to the leg vertices of the previous route, for
+ * example the `segmentLatLngList` of each segment from `getRouteSegments`.
+ * Unchanged legs are returned as is, so callers can skip redrawing them by
+ * identity.
+ *
+ * @param legs - Vertices of each leg of the previous route.
+ * @param routeChange - The change reported by `onRouteChanged`.
+ * @returns Vertices of each leg of the new route.
+ */
+export const applyRouteChange = (
+  legs: readonly LatLng[][],
+  routeChange: RouteChange
+): LatLng[][] => {
+  const result: LatLng[][] = routeChange.fullReplacement
+    ? []
+    : legs.slice(
+        routeChange.droppedLegCount,
+        routeChange.droppedLegCount + routeChange.legCount
+      );
+  for (const change of routeChange.legChanges) {
+    const replacement: LatLng[] = [];
+    for (let i = 0; i + 1 < change.latLngs.length; i += 2) {
+      replacement.push({
+        lat: change.latLngs[i] ?? 0,
+        lng: change.latLngs[i + 1] ?? 0,
+      });
+    }
+    const previous = result[change.legIndex] ?? [];
+    result[change.legIndex] = [
+      ...previous.slice(0, change.start),
+      ...replacement,
+      ...previous.slice(change.start + change.removedCount),
+    ];
+  }
+  return result;
+};
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import type { StopSchedule, TimeWindowStop } from '../types';
+
+/**
+ * Schedules of a suffix of a stop sequence, as returned by the native
+ * evaluator. Slack of open windows is sent as Number.MAX_VALUE.
+ */
+export interface PackedStopSchedules {
+  firstIndex: number;
+  stopCount: number;
+  arrivalTimes: number[];
+  waitSeconds: number[];
+  slackSeconds: number[];
+  routed: boolean[];
+}
+
+export const toTimeWindowStopSpec = (stop: TimeWindowStop) => ({
+  lat: stop.position.lat,
+  lng: stop.position.lng,
+  windowStart: stop.windowStart,
+  windowEnd: stop.windowEnd,
+  serviceSeconds: stop.serviceSeconds,
+});
+
+/**
+ * Replaces the schedules from `packed.firstIndex` on with the unpacked ones.
+ * The schedules before it are unchanged by the edit that produced `packed`.
+ *
+ * @param previous - The schedules before the edit.
+ * @param packed - The recomputed suffix.
+ * @returns The schedules of all stops after the edit.
+ */
+export const applyStopSchedules = (
+  previous: readonly StopSchedule[],
+  packed: PackedStopSchedules
+): StopSchedule[] => {
+  const schedules = previous.slice(0, packed.firstIndex);
+  for (let i = 0; i < packed.stopCount - packed.firstIndex; i++) {
+    const slack = packed.slackSeconds[i] ?? 0;
+    const slackSeconds = slack >= Number.MAX_VALUE ? Infinity : slack;
+    schedules.push({
+      arrivalTime: packed.arrivalTimes[i] ?? 0,
+      waitSeconds: packed.waitSeconds[i] ?? 0,
+      slackSeconds,
+      latenessSeconds: Math.max(0, -slackSeconds),
+      routed: packed.routed[i] ?? false,
+    });
+  }
+  return schedules;
+};
@@ -18,10 +18,16 @@ import type { LatLng, Location } from '../../shared/types';
 import type {
   AlternateRoutingStrategy,
   AudioGuidance,
+  ManeuverPoint,
+  RouteChange,
   RouteSegment,
   RouteStatus,
   RoutingStrategy,
+  StopSchedule,
   TimeAndDistance,
+  TimeWindowEdit,
+  TimeWindowOptions,
+  TimeWindowStop,
   TravelMode,
   Waypoint,
   TermsAndConditionsUIParams,
@@ -74,6 +80,26 @@ export interface SetDestinationsOptions {
    * Cannot be used with routingOptions.
    */
   routeTokenOptions?: RouteTokenOptions;
+
+  /**
+   * Debounce window in milliseconds. When set, the routing request is delayed by
+   * this amount and dropped if `setDestinations` is called again within the
+   * window, so that a burst of updates results in a single routing request.
+   * Defaults to 0 (request is issued immediately).
+   *
+   * Regardless of this option, a new `setDestinations` call always supersedes
+   * the one still in flight: the earlier promise resolves with
+   * `RouteStatus.ROUTE_CANCELED`.
+   */
+  debounceMs?: number;
+
+  /**
+   * Waypoint positions packed as `[lat0, lng0, lat1, lng1, ...]`, for large stop
+   * lists. Waypoint `i` without a `placeId` or `position` uses pair `i`; pairs
+   * beyond the end of the waypoints list are added as plain waypoints, so the
+   * waypoints list may be left empty.
+   */
+  packedPositions?: Float64Array | number[];
 }
 
 /**
@@ -236,8 +262,12 @@ export interface NavigationCallbacks {
 
   /**
    * Callback function invoked when the route is changed.
+   *
+   * @param routeChange - The new route as a patch of the route of the
+   * previous event, so that overlays and caches derived from
+   * `getRouteSegments` can be updated without re-fetching the whole route.
    */
-  onRouteChanged?(): void;
+  onRouteChanged?(routeChange: RouteChange): void;
 
   /**
    * Callback function invoked when rerouting is requested due to an
@@ -382,6 +412,25 @@ export interface NavigationController {
    */
   cleanup(): Promise<void>;
 
+  /**
+   * Suspends navigation without releasing the navigation session.
+   *
+   * Navigation listeners, guidance, location simulation and road-snapped location
+   * updates are silenced, while the session, destinations and attached views are
+   * kept alive. Use this instead of `cleanup()` between jobs to avoid paying the
+   * full initialization cost again; call `resumeNavigation()` to continue.
+   * Calling it while already suspended has no effect.
+   */
+  suspendNavigation(): Promise<void>;
+
+  /**
+   * Resumes navigation previously suspended with `suspendNavigation()`,
+   * restoring listeners, location updates, simulation and guidance to the state
+   * they were in when the session was suspended.
+   * Calling it while not suspended has no effect.
+   */
+  resumeNavigation(): Promise<void>;
+
   /**
    *
    * @returns the current route information.
@@ -414,6 +463,45 @@ export interface NavigationController {
    */
   getTraveledPath(): Promise<LatLng[]>;
 
+  /**
+   * Retrieves where the current and remaining steps end on the route, as of
+   * the latest turn-by-turn update. Steps keep their points until the route
+   * changes, so maneuver markers can be placed without processing the route.
+   *
+   * @returns A promise that resolves with one point per step, or an empty
+   * array before the first update of the current route.
+   */
+  getManeuverPoints(): Promise<ManeuverPoint[]>;
+
+  /**
+   * Checks whether each stop of a sequence is reached within its time window.
+   * Legs that the current route also takes use its cached travel times, and
+   * other legs are estimated from their great-circle distance, so a reorder
+   * can be checked before it is passed to `setDestinations`. The sequence is
+   * kept for `updateTimeWindowStop`. On a route change its legs follow the
+   * new route, and it restarts from the current location and time.
+   *
+   * @param stops - The stops, in the order they are visited.
+   * @param options - Where and when the sequence starts, and how other legs
+   * are estimated.
+   * @returns A promise that resolves with the schedule of each stop.
+   */
+  evaluateTimeWindows(
+    stops: TimeWindowStop[],
+    options?: TimeWindowOptions
+  ): Promise<StopSchedule[]>;
+
+  /**
+   * Applies a single-stop edit to the sequence of the last
+   * `evaluateTimeWindows` call. Only the stops from the first one the edit
+   * affects are scheduled again.
+   *
+   * @param edit - The edit.
+   * @returns A promise that resolves with the schedule of each stop after the
+   * edit.
+   */
+  updateTimeWindowStop(edit: TimeWindowEdit): Promise<StopSchedule[]>;
+
   /**
    * Asynchronously retrieves the version of the Navigation SDK.
    *
@@ -442,7 +530,10 @@ export interface NavigationController {
    *                    or stopover point with specific attributes.
    * @param options - Optional destination options including routing, display, or route token settings.
    *                  Note: routingOptions and routeTokenOptions are mutually exclusive.
-   * @returns A promise that resolves with the RouteStatus indicating the result of route calculation.
+   * @returns A promise that resolves with the RouteStatus indicating the result of route calculation,
+   *          or `RouteStatus.ROUTE_CANCELED` if a newer request superseded this one.
+   * @throws WaypointValidationError listing every invalid waypoint by index, in
+   *         which case no routing request is issued.
    */
   setDestinations(
     waypoints: Waypoint[],
@@ -540,5 +631,11 @@ export enum TaskRemovedBehavior {
 /**
  * Defines the turn-by-turn event data.
  */
-// eslint-disable-next-line @typescript-eslint/no-empty-object-type
-export interface TurnByTurnEvent {}
+export interface TurnByTurnEvent {
+  /**
+   * Where the current and remaining steps end on the route, packed as
+   * [stepNumber, lat, lng, legIndex, firstVertex, lastVertex, ...]. Unpack
+   * with `unpackManeuverPoints`. Absent until a route is known.
+   */
+  maneuverPoints?: number[];
+}
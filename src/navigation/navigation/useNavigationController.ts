@@ -25,9 +25,15 @@ import {
 import type {
   Waypoint,
   AudioGuidance,
+  ManeuverPoint,
+  RouteChange,
   RouteSegment,
   TimeAndDistance,
   RouteStatus,
+  StopSchedule,
+  TimeWindowEdit,
+  TimeWindowOptions,
+  TimeWindowStop,
 } from '../types';
 import { NavigationSessionStatus } from '../types';
 import {
@@ -40,6 +46,9 @@ import {
   type LocationSimulationOptions,
   type ArrivalEvent,
 } from './types';
+import { toWaypointValidationError } from './WaypointValidationError';
+import { unpackManeuverPoints } from './maneuverPoints';
+import { applyStopSchedules, toTimeWindowStopSpec } from './timeWindows';
 
 const { NavModule } = NativeModules;
 
@@ -58,7 +67,9 @@ export type NavigationListenerSetters = {
     callback: ((location: Location) => void) | null | undefined
   ) => void;
   setOnNavigationReady: (callback: (() => void) | null | undefined) => void;
-  setOnRouteChanged: (callback: (() => void) | null | undefined) => void;
+  setOnRouteChanged: (
+    callback: ((routeChange: RouteChange) => void) | null | undefined
+  ) => void;
   setOnReroutingRequestedByOffRoute: (
     callback: (() => void) | null | undefined
   ) => void;
@@ -141,7 +152,9 @@ export const useNavigationController = (
     null
   );
   const onNavigationReadyRef = useRef<(() => void) | null>(null);
-  const onRouteChangedRef = useRef<(() => void) | null>(null);
+  const onRouteChangedRef = useRef<
+    ((routeChange: RouteChange) => void) | null
+  >(null);
   const onReroutingRequestedByOffRouteRef = useRef<(() => void) | null>(null);
   const onTrafficUpdatedRef = useRef<(() => void) | null>(null);
   const onRemainingTimeOrDistanceChangedRef = useRef<
@@ -151,6 +164,8 @@ export const useNavigationController = (
     ((turnByTurnEvents: TurnByTurnEvent[]) => void) | null
   >(null);
   const logDebugInfoRef = useRef<((message: string) => void) | null>(null);
+  // Schedules of the last evaluated stop sequence, updated by native edits.
+  const stopSchedulesRef = useRef<StopSchedule[]>([]);
 
   // Subscribe to events at the top level, routing to refs
   useEventSubscription('NavModule', 'onStartGuidance', () => {
@@ -173,9 +188,13 @@ export const useNavigationController = (
     }
   );
 
-  useEventSubscription('NavModule', 'onRouteChanged', () => {
-    onRouteChangedRef.current?.();
-  });
+  useEventSubscription<{ routeChange: RouteChange }>(
+    'NavModule',
+    'onRouteChanged',
+    payload => {
+      onRouteChangedRef.current?.(payload.routeChange);
+    }
+  );
 
   useEventSubscription('NavModule', 'onReroutingRequestedByOffRoute', () => {
     onReroutingRequestedByOffRouteRef.current?.();
@@ -254,7 +273,7 @@ export const useNavigationController = (
   );
 
   const setOnRouteChanged = useCallback(
-    (callback: (() => void) | null | undefined) => {
+    (callback: ((routeChange: RouteChange) => void) | null | undefined) => {
       onRouteChangedRef.current = callback ?? null;
     },
     []
@@ -320,21 +339,37 @@ export const useNavigationController = (
     waypoints: Waypoint[],
     options?: SetDestinationsOptions
   ) => {
-    const { routingOptions, displayOptions, routeTokenOptions } = options ?? {};
+    const {
+      routingOptions,
+      displayOptions,
+      routeTokenOptions,
+      debounceMs,
+      packedPositions,
+    } = options ?? {};
     if (routingOptions && routeTokenOptions) {
       throw new Error(
         'Only one of routingOptions or routeTokenOptions can be provided, not both.'
       );
     }
     // Always send objects with defaults (never null) to ensure safe copying on native side
-    const result = await NavModule.setDestinations(
+    const waypointBatch = {
       waypoints,
-      routingOptions ? { ...routingOptions, valid: true } : { valid: false },
-      displayOptions ? { ...displayOptions, valid: true } : { valid: false },
-      routeTokenOptions
-        ? { ...routeTokenOptions, valid: true }
-        : { valid: false, routeToken: '' }
-    );
+      packedPositions: packedPositions ? Array.from(packedPositions) : [],
+    };
+    let result;
+    try {
+      result = await NavModule.setDestinations(
+        waypointBatch,
+        routingOptions ? { ...routingOptions, valid: true } : { valid: false },
+        displayOptions ? { ...displayOptions, valid: true } : { valid: false },
+        routeTokenOptions
+          ? { ...routeTokenOptions, valid: true }
+          : { valid: false, routeToken: '' },
+        debounceMs ?? 0
+      );
+    } catch (error) {
+      throw toWaypointValidationError(error) ?? error;
+    }
     // Native module returns a string that matches RouteStatus enum values
     return result as RouteStatus;
   };
@@ -430,6 +465,14 @@ export const useNavigationController = (
         await NavModule.cleanup();
       },
 
+      suspendNavigation: async () => {
+        await NavModule.suspendNavigation();
+      },
+
+      resumeNavigation: async () => {
+        await NavModule.resumeNavigation();
+      },
+
       setDestination: async (
         waypoint: Waypoint,
         options?: SetDestinationsOptions
@@ -507,6 +550,37 @@ export const useNavigationController = (
         return await NavModule.getTraveledPath();
       },
 
+      getManeuverPoints: async (): Promise<ManeuverPoint[]> => {
+        return unpackManeuverPoints(await NavModule.getManeuverPoints());
+      },
+
+      evaluateTimeWindows: async (
+        stops: TimeWindowStop[],
+        options?: TimeWindowOptions
+      ): Promise<StopSchedule[]> => {
+        const packed = await NavModule.evaluateTimeWindows({
+          ...options,
+          stops: stops.map(toTimeWindowStopSpec),
+        });
+        stopSchedulesRef.current = applyStopSchedules([], packed);
+        return stopSchedulesRef.current;
+      },
+
+      updateTimeWindowStop: async (
+        edit: TimeWindowEdit
+      ): Promise<StopSchedule[]> => {
+        const packed = await NavModule.updateTimeWindowStop(
+          'stop' in edit
+            ? { ...edit, stop: toTimeWindowStopSpec(edit.stop) }
+            : edit
+        );
+        stopSchedulesRef.current = applyStopSchedules(
+          stopSchedulesRef.current,
+          packed
+        );
+        return stopSchedulesRef.current;
+      },
+
       getNavSDKVersion: async (): Promise<string> => {
         return await NavModule.getNavSDKVersion();
       },
@@ -276,7 +276,9 @@ export const NavigationView = (
       onMarkerInfoWindowTapped={onMarkerInfoWindowTapped}
       onRecenterButtonClick={onRecenterButtonClick}
       onPromptVisibilityChanged={onPromptVisibilityChanged}
-    />
+    >
+      {props.children}
+    </NavView>
   );
 };
 
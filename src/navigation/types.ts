@@ -302,6 +302,131 @@ export interface RouteSegment {
   segmentLatLngList: LatLng[];
 }
 
+/**
+ * The vertices of one route leg that changed on a reroute. Vertices
+ * `[start, start + removedCount)` of the previous leg are replaced with
+ * `latLngs`; everything before and after them is unchanged.
+ */
+export interface RouteLegChange {
+  /** Index of the leg in the new route. */
+  legIndex: number;
+  /** Index of the first changed vertex. */
+  start: number;
+  /** Number of vertices of the previous leg that were replaced. */
+  removedCount: number;
+  /** Packed `[lat, lng, ...]` replacement vertices. */
+  latLngs: number[];
+}
+
+/**
+ * Describes a new route as a patch of the route of the previous
+ * `onRouteChanged` event. Vertices are compared at 1e-6 degree precision.
+ */
+export interface RouteChange {
+  /**
+   * True when there is no previous route to patch, e.g. for the first route
+   * or when legs were added. Every leg is then listed with `start` and
+   * `removedCount` set to 0.
+   */
+  fullReplacement: boolean;
+  /** Number of legs removed from the start of the previous route. */
+  droppedLegCount: number;
+  /** Number of legs in the new route. */
+  legCount: number;
+  /** The legs that changed; legs that are not listed are unchanged. */
+  legChanges: RouteLegChange[];
+}
+
+/**
+ * Where a step of the current route ends, as located on the route geometry
+ * by the native index of `getManeuverPoints`.
+ */
+export interface ManeuverPoint {
+  /** The `stepNumber` of the step. */
+  stepNumber: number;
+  /** Position of the step's maneuver on the route. */
+  position: LatLng;
+  /** Index of the leg, in `getRouteSegments`, that holds the maneuver. */
+  legIndex: number;
+  /** Index in the leg of the vertex at or before the start of the step. */
+  firstVertex: number;
+  /** Index in the leg of the vertex at or after the maneuver. */
+  lastVertex: number;
+}
+
+/**
+ * A stop of a sequence checked by `evaluateTimeWindows`. Times are in
+ * milliseconds since the epoch; an omitted window end is open.
+ */
+export interface TimeWindowStop {
+  position: LatLng;
+  /** Earliest time service may start. Earlier arrivals wait. */
+  windowStart?: number;
+  /** Latest time service may start. */
+  windowEnd?: number;
+  /** Time spent at the stop before leaving for the next one. */
+  serviceSeconds?: number;
+}
+
+/**
+ * Options of `evaluateTimeWindows`.
+ */
+export interface TimeWindowOptions {
+  /** Start of the sequence. Defaults to the current road-snapped location. */
+  origin?: LatLng;
+  /** Departure from the origin, in milliseconds since the epoch. Defaults to now. */
+  departureTime?: number;
+  /**
+   * Speed of legs that are not on the current route, which are estimated
+   * from the great-circle distance. Defaults to 11 m/s.
+   */
+  speedMetersPerSecond?: number;
+  /** Ratio of road to great-circle distance of estimated legs. Defaults to 1.3. */
+  detourFactor?: number;
+}
+
+/**
+ * The kinds of single-stop edits of `updateTimeWindowStop`.
+ */
+export enum TimeWindowEditType {
+  REPLACE = 0,
+  INSERT,
+  REMOVE,
+  MOVE,
+}
+
+/**
+ * A single-stop edit of the last sequence checked by `evaluateTimeWindows`.
+ */
+export type TimeWindowEdit =
+  | { type: TimeWindowEditType.REPLACE; index: number; stop: TimeWindowStop }
+  | { type: TimeWindowEditType.INSERT; index: number; stop: TimeWindowStop }
+  | { type: TimeWindowEditType.REMOVE; index: number }
+  | { type: TimeWindowEditType.MOVE; index: number; toIndex: number };
+
+/**
+ * When a stop of a sequence is reached and how much room its time window
+ * leaves.
+ */
+export interface StopSchedule {
+  /** Arrival at the stop, in milliseconds since the epoch. */
+  arrivalTime: number;
+  /** Time waiting for the window to open. */
+  waitSeconds: number;
+  /**
+   * Time between the start of service and the end of the window. Negative
+   * when late, and `Infinity` for open windows.
+   */
+  slackSeconds: number;
+  /** How late service starts, or 0 if it starts within the window. */
+  latenessSeconds: number;
+  /**
+   * Whether the travel time to the stop came from the current route rather
+   * than an estimate.
+   */
+  routed: boolean;
+}
+
 /**
  * Used to specify navigation destinations. It may be constructed from
  * a latitude/longitude pair, or a Google Place ID.
@@ -325,6 +450,36 @@ export interface Waypoint {
   preferredHeading?: number;
 }
 
+/**
+ * Reason a waypoint was rejected before routing.
+ */
+export enum WaypointErrorCode {
+  /** The waypoint has neither a place ID nor a position. */
+  MISSING_LOCATION = 'MISSING_LOCATION',
+  /** The latitude or longitude is out of range. */
+  INVALID_POSITION = 'INVALID_POSITION',
+  /** The place ID is not supported. */
+  INVALID_PLACE_ID = 'INVALID_PLACE_ID',
+  /** The preferred heading is outside [0, 360]. */
+  INVALID_HEADING = 'INVALID_HEADING',
+  /** The place ID or position repeats the previous waypoint. */
+  DUPLICATE_WAYPOINT = 'DUPLICATE_WAYPOINT',
+  /** The packed positions array has an odd number of values. */
+  INVALID_PACKED_POSITIONS = 'INVALID_PACKED_POSITIONS',
+}
+
+/**
+ * Describes a single invalid waypoint passed to setDestinations.
+ */
+export interface WaypointError {
+  /** Index of the waypoint in the list (or packed position pair). */
+  index: number;
+  /** Reason the waypoint was rejected. */
+  code: WaypointErrorCode;
+  /** Human readable description of the problem. */
+  message: string;
+}
+
 /**
  * Represents both time and distance to a destination.
  */